@@ -20,6 +20,7 @@ mkdir -p build/superio/common
 mkdir -p build/superio/nuvoton/nct5104d
 mkdir -p $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libamd
 mkdir -p $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/liblzma
+mkdir -p $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/liblz4
 mkdir -p $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libcbfs
 mkdir -p $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form
 mkdir -p $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu
@@ -212,7 +213,7 @@ cat out/src/fw/q35-acpi-dsdt.off > out/src/fw/q35-acpi-dsdt.hex
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Wno-unused-but-set-variable  -Iout/ -Isrc -Os -MD -g -Wall -Wno-strict-aliasing -Wold-style-definition -Wtype-limits -m32 -march=i386 -mregparm=3 -mpreferred-stack-boundary=2 -minline-all-stringops -freg-struct-return -ffreestanding -fno-delete-null-pointer-checks -ffunction-sections -fdata-sections -fno-common  -fno-stack-protector  -DMODE16=0 -DMODESEGMENT=0 -fomit-frame-pointer -c src/fw/pirtable.c -o out/src/fw/pirtable.o
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Wno-unused-but-set-variable  -Iout/ -Isrc -Os -MD -g -Wall -Wno-strict-aliasing -Wold-style-definition -Wtype-limits -m32 -march=i386 -mregparm=3 -mpreferred-stack-boundary=2 -minline-all-stringops -freg-struct-return -ffreestanding -fno-delete-null-pointer-checks -ffunction-sections -fdata-sections -fno-common  -fno-stack-protector  -DMODE16=0 -DMODESEGMENT=0 -fomit-frame-pointer -c src/fw/smbios.c -o out/src/fw/smbios.o
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Wno-unused-but-set-variable  -Iout/ -Isrc -Os -MD -g -Wall -Wno-strict-aliasing -Wold-style-definition -Wtype-limits -m32 -march=i386 -mregparm=3 -mpreferred-stack-boundary=2 -minline-all-stringops -freg-struct-return -ffreestanding -fno-delete-null-pointer-checks -ffunction-sections -fdata-sections -fno-common  -fno-stack-protector  -DMODE16=0 -DMODESEGMENT=0 -fomit-frame-pointer -c src/fw/romfile_loader.c -o out/src/fw/romfile_loader.o
-printf '#include "misc.c"\n #include "stacks.c"\n #include "output.c"\n #include "string.c"\n #include "x86.c"\n #include "block.c"\n #include "cdrom.c"\n #include "mouse.c"\n #include "kbd.c"\n #include "serial.c"\n #include "clock.c"\n #include "resume.c"\n #include "pnpbios.c"\n #include "vgahooks.c"\n #include "pcibios.c"\n #include "apm.c"\n #include "fw/smp.c"\n #include "hw/pci.c"\n #include "hw/timer.c"\n #include "hw/rtc.c"\n #include "hw/dma.c"\n #include "hw/pic.c"\n #include "hw/ps2port.c"\n #include "hw/serialio.c"\n #include "hw/usb.c"\n #include "hw/usb-uhci.c"\n #include "hw/usb-ohci.c"\n #include "hw/usb-ehci.c"\n #include "hw/usb-hid.c"\n #include "hw/usb-msc.c"\n #include "hw/usb-uas.c"\n #include "hw/blockcmd.c"\n #include "hw/floppy.c"\n #include "hw/ata.c"\n #include "hw/ramdisk.c"\n #include "hw/virtio-ring.c"\n #include "hw/virtio-pci.c"\n #include "hw/virtio-blk.c"\n #include "hw/virtio-scsi.c"\n #include "hw/lsi-scsi.c"\n #include "hw/esp-scsi.c"\n #include "hw/megasas.c"\n #include "hw/sdhc_generic.c"\n #include "hw/sd.c"\n #include "hw/sd_if.c"\n #include "hw/sd_utils.c"\n #include "post.c"\n #include "memmap.c"\n #include "malloc.c"\n #include "pmm.c"\n #include "romfile.c"\n #include "optionroms.c"\n #include "boot.c"\n #include "bootsplash.c"\n #include "jpeg.c"\n #include "bmp.c"\n #include "hw/ahci.c"\n #include "hw/pvscsi.c"\n #include "hw/usb-xhci.c"\n #include "hw/usb-hub.c"\n #include "fw/coreboot.c"\n #include "fw/lzmadecode.c"\n #include "fw/csm.c"\n #include "fw/biostables.c"\n #include "fw/paravirt.c"\n #include "fw/shadow.c"\n #include "fw/pciinit.c"\n #include "fw/smm.c"\n #include "fw/mtrr.c"\n #include "fw/xen.c"\n #include "fw/acpi.c"\n #include "fw/mptable.c"\n #include "fw/pirtable.c"\n #include "fw/smbios.c"\n #include "fw/romfile_loader.c"\n' > out/ccode32flat.o.tmp.c
+printf '#include "misc.c"\n #include "stacks.c"\n #include "output.c"\n #include "string.c"\n #include "x86.c"\n #include "block.c"\n #include "cdrom.c"\n #include "mouse.c"\n #include "kbd.c"\n #include "serial.c"\n #include "clock.c"\n #include "resume.c"\n #include "pnpbios.c"\n #include "vgahooks.c"\n #include "pcibios.c"\n #include "apm.c"\n #include "fw/smp.c"\n #include "hw/pci.c"\n #include "hw/timer.c"\n #include "hw/rtc.c"\n #include "hw/dma.c"\n #include "hw/pic.c"\n #include "hw/ps2port.c"\n #include "hw/serialio.c"\n #include "hw/usb.c"\n #include "hw/usb-uhci.c"\n #include "hw/usb-ohci.c"\n #include "hw/usb-ehci.c"\n #include "hw/usb-hid.c"\n #include "hw/usb-msc.c"\n #include "hw/usb-uas.c"\n #include "hw/blockcmd.c"\n #include "hw/floppy.c"\n #include "hw/ata.c"\n #include "hw/ramdisk.c"\n #include "hw/virtio-ring.c"\n #include "hw/virtio-pci.c"\n #include "hw/virtio-blk.c"\n #include "hw/virtio-scsi.c"\n #include "hw/lsi-scsi.c"\n #include "hw/esp-scsi.c"\n #include "hw/megasas.c"\n #include "hw/sdhc_generic.c"\n #include "hw/sd.c"\n #include "hw/sd_if.c"\n #include "hw/sd_utils.c"\n #include "post.c"\n #include "memmap.c"\n #include "malloc.c"\n #include "pmm.c"\n #include "romfile.c"\n #include "optionroms.c"\n #include "boot.c"\n #include "bootsplash.c"\n #include "jpeg.c"\n #include "bmp.c"\n #include "hw/ahci.c"\n #include "hw/pvscsi.c"\n #include "hw/usb-xhci.c"\n #include "hw/usb-hub.c"\n #include "fw/coreboot.c"\n #include "fw/lzmadecode.c"\n #include "fw/lz4dec.c"\n #include "fw/csm.c"\n #include "fw/biostables.c"\n #include "fw/paravirt.c"\n #include "fw/shadow.c"\n #include "fw/pciinit.c"\n #include "fw/smm.c"\n #include "fw/mtrr.c"\n #include "fw/xen.c"\n #include "fw/acpi.c"\n #include "fw/mptable.c"\n #include "fw/pirtable.c"\n #include "fw/smbios.c"\n #include "fw/romfile_loader.c"\n' > out/ccode32flat.o.tmp.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Wno-unused-but-set-variable   -Iout/ -Isrc -Os -MD -g -Wall -Wno-strict-aliasing -Wold-style-definition -Wtype-limits -m32 -march=i386 -mregparm=3 -mpreferred-stack-boundary=2 -minline-all-stringops -freg-struct-return -ffreestanding -fno-delete-null-pointer-checks -ffunction-sections -fdata-sections -fno-common  -fno-stack-protector  -DMODE16=0 -DMODESEGMENT=0 -fomit-frame-pointer -fwhole-program -DWHOLE_PROGRAM -c out/ccode32flat.o.tmp.c -o out/ccode32flat.o
 printf '#include "string.c"\n #include "output.c"\n #include "pcibios.c"\n #include "apm.c"\n #include "stacks.c"\n #include "hw/pci.c"\n #include "hw/serialio.c"\n' > out/code32seg.o.tmp.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Wno-unused-but-set-variable   -Iout/ -Isrc -Os -MD -g -Wall -Wno-strict-aliasing -Wold-style-definition -Wtype-limits -m32 -march=i386 -mregparm=3 -mpreferred-stack-boundary=2 -minline-all-stringops -freg-struct-return -ffreestanding -fno-delete-null-pointer-checks -ffunction-sections -fdata-sections -fno-common  -fno-stack-protector  -DMODESEGMENT=1 -fno-defer-pop -fno-jump-tables -fno-tree-switch-conversion -DMODE16=0 -fomit-frame-pointer -fwhole-program -DWHOLE_PROGRAM -c out/code32seg.o.tmp.c -o out/code32seg.o
@@ -276,6 +277,7 @@ mkdir -p build/mainboard/pcengines/apu
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/console/printk.romstage.o src/console/printk.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/console/vtxprintf.romstage.o src/console/vtxprintf.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/cpu/amd/agesa/s3_resume.romstage.o src/cpu/amd/agesa/s3_resume.c
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/cpu/amd/agesa/mem_restore.romstage.o src/cpu/amd/agesa/mem_restore.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/cpu/x86/car.romstage.o src/cpu/x86/car.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/cpu/x86/lapic/apic_timer.romstage.o src/cpu/x86/lapic/apic_timer.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/cpu/x86/lapic/boot_cpu.romstage.o src/cpu/x86/lapic/boot_cpu.c
@@ -288,7 +290,9 @@ mkdir -p build/mainboard/pcengines/apu
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/drivers/uart/util.romstage.o src/drivers/uart/util.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/bootmode.romstage.o src/lib/bootmode.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/cbfs.romstage.o src/lib/cbfs.c
-"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/cbmem.romstage.o src/lib/cbmem.c
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/dynamic_cbmem.romstage.o src/lib/dynamic_cbmem.c
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/cbmem_dir.romstage.o src/lib/cbmem_dir.c
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/timestamp.romstage.o src/lib/timestamp.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/clog2.romstage.o src/lib/clog2.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/compute_ip_checksum.romstage.o src/lib/compute_ip_checksum.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/gcc.romstage.o src/lib/gcc.c
@@ -296,8 +300,10 @@ mkdir -p build/mainboard/pcengines/apu
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/loaders/cbfs_ramstage_loader.romstage.o src/lib/loaders/cbfs_ramstage_loader.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/loaders/load_and_run_ramstage.romstage.o src/lib/loaders/load_and_run_ramstage.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/lzma.romstage.o src/lib/lzma.c
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/lz4.romstage.o src/lib/lz4.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/memchr.romstage.o src/lib/memchr.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/memcmp.romstage.o src/lib/memcmp.c
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/ramstage_cache.romstage.o src/lib/ramstage_cache.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/ramtest.romstage.o src/lib/ramtest.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/mainboard/pcengines/apu/BiosCallOuts.romstage.o src/mainboard/pcengines/apu/BiosCallOuts.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -D__PRE_RAM__ -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/mainboard/pcengines/apu/PlatformGnbPcie.romstage.o src/mainboard/pcengines/apu/PlatformGnbPcie.c
@@ -612,7 +618,7 @@ mv build/coreboot.pre1.tmp build/coreboot.pre1
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -c -o build/vendorcode/amd/agesa/f14/Proc/Mem/Tech/mttsrc.libagesa.o src/vendorcode/amd/agesa/f14/Proc/Mem/Tech/mttsrc.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -c -o build/vendorcode/amd/agesa/f14/Proc/Recovery/HT/htInitReset.libagesa.o src/vendorcode/amd/agesa/f14/Proc/Recovery/HT/htInitReset.c
 ar rcs build/libagesa.fam14.a build/vendorcode/amd/agesa/f14/Legacy/Proc/Dispatcher.libagesa.o build/vendorcode/amd/agesa/f14/Legacy/Proc/agesaCallouts.libagesa.o build/vendorcode/amd/agesa/f14/Legacy/Proc/hobTransfer.libagesa.o build/vendorcode/amd/agesa/f14/Lib/amdlib.libagesa.o build/vendorcode/amd/agesa/f14/Lib/helper.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/F14C6State.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/F14IoCstate.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/F14MicrocodePatch0500000B.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/F14MicrocodePatch0500001A.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/F14MicrocodePatch05000028.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/F14MicrocodePatch05000101.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON/F14OnCpb.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON/F14OnEquivalenceTable.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON/F14OnInitEarlyTable.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON/F14OnLogicalIdTables.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON/F14OnMicrocodePatchTables.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON/F14OnPciTables.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/cpuCommonF14Utilities.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/cpuF14BrandId.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/cpuF14BrandIdFt1.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/cpuF14CacheDefaults.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/cpuF14Dmi.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/cpuF14LowPowerInit.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/cpuF14MsrTables.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/cpuF14PciTables.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/cpuF14PerCorePciTables.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/cpuF14PowerCheck.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/cpuF14PowerMgmtSystemTables.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/cpuF14PowerPlane.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/cpuF14Pstate.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/cpuF14SoftwareThermal.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/cpuF14Utilities.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/cpuF14WheaInitDataTables.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Feature/cpuC6State.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Feature/cpuCacheFlushOnHalt.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Feature/cpuCacheInit.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Feature/cpuCpb.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Feature/cpuDmi.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Feature/cpuFeatureLeveling.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Feature/cpuFeatures.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Feature/cpuHwC1e.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Feature/cpuIoCstate.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Feature/cpuPstateGather.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Feature/cpuPstateLeveling.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Feature/cpuPstateTables.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Feature/cpuSlit.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Feature/cpuSrat.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Feature/cpuWhea.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/S3.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/Table.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/cahalt.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/cahaltasm.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/cpuApicUtilities.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/cpuBist.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/cpuBrandId.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/cpuEarlyInit.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/cpuEventLog.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/cpuFamilyTranslation.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/cpuGeneralServices.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/cpuInitEarlyTable.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/cpuLateInit.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/cpuMicrocodePatch.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/cpuPostInit.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/cpuPowerMgmt.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/cpuPowerMgmtMultiSocket.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/cpuPowerMgmtSingleSocket.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/cpuWarmReset.libagesa.o build/vendorcode/amd/agesa/f14/Proc/CPU/heapManager.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Common/AmdInitEarly.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Common/AmdInitEnv.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Common/AmdInitLate.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Common/AmdInitMid.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Common/AmdInitPost.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Common/AmdInitReset.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Common/AmdInitResume.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Common/AmdLateRunApTask.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Common/AmdS3LateRestore.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Common/AmdS3Save.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Common/CommonInits.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Common/CommonReturns.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Common/CreateStruct.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Common/S3RestoreState.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Common/S3SaveState.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Common/GnbLibFeatures.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family/0x14/F14GfxServices.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/GfxConfigData.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/GfxGmcInit.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/GfxInitAtEnvPost.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/GfxInitAtMidPost.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/GfxInitAtPost.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/GfxIntegratedInfoTableInit.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/GfxLib.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/GfxRegisterAcc.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/GfxStrapsInit.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/GnbInitAtEarly.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/GnbInitAtEnv.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/GnbInitAtLate.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/GnbInitAtMid.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/GnbInitAtPost.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/GnbInitAtReset.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib/GnbLib.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib/GnbLibCpuAcc.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib/GnbLibHeap.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib/GnbLibIoAcc.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib/GnbLibMemAcc.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib/GnbLibPci.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib/GnbLibPciAcc.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbGfxConfig/GfxConfigEnv.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbGfxConfig/GfxConfigPost.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbGfxInitLibV1/GfxCardInfo.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbGfxInitLibV1/GfxEnumConnectors.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbGfxInitLibV1/GfxPowerPlayTable.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbNbInitLibV1/GnbNbInitLibV1.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbPcieAlibV1/PcieAlib.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbPcieConfig/PcieConfigData.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbPcieConfig/PcieConfigLib.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbPcieConfig/PcieInputParser.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbPcieConfig/PcieMapTopology.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbPcieInitLibV1/PcieAspm.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbPcieInitLibV1/PcieAspmBlackList.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbPcieInitLibV1/PcieAspmExitLatency.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbPcieInitLibV1/PciePifServices.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbPcieInitLibV1/PciePortRegAcc.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbPcieInitLibV1/PciePortServices.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbPcieInitLibV1/PciePowerMgmt.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbPcieInitLibV1/PcieSbLink.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbPcieInitLibV1/PcieSiliconServices.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbPcieInitLibV1/PcieTimer.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbPcieInitLibV1/PcieTopologyServices.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbPcieInitLibV1/PcieUtilityLib.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbPcieInitLibV1/PcieWrapperRegAcc.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbPcieTrainingV1/PcieTraining.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbPcieTrainingV1/PcieWorkarounds.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14/F14NbLclkDpm.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14/F14NbLclkNclkRatio.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14/F14NbPowerGate.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14/F14NbServices.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14/F14NbSmu.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature/NbFuseTable.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature/NbLclkDpm.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Nb/NbConfigData.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Nb/NbInit.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Nb/NbInitAtEarly.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Nb/NbInitAtEnv.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Nb/NbInitAtLatePost.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Nb/NbInitAtPost.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Nb/NbInitAtReset.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Nb/NbPowerMgmt.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/Nb/NbSmuLib.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14/F14PcieAlib.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14/F14PcieComplexConfig.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14/F14PcieComplexServices.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14/F14PciePhyServices.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14/F14PciePifServices.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14/F14PcieWrapperServices.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/PcieInit.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/PcieInitAtEarlyPost.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/PcieInitAtEnv.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/PcieInitAtLatePost.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/PcieInitAtPost.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/PcieLateInit.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/PcieMiscLib.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/PciePortInit.libagesa.o build/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/PciePortLateInit.libagesa.o build/vendorcode/amd/agesa/f14/Proc/HT/Fam14/htNbFam14.libagesa.o build/vendorcode/amd/agesa/f14/Proc/HT/Fam14/htNbUtilitiesFam14.libagesa.o build/vendorcode/amd/agesa/f14/Proc/HT/htFeat.libagesa.o build/vendorcode/amd/agesa/f14/Proc/HT/htInterface.libagesa.o build/vendorcode/amd/agesa/f14/Proc/HT/htInterfaceCoherent.libagesa.o build/vendorcode/amd/agesa/f14/Proc/HT/htInterfaceGeneral.libagesa.o build/vendorcode/amd/agesa/f14/Proc/HT/htInterfaceNonCoherent.libagesa.o build/vendorcode/amd/agesa/f14/Proc/HT/htMain.libagesa.o build/vendorcode/amd/agesa/f14/Proc/HT/htNb.libagesa.o build/vendorcode/amd/agesa/f14/Proc/HT/htNotify.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Ardk/ON/mason3.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Ardk/ON/mauon3.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Ardk/ma.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Feat/CHINTLV/mfchi.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Feat/CSINTLV/mfcsi.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Feat/DMI/mfDMI.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Feat/ECC/mfecc.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Feat/ECC/mfemp.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Feat/EXCLUDIMM/mfdimmexclud.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Feat/IDENDIMM/mfidendimm.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Feat/INTLVRN/mfintlvrn.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Feat/LVDDR3/mflvddr3.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Feat/MEMCLR/mfmemclr.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Feat/ODTHERMAL/mfodthermal.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Feat/PARTRN/mfParallelTraining.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Feat/PARTRN/mfStandardTraining.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Feat/S3/mfs3.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Feat/TABLE/mftds.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Main/ON/mmflowon.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Main/mdef.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Main/merrhdl.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Main/minit.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Main/mm.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Main/mmConditionalPso.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Main/mmEcc.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Main/mmExcludeDimm.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Main/mmLvDdr3.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Main/mmMemClr.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Main/mmMemRestore.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Main/mmNodeInterleave.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Main/mmOnlineSpare.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Main/mmParallelTraining.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Main/mmStandardTraining.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Main/mmUmaAlloc.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Main/mmflow.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Main/mu.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Main/muc.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON/mnS3on.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON/mndcton.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON/mnflowon.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON/mnidendimmon.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON/mnmcton.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON/mnon.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON/mnoton.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON/mnphyon.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON/mnprotoon.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON/mnregon.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/NB/mn.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/NB/mnS3.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/NB/mndct.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/NB/mnfeat.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/NB/mnflow.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/NB/mnmct.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/NB/mnphy.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/NB/mnreg.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/NB/mntrain3.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Ps/ON/mpson3.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Ps/ON/mpuon3.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Ps/mp.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Tech/DDR3/mt3.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Tech/DDR3/mtot3.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Tech/DDR3/mtrci3.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Tech/DDR3/mtsdi3.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Tech/DDR3/mtspd3.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Tech/DDR3/mttecc3.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Tech/DDR3/mttwl3.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Tech/mt.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Tech/mthdi.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Tech/mttEdgeDetect.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Tech/mttdimbt.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Tech/mttecc.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Tech/mtthrc.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Tech/mttml.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Tech/mttoptsrc.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Mem/Tech/mttsrc.libagesa.o build/vendorcode/amd/agesa/f14/Proc/Recovery/HT/htInitReset.libagesa.o
-"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -nostdlib -nostartfiles -static -o build/cbfs/fallback/romstage_null.debug -Lbuild -T build/generated/romstage_null.ld -Wl,--wrap,__divdi3 -Wl,--wrap,__udivdi3 -Wl,--wrap,__moddi3 -Wl,--wrap,__umoddi3 -Wl,--start-group build/generated/crt0.romstage.o build/mainboard/pcengines/apu/static.romstage.o build/arch/x86/boot/cbmem.romstage.o build/arch/x86/lib/cbfs_and_run.romstage.o build/arch/x86/lib/memcpy.romstage.o build/arch/x86/lib/memmove.romstage.o build/arch/x86/lib/memset.romstage.o build/arch/x86/lib/rom_media.romstage.o build/console/console.romstage.o build/console/die.romstage.o build/console/init.romstage.o build/console/post.romstage.o build/console/printk.romstage.o build/console/vtxprintf.romstage.o build/cpu/amd/agesa/s3_resume.romstage.o build/cpu/x86/car.romstage.o build/cpu/x86/lapic/apic_timer.romstage.o build/cpu/x86/lapic/boot_cpu.romstage.o build/device/device_romstage.romstage.o build/device/dram/ddr3.romstage.o build/device/pci_early.romstage.o build/drivers/pc80/mc146818rtc.romstage.o build/drivers/pc80/mc146818rtc_early.romstage.o build/drivers/uart/uart8250io.romstage.o build/drivers/uart/util.romstage.o build/lib/bootmode.romstage.o build/lib/cbfs.romstage.o build/lib/cbmem.romstage.o build/lib/clog2.romstage.o build/lib/compute_ip_checksum.romstage.o build/lib/gcc.romstage.o build/lib/hexdump.romstage.o build/lib/loaders/cbfs_ramstage_loader.romstage.o build/lib/loaders/load_and_run_ramstage.romstage.o build/lib/lzma.romstage.o build/lib/memchr.romstage.o build/lib/memcmp.romstage.o build/lib/ramtest.romstage.o build/mainboard/pcengines/apu/BiosCallOuts.romstage.o build/mainboard/pcengines/apu/PlatformGnbPcie.romstage.o build/mainboard/pcengines/apu/agesawrapper.romstage.o build/mainboard/pcengines/apu/buildOpts.romstage.o build/mainboard/pcengines/apu/gpio_ftns.romstage.o build/northbridge/amd/agesa/common/common.romstage.o build/northbridge/amd/agesa/family14/dimmSpd.romstage.o build/northbridge/amd/agesa/family14/fam14_callouts.romstage.o build/southbridge/amd/cimx/cimx_util.romstage.o build/southbridge/amd/cimx/sb800/cfg.romstage.o build/southbridge/amd/cimx/sb800/early.romstage.o build/southbridge/amd/cimx/sb800/reset.romstage.o build/southbridge/amd/cimx/sb800/smbus.romstage.o build/vendorcode/amd/cimx/sb800/ACPILIB.romstage.o build/vendorcode/amd/cimx/sb800/AMDLIB.romstage.o build/vendorcode/amd/cimx/sb800/AMDSBLIB.romstage.o build/vendorcode/amd/cimx/sb800/AZALIA.romstage.o build/vendorcode/amd/cimx/sb800/DISPATCHER.romstage.o build/vendorcode/amd/cimx/sb800/EC.romstage.o build/vendorcode/amd/cimx/sb800/ECLIB.romstage.o build/vendorcode/amd/cimx/sb800/ECfanLIB.romstage.o build/vendorcode/amd/cimx/sb800/ECfanc.romstage.o build/vendorcode/amd/cimx/sb800/GEC.romstage.o build/vendorcode/amd/cimx/sb800/Gpp.romstage.o build/vendorcode/amd/cimx/sb800/IOLIB.romstage.o build/vendorcode/amd/cimx/sb800/MEMLIB.romstage.o build/vendorcode/amd/cimx/sb800/PCILIB.romstage.o build/vendorcode/amd/cimx/sb800/PMIO2LIB.romstage.o build/vendorcode/amd/cimx/sb800/PMIOLIB.romstage.o build/vendorcode/amd/cimx/sb800/SATA.romstage.o build/vendorcode/amd/cimx/sb800/SBCMN.romstage.o build/vendorcode/amd/cimx/sb800/SBMAIN.romstage.o build/vendorcode/amd/cimx/sb800/SBPELIB.romstage.o build/vendorcode/amd/cimx/sb800/SBPOR.romstage.o build/vendorcode/amd/cimx/sb800/SMM.romstage.o build/vendorcode/amd/cimx/sb800/USB.romstage.o  build/libagesa.fam14.a "$SAGE_HOME"/tools/xgcc/bin/../lib/gcc/i386-elf/4.7.3/libgcc.a -Wl,--end-group
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -nostdlib -nostartfiles -static -o build/cbfs/fallback/romstage_null.debug -Lbuild -T build/generated/romstage_null.ld -Wl,--wrap,__divdi3 -Wl,--wrap,__udivdi3 -Wl,--wrap,__moddi3 -Wl,--wrap,__umoddi3 -Wl,--start-group build/generated/crt0.romstage.o build/mainboard/pcengines/apu/static.romstage.o build/arch/x86/boot/cbmem.romstage.o build/arch/x86/lib/cbfs_and_run.romstage.o build/arch/x86/lib/memcpy.romstage.o build/arch/x86/lib/memmove.romstage.o build/arch/x86/lib/memset.romstage.o build/arch/x86/lib/rom_media.romstage.o build/console/console.romstage.o build/console/die.romstage.o build/console/init.romstage.o build/console/post.romstage.o build/console/printk.romstage.o build/console/vtxprintf.romstage.o build/cpu/amd/agesa/s3_resume.romstage.o build/cpu/amd/agesa/mem_restore.romstage.o build/cpu/x86/car.romstage.o build/cpu/x86/lapic/apic_timer.romstage.o build/cpu/x86/lapic/boot_cpu.romstage.o build/device/device_romstage.romstage.o build/device/dram/ddr3.romstage.o build/device/pci_early.romstage.o build/drivers/pc80/mc146818rtc.romstage.o build/drivers/pc80/mc146818rtc_early.romstage.o build/drivers/uart/uart8250io.romstage.o build/drivers/uart/util.romstage.o build/lib/bootmode.romstage.o build/lib/cbfs.romstage.o build/lib/dynamic_cbmem.romstage.o build/lib/cbmem_dir.romstage.o build/lib/timestamp.romstage.o build/lib/clog2.romstage.o build/lib/compute_ip_checksum.romstage.o build/lib/gcc.romstage.o build/lib/hexdump.romstage.o build/lib/loaders/cbfs_ramstage_loader.romstage.o build/lib/loaders/load_and_run_ramstage.romstage.o build/lib/lzma.romstage.o build/lib/lz4.romstage.o build/lib/memchr.romstage.o build/lib/memcmp.romstage.o build/lib/ramstage_cache.romstage.o build/lib/ramtest.romstage.o build/mainboard/pcengines/apu/BiosCallOuts.romstage.o build/mainboard/pcengines/apu/PlatformGnbPcie.romstage.o build/mainboard/pcengines/apu/agesawrapper.romstage.o build/mainboard/pcengines/apu/buildOpts.romstage.o build/mainboard/pcengines/apu/gpio_ftns.romstage.o build/northbridge/amd/agesa/common/common.romstage.o build/northbridge/amd/agesa/family14/dimmSpd.romstage.o build/northbridge/amd/agesa/family14/fam14_callouts.romstage.o build/southbridge/amd/cimx/cimx_util.romstage.o build/southbridge/amd/cimx/sb800/cfg.romstage.o build/southbridge/amd/cimx/sb800/early.romstage.o build/southbridge/amd/cimx/sb800/reset.romstage.o build/southbridge/amd/cimx/sb800/smbus.romstage.o build/vendorcode/amd/cimx/sb800/ACPILIB.romstage.o build/vendorcode/amd/cimx/sb800/AMDLIB.romstage.o build/vendorcode/amd/cimx/sb800/AMDSBLIB.romstage.o build/vendorcode/amd/cimx/sb800/AZALIA.romstage.o build/vendorcode/amd/cimx/sb800/DISPATCHER.romstage.o build/vendorcode/amd/cimx/sb800/EC.romstage.o build/vendorcode/amd/cimx/sb800/ECLIB.romstage.o build/vendorcode/amd/cimx/sb800/ECfanLIB.romstage.o build/vendorcode/amd/cimx/sb800/ECfanc.romstage.o build/vendorcode/amd/cimx/sb800/GEC.romstage.o build/vendorcode/amd/cimx/sb800/Gpp.romstage.o build/vendorcode/amd/cimx/sb800/IOLIB.romstage.o build/vendorcode/amd/cimx/sb800/MEMLIB.romstage.o build/vendorcode/amd/cimx/sb800/PCILIB.romstage.o build/vendorcode/amd/cimx/sb800/PMIO2LIB.romstage.o build/vendorcode/amd/cimx/sb800/PMIOLIB.romstage.o build/vendorcode/amd/cimx/sb800/SATA.romstage.o build/vendorcode/amd/cimx/sb800/SBCMN.romstage.o build/vendorcode/amd/cimx/sb800/SBMAIN.romstage.o build/vendorcode/amd/cimx/sb800/SBPELIB.romstage.o build/vendorcode/amd/cimx/sb800/SBPOR.romstage.o build/vendorcode/amd/cimx/sb800/SMM.romstage.o build/vendorcode/amd/cimx/sb800/USB.romstage.o  build/libagesa.fam14.a "$SAGE_HOME"/tools/xgcc/bin/../lib/gcc/i386-elf/4.7.3/libgcc.a -Wl,--end-group
 cp build/cbfs/fallback/romstage_null.debug build/cbfs/fallback/romstage_null.elf.tmp
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-nm -n build/cbfs/fallback/romstage_null.elf.tmp | sort > build/cbfs/fallback/romstage_null.map
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-objcopy --strip-debug build/cbfs/fallback/romstage_null.elf.tmp
@@ -626,7 +632,7 @@ rm -f build/generated/romstage_xip.ld
 sed -e 's/^/ROMSTAGE_BASE = /g' -e 's/$/;/g' build/cbfs/fallback/base_xip.txt > build/generated/romstage_xip.ld.tmp
 sed -e '/ROMSTAGE_BASE/d' build/generated/romstage_null.ld >> build/generated/romstage_xip.ld.tmp
 mv build/generated/romstage_xip.ld.tmp build/generated/romstage_xip.ld
-"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -nostdlib -nostartfiles -static -o build/cbfs/fallback/romstage_xip.debug -Lbuild -T build/generated/romstage_xip.ld -Wl,--wrap,__divdi3 -Wl,--wrap,__udivdi3 -Wl,--wrap,__moddi3 -Wl,--wrap,__umoddi3 -Wl,--start-group build/generated/crt0.romstage.o build/mainboard/pcengines/apu/static.romstage.o build/arch/x86/boot/cbmem.romstage.o build/arch/x86/lib/cbfs_and_run.romstage.o build/arch/x86/lib/memcpy.romstage.o build/arch/x86/lib/memmove.romstage.o build/arch/x86/lib/memset.romstage.o build/arch/x86/lib/rom_media.romstage.o build/console/console.romstage.o build/console/die.romstage.o build/console/init.romstage.o build/console/post.romstage.o build/console/printk.romstage.o build/console/vtxprintf.romstage.o build/cpu/amd/agesa/s3_resume.romstage.o build/cpu/x86/car.romstage.o build/cpu/x86/lapic/apic_timer.romstage.o build/cpu/x86/lapic/boot_cpu.romstage.o build/device/device_romstage.romstage.o build/device/dram/ddr3.romstage.o build/device/pci_early.romstage.o build/drivers/pc80/mc146818rtc.romstage.o build/drivers/pc80/mc146818rtc_early.romstage.o build/drivers/uart/uart8250io.romstage.o build/drivers/uart/util.romstage.o build/lib/bootmode.romstage.o build/lib/cbfs.romstage.o build/lib/cbmem.romstage.o build/lib/clog2.romstage.o build/lib/compute_ip_checksum.romstage.o build/lib/gcc.romstage.o build/lib/hexdump.romstage.o build/lib/loaders/cbfs_ramstage_loader.romstage.o build/lib/loaders/load_and_run_ramstage.romstage.o build/lib/lzma.romstage.o build/lib/memchr.romstage.o build/lib/memcmp.romstage.o build/lib/ramtest.romstage.o build/mainboard/pcengines/apu/BiosCallOuts.romstage.o build/mainboard/pcengines/apu/PlatformGnbPcie.romstage.o build/mainboard/pcengines/apu/agesawrapper.romstage.o build/mainboard/pcengines/apu/buildOpts.romstage.o build/mainboard/pcengines/apu/gpio_ftns.romstage.o build/northbridge/amd/agesa/common/common.romstage.o build/northbridge/amd/agesa/family14/dimmSpd.romstage.o build/northbridge/amd/agesa/family14/fam14_callouts.romstage.o build/southbridge/amd/cimx/cimx_util.romstage.o build/southbridge/amd/cimx/sb800/cfg.romstage.o build/southbridge/amd/cimx/sb800/early.romstage.o build/southbridge/amd/cimx/sb800/reset.romstage.o build/southbridge/amd/cimx/sb800/smbus.romstage.o build/vendorcode/amd/cimx/sb800/ACPILIB.romstage.o build/vendorcode/amd/cimx/sb800/AMDLIB.romstage.o build/vendorcode/amd/cimx/sb800/AMDSBLIB.romstage.o build/vendorcode/amd/cimx/sb800/AZALIA.romstage.o build/vendorcode/amd/cimx/sb800/DISPATCHER.romstage.o build/vendorcode/amd/cimx/sb800/EC.romstage.o build/vendorcode/amd/cimx/sb800/ECLIB.romstage.o build/vendorcode/amd/cimx/sb800/ECfanLIB.romstage.o build/vendorcode/amd/cimx/sb800/ECfanc.romstage.o build/vendorcode/amd/cimx/sb800/GEC.romstage.o build/vendorcode/amd/cimx/sb800/Gpp.romstage.o build/vendorcode/amd/cimx/sb800/IOLIB.romstage.o build/vendorcode/amd/cimx/sb800/MEMLIB.romstage.o build/vendorcode/amd/cimx/sb800/PCILIB.romstage.o build/vendorcode/amd/cimx/sb800/PMIO2LIB.romstage.o build/vendorcode/amd/cimx/sb800/PMIOLIB.romstage.o build/vendorcode/amd/cimx/sb800/SATA.romstage.o build/vendorcode/amd/cimx/sb800/SBCMN.romstage.o build/vendorcode/amd/cimx/sb800/SBMAIN.romstage.o build/vendorcode/amd/cimx/sb800/SBPELIB.romstage.o build/vendorcode/amd/cimx/sb800/SBPOR.romstage.o build/vendorcode/amd/cimx/sb800/SMM.romstage.o build/vendorcode/amd/cimx/sb800/USB.romstage.o  build/libagesa.fam14.a "$SAGE_HOME"/tools/xgcc/bin/../lib/gcc/i386-elf/4.7.3/libgcc.a -Wl,--end-group
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800 -nostdlib -nostartfiles -static -o build/cbfs/fallback/romstage_xip.debug -Lbuild -T build/generated/romstage_xip.ld -Wl,--wrap,__divdi3 -Wl,--wrap,__udivdi3 -Wl,--wrap,__moddi3 -Wl,--wrap,__umoddi3 -Wl,--start-group build/generated/crt0.romstage.o build/mainboard/pcengines/apu/static.romstage.o build/arch/x86/boot/cbmem.romstage.o build/arch/x86/lib/cbfs_and_run.romstage.o build/arch/x86/lib/memcpy.romstage.o build/arch/x86/lib/memmove.romstage.o build/arch/x86/lib/memset.romstage.o build/arch/x86/lib/rom_media.romstage.o build/console/console.romstage.o build/console/die.romstage.o build/console/init.romstage.o build/console/post.romstage.o build/console/printk.romstage.o build/console/vtxprintf.romstage.o build/cpu/amd/agesa/s3_resume.romstage.o build/cpu/amd/agesa/mem_restore.romstage.o build/cpu/x86/car.romstage.o build/cpu/x86/lapic/apic_timer.romstage.o build/cpu/x86/lapic/boot_cpu.romstage.o build/device/device_romstage.romstage.o build/device/dram/ddr3.romstage.o build/device/pci_early.romstage.o build/drivers/pc80/mc146818rtc.romstage.o build/drivers/pc80/mc146818rtc_early.romstage.o build/drivers/uart/uart8250io.romstage.o build/drivers/uart/util.romstage.o build/lib/bootmode.romstage.o build/lib/cbfs.romstage.o build/lib/dynamic_cbmem.romstage.o build/lib/cbmem_dir.romstage.o build/lib/timestamp.romstage.o build/lib/clog2.romstage.o build/lib/compute_ip_checksum.romstage.o build/lib/gcc.romstage.o build/lib/hexdump.romstage.o build/lib/loaders/cbfs_ramstage_loader.romstage.o build/lib/loaders/load_and_run_ramstage.romstage.o build/lib/lzma.romstage.o build/lib/lz4.romstage.o build/lib/memchr.romstage.o build/lib/memcmp.romstage.o build/lib/ramstage_cache.romstage.o build/lib/ramtest.romstage.o build/mainboard/pcengines/apu/BiosCallOuts.romstage.o build/mainboard/pcengines/apu/PlatformGnbPcie.romstage.o build/mainboard/pcengines/apu/agesawrapper.romstage.o build/mainboard/pcengines/apu/buildOpts.romstage.o build/mainboard/pcengines/apu/gpio_ftns.romstage.o build/northbridge/amd/agesa/common/common.romstage.o build/northbridge/amd/agesa/family14/dimmSpd.romstage.o build/northbridge/amd/agesa/family14/fam14_callouts.romstage.o build/southbridge/amd/cimx/cimx_util.romstage.o build/southbridge/amd/cimx/sb800/cfg.romstage.o build/southbridge/amd/cimx/sb800/early.romstage.o build/southbridge/amd/cimx/sb800/reset.romstage.o build/southbridge/amd/cimx/sb800/smbus.romstage.o build/vendorcode/amd/cimx/sb800/ACPILIB.romstage.o build/vendorcode/amd/cimx/sb800/AMDLIB.romstage.o build/vendorcode/amd/cimx/sb800/AMDSBLIB.romstage.o build/vendorcode/amd/cimx/sb800/AZALIA.romstage.o build/vendorcode/amd/cimx/sb800/DISPATCHER.romstage.o build/vendorcode/amd/cimx/sb800/EC.romstage.o build/vendorcode/amd/cimx/sb800/ECLIB.romstage.o build/vendorcode/amd/cimx/sb800/ECfanLIB.romstage.o build/vendorcode/amd/cimx/sb800/ECfanc.romstage.o build/vendorcode/amd/cimx/sb800/GEC.romstage.o build/vendorcode/amd/cimx/sb800/Gpp.romstage.o build/vendorcode/amd/cimx/sb800/IOLIB.romstage.o build/vendorcode/amd/cimx/sb800/MEMLIB.romstage.o build/vendorcode/amd/cimx/sb800/PCILIB.romstage.o build/vendorcode/amd/cimx/sb800/PMIO2LIB.romstage.o build/vendorcode/amd/cimx/sb800/PMIOLIB.romstage.o build/vendorcode/amd/cimx/sb800/SATA.romstage.o build/vendorcode/amd/cimx/sb800/SBCMN.romstage.o build/vendorcode/amd/cimx/sb800/SBMAIN.romstage.o build/vendorcode/amd/cimx/sb800/SBPELIB.romstage.o build/vendorcode/amd/cimx/sb800/SBPOR.romstage.o build/vendorcode/amd/cimx/sb800/SMM.romstage.o build/vendorcode/amd/cimx/sb800/USB.romstage.o  build/libagesa.fam14.a "$SAGE_HOME"/tools/xgcc/bin/../lib/gcc/i386-elf/4.7.3/libgcc.a -Wl,--end-group
 cp build/cbfs/fallback/romstage_xip.debug build/cbfs/fallback/romstage_xip.elf.tmp
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-nm -n build/cbfs/fallback/romstage_xip.elf.tmp | sort > build/cbfs/fallback/romstage_xip.map
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-objcopy --strip-debug build/cbfs/fallback/romstage_xip.elf.tmp
@@ -993,12 +999,18 @@ env CCACHE_DISABLE=1 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -DARCH=i386 -DPLA
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -DARCH=i386 -DPLATFORM=pcbios -march=i386 -fomit-frame-pointer -fstrength-reduce -falign-jumps=1 -falign-loops=1 -falign-functions=1 -mpreferred-stack-boundary=2 -mregparm=3 -mrtd -freg-struct-return -m32 -fshort-wchar -Ui386 -Ulinux -DNVALGRIND -Iinclude -I. -Iarch/x86/include -Iarch/i386/include -Iarch/i386/include/pcbios -Os -g -ffreestanding -Wall -W -Wformat-nonliteral  -fno-stack-protector  -fno-dwarf2-cfi-asm -fno-exceptions  -fno-unwind-tables -fno-asynchronous-unwind-tables -Wno-address  -Werror -ffunction-sections -fdata-sections -include include/compiler.h   -DOBJECT=png_test -c tests/png_test.c -o $ROOTDIR/payloads/ipxe/src/bin/png_test.o 
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -DARCH=i386 -DPLATFORM=pcbios -march=i386 -fomit-frame-pointer -fstrength-reduce -falign-jumps=1 -falign-loops=1 -falign-functions=1 -mpreferred-stack-boundary=2 -mregparm=3 -mrtd -freg-struct-return -m32 -fshort-wchar -Ui386 -Ulinux -DNVALGRIND -Iinclude -I. -Iarch/x86/include -Iarch/i386/include -Iarch/i386/include/pcbios -Os -g -ffreestanding -Wall -W -Wformat-nonliteral  -fno-stack-protector  -fno-dwarf2-cfi-asm -fno-exceptions  -fno-unwind-tables -fno-asynchronous-unwind-tables -Wno-address  -Werror -ffunction-sections -fdata-sections -include include/compiler.h   -DOBJECT=pnm_test -c tests/pnm_test.c -o $ROOTDIR/payloads/ipxe/src/bin/pnm_test.o 
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -DARCH=i386 -DPLATFORM=pcbios -march=i386 -fomit-frame-pointer -fstrength-reduce -falign-jumps=1 -falign-loops=1 -falign-functions=1 -mpreferred-stack-boundary=2 -mregparm=3 -mrtd -freg-struct-return -m32 -fshort-wchar -Ui386 -Ulinux -DNVALGRIND -Iinclude -I. -Iarch/x86/include -Iarch/i386/include -Iarch/i386/include/pcbios -Os -g -ffreestanding -Wall -W -Wformat-nonliteral  -fno-stack-protector  -fno-dwarf2-cfi-asm -fno-exceptions  -fno-unwind-tables -fno-asynchronous-unwind-tables -Wno-address  -Werror -ffunction-sections -fdata-sections -include include/compiler.h   -DOBJECT=profile_test -c tests/profile_test.c -o $ROOTDIR/payloads/ipxe/src/bin/profile_test.o 
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -DARCH=i386 -DPLATFORM=pcbios -march=i386 -fomit-frame-pointer -fstrength-reduce -falign-jumps=1 -falign-loops=1 -falign-functions=1 -mpreferred-stack-boundary=2 -mregparm=3 -mrtd -freg-struct-return -m32 -fshort-wchar -Ui386 -Ulinux -DNVALGRIND -Iinclude -I. -Iarch/x86/include -Iarch/i386/include -Iarch/i386/include/pcbios -Os -g -ffreestanding -Wall -W -Wformat-nonliteral  -fno-stack-protector  -fno-dwarf2-cfi-asm -fno-exceptions  -fno-unwind-tables -fno-asynchronous-unwind-tables -Wno-address  -Werror -ffunction-sections -fdata-sections -include include/compiler.h   -DOBJECT=realtek_test -c tests/realtek_test.c -o $ROOTDIR/payloads/ipxe/src/bin/realtek_test.o 
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -DARCH=i386 -DPLATFORM=pcbios -march=i386 -fomit-frame-pointer -fstrength-reduce -falign-jumps=1 -falign-loops=1 -falign-functions=1 -mpreferred-stack-boundary=2 -mregparm=3 -mrtd -freg-struct-return -m32 -fshort-wchar -Ui386 -Ulinux -DNVALGRIND -Iinclude -I. -Iarch/x86/include -Iarch/i386/include -Iarch/i386/include/pcbios -Os -g -ffreestanding -Wall -W -Wformat-nonliteral  -fno-stack-protector  -fno-dwarf2-cfi-asm -fno-exceptions  -fno-unwind-tables -fno-asynchronous-unwind-tables -Wno-address  -Werror -ffunction-sections -fdata-sections -include include/compiler.h   -DOBJECT=rsa_test -c tests/rsa_test.c -o $ROOTDIR/payloads/ipxe/src/bin/rsa_test.o 
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -DARCH=i386 -DPLATFORM=pcbios -march=i386 -fomit-frame-pointer -fstrength-reduce -falign-jumps=1 -falign-loops=1 -falign-functions=1 -mpreferred-stack-boundary=2 -mregparm=3 -mrtd -freg-struct-return -m32 -fshort-wchar -Ui386 -Ulinux -DNVALGRIND -Iinclude -I. -Iarch/x86/include -Iarch/i386/include -Iarch/i386/include/pcbios -Os -g -ffreestanding -Wall -W -Wformat-nonliteral  -fno-stack-protector  -fno-dwarf2-cfi-asm -fno-exceptions  -fno-unwind-tables -fno-asynchronous-unwind-tables -Wno-address  -Werror -ffunction-sections -fdata-sections -include include/compiler.h   -DOBJECT=settings_test -c tests/settings_test.c -o $ROOTDIR/payloads/ipxe/src/bin/settings_test.o 
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -DARCH=i386 -DPLATFORM=pcbios -march=i386 -fomit-frame-pointer -fstrength-reduce -falign-jumps=1 -falign-loops=1 -falign-functions=1 -mpreferred-stack-boundary=2 -mregparm=3 -mrtd -freg-struct-return -m32 -fshort-wchar -Ui386 -Ulinux -DNVALGRIND -Iinclude -I. -Iarch/x86/include -Iarch/i386/include -Iarch/i386/include/pcbios -Os -g -ffreestanding -Wall -W -Wformat-nonliteral  -fno-stack-protector  -fno-dwarf2-cfi-asm -fno-exceptions  -fno-unwind-tables -fno-asynchronous-unwind-tables -Wno-address  -Werror -ffunction-sections -fdata-sections -include include/compiler.h   -DOBJECT=sha1_test -c tests/sha1_test.c -o $ROOTDIR/payloads/ipxe/src/bin/sha1_test.o 
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -DARCH=i386 -DPLATFORM=pcbios -march=i386 -fomit-frame-pointer -fstrength-reduce -falign-jumps=1 -falign-loops=1 -falign-functions=1 -mpreferred-stack-boundary=2 -mregparm=3 -mrtd -freg-struct-return -m32 -fshort-wchar -Ui386 -Ulinux -DNVALGRIND -Iinclude -I. -Iarch/x86/include -Iarch/i386/include -Iarch/i386/include/pcbios -Os -g -ffreestanding -Wall -W -Wformat-nonliteral  -fno-stack-protector  -fno-dwarf2-cfi-asm -fno-exceptions  -fno-unwind-tables -fno-asynchronous-unwind-tables -Wno-address  -Werror -ffunction-sections -fdata-sections -include include/compiler.h   -DOBJECT=sha256_test -c tests/sha256_test.c -o $ROOTDIR/payloads/ipxe/src/bin/sha256_test.o 
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -DARCH=i386 -DPLATFORM=pcbios -march=i386 -fomit-frame-pointer -fstrength-reduce -falign-jumps=1 -falign-loops=1 -falign-functions=1 -mpreferred-stack-boundary=2 -mregparm=3 -mrtd -freg-struct-return -m32 -fshort-wchar -Ui386 -Ulinux -DNVALGRIND -Iinclude -I. -Iarch/x86/include -Iarch/i386/include -Iarch/i386/include/pcbios -Os -g -ffreestanding -Wall -W -Wformat-nonliteral  -fno-stack-protector  -fno-dwarf2-cfi-asm -fno-exceptions  -fno-unwind-tables -fno-asynchronous-unwind-tables -Wno-address  -Werror -ffunction-sections -fdata-sections -include include/compiler.h   -DOBJECT=string_test -c tests/string_test.c -o $ROOTDIR/payloads/ipxe/src/bin/string_test.o 
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -DARCH=i386 -DPLATFORM=pcbios -march=i386 -fomit-frame-pointer -fstrength-reduce -falign-jumps=1 -falign-loops=1 -falign-functions=1 -mpreferred-stack-boundary=2 -mregparm=3 -mrtd -freg-struct-return -m32 -fshort-wchar -Ui386 -Ulinux -DNVALGRIND -Iinclude -I. -Iarch/x86/include -Iarch/i386/include -Iarch/i386/include/pcbios -Os -g -ffreestanding -Wall -W -Wformat-nonliteral  -fno-stack-protector  -fno-dwarf2-cfi-asm -fno-exceptions  -fno-unwind-tables -fno-asynchronous-unwind-tables -Wno-address  -Werror -ffunction-sections -fdata-sections -include include/compiler.h   -DOBJECT=tcp_test -c tests/tcp_test.c -o $ROOTDIR/payloads/ipxe/src/bin/tcp_test.o 
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -DARCH=i386 -DPLATFORM=pcbios -march=i386 -fomit-frame-pointer -fstrength-reduce -falign-jumps=1 -falign-loops=1 -falign-functions=1 -mpreferred-stack-boundary=2 -mregparm=3 -mrtd -freg-struct-return -m32 -fshort-wchar -Ui386 -Ulinux -DNVALGRIND -Iinclude -I. -Iarch/x86/include -Iarch/i386/include -Iarch/i386/include/pcbios -Os -g -ffreestanding -Wall -W -Wformat-nonliteral  -fno-stack-protector  -fno-dwarf2-cfi-asm -fno-exceptions  -fno-unwind-tables -fno-asynchronous-unwind-tables -Wno-address  -Werror -ffunction-sections -fdata-sections -include include/compiler.h   -DOBJECT=tcpip_test -c tests/tcpip_test.c -o $ROOTDIR/payloads/ipxe/src/bin/tcpip_test.o 
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -DARCH=i386 -DPLATFORM=pcbios -march=i386 -fomit-frame-pointer -fstrength-reduce -falign-jumps=1 -falign-loops=1 -falign-functions=1 -mpreferred-stack-boundary=2 -mregparm=3 -mrtd -freg-struct-return -m32 -fshort-wchar -Ui386 -Ulinux -DNVALGRIND -Iinclude -I. -Iarch/x86/include -Iarch/i386/include -Iarch/i386/include/pcbios -Os -g -ffreestanding -Wall -W -Wformat-nonliteral  -fno-stack-protector  -fno-dwarf2-cfi-asm -fno-exceptions  -fno-unwind-tables -fno-asynchronous-unwind-tables -Wno-address  -Werror -ffunction-sections -fdata-sections -include include/compiler.h   -DOBJECT=downloader_bench -c tests/downloader_bench.c -o $ROOTDIR/payloads/ipxe/src/bin/downloader_bench.o 
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -DARCH=i386 -DPLATFORM=pcbios -march=i386 -fomit-frame-pointer -fstrength-reduce -falign-jumps=1 -falign-loops=1 -falign-functions=1 -mpreferred-stack-boundary=2 -mregparm=3 -mrtd -freg-struct-return -m32 -fshort-wchar -Ui386 -Ulinux -DNVALGRIND -Iinclude -I. -Iarch/x86/include -Iarch/i386/include -Iarch/i386/include/pcbios -Os -g -ffreestanding -Wall -W -Wformat-nonliteral  -fno-stack-protector  -fno-dwarf2-cfi-asm -fno-exceptions  -fno-unwind-tables -fno-asynchronous-unwind-tables -Wno-address  -Werror -ffunction-sections -fdata-sections -include include/compiler.h   -DOBJECT=downloader_server -c tests/downloader_server.c -o $ROOTDIR/payloads/ipxe/src/bin/downloader_server.o 
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -DARCH=i386 -DPLATFORM=pcbios -march=i386 -fomit-frame-pointer -fstrength-reduce -falign-jumps=1 -falign-loops=1 -falign-functions=1 -mpreferred-stack-boundary=2 -mregparm=3 -mrtd -freg-struct-return -m32 -fshort-wchar -Ui386 -Ulinux -DNVALGRIND -Iinclude -I. -Iarch/x86/include -Iarch/i386/include -Iarch/i386/include/pcbios -Os -g -ffreestanding -Wall -W -Wformat-nonliteral  -fno-stack-protector  -fno-dwarf2-cfi-asm -fno-exceptions  -fno-unwind-tables -fno-asynchronous-unwind-tables -Wno-address  -Werror -ffunction-sections -fdata-sections -include include/compiler.h   -DOBJECT=downloader_test -c tests/downloader_test.c -o $ROOTDIR/payloads/ipxe/src/bin/downloader_test.o 
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -DARCH=i386 -DPLATFORM=pcbios -march=i386 -fomit-frame-pointer -fstrength-reduce -falign-jumps=1 -falign-loops=1 -falign-functions=1 -mpreferred-stack-boundary=2 -mregparm=3 -mrtd -freg-struct-return -m32 -fshort-wchar -Ui386 -Ulinux -DNVALGRIND -Iinclude -I. -Iarch/x86/include -Iarch/i386/include -Iarch/i386/include/pcbios -Os -g -ffreestanding -Wall -W -Wformat-nonliteral  -fno-stack-protector  -fno-dwarf2-cfi-asm -fno-exceptions  -fno-unwind-tables -fno-asynchronous-unwind-tables -Wno-address  -Werror -ffunction-sections -fdata-sections -include include/compiler.h   -DOBJECT=tftp_test -c tests/tftp_test.c -o $ROOTDIR/payloads/ipxe/src/bin/tftp_test.o 
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -DARCH=i386 -DPLATFORM=pcbios -march=i386 -fomit-frame-pointer -fstrength-reduce -falign-jumps=1 -falign-loops=1 -falign-functions=1 -mpreferred-stack-boundary=2 -mregparm=3 -mrtd -freg-struct-return -m32 -fshort-wchar -Ui386 -Ulinux -DNVALGRIND -Iinclude -I. -Iarch/x86/include -Iarch/i386/include -Iarch/i386/include/pcbios -Os -g -ffreestanding -Wall -W -Wformat-nonliteral  -fno-stack-protector  -fno-dwarf2-cfi-asm -fno-exceptions  -fno-unwind-tables -fno-asynchronous-unwind-tables -Wno-address  -Werror -ffunction-sections -fdata-sections -include include/compiler.h   -DOBJECT=test -c tests/test.c -o $ROOTDIR/payloads/ipxe/src/bin/test.o 
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -DARCH=i386 -DPLATFORM=pcbios -march=i386 -fomit-frame-pointer -fstrength-reduce -falign-jumps=1 -falign-loops=1 -falign-functions=1 -mpreferred-stack-boundary=2 -mregparm=3 -mrtd -freg-struct-return -m32 -fshort-wchar -Ui386 -Ulinux -DNVALGRIND -Iinclude -I. -Iarch/x86/include -Iarch/i386/include -Iarch/i386/include/pcbios -Os -g -ffreestanding -Wall -W -Wformat-nonliteral  -fno-stack-protector  -fno-dwarf2-cfi-asm -fno-exceptions  -fno-unwind-tables -fno-asynchronous-unwind-tables -Wno-address  -Werror -ffunction-sections -fdata-sections -include include/compiler.h   -DOBJECT=tests -c tests/tests.c -o $ROOTDIR/payloads/ipxe/src/bin/tests.o 
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -DARCH=i386 -DPLATFORM=pcbios -march=i386 -fomit-frame-pointer -fstrength-reduce -falign-jumps=1 -falign-loops=1 -falign-functions=1 -mpreferred-stack-boundary=2 -mregparm=3 -mrtd -freg-struct-return -m32 -fshort-wchar -Ui386 -Ulinux -DNVALGRIND -Iinclude -I. -Iarch/x86/include -Iarch/i386/include -Iarch/i386/include/pcbios -Os -g -ffreestanding -Wall -W -Wformat-nonliteral  -fno-stack-protector  -fno-dwarf2-cfi-asm -fno-exceptions  -fno-unwind-tables -fno-asynchronous-unwind-tables -Wno-address  -Werror -ffunction-sections -fdata-sections -include include/compiler.h   -DOBJECT=time_test -c tests/time_test.c -o $ROOTDIR/payloads/ipxe/src/bin/time_test.o 
@@ -1259,7 +1271,7 @@ env CCACHE_DISABLE=1 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -DARCH=i386 -DPLA
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc -E  -DARCH=i386 -DPLATFORM=pcbios -march=i386 -fomit-frame-pointer -fstrength-reduce -falign-jumps=1 -falign-loops=1 -falign-functions=1 -mpreferred-stack-boundary=2 -mregparm=3 -mrtd -freg-struct-return -m32 -fshort-wchar -Ui386 -Ulinux -DNVALGRIND -Iinclude -I. -Iarch/x86/include -Iarch/i386/include -Iarch/i386/include/pcbios -Os -g -ffreestanding -Wall -W -Wformat-nonliteral  -fno-stack-protector  -fno-dwarf2-cfi-asm -fno-exceptions  -fno-unwind-tables -fno-asynchronous-unwind-tables -Wno-address  -Werror -ffunction-sections -fdata-sections -include include/compiler.h -DASSEMBLY  -DOBJECT=com32_wrapper arch/i386/interface/syslinux/com32_wrapper.S | "$SAGE_HOME"/tools/xgcc/bin/i386-elf-as  --32  --divide  --fatal-warnings -o $ROOTDIR/payloads/ipxe/src/bin/com32_wrapper.o
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc -E  -DARCH=i386 -DPLATFORM=pcbios -march=i386 -fomit-frame-pointer -fstrength-reduce -falign-jumps=1 -falign-loops=1 -falign-functions=1 -mpreferred-stack-boundary=2 -mregparm=3 -mrtd -freg-struct-return -m32 -fshort-wchar -Ui386 -Ulinux -DNVALGRIND -Iinclude -I. -Iarch/x86/include -Iarch/i386/include -Iarch/i386/include/pcbios -Os -g -ffreestanding -Wall -W -Wformat-nonliteral  -fno-stack-protector  -fno-dwarf2-cfi-asm -fno-exceptions  -fno-unwind-tables -fno-asynchronous-unwind-tables -Wno-address  -Werror -ffunction-sections -fdata-sections -include include/compiler.h -DASSEMBLY  -DOBJECT=undiisr arch/i386/drivers/net/undiisr.S | "$SAGE_HOME"/tools/xgcc/bin/i386-elf-as  --32  --divide  --fatal-warnings -o $ROOTDIR/payloads/ipxe/src/bin/undiisr.o
 rm -f $ROOTDIR/payloads/ipxe/src/bin/blib.a
-"$SAGE_HOME"/tools/xgcc/bin/i386-elf-ar r $ROOTDIR/payloads/ipxe/src/bin/blib.a  $ROOTDIR/payloads/ipxe/src/bin/__divdi3.o $ROOTDIR/payloads/ipxe/src/bin/icc.o $ROOTDIR/payloads/ipxe/src/bin/memcpy.o $ROOTDIR/payloads/ipxe/src/bin/__moddi3.o $ROOTDIR/payloads/ipxe/src/bin/__udivdi3.o $ROOTDIR/payloads/ipxe/src/bin/__udivmoddi4.o $ROOTDIR/payloads/ipxe/src/bin/__umoddi3.o $ROOTDIR/payloads/ipxe/src/bin/acpi.o $ROOTDIR/payloads/ipxe/src/bin/ansicol.o $ROOTDIR/payloads/ipxe/src/bin/ansicoldef.o $ROOTDIR/payloads/ipxe/src/bin/ansiesc.o $ROOTDIR/payloads/ipxe/src/bin/asprintf.o $ROOTDIR/payloads/ipxe/src/bin/assert.o $ROOTDIR/payloads/ipxe/src/bin/base16.o $ROOTDIR/payloads/ipxe/src/bin/base64.o $ROOTDIR/payloads/ipxe/src/bin/basename.o $ROOTDIR/payloads/ipxe/src/bin/bitmap.o $ROOTDIR/payloads/ipxe/src/bin/blockdev.o $ROOTDIR/payloads/ipxe/src/bin/console.o $ROOTDIR/payloads/ipxe/src/bin/cpio.o $ROOTDIR/payloads/ipxe/src/bin/ctype.o $ROOTDIR/payloads/ipxe/src/bin/cwuri.o $ROOTDIR/payloads/ipxe/src/bin/debug.o $ROOTDIR/payloads/ipxe/src/bin/debug_md5.o $ROOTDIR/payloads/ipxe/src/bin/device.o $ROOTDIR/payloads/ipxe/src/bin/downloader.o $ROOTDIR/payloads/ipxe/src/bin/edd.o $ROOTDIR/payloads/ipxe/src/bin/errno.o $ROOTDIR/payloads/ipxe/src/bin/exec.o $ROOTDIR/payloads/ipxe/src/bin/fbcon.o $ROOTDIR/payloads/ipxe/src/bin/fnrec.o $ROOTDIR/payloads/ipxe/src/bin/gdbserial.o $ROOTDIR/payloads/ipxe/src/bin/gdbstub.o $ROOTDIR/payloads/ipxe/src/bin/gdbudp.o $ROOTDIR/payloads/ipxe/src/bin/getkey.o $ROOTDIR/payloads/ipxe/src/bin/getopt.o $ROOTDIR/payloads/ipxe/src/bin/hw.o $ROOTDIR/payloads/ipxe/src/bin/i82365.o $ROOTDIR/payloads/ipxe/src/bin/image.o $ROOTDIR/payloads/ipxe/src/bin/init.o $ROOTDIR/payloads/ipxe/src/bin/interface.o $ROOTDIR/payloads/ipxe/src/bin/iobuf.o $ROOTDIR/payloads/ipxe/src/bin/isqrt.o $ROOTDIR/payloads/ipxe/src/bin/job.o $ROOTDIR/payloads/ipxe/src/bin/linebuf.o $ROOTDIR/payloads/ipxe/src/bin/lineconsole.o $ROOTDIR/payloads/ipxe/src/bin/list.o $ROOTDIR/payloads/ipxe/src/bin/log.o $ROOTDIR/payloads/ipxe/src/bin/main.o $ROOTDIR/payloads/ipxe/src/bin/malloc.o $ROOTDIR/payloads/ipxe/src/bin/memblock.o $ROOTDIR/payloads/ipxe/src/bin/memmap_settings.o $ROOTDIR/payloads/ipxe/src/bin/menu.o $ROOTDIR/payloads/ipxe/src/bin/misc.o $ROOTDIR/payloads/ipxe/src/bin/monojob.o $ROOTDIR/payloads/ipxe/src/bin/null_nap.o $ROOTDIR/payloads/ipxe/src/bin/null_reboot.o $ROOTDIR/payloads/ipxe/src/bin/null_sanboot.o $ROOTDIR/payloads/ipxe/src/bin/null_time.o $ROOTDIR/payloads/ipxe/src/bin/nvo.o $ROOTDIR/payloads/ipxe/src/bin/open.o $ROOTDIR/payloads/ipxe/src/bin/params.o $ROOTDIR/payloads/ipxe/src/bin/parseopt.o $ROOTDIR/payloads/ipxe/src/bin/pc_kbd.o $ROOTDIR/payloads/ipxe/src/bin/pcmcia.o $ROOTDIR/payloads/ipxe/src/bin/pending.o $ROOTDIR/payloads/ipxe/src/bin/pinger.o $ROOTDIR/payloads/ipxe/src/bin/pixbuf.o $ROOTDIR/payloads/ipxe/src/bin/posix_io.o $ROOTDIR/payloads/ipxe/src/bin/process.o $ROOTDIR/payloads/ipxe/src/bin/profile.o $ROOTDIR/payloads/ipxe/src/bin/random.o $ROOTDIR/payloads/ipxe/src/bin/refcnt.o $ROOTDIR/payloads/ipxe/src/bin/resolv.o $ROOTDIR/payloads/ipxe/src/bin/serial.o $ROOTDIR/payloads/ipxe/src/bin/serial_console.o $ROOTDIR/payloads/ipxe/src/bin/settings.o $ROOTDIR/payloads/ipxe/src/bin/string.o $ROOTDIR/payloads/ipxe/src/bin/stringextra.o $ROOTDIR/payloads/ipxe/src/bin/strtoull.o $ROOTDIR/payloads/ipxe/src/bin/time.o $ROOTDIR/payloads/ipxe/src/bin/timer.o $ROOTDIR/payloads/ipxe/src/bin/uri.o $ROOTDIR/payloads/ipxe/src/bin/uuid.o $ROOTDIR/payloads/ipxe/src/bin/version.o $ROOTDIR/payloads/ipxe/src/bin/vsprintf.o $ROOTDIR/payloads/ipxe/src/bin/wchar.o $ROOTDIR/payloads/ipxe/src/bin/xferbuf.o $ROOTDIR/payloads/ipxe/src/bin/xfer.o $ROOTDIR/payloads/ipxe/src/bin/aoe.o $ROOTDIR/payloads/ipxe/src/bin/arp.o $ROOTDIR/payloads/ipxe/src/bin/dhcpopts.o $ROOTDIR/payloads/ipxe/src/bin/dhcppkt.o $ROOTDIR/payloads/ipxe/src/bin/eapol.o $ROOTDIR/payloads/ipxe/src/bin/ethernet.o $ROOTDIR/payloads/ipxe/src/bin/eth_slow.o $ROOTDIR/payloads/ipxe/src/bin/fakedhcp.o $ROOTDIR/payloads/ipxe/src/bin/fc.o $ROOTDIR/payloads/ipxe/src/bin/fcels.o $ROOTDIR/payloads/ipxe/src/bin/fcns.o $ROOTDIR/payloads/ipxe/src/bin/fcoe.o $ROOTDIR/payloads/ipxe/src/bin/fcp.o $ROOTDIR/payloads/ipxe/src/bin/fragment.o $ROOTDIR/payloads/ipxe/src/bin/icmp.o $ROOTDIR/payloads/ipxe/src/bin/icmpv4.o $ROOTDIR/payloads/ipxe/src/bin/icmpv6.o $ROOTDIR/payloads/ipxe/src/bin/infiniband.o $ROOTDIR/payloads/ipxe/src/bin/iobpad.o $ROOTDIR/payloads/ipxe/src/bin/ipv4.o $ROOTDIR/payloads/ipxe/src/bin/ipv6.o $ROOTDIR/payloads/ipxe/src/bin/ndp.o $ROOTDIR/payloads/ipxe/src/bin/neighbour.o $ROOTDIR/payloads/ipxe/src/bin/netdevice.o $ROOTDIR/payloads/ipxe/src/bin/netdev_settings.o $ROOTDIR/payloads/ipxe/src/bin/nullnet.o $ROOTDIR/payloads/ipxe/src/bin/ping.o $ROOTDIR/payloads/ipxe/src/bin/rarp.o $ROOTDIR/payloads/ipxe/src/bin/retry.o $ROOTDIR/payloads/ipxe/src/bin/socket.o $ROOTDIR/payloads/ipxe/src/bin/tcp.o $ROOTDIR/payloads/ipxe/src/bin/tcpip.o $ROOTDIR/payloads/ipxe/src/bin/tls.o $ROOTDIR/payloads/ipxe/src/bin/udp.o $ROOTDIR/payloads/ipxe/src/bin/validator.o $ROOTDIR/payloads/ipxe/src/bin/vlan.o $ROOTDIR/payloads/ipxe/src/bin/mount.o $ROOTDIR/payloads/ipxe/src/bin/nfs.o $ROOTDIR/payloads/ipxe/src/bin/nfs_open.o $ROOTDIR/payloads/ipxe/src/bin/nfs_uri.o $ROOTDIR/payloads/ipxe/src/bin/oncrpc_iob.o $ROOTDIR/payloads/ipxe/src/bin/portmap.o $ROOTDIR/payloads/ipxe/src/bin/ftp.o $ROOTDIR/payloads/ipxe/src/bin/http.o $ROOTDIR/payloads/ipxe/src/bin/httpcore.o $ROOTDIR/payloads/ipxe/src/bin/https.o $ROOTDIR/payloads/ipxe/src/bin/iscsi.o $ROOTDIR/payloads/ipxe/src/bin/oncrpc.o $ROOTDIR/payloads/ipxe/src/bin/syslogs.o $ROOTDIR/payloads/ipxe/src/bin/dhcp.o $ROOTDIR/payloads/ipxe/src/bin/dhcpv6.o $ROOTDIR/payloads/ipxe/src/bin/dns.o $ROOTDIR/payloads/ipxe/src/bin/slam.o $ROOTDIR/payloads/ipxe/src/bin/syslog.o $ROOTDIR/payloads/ipxe/src/bin/tftp.o $ROOTDIR/payloads/ipxe/src/bin/ib_cm.o $ROOTDIR/payloads/ipxe/src/bin/ib_cmrc.o $ROOTDIR/payloads/ipxe/src/bin/ib_mcast.o $ROOTDIR/payloads/ipxe/src/bin/ib_mi.o $ROOTDIR/payloads/ipxe/src/bin/ib_packet.o $ROOTDIR/payloads/ipxe/src/bin/ib_pathrec.o $ROOTDIR/payloads/ipxe/src/bin/ib_sma.o $ROOTDIR/payloads/ipxe/src/bin/ib_smc.o $ROOTDIR/payloads/ipxe/src/bin/ib_srp.o $ROOTDIR/payloads/ipxe/src/bin/net80211.o $ROOTDIR/payloads/ipxe/src/bin/rc80211.o $ROOTDIR/payloads/ipxe/src/bin/sec80211.o $ROOTDIR/payloads/ipxe/src/bin/wep.o $ROOTDIR/payloads/ipxe/src/bin/wpa.o $ROOTDIR/payloads/ipxe/src/bin/wpa_ccmp.o $ROOTDIR/payloads/ipxe/src/bin/wpa_psk.o $ROOTDIR/payloads/ipxe/src/bin/wpa_tkip.o $ROOTDIR/payloads/ipxe/src/bin/efi_image.o $ROOTDIR/payloads/ipxe/src/bin/elf.o $ROOTDIR/payloads/ipxe/src/bin/embedded.o $ROOTDIR/payloads/ipxe/src/bin/png.o $ROOTDIR/payloads/ipxe/src/bin/pnm.o $ROOTDIR/payloads/ipxe/src/bin/script.o $ROOTDIR/payloads/ipxe/src/bin/segment.o $ROOTDIR/payloads/ipxe/src/bin/eisa.o $ROOTDIR/payloads/ipxe/src/bin/isa.o $ROOTDIR/payloads/ipxe/src/bin/isa_ids.o $ROOTDIR/payloads/ipxe/src/bin/isapnp.o $ROOTDIR/payloads/ipxe/src/bin/mca.o $ROOTDIR/payloads/ipxe/src/bin/pcibackup.o $ROOTDIR/payloads/ipxe/src/bin/pci.o $ROOTDIR/payloads/ipxe/src/bin/pciextra.o $ROOTDIR/payloads/ipxe/src/bin/pci_settings.o $ROOTDIR/payloads/ipxe/src/bin/pcivpd.o $ROOTDIR/payloads/ipxe/src/bin/virtio-pci.o $ROOTDIR/payloads/ipxe/src/bin/virtio-ring.o $ROOTDIR/payloads/ipxe/src/bin/3c503.o $ROOTDIR/payloads/ipxe/src/bin/3c509.o $ROOTDIR/payloads/ipxe/src/bin/3c509-eisa.o $ROOTDIR/payloads/ipxe/src/bin/3c515.o $ROOTDIR/payloads/ipxe/src/bin/3c529.o $ROOTDIR/payloads/ipxe/src/bin/3c595.o $ROOTDIR/payloads/ipxe/src/bin/3c5x9.o $ROOTDIR/payloads/ipxe/src/bin/3c90x.o $ROOTDIR/payloads/ipxe/src/bin/amd8111e.o $ROOTDIR/payloads/ipxe/src/bin/atl1e.o $ROOTDIR/payloads/ipxe/src/bin/b44.o $ROOTDIR/payloads/ipxe/src/bin/bnx2.o $ROOTDIR/payloads/ipxe/src/bin/cs89x0.o $ROOTDIR/payloads/ipxe/src/bin/davicom.o $ROOTDIR/payloads/ipxe/src/bin/depca.o $ROOTDIR/payloads/ipxe/src/bin/dmfe.o $ROOTDIR/payloads/ipxe/src/bin/eepro100.o $ROOTDIR/payloads/ipxe/src/bin/eepro.o $ROOTDIR/payloads/ipxe/src/bin/epic100.o $ROOTDIR/payloads/ipxe/src/bin/etherfabric.o $ROOTDIR/payloads/ipxe/src/bin/forcedeth.o $ROOTDIR/payloads/ipxe/src/bin/intel.o $ROOTDIR/payloads/ipxe/src/bin/intelx.o $ROOTDIR/payloads/ipxe/src/bin/ipoib.o $ROOTDIR/payloads/ipxe/src/bin/jme.o $ROOTDIR/payloads/ipxe/src/bin/legacy.o $ROOTDIR/payloads/ipxe/src/bin/mii.o $ROOTDIR/payloads/ipxe/src/bin/myri10ge.o $ROOTDIR/payloads/ipxe/src/bin/myson.o $ROOTDIR/payloads/ipxe/src/bin/natsemi.o $ROOTDIR/payloads/ipxe/src/bin/ne2k_isa.o $ROOTDIR/payloads/ipxe/src/bin/ne.o $ROOTDIR/payloads/ipxe/src/bin/ns8390.o $ROOTDIR/payloads/ipxe/src/bin/pcnet32.o $ROOTDIR/payloads/ipxe/src/bin/pnic.o $ROOTDIR/payloads/ipxe/src/bin/prism2_pci.o $ROOTDIR/payloads/ipxe/src/bin/prism2_plx.o $ROOTDIR/payloads/ipxe/src/bin/realtek.o $ROOTDIR/payloads/ipxe/src/bin/rhine.o $ROOTDIR/payloads/ipxe/src/bin/sis190.o $ROOTDIR/payloads/ipxe/src/bin/sis900.o $ROOTDIR/payloads/ipxe/src/bin/skeleton.o $ROOTDIR/payloads/ipxe/src/bin/skge.o $ROOTDIR/payloads/ipxe/src/bin/sky2.o $ROOTDIR/payloads/ipxe/src/bin/smc9000.o $ROOTDIR/payloads/ipxe/src/bin/sundance.o $ROOTDIR/payloads/ipxe/src/bin/tlan.o $ROOTDIR/payloads/ipxe/src/bin/tulip.o $ROOTDIR/payloads/ipxe/src/bin/velocity.o $ROOTDIR/payloads/ipxe/src/bin/virtio-net.o $ROOTDIR/payloads/ipxe/src/bin/vmxnet3.o $ROOTDIR/payloads/ipxe/src/bin/w89c840.o $ROOTDIR/payloads/ipxe/src/bin/wd.o $ROOTDIR/payloads/ipxe/src/bin/igbvf_main.o $ROOTDIR/payloads/ipxe/src/bin/igbvf_mbx.o $ROOTDIR/payloads/ipxe/src/bin/igbvf_vf.o $ROOTDIR/payloads/ipxe/src/bin/phantom.o $ROOTDIR/payloads/ipxe/src/bin/rtl8180.o $ROOTDIR/payloads/ipxe/src/bin/rtl8180_grf5101.o $ROOTDIR/payloads/ipxe/src/bin/rtl8180_max2820.o $ROOTDIR/payloads/ipxe/src/bin/rtl8180_sa2400.o $ROOTDIR/payloads/ipxe/src/bin/rtl8185.o $ROOTDIR/payloads/ipxe/src/bin/rtl8185_rtl8225.o $ROOTDIR/payloads/ipxe/src/bin/rtl818x.o $ROOTDIR/payloads/ipxe/src/bin/ath_hw.o $ROOTDIR/payloads/ipxe/src/bin/ath_key.o $ROOTDIR/payloads/ipxe/src/bin/ath_main.o $ROOTDIR/payloads/ipxe/src/bin/ath_regd.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_attach.o $ROOTDIR/payloads/ipxe/src/bin/ath5k.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_caps.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_desc.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_dma.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_eeprom.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_gpio.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_initvals.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_pcu.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_phy.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_qcu.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_reset.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_rfkill.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ani.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ar5008_phy.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ar9002_calib.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ar9002_hw.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ar9002_mac.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ar9002_phy.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ar9003_calib.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ar9003_eeprom.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ar9003_hw.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ar9003_mac.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ar9003_phy.o $ROOTDIR/payloads/ipxe/src/bin/ath9k.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_calib.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_common.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_eeprom_4k.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_eeprom_9287.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_eeprom.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_eeprom_def.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_hw.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_init.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_mac.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_main.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_recv.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_xmit.o $ROOTDIR/payloads/ipxe/src/bin/vxge.o $ROOTDIR/payloads/ipxe/src/bin/vxge_config.o $ROOTDIR/payloads/ipxe/src/bin/vxge_main.o $ROOTDIR/payloads/ipxe/src/bin/vxge_traffic.o $ROOTDIR/payloads/ipxe/src/bin/snpnet.o $ROOTDIR/payloads/ipxe/src/bin/snponly.o $ROOTDIR/payloads/ipxe/src/bin/tg3.o $ROOTDIR/payloads/ipxe/src/bin/tg3_hw.o $ROOTDIR/payloads/ipxe/src/bin/tg3_phy.o $ROOTDIR/payloads/ipxe/src/bin/ata.o $ROOTDIR/payloads/ipxe/src/bin/ibft.o $ROOTDIR/payloads/ipxe/src/bin/scsi.o $ROOTDIR/payloads/ipxe/src/bin/srp.o $ROOTDIR/payloads/ipxe/src/bin/nvs.o $ROOTDIR/payloads/ipxe/src/bin/nvsvpd.o $ROOTDIR/payloads/ipxe/src/bin/spi.o $ROOTDIR/payloads/ipxe/src/bin/threewire.o $ROOTDIR/payloads/ipxe/src/bin/bitbash.o $ROOTDIR/payloads/ipxe/src/bin/i2c_bit.o $ROOTDIR/payloads/ipxe/src/bin/spi_bit.o $ROOTDIR/payloads/ipxe/src/bin/arbel.o $ROOTDIR/payloads/ipxe/src/bin/hermon.o $ROOTDIR/payloads/ipxe/src/bin/linda.o $ROOTDIR/payloads/ipxe/src/bin/linda_fw.o $ROOTDIR/payloads/ipxe/src/bin/qib7322.o $ROOTDIR/payloads/ipxe/src/bin/efi_bofm.o $ROOTDIR/payloads/ipxe/src/bin/efi_console.o $ROOTDIR/payloads/ipxe/src/bin/efi_debug.o $ROOTDIR/payloads/ipxe/src/bin/efi_download.o $ROOTDIR/payloads/ipxe/src/bin/efi_driver.o $ROOTDIR/payloads/ipxe/src/bin/efi_file.o $ROOTDIR/payloads/ipxe/src/bin/efi_hii.o $ROOTDIR/payloads/ipxe/src/bin/efi_init.o $ROOTDIR/payloads/ipxe/src/bin/efi_pci.o $ROOTDIR/payloads/ipxe/src/bin/efi_reboot.o $ROOTDIR/payloads/ipxe/src/bin/efi_smbios.o $ROOTDIR/payloads/ipxe/src/bin/efi_snp.o $ROOTDIR/payloads/ipxe/src/bin/efi_snp_hii.o $ROOTDIR/payloads/ipxe/src/bin/efi_strings.o $ROOTDIR/payloads/ipxe/src/bin/efi_timer.o $ROOTDIR/payloads/ipxe/src/bin/efi_uaccess.o $ROOTDIR/payloads/ipxe/src/bin/efi_umalloc.o $ROOTDIR/payloads/ipxe/src/bin/smbios.o $ROOTDIR/payloads/ipxe/src/bin/smbios_settings.o $ROOTDIR/payloads/ipxe/src/bin/bofm.o $ROOTDIR/payloads/ipxe/src/bin/aes_cbc_test.o $ROOTDIR/payloads/ipxe/src/bin/base16_test.o $ROOTDIR/payloads/ipxe/src/bin/base64_test.o $ROOTDIR/payloads/ipxe/src/bin/bigint_test.o $ROOTDIR/payloads/ipxe/src/bin/bofm_test.o $ROOTDIR/payloads/ipxe/src/bin/byteswap_test.o $ROOTDIR/payloads/ipxe/src/bin/cbc_test.o $ROOTDIR/payloads/ipxe/src/bin/cms_test.o $ROOTDIR/payloads/ipxe/src/bin/crc32_test.o $ROOTDIR/payloads/ipxe/src/bin/deflate_test.o $ROOTDIR/payloads/ipxe/src/bin/digest_test.o $ROOTDIR/payloads/ipxe/src/bin/dns_test.o $ROOTDIR/payloads/ipxe/src/bin/entropy_sample.o $ROOTDIR/payloads/ipxe/src/bin/hash_df_test.o $ROOTDIR/payloads/ipxe/src/bin/hmac_drbg_test.o $ROOTDIR/payloads/ipxe/src/bin/ipv6_test.o $ROOTDIR/payloads/ipxe/src/bin/linebuf_test.o $ROOTDIR/payloads/ipxe/src/bin/list_test.o $ROOTDIR/payloads/ipxe/src/bin/math_test.o $ROOTDIR/payloads/ipxe/src/bin/md5_test.o $ROOTDIR/payloads/ipxe/src/bin/memcpy_test.o $ROOTDIR/payloads/ipxe/src/bin/ocsp_test.o $ROOTDIR/payloads/ipxe/src/bin/pixbuf_test.o $ROOTDIR/payloads/ipxe/src/bin/png_test.o $ROOTDIR/payloads/ipxe/src/bin/pnm_test.o $ROOTDIR/payloads/ipxe/src/bin/profile_test.o $ROOTDIR/payloads/ipxe/src/bin/rsa_test.o $ROOTDIR/payloads/ipxe/src/bin/settings_test.o $ROOTDIR/payloads/ipxe/src/bin/sha1_test.o $ROOTDIR/payloads/ipxe/src/bin/sha256_test.o $ROOTDIR/payloads/ipxe/src/bin/string_test.o $ROOTDIR/payloads/ipxe/src/bin/tcpip_test.o $ROOTDIR/payloads/ipxe/src/bin/test.o $ROOTDIR/payloads/ipxe/src/bin/tests.o $ROOTDIR/payloads/ipxe/src/bin/time_test.o $ROOTDIR/payloads/ipxe/src/bin/umalloc_test.o $ROOTDIR/payloads/ipxe/src/bin/uri_test.o $ROOTDIR/payloads/ipxe/src/bin/vsprintf_test.o $ROOTDIR/payloads/ipxe/src/bin/x509_test.o $ROOTDIR/payloads/ipxe/src/bin/aes_wrap.o $ROOTDIR/payloads/ipxe/src/bin/arc4.o $ROOTDIR/payloads/ipxe/src/bin/asn1.o $ROOTDIR/payloads/ipxe/src/bin/axtls_aes.o $ROOTDIR/payloads/ipxe/src/bin/bigint.o $ROOTDIR/payloads/ipxe/src/bin/cbc.o $ROOTDIR/payloads/ipxe/src/bin/certstore.o $ROOTDIR/payloads/ipxe/src/bin/chap.o $ROOTDIR/payloads/ipxe/src/bin/cms.o $ROOTDIR/payloads/ipxe/src/bin/crc32.o $ROOTDIR/payloads/ipxe/src/bin/crypto_null.o $ROOTDIR/payloads/ipxe/src/bin/deflate.o $ROOTDIR/payloads/ipxe/src/bin/drbg.o $ROOTDIR/payloads/ipxe/src/bin/entropy.o $ROOTDIR/payloads/ipxe/src/bin/hash_df.o $ROOTDIR/payloads/ipxe/src/bin/hmac.o $ROOTDIR/payloads/ipxe/src/bin/hmac_drbg.o $ROOTDIR/payloads/ipxe/src/bin/md5.o $ROOTDIR/payloads/ipxe/src/bin/null_entropy.o $ROOTDIR/payloads/ipxe/src/bin/ocsp.o $ROOTDIR/payloads/ipxe/src/bin/privkey.o $ROOTDIR/payloads/ipxe/src/bin/random_nz.o $ROOTDIR/payloads/ipxe/src/bin/rbg.o $ROOTDIR/payloads/ipxe/src/bin/rootcert.o $ROOTDIR/payloads/ipxe/src/bin/rsa.o $ROOTDIR/payloads/ipxe/src/bin/sha1.o $ROOTDIR/payloads/ipxe/src/bin/sha1extra.o $ROOTDIR/payloads/ipxe/src/bin/sha256.o $ROOTDIR/payloads/ipxe/src/bin/x509.o $ROOTDIR/payloads/ipxe/src/bin/aes.o $ROOTDIR/payloads/ipxe/src/bin/editstring.o $ROOTDIR/payloads/ipxe/src/bin/linux_args.o $ROOTDIR/payloads/ipxe/src/bin/readline.o $ROOTDIR/payloads/ipxe/src/bin/shell.o $ROOTDIR/payloads/ipxe/src/bin/strerror.o $ROOTDIR/payloads/ipxe/src/bin/wireless_errors.o $ROOTDIR/payloads/ipxe/src/bin/autoboot_cmd.o $ROOTDIR/payloads/ipxe/src/bin/config_cmd.o $ROOTDIR/payloads/ipxe/src/bin/console_cmd.o $ROOTDIR/payloads/ipxe/src/bin/dhcp_cmd.o $ROOTDIR/payloads/ipxe/src/bin/digest_cmd.o $ROOTDIR/payloads/ipxe/src/bin/fcmgmt_cmd.o $ROOTDIR/payloads/ipxe/src/bin/gdbstub_cmd.o $ROOTDIR/payloads/ipxe/src/bin/ifmgmt_cmd.o $ROOTDIR/payloads/ipxe/src/bin/image_cmd.o $ROOTDIR/payloads/ipxe/src/bin/image_trust_cmd.o $ROOTDIR/payloads/ipxe/src/bin/ipstat_cmd.o $ROOTDIR/payloads/ipxe/src/bin/iwmgmt_cmd.o $ROOTDIR/payloads/ipxe/src/bin/login_cmd.o $ROOTDIR/payloads/ipxe/src/bin/lotest_cmd.o $ROOTDIR/payloads/ipxe/src/bin/menu_cmd.o $ROOTDIR/payloads/ipxe/src/bin/neighbour_cmd.o $ROOTDIR/payloads/ipxe/src/bin/nslookup_cmd.o $ROOTDIR/payloads/ipxe/src/bin/nvo_cmd.o $ROOTDIR/payloads/ipxe/src/bin/param_cmd.o $ROOTDIR/payloads/ipxe/src/bin/pci_cmd.o $ROOTDIR/payloads/ipxe/src/bin/ping_cmd.o $ROOTDIR/payloads/ipxe/src/bin/poweroff_cmd.o $ROOTDIR/payloads/ipxe/src/bin/profstat_cmd.o $ROOTDIR/payloads/ipxe/src/bin/reboot_cmd.o $ROOTDIR/payloads/ipxe/src/bin/route_cmd.o $ROOTDIR/payloads/ipxe/src/bin/sanboot_cmd.o $ROOTDIR/payloads/ipxe/src/bin/sync_cmd.o $ROOTDIR/payloads/ipxe/src/bin/time_cmd.o $ROOTDIR/payloads/ipxe/src/bin/vlan_cmd.o $ROOTDIR/payloads/ipxe/src/bin/login_ui.o $ROOTDIR/payloads/ipxe/src/bin/menu_ui.o $ROOTDIR/payloads/ipxe/src/bin/settings_ui.o $ROOTDIR/payloads/ipxe/src/bin/alert.o $ROOTDIR/payloads/ipxe/src/bin/ansi_screen.o $ROOTDIR/payloads/ipxe/src/bin/clear.o $ROOTDIR/payloads/ipxe/src/bin/colour.o $ROOTDIR/payloads/ipxe/src/bin/edging.o $ROOTDIR/payloads/ipxe/src/bin/kb.o $ROOTDIR/payloads/ipxe/src/bin/mucurses.o $ROOTDIR/payloads/ipxe/src/bin/print.o $ROOTDIR/payloads/ipxe/src/bin/print_nadv.o $ROOTDIR/payloads/ipxe/src/bin/slk.o $ROOTDIR/payloads/ipxe/src/bin/winattrs.o $ROOTDIR/payloads/ipxe/src/bin/windows.o $ROOTDIR/payloads/ipxe/src/bin/wininit.o $ROOTDIR/payloads/ipxe/src/bin/editbox.o $ROOTDIR/payloads/ipxe/src/bin/keymap_al.o $ROOTDIR/payloads/ipxe/src/bin/keymap_az.o $ROOTDIR/payloads/ipxe/src/bin/keymap_bg.o $ROOTDIR/payloads/ipxe/src/bin/keymap_by.o $ROOTDIR/payloads/ipxe/src/bin/keymap_cf.o $ROOTDIR/payloads/ipxe/src/bin/keymap_cz.o $ROOTDIR/payloads/ipxe/src/bin/keymap_de.o $ROOTDIR/payloads/ipxe/src/bin/keymap_dk.o $ROOTDIR/payloads/ipxe/src/bin/keymap_es.o $ROOTDIR/payloads/ipxe/src/bin/keymap_et.o $ROOTDIR/payloads/ipxe/src/bin/keymap_fi.o $ROOTDIR/payloads/ipxe/src/bin/keymap_fr.o $ROOTDIR/payloads/ipxe/src/bin/keymap_gr.o $ROOTDIR/payloads/ipxe/src/bin/keymap_hu.o $ROOTDIR/payloads/ipxe/src/bin/keymap_il.o $ROOTDIR/payloads/ipxe/src/bin/keymap_it.o $ROOTDIR/payloads/ipxe/src/bin/keymap_lt.o $ROOTDIR/payloads/ipxe/src/bin/keymap_mk.o $ROOTDIR/payloads/ipxe/src/bin/keymap_mt.o $ROOTDIR/payloads/ipxe/src/bin/keymap_nl.o $ROOTDIR/payloads/ipxe/src/bin/keymap_no.o $ROOTDIR/payloads/ipxe/src/bin/keymap_no-latin1.o $ROOTDIR/payloads/ipxe/src/bin/keymap_pl.o $ROOTDIR/payloads/ipxe/src/bin/keymap_pt.o $ROOTDIR/payloads/ipxe/src/bin/keymap_ro.o $ROOTDIR/payloads/ipxe/src/bin/keymap_ru.o $ROOTDIR/payloads/ipxe/src/bin/keymap_sg.o $ROOTDIR/payloads/ipxe/src/bin/keymap_sr.o $ROOTDIR/payloads/ipxe/src/bin/keymap_th.o $ROOTDIR/payloads/ipxe/src/bin/keymap_ua.o $ROOTDIR/payloads/ipxe/src/bin/keymap_uk.o $ROOTDIR/payloads/ipxe/src/bin/keymap_us.o $ROOTDIR/payloads/ipxe/src/bin/keymap_wo.o $ROOTDIR/payloads/ipxe/src/bin/autoboot.o $ROOTDIR/payloads/ipxe/src/bin/dhcpmgmt.o $ROOTDIR/payloads/ipxe/src/bin/fcmgmt.o $ROOTDIR/payloads/ipxe/src/bin/ifmgmt.o $ROOTDIR/payloads/ipxe/src/bin/imgmgmt.o $ROOTDIR/payloads/ipxe/src/bin/imgtrust.o $ROOTDIR/payloads/ipxe/src/bin/ipstat.o $ROOTDIR/payloads/ipxe/src/bin/iwmgmt.o $ROOTDIR/payloads/ipxe/src/bin/lotest.o $ROOTDIR/payloads/ipxe/src/bin/neighmgmt.o $ROOTDIR/payloads/ipxe/src/bin/nslookup.o $ROOTDIR/payloads/ipxe/src/bin/pingmgmt.o $ROOTDIR/payloads/ipxe/src/bin/profstat.o $ROOTDIR/payloads/ipxe/src/bin/prompt.o $ROOTDIR/payloads/ipxe/src/bin/pxemenu.o $ROOTDIR/payloads/ipxe/src/bin/route.o $ROOTDIR/payloads/ipxe/src/bin/route_ipv4.o $ROOTDIR/payloads/ipxe/src/bin/route_ipv6.o $ROOTDIR/payloads/ipxe/src/bin/sync.o $ROOTDIR/payloads/ipxe/src/bin/config.o $ROOTDIR/payloads/ipxe/src/bin/config_ethernet.o $ROOTDIR/payloads/ipxe/src/bin/config_fc.o $ROOTDIR/payloads/ipxe/src/bin/config_infiniband.o $ROOTDIR/payloads/ipxe/src/bin/config_net80211.o $ROOTDIR/payloads/ipxe/src/bin/config_romprefix.o $ROOTDIR/payloads/ipxe/src/bin/config_route.o $ROOTDIR/payloads/ipxe/src/bin/basemem_packet.o $ROOTDIR/payloads/ipxe/src/bin/cachedhcp.o $ROOTDIR/payloads/ipxe/src/bin/dumpregs.o $ROOTDIR/payloads/ipxe/src/bin/gdbmach.o $ROOTDIR/payloads/ipxe/src/bin/nulltrap.o $ROOTDIR/payloads/ipxe/src/bin/pci_autoboot.o $ROOTDIR/payloads/ipxe/src/bin/pic8259.o $ROOTDIR/payloads/ipxe/src/bin/rdtsc_timer.o $ROOTDIR/payloads/ipxe/src/bin/relocate.o $ROOTDIR/payloads/ipxe/src/bin/runtime.o $ROOTDIR/payloads/ipxe/src/bin/timer2.o $ROOTDIR/payloads/ipxe/src/bin/video_subr.o $ROOTDIR/payloads/ipxe/src/bin/librm_mgmt.o $ROOTDIR/payloads/ipxe/src/bin/librm_test.o $ROOTDIR/payloads/ipxe/src/bin/basemem.o $ROOTDIR/payloads/ipxe/src/bin/bios_console.o $ROOTDIR/payloads/ipxe/src/bin/fakee820.o $ROOTDIR/payloads/ipxe/src/bin/hidemem.o $ROOTDIR/payloads/ipxe/src/bin/memmap.o $ROOTDIR/payloads/ipxe/src/bin/pnpbios.o $ROOTDIR/payloads/ipxe/src/bin/bootsector.o $ROOTDIR/payloads/ipxe/src/bin/bzimage.o $ROOTDIR/payloads/ipxe/src/bin/com32.o $ROOTDIR/payloads/ipxe/src/bin/comboot.o $ROOTDIR/payloads/ipxe/src/bin/elfboot.o $ROOTDIR/payloads/ipxe/src/bin/initrd.o $ROOTDIR/payloads/ipxe/src/bin/multiboot.o $ROOTDIR/payloads/ipxe/src/bin/nbi.o $ROOTDIR/payloads/ipxe/src/bin/pxe_image.o $ROOTDIR/payloads/ipxe/src/bin/sdi.o $ROOTDIR/payloads/ipxe/src/bin/apm.o $ROOTDIR/payloads/ipxe/src/bin/biosint.o $ROOTDIR/payloads/ipxe/src/bin/bios_nap.o $ROOTDIR/payloads/ipxe/src/bin/bios_reboot.o $ROOTDIR/payloads/ipxe/src/bin/bios_smbios.o $ROOTDIR/payloads/ipxe/src/bin/bios_timer.o $ROOTDIR/payloads/ipxe/src/bin/int13.o $ROOTDIR/payloads/ipxe/src/bin/memtop_umalloc.o $ROOTDIR/payloads/ipxe/src/bin/pcibios.o $ROOTDIR/payloads/ipxe/src/bin/rtc_entropy.o $ROOTDIR/payloads/ipxe/src/bin/rtc_time.o $ROOTDIR/payloads/ipxe/src/bin/vesafb.o $ROOTDIR/payloads/ipxe/src/bin/pxe_call.o $ROOTDIR/payloads/ipxe/src/bin/pxe_exit_hook.o $ROOTDIR/payloads/ipxe/src/bin/pxe_file.o $ROOTDIR/payloads/ipxe/src/bin/pxe_loader.o $ROOTDIR/payloads/ipxe/src/bin/pxe_preboot.o $ROOTDIR/payloads/ipxe/src/bin/pxe_tftp.o $ROOTDIR/payloads/ipxe/src/bin/pxe_udp.o $ROOTDIR/payloads/ipxe/src/bin/pxe_undi.o $ROOTDIR/payloads/ipxe/src/bin/pxeparent.o $ROOTDIR/payloads/ipxe/src/bin/com32_call.o $ROOTDIR/payloads/ipxe/src/bin/comboot_call.o $ROOTDIR/payloads/ipxe/src/bin/comboot_resolv.o $ROOTDIR/payloads/ipxe/src/bin/guestinfo.o $ROOTDIR/payloads/ipxe/src/bin/guestrpc.o $ROOTDIR/payloads/ipxe/src/bin/vmconsole.o $ROOTDIR/payloads/ipxe/src/bin/vmware.o $ROOTDIR/payloads/ipxe/src/bin/pxe_cmd.o $ROOTDIR/payloads/ipxe/src/bin/cpuid.o $ROOTDIR/payloads/ipxe/src/bin/cpuid_settings.o $ROOTDIR/payloads/ipxe/src/bin/debugcon.o $ROOTDIR/payloads/ipxe/src/bin/pcidirect.o $ROOTDIR/payloads/ipxe/src/bin/x86_bigint.o $ROOTDIR/payloads/ipxe/src/bin/x86_io.o $ROOTDIR/payloads/ipxe/src/bin/x86_string.o $ROOTDIR/payloads/ipxe/src/bin/x86_tcpip.o $ROOTDIR/payloads/ipxe/src/bin/efix86_nap.o $ROOTDIR/payloads/ipxe/src/bin/efidrvprefix.o $ROOTDIR/payloads/ipxe/src/bin/efiprefix.o $ROOTDIR/payloads/ipxe/src/bin/cpuid_cmd.o $ROOTDIR/payloads/ipxe/src/bin/undi.o $ROOTDIR/payloads/ipxe/src/bin/undiload.o $ROOTDIR/payloads/ipxe/src/bin/undinet.o $ROOTDIR/payloads/ipxe/src/bin/undionly.o $ROOTDIR/payloads/ipxe/src/bin/undipreload.o $ROOTDIR/payloads/ipxe/src/bin/undirom.o $ROOTDIR/payloads/ipxe/src/bin/gdbstub_test.o $ROOTDIR/payloads/ipxe/src/bin/gdbidt.o $ROOTDIR/payloads/ipxe/src/bin/patch_cf.o $ROOTDIR/payloads/ipxe/src/bin/setjmp.o $ROOTDIR/payloads/ipxe/src/bin/stack16.o $ROOTDIR/payloads/ipxe/src/bin/stack.o $ROOTDIR/payloads/ipxe/src/bin/virtaddr.o $ROOTDIR/payloads/ipxe/src/bin/liba20.o $ROOTDIR/payloads/ipxe/src/bin/libkir.o $ROOTDIR/payloads/ipxe/src/bin/libpm.o $ROOTDIR/payloads/ipxe/src/bin/librm.o $ROOTDIR/payloads/ipxe/src/bin/bootpart.o $ROOTDIR/payloads/ipxe/src/bin/dskprefix.o $ROOTDIR/payloads/ipxe/src/bin/exeprefix.o $ROOTDIR/payloads/ipxe/src/bin/hdprefix.o $ROOTDIR/payloads/ipxe/src/bin/kkkpxeprefix.o $ROOTDIR/payloads/ipxe/src/bin/kkpxeprefix.o $ROOTDIR/payloads/ipxe/src/bin/kpxeprefix.o $ROOTDIR/payloads/ipxe/src/bin/libprefix.o $ROOTDIR/payloads/ipxe/src/bin/lkrnprefix.o $ROOTDIR/payloads/ipxe/src/bin/mbr.o $ROOTDIR/payloads/ipxe/src/bin/mromprefix.o $ROOTDIR/payloads/ipxe/src/bin/nbiprefix.o $ROOTDIR/payloads/ipxe/src/bin/nullprefix.o $ROOTDIR/payloads/ipxe/src/bin/pxeprefix.o $ROOTDIR/payloads/ipxe/src/bin/romprefix.o $ROOTDIR/payloads/ipxe/src/bin/undiloader.o $ROOTDIR/payloads/ipxe/src/bin/unnrv2b16.o $ROOTDIR/payloads/ipxe/src/bin/unnrv2b.o $ROOTDIR/payloads/ipxe/src/bin/usbdisk.o $ROOTDIR/payloads/ipxe/src/bin/e820mangler.o $ROOTDIR/payloads/ipxe/src/bin/pxe_entry.o $ROOTDIR/payloads/ipxe/src/bin/com32_wrapper.o $ROOTDIR/payloads/ipxe/src/bin/undiisr.o
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-ar r $ROOTDIR/payloads/ipxe/src/bin/blib.a  $ROOTDIR/payloads/ipxe/src/bin/__divdi3.o $ROOTDIR/payloads/ipxe/src/bin/icc.o $ROOTDIR/payloads/ipxe/src/bin/memcpy.o $ROOTDIR/payloads/ipxe/src/bin/__moddi3.o $ROOTDIR/payloads/ipxe/src/bin/__udivdi3.o $ROOTDIR/payloads/ipxe/src/bin/__udivmoddi4.o $ROOTDIR/payloads/ipxe/src/bin/__umoddi3.o $ROOTDIR/payloads/ipxe/src/bin/acpi.o $ROOTDIR/payloads/ipxe/src/bin/ansicol.o $ROOTDIR/payloads/ipxe/src/bin/ansicoldef.o $ROOTDIR/payloads/ipxe/src/bin/ansiesc.o $ROOTDIR/payloads/ipxe/src/bin/asprintf.o $ROOTDIR/payloads/ipxe/src/bin/assert.o $ROOTDIR/payloads/ipxe/src/bin/base16.o $ROOTDIR/payloads/ipxe/src/bin/base64.o $ROOTDIR/payloads/ipxe/src/bin/basename.o $ROOTDIR/payloads/ipxe/src/bin/bitmap.o $ROOTDIR/payloads/ipxe/src/bin/blockdev.o $ROOTDIR/payloads/ipxe/src/bin/console.o $ROOTDIR/payloads/ipxe/src/bin/cpio.o $ROOTDIR/payloads/ipxe/src/bin/ctype.o $ROOTDIR/payloads/ipxe/src/bin/cwuri.o $ROOTDIR/payloads/ipxe/src/bin/debug.o $ROOTDIR/payloads/ipxe/src/bin/debug_md5.o $ROOTDIR/payloads/ipxe/src/bin/device.o $ROOTDIR/payloads/ipxe/src/bin/downloader.o $ROOTDIR/payloads/ipxe/src/bin/downloader_bench.o $ROOTDIR/payloads/ipxe/src/bin/downloader_server.o $ROOTDIR/payloads/ipxe/src/bin/downloader_test.o $ROOTDIR/payloads/ipxe/src/bin/edd.o $ROOTDIR/payloads/ipxe/src/bin/errno.o $ROOTDIR/payloads/ipxe/src/bin/exec.o $ROOTDIR/payloads/ipxe/src/bin/fbcon.o $ROOTDIR/payloads/ipxe/src/bin/fnrec.o $ROOTDIR/payloads/ipxe/src/bin/gdbserial.o $ROOTDIR/payloads/ipxe/src/bin/gdbstub.o $ROOTDIR/payloads/ipxe/src/bin/gdbudp.o $ROOTDIR/payloads/ipxe/src/bin/getkey.o $ROOTDIR/payloads/ipxe/src/bin/getopt.o $ROOTDIR/payloads/ipxe/src/bin/hw.o $ROOTDIR/payloads/ipxe/src/bin/i82365.o $ROOTDIR/payloads/ipxe/src/bin/image.o $ROOTDIR/payloads/ipxe/src/bin/init.o $ROOTDIR/payloads/ipxe/src/bin/interface.o $ROOTDIR/payloads/ipxe/src/bin/iobuf.o $ROOTDIR/payloads/ipxe/src/bin/isqrt.o $ROOTDIR/payloads/ipxe/src/bin/job.o $ROOTDIR/payloads/ipxe/src/bin/linebuf.o $ROOTDIR/payloads/ipxe/src/bin/lineconsole.o $ROOTDIR/payloads/ipxe/src/bin/list.o $ROOTDIR/payloads/ipxe/src/bin/log.o $ROOTDIR/payloads/ipxe/src/bin/main.o $ROOTDIR/payloads/ipxe/src/bin/malloc.o $ROOTDIR/payloads/ipxe/src/bin/memblock.o $ROOTDIR/payloads/ipxe/src/bin/memmap_settings.o $ROOTDIR/payloads/ipxe/src/bin/menu.o $ROOTDIR/payloads/ipxe/src/bin/misc.o $ROOTDIR/payloads/ipxe/src/bin/monojob.o $ROOTDIR/payloads/ipxe/src/bin/null_nap.o $ROOTDIR/payloads/ipxe/src/bin/null_reboot.o $ROOTDIR/payloads/ipxe/src/bin/null_sanboot.o $ROOTDIR/payloads/ipxe/src/bin/null_time.o $ROOTDIR/payloads/ipxe/src/bin/nvo.o $ROOTDIR/payloads/ipxe/src/bin/open.o $ROOTDIR/payloads/ipxe/src/bin/params.o $ROOTDIR/payloads/ipxe/src/bin/parseopt.o $ROOTDIR/payloads/ipxe/src/bin/pc_kbd.o $ROOTDIR/payloads/ipxe/src/bin/pcmcia.o $ROOTDIR/payloads/ipxe/src/bin/pending.o $ROOTDIR/payloads/ipxe/src/bin/pinger.o $ROOTDIR/payloads/ipxe/src/bin/pixbuf.o $ROOTDIR/payloads/ipxe/src/bin/posix_io.o $ROOTDIR/payloads/ipxe/src/bin/process.o $ROOTDIR/payloads/ipxe/src/bin/profile.o $ROOTDIR/payloads/ipxe/src/bin/random.o $ROOTDIR/payloads/ipxe/src/bin/refcnt.o $ROOTDIR/payloads/ipxe/src/bin/resolv.o $ROOTDIR/payloads/ipxe/src/bin/serial.o $ROOTDIR/payloads/ipxe/src/bin/serial_console.o $ROOTDIR/payloads/ipxe/src/bin/settings.o $ROOTDIR/payloads/ipxe/src/bin/string.o $ROOTDIR/payloads/ipxe/src/bin/stringextra.o $ROOTDIR/payloads/ipxe/src/bin/strtoull.o $ROOTDIR/payloads/ipxe/src/bin/time.o $ROOTDIR/payloads/ipxe/src/bin/timer.o $ROOTDIR/payloads/ipxe/src/bin/uri.o $ROOTDIR/payloads/ipxe/src/bin/uuid.o $ROOTDIR/payloads/ipxe/src/bin/version.o $ROOTDIR/payloads/ipxe/src/bin/vsprintf.o $ROOTDIR/payloads/ipxe/src/bin/wchar.o $ROOTDIR/payloads/ipxe/src/bin/xferbuf.o $ROOTDIR/payloads/ipxe/src/bin/xfer.o $ROOTDIR/payloads/ipxe/src/bin/aoe.o $ROOTDIR/payloads/ipxe/src/bin/arp.o $ROOTDIR/payloads/ipxe/src/bin/dhcpopts.o $ROOTDIR/payloads/ipxe/src/bin/dhcppkt.o $ROOTDIR/payloads/ipxe/src/bin/eapol.o $ROOTDIR/payloads/ipxe/src/bin/ethernet.o $ROOTDIR/payloads/ipxe/src/bin/eth_slow.o $ROOTDIR/payloads/ipxe/src/bin/fakedhcp.o $ROOTDIR/payloads/ipxe/src/bin/fc.o $ROOTDIR/payloads/ipxe/src/bin/fcels.o $ROOTDIR/payloads/ipxe/src/bin/fcns.o $ROOTDIR/payloads/ipxe/src/bin/fcoe.o $ROOTDIR/payloads/ipxe/src/bin/fcp.o $ROOTDIR/payloads/ipxe/src/bin/fragment.o $ROOTDIR/payloads/ipxe/src/bin/icmp.o $ROOTDIR/payloads/ipxe/src/bin/icmpv4.o $ROOTDIR/payloads/ipxe/src/bin/icmpv6.o $ROOTDIR/payloads/ipxe/src/bin/infiniband.o $ROOTDIR/payloads/ipxe/src/bin/iobpad.o $ROOTDIR/payloads/ipxe/src/bin/ipv4.o $ROOTDIR/payloads/ipxe/src/bin/ipv6.o $ROOTDIR/payloads/ipxe/src/bin/ndp.o $ROOTDIR/payloads/ipxe/src/bin/neighbour.o $ROOTDIR/payloads/ipxe/src/bin/netdevice.o $ROOTDIR/payloads/ipxe/src/bin/netdev_settings.o $ROOTDIR/payloads/ipxe/src/bin/nullnet.o $ROOTDIR/payloads/ipxe/src/bin/ping.o $ROOTDIR/payloads/ipxe/src/bin/rarp.o $ROOTDIR/payloads/ipxe/src/bin/retry.o $ROOTDIR/payloads/ipxe/src/bin/socket.o $ROOTDIR/payloads/ipxe/src/bin/tcp.o $ROOTDIR/payloads/ipxe/src/bin/tcpip.o $ROOTDIR/payloads/ipxe/src/bin/tls.o $ROOTDIR/payloads/ipxe/src/bin/udp.o $ROOTDIR/payloads/ipxe/src/bin/validator.o $ROOTDIR/payloads/ipxe/src/bin/vlan.o $ROOTDIR/payloads/ipxe/src/bin/mount.o $ROOTDIR/payloads/ipxe/src/bin/nfs.o $ROOTDIR/payloads/ipxe/src/bin/nfs_open.o $ROOTDIR/payloads/ipxe/src/bin/nfs_uri.o $ROOTDIR/payloads/ipxe/src/bin/oncrpc_iob.o $ROOTDIR/payloads/ipxe/src/bin/portmap.o $ROOTDIR/payloads/ipxe/src/bin/ftp.o $ROOTDIR/payloads/ipxe/src/bin/http.o $ROOTDIR/payloads/ipxe/src/bin/httpcore.o $ROOTDIR/payloads/ipxe/src/bin/https.o $ROOTDIR/payloads/ipxe/src/bin/iscsi.o $ROOTDIR/payloads/ipxe/src/bin/oncrpc.o $ROOTDIR/payloads/ipxe/src/bin/syslogs.o $ROOTDIR/payloads/ipxe/src/bin/dhcp.o $ROOTDIR/payloads/ipxe/src/bin/dhcpv6.o $ROOTDIR/payloads/ipxe/src/bin/dns.o $ROOTDIR/payloads/ipxe/src/bin/slam.o $ROOTDIR/payloads/ipxe/src/bin/syslog.o $ROOTDIR/payloads/ipxe/src/bin/tftp.o $ROOTDIR/payloads/ipxe/src/bin/ib_cm.o $ROOTDIR/payloads/ipxe/src/bin/ib_cmrc.o $ROOTDIR/payloads/ipxe/src/bin/ib_mcast.o $ROOTDIR/payloads/ipxe/src/bin/ib_mi.o $ROOTDIR/payloads/ipxe/src/bin/ib_packet.o $ROOTDIR/payloads/ipxe/src/bin/ib_pathrec.o $ROOTDIR/payloads/ipxe/src/bin/ib_sma.o $ROOTDIR/payloads/ipxe/src/bin/ib_smc.o $ROOTDIR/payloads/ipxe/src/bin/ib_srp.o $ROOTDIR/payloads/ipxe/src/bin/net80211.o $ROOTDIR/payloads/ipxe/src/bin/rc80211.o $ROOTDIR/payloads/ipxe/src/bin/sec80211.o $ROOTDIR/payloads/ipxe/src/bin/wep.o $ROOTDIR/payloads/ipxe/src/bin/wpa.o $ROOTDIR/payloads/ipxe/src/bin/wpa_ccmp.o $ROOTDIR/payloads/ipxe/src/bin/wpa_psk.o $ROOTDIR/payloads/ipxe/src/bin/wpa_tkip.o $ROOTDIR/payloads/ipxe/src/bin/efi_image.o $ROOTDIR/payloads/ipxe/src/bin/elf.o $ROOTDIR/payloads/ipxe/src/bin/embedded.o $ROOTDIR/payloads/ipxe/src/bin/png.o $ROOTDIR/payloads/ipxe/src/bin/pnm.o $ROOTDIR/payloads/ipxe/src/bin/script.o $ROOTDIR/payloads/ipxe/src/bin/segment.o $ROOTDIR/payloads/ipxe/src/bin/eisa.o $ROOTDIR/payloads/ipxe/src/bin/isa.o $ROOTDIR/payloads/ipxe/src/bin/isa_ids.o $ROOTDIR/payloads/ipxe/src/bin/isapnp.o $ROOTDIR/payloads/ipxe/src/bin/mca.o $ROOTDIR/payloads/ipxe/src/bin/pcibackup.o $ROOTDIR/payloads/ipxe/src/bin/pci.o $ROOTDIR/payloads/ipxe/src/bin/pciextra.o $ROOTDIR/payloads/ipxe/src/bin/pci_settings.o $ROOTDIR/payloads/ipxe/src/bin/pcivpd.o $ROOTDIR/payloads/ipxe/src/bin/virtio-pci.o $ROOTDIR/payloads/ipxe/src/bin/virtio-ring.o $ROOTDIR/payloads/ipxe/src/bin/3c503.o $ROOTDIR/payloads/ipxe/src/bin/3c509.o $ROOTDIR/payloads/ipxe/src/bin/3c509-eisa.o $ROOTDIR/payloads/ipxe/src/bin/3c515.o $ROOTDIR/payloads/ipxe/src/bin/3c529.o $ROOTDIR/payloads/ipxe/src/bin/3c595.o $ROOTDIR/payloads/ipxe/src/bin/3c5x9.o $ROOTDIR/payloads/ipxe/src/bin/3c90x.o $ROOTDIR/payloads/ipxe/src/bin/amd8111e.o $ROOTDIR/payloads/ipxe/src/bin/atl1e.o $ROOTDIR/payloads/ipxe/src/bin/b44.o $ROOTDIR/payloads/ipxe/src/bin/bnx2.o $ROOTDIR/payloads/ipxe/src/bin/cs89x0.o $ROOTDIR/payloads/ipxe/src/bin/davicom.o $ROOTDIR/payloads/ipxe/src/bin/depca.o $ROOTDIR/payloads/ipxe/src/bin/dmfe.o $ROOTDIR/payloads/ipxe/src/bin/eepro100.o $ROOTDIR/payloads/ipxe/src/bin/eepro.o $ROOTDIR/payloads/ipxe/src/bin/epic100.o $ROOTDIR/payloads/ipxe/src/bin/etherfabric.o $ROOTDIR/payloads/ipxe/src/bin/forcedeth.o $ROOTDIR/payloads/ipxe/src/bin/intel.o $ROOTDIR/payloads/ipxe/src/bin/intelx.o $ROOTDIR/payloads/ipxe/src/bin/ipoib.o $ROOTDIR/payloads/ipxe/src/bin/jme.o $ROOTDIR/payloads/ipxe/src/bin/legacy.o $ROOTDIR/payloads/ipxe/src/bin/mii.o $ROOTDIR/payloads/ipxe/src/bin/myri10ge.o $ROOTDIR/payloads/ipxe/src/bin/myson.o $ROOTDIR/payloads/ipxe/src/bin/natsemi.o $ROOTDIR/payloads/ipxe/src/bin/ne2k_isa.o $ROOTDIR/payloads/ipxe/src/bin/ne.o $ROOTDIR/payloads/ipxe/src/bin/ns8390.o $ROOTDIR/payloads/ipxe/src/bin/pcnet32.o $ROOTDIR/payloads/ipxe/src/bin/pnic.o $ROOTDIR/payloads/ipxe/src/bin/prism2_pci.o $ROOTDIR/payloads/ipxe/src/bin/prism2_plx.o $ROOTDIR/payloads/ipxe/src/bin/realtek.o $ROOTDIR/payloads/ipxe/src/bin/rhine.o $ROOTDIR/payloads/ipxe/src/bin/sis190.o $ROOTDIR/payloads/ipxe/src/bin/sis900.o $ROOTDIR/payloads/ipxe/src/bin/skeleton.o $ROOTDIR/payloads/ipxe/src/bin/skge.o $ROOTDIR/payloads/ipxe/src/bin/sky2.o $ROOTDIR/payloads/ipxe/src/bin/smc9000.o $ROOTDIR/payloads/ipxe/src/bin/sundance.o $ROOTDIR/payloads/ipxe/src/bin/tlan.o $ROOTDIR/payloads/ipxe/src/bin/tulip.o $ROOTDIR/payloads/ipxe/src/bin/velocity.o $ROOTDIR/payloads/ipxe/src/bin/virtio-net.o $ROOTDIR/payloads/ipxe/src/bin/vmxnet3.o $ROOTDIR/payloads/ipxe/src/bin/w89c840.o $ROOTDIR/payloads/ipxe/src/bin/wd.o $ROOTDIR/payloads/ipxe/src/bin/igbvf_main.o $ROOTDIR/payloads/ipxe/src/bin/igbvf_mbx.o $ROOTDIR/payloads/ipxe/src/bin/igbvf_vf.o $ROOTDIR/payloads/ipxe/src/bin/phantom.o $ROOTDIR/payloads/ipxe/src/bin/rtl8180.o $ROOTDIR/payloads/ipxe/src/bin/rtl8180_grf5101.o $ROOTDIR/payloads/ipxe/src/bin/rtl8180_max2820.o $ROOTDIR/payloads/ipxe/src/bin/rtl8180_sa2400.o $ROOTDIR/payloads/ipxe/src/bin/rtl8185.o $ROOTDIR/payloads/ipxe/src/bin/rtl8185_rtl8225.o $ROOTDIR/payloads/ipxe/src/bin/rtl818x.o $ROOTDIR/payloads/ipxe/src/bin/ath_hw.o $ROOTDIR/payloads/ipxe/src/bin/ath_key.o $ROOTDIR/payloads/ipxe/src/bin/ath_main.o $ROOTDIR/payloads/ipxe/src/bin/ath_regd.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_attach.o $ROOTDIR/payloads/ipxe/src/bin/ath5k.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_caps.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_desc.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_dma.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_eeprom.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_gpio.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_initvals.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_pcu.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_phy.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_qcu.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_reset.o $ROOTDIR/payloads/ipxe/src/bin/ath5k_rfkill.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ani.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ar5008_phy.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ar9002_calib.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ar9002_hw.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ar9002_mac.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ar9002_phy.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ar9003_calib.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ar9003_eeprom.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ar9003_hw.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ar9003_mac.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_ar9003_phy.o $ROOTDIR/payloads/ipxe/src/bin/ath9k.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_calib.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_common.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_eeprom_4k.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_eeprom_9287.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_eeprom.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_eeprom_def.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_hw.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_init.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_mac.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_main.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_recv.o $ROOTDIR/payloads/ipxe/src/bin/ath9k_xmit.o $ROOTDIR/payloads/ipxe/src/bin/vxge.o $ROOTDIR/payloads/ipxe/src/bin/vxge_config.o $ROOTDIR/payloads/ipxe/src/bin/vxge_main.o $ROOTDIR/payloads/ipxe/src/bin/vxge_traffic.o $ROOTDIR/payloads/ipxe/src/bin/snpnet.o $ROOTDIR/payloads/ipxe/src/bin/snponly.o $ROOTDIR/payloads/ipxe/src/bin/tg3.o $ROOTDIR/payloads/ipxe/src/bin/tg3_hw.o $ROOTDIR/payloads/ipxe/src/bin/tg3_phy.o $ROOTDIR/payloads/ipxe/src/bin/ata.o $ROOTDIR/payloads/ipxe/src/bin/ibft.o $ROOTDIR/payloads/ipxe/src/bin/scsi.o $ROOTDIR/payloads/ipxe/src/bin/srp.o $ROOTDIR/payloads/ipxe/src/bin/nvs.o $ROOTDIR/payloads/ipxe/src/bin/nvsvpd.o $ROOTDIR/payloads/ipxe/src/bin/spi.o $ROOTDIR/payloads/ipxe/src/bin/threewire.o $ROOTDIR/payloads/ipxe/src/bin/bitbash.o $ROOTDIR/payloads/ipxe/src/bin/i2c_bit.o $ROOTDIR/payloads/ipxe/src/bin/spi_bit.o $ROOTDIR/payloads/ipxe/src/bin/arbel.o $ROOTDIR/payloads/ipxe/src/bin/hermon.o $ROOTDIR/payloads/ipxe/src/bin/linda.o $ROOTDIR/payloads/ipxe/src/bin/linda_fw.o $ROOTDIR/payloads/ipxe/src/bin/qib7322.o $ROOTDIR/payloads/ipxe/src/bin/efi_bofm.o $ROOTDIR/payloads/ipxe/src/bin/efi_console.o $ROOTDIR/payloads/ipxe/src/bin/efi_debug.o $ROOTDIR/payloads/ipxe/src/bin/efi_download.o $ROOTDIR/payloads/ipxe/src/bin/efi_driver.o $ROOTDIR/payloads/ipxe/src/bin/efi_file.o $ROOTDIR/payloads/ipxe/src/bin/efi_hii.o $ROOTDIR/payloads/ipxe/src/bin/efi_init.o $ROOTDIR/payloads/ipxe/src/bin/efi_pci.o $ROOTDIR/payloads/ipxe/src/bin/efi_reboot.o $ROOTDIR/payloads/ipxe/src/bin/efi_smbios.o $ROOTDIR/payloads/ipxe/src/bin/efi_snp.o $ROOTDIR/payloads/ipxe/src/bin/efi_snp_hii.o $ROOTDIR/payloads/ipxe/src/bin/efi_strings.o $ROOTDIR/payloads/ipxe/src/bin/efi_timer.o $ROOTDIR/payloads/ipxe/src/bin/efi_uaccess.o $ROOTDIR/payloads/ipxe/src/bin/efi_umalloc.o $ROOTDIR/payloads/ipxe/src/bin/smbios.o $ROOTDIR/payloads/ipxe/src/bin/smbios_settings.o $ROOTDIR/payloads/ipxe/src/bin/bofm.o $ROOTDIR/payloads/ipxe/src/bin/aes_cbc_test.o $ROOTDIR/payloads/ipxe/src/bin/base16_test.o $ROOTDIR/payloads/ipxe/src/bin/base64_test.o $ROOTDIR/payloads/ipxe/src/bin/bigint_test.o $ROOTDIR/payloads/ipxe/src/bin/bofm_test.o $ROOTDIR/payloads/ipxe/src/bin/byteswap_test.o $ROOTDIR/payloads/ipxe/src/bin/cbc_test.o $ROOTDIR/payloads/ipxe/src/bin/cms_test.o $ROOTDIR/payloads/ipxe/src/bin/crc32_test.o $ROOTDIR/payloads/ipxe/src/bin/deflate_test.o $ROOTDIR/payloads/ipxe/src/bin/digest_test.o $ROOTDIR/payloads/ipxe/src/bin/dns_test.o $ROOTDIR/payloads/ipxe/src/bin/entropy_sample.o $ROOTDIR/payloads/ipxe/src/bin/hash_df_test.o $ROOTDIR/payloads/ipxe/src/bin/hmac_drbg_test.o $ROOTDIR/payloads/ipxe/src/bin/ipv6_test.o $ROOTDIR/payloads/ipxe/src/bin/linebuf_test.o $ROOTDIR/payloads/ipxe/src/bin/list_test.o $ROOTDIR/payloads/ipxe/src/bin/math_test.o $ROOTDIR/payloads/ipxe/src/bin/md5_test.o $ROOTDIR/payloads/ipxe/src/bin/memcpy_test.o $ROOTDIR/payloads/ipxe/src/bin/ocsp_test.o $ROOTDIR/payloads/ipxe/src/bin/pixbuf_test.o $ROOTDIR/payloads/ipxe/src/bin/png_test.o $ROOTDIR/payloads/ipxe/src/bin/pnm_test.o $ROOTDIR/payloads/ipxe/src/bin/profile_test.o $ROOTDIR/payloads/ipxe/src/bin/realtek_test.o $ROOTDIR/payloads/ipxe/src/bin/rsa_test.o $ROOTDIR/payloads/ipxe/src/bin/settings_test.o $ROOTDIR/payloads/ipxe/src/bin/sha1_test.o $ROOTDIR/payloads/ipxe/src/bin/sha256_test.o $ROOTDIR/payloads/ipxe/src/bin/string_test.o $ROOTDIR/payloads/ipxe/src/bin/tcp_test.o $ROOTDIR/payloads/ipxe/src/bin/tcpip_test.o $ROOTDIR/payloads/ipxe/src/bin/tftp_test.o $ROOTDIR/payloads/ipxe/src/bin/test.o $ROOTDIR/payloads/ipxe/src/bin/tests.o $ROOTDIR/payloads/ipxe/src/bin/time_test.o $ROOTDIR/payloads/ipxe/src/bin/umalloc_test.o $ROOTDIR/payloads/ipxe/src/bin/uri_test.o $ROOTDIR/payloads/ipxe/src/bin/vsprintf_test.o $ROOTDIR/payloads/ipxe/src/bin/x509_test.o $ROOTDIR/payloads/ipxe/src/bin/aes_wrap.o $ROOTDIR/payloads/ipxe/src/bin/arc4.o $ROOTDIR/payloads/ipxe/src/bin/asn1.o $ROOTDIR/payloads/ipxe/src/bin/axtls_aes.o $ROOTDIR/payloads/ipxe/src/bin/bigint.o $ROOTDIR/payloads/ipxe/src/bin/cbc.o $ROOTDIR/payloads/ipxe/src/bin/certstore.o $ROOTDIR/payloads/ipxe/src/bin/chap.o $ROOTDIR/payloads/ipxe/src/bin/cms.o $ROOTDIR/payloads/ipxe/src/bin/crc32.o $ROOTDIR/payloads/ipxe/src/bin/crypto_null.o $ROOTDIR/payloads/ipxe/src/bin/deflate.o $ROOTDIR/payloads/ipxe/src/bin/drbg.o $ROOTDIR/payloads/ipxe/src/bin/entropy.o $ROOTDIR/payloads/ipxe/src/bin/hash_df.o $ROOTDIR/payloads/ipxe/src/bin/hmac.o $ROOTDIR/payloads/ipxe/src/bin/hmac_drbg.o $ROOTDIR/payloads/ipxe/src/bin/md5.o $ROOTDIR/payloads/ipxe/src/bin/null_entropy.o $ROOTDIR/payloads/ipxe/src/bin/ocsp.o $ROOTDIR/payloads/ipxe/src/bin/privkey.o $ROOTDIR/payloads/ipxe/src/bin/random_nz.o $ROOTDIR/payloads/ipxe/src/bin/rbg.o $ROOTDIR/payloads/ipxe/src/bin/rootcert.o $ROOTDIR/payloads/ipxe/src/bin/rsa.o $ROOTDIR/payloads/ipxe/src/bin/sha1.o $ROOTDIR/payloads/ipxe/src/bin/sha1extra.o $ROOTDIR/payloads/ipxe/src/bin/sha256.o $ROOTDIR/payloads/ipxe/src/bin/x509.o $ROOTDIR/payloads/ipxe/src/bin/aes.o $ROOTDIR/payloads/ipxe/src/bin/editstring.o $ROOTDIR/payloads/ipxe/src/bin/linux_args.o $ROOTDIR/payloads/ipxe/src/bin/readline.o $ROOTDIR/payloads/ipxe/src/bin/shell.o $ROOTDIR/payloads/ipxe/src/bin/strerror.o $ROOTDIR/payloads/ipxe/src/bin/wireless_errors.o $ROOTDIR/payloads/ipxe/src/bin/autoboot_cmd.o $ROOTDIR/payloads/ipxe/src/bin/config_cmd.o $ROOTDIR/payloads/ipxe/src/bin/console_cmd.o $ROOTDIR/payloads/ipxe/src/bin/dhcp_cmd.o $ROOTDIR/payloads/ipxe/src/bin/digest_cmd.o $ROOTDIR/payloads/ipxe/src/bin/fcmgmt_cmd.o $ROOTDIR/payloads/ipxe/src/bin/gdbstub_cmd.o $ROOTDIR/payloads/ipxe/src/bin/ifmgmt_cmd.o $ROOTDIR/payloads/ipxe/src/bin/image_cmd.o $ROOTDIR/payloads/ipxe/src/bin/image_trust_cmd.o $ROOTDIR/payloads/ipxe/src/bin/ipstat_cmd.o $ROOTDIR/payloads/ipxe/src/bin/iwmgmt_cmd.o $ROOTDIR/payloads/ipxe/src/bin/login_cmd.o $ROOTDIR/payloads/ipxe/src/bin/lotest_cmd.o $ROOTDIR/payloads/ipxe/src/bin/menu_cmd.o $ROOTDIR/payloads/ipxe/src/bin/neighbour_cmd.o $ROOTDIR/payloads/ipxe/src/bin/nslookup_cmd.o $ROOTDIR/payloads/ipxe/src/bin/nvo_cmd.o $ROOTDIR/payloads/ipxe/src/bin/param_cmd.o $ROOTDIR/payloads/ipxe/src/bin/pci_cmd.o $ROOTDIR/payloads/ipxe/src/bin/ping_cmd.o $ROOTDIR/payloads/ipxe/src/bin/poweroff_cmd.o $ROOTDIR/payloads/ipxe/src/bin/profstat_cmd.o $ROOTDIR/payloads/ipxe/src/bin/reboot_cmd.o $ROOTDIR/payloads/ipxe/src/bin/route_cmd.o $ROOTDIR/payloads/ipxe/src/bin/sanboot_cmd.o $ROOTDIR/payloads/ipxe/src/bin/sync_cmd.o $ROOTDIR/payloads/ipxe/src/bin/time_cmd.o $ROOTDIR/payloads/ipxe/src/bin/vlan_cmd.o $ROOTDIR/payloads/ipxe/src/bin/login_ui.o $ROOTDIR/payloads/ipxe/src/bin/menu_ui.o $ROOTDIR/payloads/ipxe/src/bin/settings_ui.o $ROOTDIR/payloads/ipxe/src/bin/alert.o $ROOTDIR/payloads/ipxe/src/bin/ansi_screen.o $ROOTDIR/payloads/ipxe/src/bin/clear.o $ROOTDIR/payloads/ipxe/src/bin/colour.o $ROOTDIR/payloads/ipxe/src/bin/edging.o $ROOTDIR/payloads/ipxe/src/bin/kb.o $ROOTDIR/payloads/ipxe/src/bin/mucurses.o $ROOTDIR/payloads/ipxe/src/bin/print.o $ROOTDIR/payloads/ipxe/src/bin/print_nadv.o $ROOTDIR/payloads/ipxe/src/bin/slk.o $ROOTDIR/payloads/ipxe/src/bin/winattrs.o $ROOTDIR/payloads/ipxe/src/bin/windows.o $ROOTDIR/payloads/ipxe/src/bin/wininit.o $ROOTDIR/payloads/ipxe/src/bin/editbox.o $ROOTDIR/payloads/ipxe/src/bin/keymap_al.o $ROOTDIR/payloads/ipxe/src/bin/keymap_az.o $ROOTDIR/payloads/ipxe/src/bin/keymap_bg.o $ROOTDIR/payloads/ipxe/src/bin/keymap_by.o $ROOTDIR/payloads/ipxe/src/bin/keymap_cf.o $ROOTDIR/payloads/ipxe/src/bin/keymap_cz.o $ROOTDIR/payloads/ipxe/src/bin/keymap_de.o $ROOTDIR/payloads/ipxe/src/bin/keymap_dk.o $ROOTDIR/payloads/ipxe/src/bin/keymap_es.o $ROOTDIR/payloads/ipxe/src/bin/keymap_et.o $ROOTDIR/payloads/ipxe/src/bin/keymap_fi.o $ROOTDIR/payloads/ipxe/src/bin/keymap_fr.o $ROOTDIR/payloads/ipxe/src/bin/keymap_gr.o $ROOTDIR/payloads/ipxe/src/bin/keymap_hu.o $ROOTDIR/payloads/ipxe/src/bin/keymap_il.o $ROOTDIR/payloads/ipxe/src/bin/keymap_it.o $ROOTDIR/payloads/ipxe/src/bin/keymap_lt.o $ROOTDIR/payloads/ipxe/src/bin/keymap_mk.o $ROOTDIR/payloads/ipxe/src/bin/keymap_mt.o $ROOTDIR/payloads/ipxe/src/bin/keymap_nl.o $ROOTDIR/payloads/ipxe/src/bin/keymap_no.o $ROOTDIR/payloads/ipxe/src/bin/keymap_no-latin1.o $ROOTDIR/payloads/ipxe/src/bin/keymap_pl.o $ROOTDIR/payloads/ipxe/src/bin/keymap_pt.o $ROOTDIR/payloads/ipxe/src/bin/keymap_ro.o $ROOTDIR/payloads/ipxe/src/bin/keymap_ru.o $ROOTDIR/payloads/ipxe/src/bin/keymap_sg.o $ROOTDIR/payloads/ipxe/src/bin/keymap_sr.o $ROOTDIR/payloads/ipxe/src/bin/keymap_th.o $ROOTDIR/payloads/ipxe/src/bin/keymap_ua.o $ROOTDIR/payloads/ipxe/src/bin/keymap_uk.o $ROOTDIR/payloads/ipxe/src/bin/keymap_us.o $ROOTDIR/payloads/ipxe/src/bin/keymap_wo.o $ROOTDIR/payloads/ipxe/src/bin/autoboot.o $ROOTDIR/payloads/ipxe/src/bin/dhcpmgmt.o $ROOTDIR/payloads/ipxe/src/bin/fcmgmt.o $ROOTDIR/payloads/ipxe/src/bin/ifmgmt.o $ROOTDIR/payloads/ipxe/src/bin/imgmgmt.o $ROOTDIR/payloads/ipxe/src/bin/imgtrust.o $ROOTDIR/payloads/ipxe/src/bin/ipstat.o $ROOTDIR/payloads/ipxe/src/bin/iwmgmt.o $ROOTDIR/payloads/ipxe/src/bin/lotest.o $ROOTDIR/payloads/ipxe/src/bin/neighmgmt.o $ROOTDIR/payloads/ipxe/src/bin/nslookup.o $ROOTDIR/payloads/ipxe/src/bin/pingmgmt.o $ROOTDIR/payloads/ipxe/src/bin/profstat.o $ROOTDIR/payloads/ipxe/src/bin/prompt.o $ROOTDIR/payloads/ipxe/src/bin/pxemenu.o $ROOTDIR/payloads/ipxe/src/bin/route.o $ROOTDIR/payloads/ipxe/src/bin/route_ipv4.o $ROOTDIR/payloads/ipxe/src/bin/route_ipv6.o $ROOTDIR/payloads/ipxe/src/bin/sync.o $ROOTDIR/payloads/ipxe/src/bin/config.o $ROOTDIR/payloads/ipxe/src/bin/config_ethernet.o $ROOTDIR/payloads/ipxe/src/bin/config_fc.o $ROOTDIR/payloads/ipxe/src/bin/config_infiniband.o $ROOTDIR/payloads/ipxe/src/bin/config_net80211.o $ROOTDIR/payloads/ipxe/src/bin/config_romprefix.o $ROOTDIR/payloads/ipxe/src/bin/config_route.o $ROOTDIR/payloads/ipxe/src/bin/basemem_packet.o $ROOTDIR/payloads/ipxe/src/bin/cachedhcp.o $ROOTDIR/payloads/ipxe/src/bin/dumpregs.o $ROOTDIR/payloads/ipxe/src/bin/gdbmach.o $ROOTDIR/payloads/ipxe/src/bin/nulltrap.o $ROOTDIR/payloads/ipxe/src/bin/pci_autoboot.o $ROOTDIR/payloads/ipxe/src/bin/pic8259.o $ROOTDIR/payloads/ipxe/src/bin/rdtsc_timer.o $ROOTDIR/payloads/ipxe/src/bin/relocate.o $ROOTDIR/payloads/ipxe/src/bin/runtime.o $ROOTDIR/payloads/ipxe/src/bin/timer2.o $ROOTDIR/payloads/ipxe/src/bin/video_subr.o $ROOTDIR/payloads/ipxe/src/bin/librm_mgmt.o $ROOTDIR/payloads/ipxe/src/bin/librm_test.o $ROOTDIR/payloads/ipxe/src/bin/basemem.o $ROOTDIR/payloads/ipxe/src/bin/bios_console.o $ROOTDIR/payloads/ipxe/src/bin/fakee820.o $ROOTDIR/payloads/ipxe/src/bin/hidemem.o $ROOTDIR/payloads/ipxe/src/bin/memmap.o $ROOTDIR/payloads/ipxe/src/bin/pnpbios.o $ROOTDIR/payloads/ipxe/src/bin/bootsector.o $ROOTDIR/payloads/ipxe/src/bin/bzimage.o $ROOTDIR/payloads/ipxe/src/bin/com32.o $ROOTDIR/payloads/ipxe/src/bin/comboot.o $ROOTDIR/payloads/ipxe/src/bin/elfboot.o $ROOTDIR/payloads/ipxe/src/bin/initrd.o $ROOTDIR/payloads/ipxe/src/bin/multiboot.o $ROOTDIR/payloads/ipxe/src/bin/nbi.o $ROOTDIR/payloads/ipxe/src/bin/pxe_image.o $ROOTDIR/payloads/ipxe/src/bin/sdi.o $ROOTDIR/payloads/ipxe/src/bin/apm.o $ROOTDIR/payloads/ipxe/src/bin/biosint.o $ROOTDIR/payloads/ipxe/src/bin/bios_nap.o $ROOTDIR/payloads/ipxe/src/bin/bios_reboot.o $ROOTDIR/payloads/ipxe/src/bin/bios_smbios.o $ROOTDIR/payloads/ipxe/src/bin/bios_timer.o $ROOTDIR/payloads/ipxe/src/bin/int13.o $ROOTDIR/payloads/ipxe/src/bin/memtop_umalloc.o $ROOTDIR/payloads/ipxe/src/bin/pcibios.o $ROOTDIR/payloads/ipxe/src/bin/rtc_entropy.o $ROOTDIR/payloads/ipxe/src/bin/rtc_time.o $ROOTDIR/payloads/ipxe/src/bin/vesafb.o $ROOTDIR/payloads/ipxe/src/bin/pxe_call.o $ROOTDIR/payloads/ipxe/src/bin/pxe_exit_hook.o $ROOTDIR/payloads/ipxe/src/bin/pxe_file.o $ROOTDIR/payloads/ipxe/src/bin/pxe_loader.o $ROOTDIR/payloads/ipxe/src/bin/pxe_preboot.o $ROOTDIR/payloads/ipxe/src/bin/pxe_tftp.o $ROOTDIR/payloads/ipxe/src/bin/pxe_udp.o $ROOTDIR/payloads/ipxe/src/bin/pxe_undi.o $ROOTDIR/payloads/ipxe/src/bin/pxeparent.o $ROOTDIR/payloads/ipxe/src/bin/com32_call.o $ROOTDIR/payloads/ipxe/src/bin/comboot_call.o $ROOTDIR/payloads/ipxe/src/bin/comboot_resolv.o $ROOTDIR/payloads/ipxe/src/bin/guestinfo.o $ROOTDIR/payloads/ipxe/src/bin/guestrpc.o $ROOTDIR/payloads/ipxe/src/bin/vmconsole.o $ROOTDIR/payloads/ipxe/src/bin/vmware.o $ROOTDIR/payloads/ipxe/src/bin/pxe_cmd.o $ROOTDIR/payloads/ipxe/src/bin/cpuid.o $ROOTDIR/payloads/ipxe/src/bin/cpuid_settings.o $ROOTDIR/payloads/ipxe/src/bin/debugcon.o $ROOTDIR/payloads/ipxe/src/bin/pcidirect.o $ROOTDIR/payloads/ipxe/src/bin/x86_bigint.o $ROOTDIR/payloads/ipxe/src/bin/x86_io.o $ROOTDIR/payloads/ipxe/src/bin/x86_string.o $ROOTDIR/payloads/ipxe/src/bin/x86_tcpip.o $ROOTDIR/payloads/ipxe/src/bin/efix86_nap.o $ROOTDIR/payloads/ipxe/src/bin/efidrvprefix.o $ROOTDIR/payloads/ipxe/src/bin/efiprefix.o $ROOTDIR/payloads/ipxe/src/bin/cpuid_cmd.o $ROOTDIR/payloads/ipxe/src/bin/undi.o $ROOTDIR/payloads/ipxe/src/bin/undiload.o $ROOTDIR/payloads/ipxe/src/bin/undinet.o $ROOTDIR/payloads/ipxe/src/bin/undionly.o $ROOTDIR/payloads/ipxe/src/bin/undipreload.o $ROOTDIR/payloads/ipxe/src/bin/undirom.o $ROOTDIR/payloads/ipxe/src/bin/gdbstub_test.o $ROOTDIR/payloads/ipxe/src/bin/gdbidt.o $ROOTDIR/payloads/ipxe/src/bin/patch_cf.o $ROOTDIR/payloads/ipxe/src/bin/setjmp.o $ROOTDIR/payloads/ipxe/src/bin/stack16.o $ROOTDIR/payloads/ipxe/src/bin/stack.o $ROOTDIR/payloads/ipxe/src/bin/virtaddr.o $ROOTDIR/payloads/ipxe/src/bin/liba20.o $ROOTDIR/payloads/ipxe/src/bin/libkir.o $ROOTDIR/payloads/ipxe/src/bin/libpm.o $ROOTDIR/payloads/ipxe/src/bin/librm.o $ROOTDIR/payloads/ipxe/src/bin/bootpart.o $ROOTDIR/payloads/ipxe/src/bin/dskprefix.o $ROOTDIR/payloads/ipxe/src/bin/exeprefix.o $ROOTDIR/payloads/ipxe/src/bin/hdprefix.o $ROOTDIR/payloads/ipxe/src/bin/kkkpxeprefix.o $ROOTDIR/payloads/ipxe/src/bin/kkpxeprefix.o $ROOTDIR/payloads/ipxe/src/bin/kpxeprefix.o $ROOTDIR/payloads/ipxe/src/bin/libprefix.o $ROOTDIR/payloads/ipxe/src/bin/lkrnprefix.o $ROOTDIR/payloads/ipxe/src/bin/mbr.o $ROOTDIR/payloads/ipxe/src/bin/mromprefix.o $ROOTDIR/payloads/ipxe/src/bin/nbiprefix.o $ROOTDIR/payloads/ipxe/src/bin/nullprefix.o $ROOTDIR/payloads/ipxe/src/bin/pxeprefix.o $ROOTDIR/payloads/ipxe/src/bin/romprefix.o $ROOTDIR/payloads/ipxe/src/bin/undiloader.o $ROOTDIR/payloads/ipxe/src/bin/unnrv2b16.o $ROOTDIR/payloads/ipxe/src/bin/unnrv2b.o $ROOTDIR/payloads/ipxe/src/bin/usbdisk.o $ROOTDIR/payloads/ipxe/src/bin/e820mangler.o $ROOTDIR/payloads/ipxe/src/bin/pxe_entry.o $ROOTDIR/payloads/ipxe/src/bin/com32_wrapper.o $ROOTDIR/payloads/ipxe/src/bin/undiisr.o
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-ranlib $ROOTDIR/payloads/ipxe/src/bin/blib.a
 gcc  -Wall -W -Wformat-nonliteral -O2 -g -MMD -Werror -o util/zbin util/zbin.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-ld  -m elf_i386 -N --no-check-sections   --gc-sections -static -T arch/i386/scripts/i386.lds  -u _rom_start --defsym check__rom_start=_rom_start   -u obj_realtek --defsym check_obj_realtek=obj_realtek   -u obj_config --defsym check_obj_config=obj_config  --defsym pci_vendor_id=0x10ec --defsym pci_device_id=0x8168 -e _rom_start $ROOTDIR/payloads/ipxe/src/bin/blib.a -o $ROOTDIR/payloads/ipxe/src/bin/10ec8168.rom.tmp --defsym _build_id=`perl -e 'printf "0x%08x", int ( rand ( 0xffffffff ) );'` -Map $ROOTDIR/payloads/ipxe/src/bin/10ec8168.rom.tmp.map
@@ -1463,16 +1475,18 @@ pushd $ROOTDIR/payloads/sortbootorder/../libpayload > /dev/null
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-ar rc $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libcbfs.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/rom_media.libcbfs.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libcbfs/cbfs.libcbfs.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libcbfs/ram_media.libcbfs.o
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none  -MMD  -Iinclude -Iinclude/x86 -I$ROOTDIR/payloads/sortbootorder/libpayloadbin/build -D_LP64=0 -Icurses/PDCurses-3.4 -Icurses/pdcurses-backend -Icurses/menu -Icurses/form -Os -pipe -nostdinc -nostdlib -fno-builtin -ffreestanding -fomit-frame-pointer -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -c -o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/liblzma/lzma.liblzma.o liblzma/lzma.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-ar rc $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/liblzma.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/liblzma/lzma.liblzma.o
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none  -MMD  -Iinclude -Iinclude/x86 -I$ROOTDIR/payloads/sortbootorder/libpayloadbin/build -D_LP64=0 -Icurses/PDCurses-3.4 -Icurses/pdcurses-backend -Icurses/menu -Icurses/form -Os -pipe -nostdinc -nostdlib -fno-builtin -ffreestanding -fomit-frame-pointer -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -c -o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/liblz4/lz4.liblz4.o liblz4/lz4.c
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-ar rc $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/liblz4.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/liblz4/lz4.liblz4.o
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none  -MMD  -Iinclude -Iinclude/x86 -I$ROOTDIR/payloads/sortbootorder/libpayloadbin/build -D_LP64=0 -Icurses/PDCurses-3.4 -Icurses/pdcurses-backend -Icurses/menu -Icurses/form -Os -pipe -nostdinc -nostdlib -fno-builtin -ffreestanding -fomit-frame-pointer -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -c -o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libamd/gpio.libamd.o libamd/gpio.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none  -MMD  -Iinclude -Iinclude/x86 -I$ROOTDIR/payloads/sortbootorder/libpayloadbin/build -D_LP64=0 -Icurses/PDCurses-3.4 -Icurses/pdcurses-backend -Icurses/menu -Icurses/form -Os -pipe -nostdinc -nostdlib -fno-builtin -ffreestanding -fomit-frame-pointer -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -c -o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libamd/i2c.libamd.o libamd/i2c.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none  -MMD  -Iinclude -Iinclude/x86 -I$ROOTDIR/payloads/sortbootorder/libpayloadbin/build -D_LP64=0 -Icurses/PDCurses-3.4 -Icurses/pdcurses-backend -Icurses/menu -Icurses/form -Os -pipe -nostdinc -nostdlib -fno-builtin -ffreestanding -fomit-frame-pointer -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -c -o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libamd/pmreg.libamd.o libamd/pmreg.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none  -MMD  -Iinclude -Iinclude/x86 -I$ROOTDIR/payloads/sortbootorder/libpayloadbin/build -D_LP64=0 -Icurses/PDCurses-3.4 -Icurses/pdcurses-backend -Icurses/menu -Icurses/form -Os -pipe -nostdinc -nostdlib -fno-builtin -ffreestanding -fomit-frame-pointer -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -c -o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libamd/spi.libamd.o libamd/spi.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-ar rc $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libamd.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libamd/gpio.libamd.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libamd/i2c.libamd.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libamd/pmreg.libamd.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libamd/spi.libamd.o
-"$SAGE_HOME"/tools/xgcc/bin/i386-elf-ar rc $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libpayload.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libpci/libpci.libpci.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/main.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/sysinfo.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/timer.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/coreboot.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/util.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/exec.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/virtual.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/string.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/crypto/sha1.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/malloc.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/printf.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/console.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/string.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/memory.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/ctype.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/ipchecksum.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/lib.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/rand.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/time.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/exec.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/readline.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/getopt_long.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/sysinfo.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/args.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/strings.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/strlcpy.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/qsort.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/hexdump.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/pci.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/speaker.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/serial.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/keyboard.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/cbmem_console.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/nvram.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/options.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/video/video.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/video/vga.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/video/corebootfb.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/video/font8x16.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/storage/storage.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/storage/ahci.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/storage/ahci_common.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/storage/ata.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/storage/ahci_ata.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/storage/atapi.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/storage/ahci_atapi.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/usbinit.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/usb.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/usb_dev.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/quirks.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/generic_hub.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/usbhub.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/uhci.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/uhci_rh.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/ohci.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/ohci_rh.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/ehci.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/ehci_rh.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/xhci.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/xhci_debug.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/xhci_devconf.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/xhci_events.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/xhci_commands.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/xhci_rh.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/usbhid.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/usbmsc.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/hid.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/pdcurses-backend/pdcdisp.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/pdcurses-backend/pdcgetsc.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/pdcurses-backend/pdckbd.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/pdcurses-backend/pdcscrn.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/pdcurses-backend/pdcsetsc.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/pdcurses-backend/pdcutil.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/addch.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/move.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/overlay.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/refresh.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/terminfo.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/window.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/util.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/inopts.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/addstr.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/keyname.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/instr.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/clear.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/addchstr.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/kernel.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/pad.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/insstr.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/border.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/getyx.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/getstr.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/getch.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/termattr.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/outopts.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/color.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/deleteln.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/initscr.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/slk.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/delch.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/touch.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/mouse.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/scanw.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/scroll.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/printw.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/bkgd.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/inch.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/attr.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/insch.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/inchstr.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/beep.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_req_name.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_item_nam.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_pad.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_cursor.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_item_new.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_attribs.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_item_opt.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_format.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_post.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_userptr.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_item_cur.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_driver.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_sub.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_win.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_global.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_item_vis.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_new.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_scale.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_spacing.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_opts.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_pattern.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_item_val.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_hook.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_item_use.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_items.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_item_top.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_page.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_opts.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_def.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_req_name.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fty_alpha.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_driver.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_user.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_win.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_newftyp.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_stat.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_pad.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_current.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_post.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fty_generic.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_page.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_hook.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_scale.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fty_int.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fty_alnum.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_cursor.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_link.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_arg.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_move.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_def.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_type.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_max.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_ftlink.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_ftchoice.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_info.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_user.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_sub.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fty_enum.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_data.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_opts.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_attr.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_dup.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_just.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/panel.libpanel.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/rom_media.libcbfs.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libcbfs/cbfs.libcbfs.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libcbfs/ram_media.libcbfs.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/liblzma/lzma.liblzma.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libamd/gpio.libamd.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libamd/i2c.libamd.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libamd/pmreg.libamd.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libamd/spi.libamd.o
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-ar rc $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libpayload.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libpci/libpci.libpci.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/main.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/sysinfo.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/timer.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/coreboot.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/util.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/exec.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/virtual.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/string.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/crypto/sha1.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/malloc.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/printf.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/console.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/string.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/memory.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/ctype.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/ipchecksum.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/lib.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/rand.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/time.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/exec.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/readline.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/getopt_long.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/sysinfo.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/args.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/strings.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/strlcpy.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/qsort.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc/hexdump.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/pci.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/speaker.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/serial.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/keyboard.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/cbmem_console.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/nvram.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/options.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/video/video.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/video/vga.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/video/corebootfb.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/video/font8x16.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/storage/storage.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/storage/ahci.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/storage/ahci_common.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/storage/ata.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/storage/ahci_ata.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/storage/atapi.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/storage/ahci_atapi.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/usbinit.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/usb.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/usb_dev.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/quirks.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/generic_hub.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/usbhub.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/uhci.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/uhci_rh.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/ohci.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/ohci_rh.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/ehci.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/ehci_rh.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/xhci.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/xhci_debug.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/xhci_devconf.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/xhci_events.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/xhci_commands.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/xhci_rh.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/usbhid.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/usb/usbmsc.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/drivers/hid.libc.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/pdcurses-backend/pdcdisp.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/pdcurses-backend/pdcgetsc.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/pdcurses-backend/pdckbd.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/pdcurses-backend/pdcscrn.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/pdcurses-backend/pdcsetsc.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/pdcurses-backend/pdcutil.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/addch.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/move.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/overlay.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/refresh.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/terminfo.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/window.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/util.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/inopts.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/addstr.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/keyname.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/instr.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/clear.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/addchstr.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/kernel.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/pad.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/insstr.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/border.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/getyx.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/getstr.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/getch.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/termattr.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/outopts.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/color.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/deleteln.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/initscr.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/slk.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/delch.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/touch.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/mouse.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/scanw.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/scroll.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/printw.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/bkgd.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/inch.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/attr.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/insch.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/inchstr.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/beep.libcurses.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_req_name.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_item_nam.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_pad.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_cursor.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_item_new.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_attribs.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_item_opt.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_format.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_post.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_userptr.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_item_cur.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_driver.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_sub.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_win.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_global.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_item_vis.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_new.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_scale.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_spacing.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_opts.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_pattern.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_item_val.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_hook.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_item_use.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_items.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/menu/m_item_top.libmenu.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_page.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_opts.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_def.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_req_name.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fty_alpha.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_driver.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_user.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_win.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_newftyp.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_stat.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_pad.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_current.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_post.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fty_generic.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_page.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_hook.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_scale.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fty_int.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fty_alnum.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_cursor.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_link.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_arg.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_move.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_def.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_type.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_max.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_ftlink.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_ftchoice.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_info.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_user.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_sub.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fty_enum.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/frm_data.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_opts.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_attr.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_dup.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/form/fld_just.libform.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/curses/PDCurses-3.4/pdcurses/panel.libpanel.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/rom_media.libcbfs.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libcbfs/cbfs.libcbfs.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libcbfs/ram_media.libcbfs.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/liblzma/lzma.liblzma.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/liblz4/lz4.liblz4.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libamd/gpio.libamd.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libamd/i2c.libamd.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libamd/pmreg.libamd.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libamd/spi.libamd.o
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none  -MMD  -Iinclude -Iinclude/x86 -I$ROOTDIR/payloads/sortbootorder/libpayloadbin/build -D_LP64=0 -Icurses/PDCurses-3.4 -Icurses/pdcurses-backend -Icurses/menu -Icurses/form -Os -pipe -nostdinc -nostdlib -fno-builtin -ffreestanding -fomit-frame-pointer -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -c -o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/head.head.o.o arch/x86/head.S
 cp $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/arch/x86/head.head.o.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/head.o
 install -m 755 -d $ROOTDIR/payloads/sortbootorder/libpayloadbin/libpayload/lib
-for lib in $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libpci.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libcurses.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libmenu.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libform.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libpanel.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libcbfs.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/liblzma.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libamd.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libpayload.a; do install -m 644 $lib $ROOTDIR/payloads/sortbootorder/libpayloadbin/libpayload/lib/; done
+for lib in $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libpci.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libc.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libcurses.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libmenu.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libform.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libpanel.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libcbfs.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/liblzma.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/liblz4.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libamd.a $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/libpayload.a; do install -m 644 $lib $ROOTDIR/payloads/sortbootorder/libpayloadbin/libpayload/lib/; done
 install -m 644 arch/x86/libpayload.ldscript $ROOTDIR/payloads/sortbootorder/libpayloadbin/libpayload/lib/
 install -m 755 -d $ROOTDIR/payloads/sortbootorder/libpayloadbin/libpayload/lib/x86
 install -m 644 $ROOTDIR/payloads/sortbootorder/libpayloadbin/build/head.o $ROOTDIR/payloads/sortbootorder/libpayloadbin/libpayload/lib/x86
@@ -1573,27 +1587,33 @@ mv build/mainboard/pcengines/apu/dsdt.ramstage.c build/mainboard/pcengines/apu/d
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/bootmem.ramstage.o src/lib/bootmem.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/bootmode.ramstage.o src/lib/bootmode.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/cbfs.ramstage.o src/lib/cbfs.c
-"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/cbmem.ramstage.o src/lib/cbmem.c
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/dynamic_cbmem.ramstage.o src/lib/dynamic_cbmem.c
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/cbmem_dir.ramstage.o src/lib/cbmem_dir.c
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/timestamp.ramstage.o src/lib/timestamp.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/cbmem_console.ramstage.o src/lib/cbmem_console.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/cbmem_info.ramstage.o src/lib/cbmem_info.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/clog2.ramstage.o src/lib/clog2.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/compute_ip_checksum.ramstage.o src/lib/compute_ip_checksum.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/coreboot_table.ramstage.o src/lib/coreboot_table.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/delay.ramstage.o src/lib/delay.c
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/timer_queue.ramstage.o src/lib/timer_queue.c
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/thread.ramstage.o src/lib/thread.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/fallback_boot.ramstage.o src/lib/fallback_boot.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/gcc.ramstage.o src/lib/gcc.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/hardwaremain.ramstage.o src/lib/hardwaremain.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/hexdump.ramstage.o src/lib/hexdump.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/lzma.ramstage.o src/lib/lzma.c
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/lz4.ramstage.o src/lib/lz4.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/malloc.ramstage.o src/lib/malloc.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/memchr.ramstage.o src/lib/memchr.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/memcmp.ramstage.o src/lib/memcmp.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/memrange.ramstage.o src/lib/memrange.c
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/ramstage_cache.ramstage.o src/lib/ramstage_cache.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/reg_script.ramstage.o src/lib/reg_script.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/selfboot.ramstage.o src/lib/selfboot.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/stack.ramstage.o src/lib/stack.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/lib/version.ramstage.o src/lib/version.c
-"$SAGE_HOME"/tools/xgcc/bin/i386-elf-ld  -o build/lib/ramstage.o -r build/lib/bootmem.ramstage.o build/lib/bootmode.ramstage.o build/lib/cbfs.ramstage.o build/lib/cbmem.ramstage.o build/lib/cbmem_console.ramstage.o build/lib/cbmem_info.ramstage.o build/lib/clog2.ramstage.o build/lib/compute_ip_checksum.ramstage.o build/lib/coreboot_table.ramstage.o build/lib/delay.ramstage.o build/lib/fallback_boot.ramstage.o build/lib/gcc.ramstage.o build/lib/hardwaremain.ramstage.o build/lib/hexdump.ramstage.o build/lib/lzma.ramstage.o build/lib/malloc.ramstage.o build/lib/memchr.ramstage.o build/lib/memcmp.ramstage.o build/lib/memrange.ramstage.o build/lib/reg_script.ramstage.o build/lib/selfboot.ramstage.o build/lib/stack.ramstage.o build/lib/version.ramstage.o 
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-ld  -o build/lib/ramstage.o -r build/lib/bootmem.ramstage.o build/lib/bootmode.ramstage.o build/lib/cbfs.ramstage.o build/lib/dynamic_cbmem.ramstage.o build/lib/cbmem_dir.ramstage.o build/lib/timestamp.ramstage.o build/lib/cbmem_console.ramstage.o build/lib/cbmem_info.ramstage.o build/lib/clog2.ramstage.o build/lib/compute_ip_checksum.ramstage.o build/lib/coreboot_table.ramstage.o build/lib/delay.ramstage.o build/lib/fallback_boot.ramstage.o build/lib/gcc.ramstage.o build/lib/hardwaremain.ramstage.o build/lib/hexdump.ramstage.o build/lib/lzma.ramstage.o build/lib/lz4.ramstage.o build/lib/malloc.ramstage.o build/lib/memchr.ramstage.o build/lib/memcmp.ramstage.o build/lib/memrange.ramstage.o build/lib/ramstage_cache.ramstage.o build/lib/reg_script.ramstage.o build/lib/selfboot.ramstage.o build/lib/stack.ramstage.o build/lib/thread.ramstage.o build/lib/timer_queue.ramstage.o build/lib/version.ramstage.o 
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/drivers/uart/uart8250io.ramstage.o src/drivers/uart/uart8250io.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/drivers/uart/util.ramstage.o src/drivers/uart/util.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-ld  -o build/drivers/uart/ramstage.o -r build/drivers/uart/uart8250io.ramstage.o build/drivers/uart/util.ramstage.o 
@@ -1633,11 +1653,12 @@ mv build/mainboard/pcengines/apu/dsdt.ramstage.c build/mainboard/pcengines/apu/d
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/cpu/x86/mtrr/mtrr.ramstage.o src/cpu/x86/mtrr/mtrr.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-ld  -o build/cpu/x86/mtrr/ramstage.o -r build/cpu/x86/mtrr/mtrr.ramstage.o 
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/cpu/x86/lapic/apic_timer.ramstage.o src/cpu/x86/lapic/apic_timer.c
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/cpu/x86/lapic/ap_jobs.ramstage.o src/cpu/x86/lapic/ap_jobs.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/cpu/x86/lapic/boot_cpu.ramstage.o src/cpu/x86/lapic/boot_cpu.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/cpu/x86/lapic/lapic.ramstage.o src/cpu/x86/lapic/lapic.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/cpu/x86/lapic/lapic_cpu_init.ramstage.o src/cpu/x86/lapic/lapic_cpu_init.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/cpu/x86/lapic/secondary.ramstage.o src/cpu/x86/lapic/secondary.S
-"$SAGE_HOME"/tools/xgcc/bin/i386-elf-ld  -o build/cpu/x86/lapic/ramstage.o -r build/cpu/x86/lapic/apic_timer.ramstage.o build/cpu/x86/lapic/boot_cpu.ramstage.o build/cpu/x86/lapic/lapic.ramstage.o build/cpu/x86/lapic/lapic_cpu_init.ramstage.o build/cpu/x86/lapic/secondary.ramstage.o 
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-ld  -o build/cpu/x86/lapic/ramstage.o -r build/cpu/x86/lapic/ap_jobs.ramstage.o build/cpu/x86/lapic/apic_timer.ramstage.o build/cpu/x86/lapic/boot_cpu.ramstage.o build/cpu/x86/lapic/lapic.ramstage.o build/cpu/x86/lapic/lapic_cpu_init.ramstage.o build/cpu/x86/lapic/secondary.ramstage.o 
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/cpu/x86/cache/cache.ramstage.o src/cpu/x86/cache/cache.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-ld  -o build/cpu/x86/cache/ramstage.o -r build/cpu/x86/cache/cache.ramstage.o 
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/cpu/amd/mtrr/amd_mtrr.ramstage.o src/cpu/amd/mtrr/amd_mtrr.c
@@ -1646,7 +1667,8 @@ mv build/mainboard/pcengines/apu/dsdt.ramstage.c build/mainboard/pcengines/apu/d
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/cpu/amd/agesa/family14/model_14_init.ramstage.o src/cpu/amd/agesa/family14/model_14_init.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-ld  -o build/cpu/amd/agesa/family14/ramstage.o -r build/cpu/amd/agesa/family14/chip_name.ramstage.o build/cpu/amd/agesa/family14/model_14_init.ramstage.o 
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/cpu/amd/agesa/s3_resume.ramstage.o src/cpu/amd/agesa/s3_resume.c
-"$SAGE_HOME"/tools/xgcc/bin/i386-elf-ld  -o build/cpu/amd/agesa/ramstage.o -r build/cpu/amd/agesa/s3_resume.ramstage.o 
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/cpu/amd/agesa/mem_restore.ramstage.o src/cpu/amd/agesa/mem_restore.c
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-ld  -o build/cpu/amd/agesa/ramstage.o -r build/cpu/amd/agesa/s3_resume.ramstage.o build/cpu/amd/agesa/mem_restore.ramstage.o 
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/console/console.ramstage.o src/console/console.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/console/die.ramstage.o src/console/die.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/console/init.ramstage.o src/console/init.c
@@ -1656,7 +1678,9 @@ mv build/mainboard/pcengines/apu/dsdt.ramstage.c build/mainboard/pcengines/apu/d
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/console/vtxprintf.ramstage.o src/console/vtxprintf.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-ld  -o build/console/ramstage.o -r build/console/console.ramstage.o build/console/die.ramstage.o build/console/init.ramstage.o build/console/post.ramstage.o build/console/printk.ramstage.o build/console/vsprintf.ramstage.o build/console/vtxprintf.ramstage.o 
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/arch/x86/lib/c_start.ramstage.o src/arch/x86/lib/c_start.S
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/arch/x86/lib/thread_switch.ramstage.o src/arch/x86/lib/thread_switch.S
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/arch/x86/lib/cpu.ramstage.o src/arch/x86/lib/cpu.c
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/arch/x86/lib/thread.ramstage.o src/arch/x86/lib/thread.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/arch/x86/lib/ebda.ramstage.o src/arch/x86/lib/ebda.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/arch/x86/lib/exception.ramstage.o src/arch/x86/lib/exception.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/arch/x86/lib/ioapic.ramstage.o src/arch/x86/lib/ioapic.c
@@ -1666,7 +1690,7 @@ mv build/mainboard/pcengines/apu/dsdt.ramstage.c build/mainboard/pcengines/apu/d
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/arch/x86/lib/pci_ops_conf1.ramstage.o src/arch/x86/lib/pci_ops_conf1.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/arch/x86/lib/pci_ops_mmconf.ramstage.o src/arch/x86/lib/pci_ops_mmconf.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/arch/x86/lib/rom_media.ramstage.o src/arch/x86/lib/rom_media.c
-"$SAGE_HOME"/tools/xgcc/bin/i386-elf-ld  -o build/arch/x86/lib/ramstage.o -r build/arch/x86/lib/c_start.ramstage.o build/arch/x86/lib/cpu.ramstage.o build/arch/x86/lib/ebda.ramstage.o build/arch/x86/lib/exception.ramstage.o build/arch/x86/lib/ioapic.ramstage.o build/arch/x86/lib/memcpy.ramstage.o build/arch/x86/lib/memmove.ramstage.o build/arch/x86/lib/memset.ramstage.o build/arch/x86/lib/pci_ops_conf1.ramstage.o build/arch/x86/lib/pci_ops_mmconf.ramstage.o build/arch/x86/lib/rom_media.ramstage.o 
+"$SAGE_HOME"/tools/xgcc/bin/i386-elf-ld  -o build/arch/x86/lib/ramstage.o -r build/arch/x86/lib/c_start.ramstage.o build/arch/x86/lib/cpu.ramstage.o build/arch/x86/lib/ebda.ramstage.o build/arch/x86/lib/exception.ramstage.o build/arch/x86/lib/ioapic.ramstage.o build/arch/x86/lib/memcpy.ramstage.o build/arch/x86/lib/memmove.ramstage.o build/arch/x86/lib/memset.ramstage.o build/arch/x86/lib/pci_ops_conf1.ramstage.o build/arch/x86/lib/pci_ops_mmconf.ramstage.o build/arch/x86/lib/rom_media.ramstage.o build/arch/x86/lib/thread.ramstage.o build/arch/x86/lib/thread_switch.ramstage.o 
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/arch/x86/boot/acpi.ramstage.o src/arch/x86/boot/acpi.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/arch/x86/boot/acpigen.ramstage.o src/arch/x86/boot/acpigen.c
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-gcc  -Wno-unused-but-set-variable  -Wa,--divide -fno-stack-protector -Wl,--build-id=none -Isrc/mainboard/pcengines/apu -Isrc/vendorcode/amd/agesa/f14 -Isrc/vendorcode/amd/agesa/f14/Include -Isrc/vendorcode/amd/agesa/f14/Lib -Isrc/vendorcode/amd/agesa/f14/Legacy -Isrc/vendorcode/amd/agesa/f14/Proc/Common -Isrc/vendorcode/amd/agesa/f14/Proc/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Family/0x14/ON -Isrc/vendorcode/amd/agesa/f14/Proc/CPU/Feature  -Isrc/vendorcode/amd/agesa/f14/Proc/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Common -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Gfx/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Modules/GnbCommonLib -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/Nb/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Family/0x14 -Isrc/vendorcode/amd/agesa/f14/Proc/GNB/PCIe/Feature -Isrc/vendorcode/amd/agesa/f14/Proc/HT -Isrc/vendorcode/amd/agesa/f14/Proc/IDS -Isrc/vendorcode/amd/agesa/f14/Proc/Mem -Isrc/vendorcode/amd/agesa/f14/Proc/Mem/NB/ON -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/GNB -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/CPU -Isrc/vendorcode/amd/agesa/f14/Proc/Recovery/Mem -march=k8-sse3 -mtune=k8-sse3 -fno-zero-initialized-in-bss -fno-strict-aliasing -Isrc/mainboard/pcengines/apu -Isrc/southbridge/amd/cimx/sb800 -Isrc/include/cpu/amd/common -Isrc/vendorcode/amd/cimx/sb800  -MMD -Isrc -Isrc/include -Ibuild -include src/include/kconfig.h -Isrc/mainboard/pcengines/apu -Isrc/northbridge/amd/common -Os -pipe -g -nostdinc -nostdlib -Wall -Wundef -Wstrict-prototypes -Wmissing-prototypes -Wwrite-strings -Wredundant-decls -Wno-trigraphs -Wstrict-aliasing -Wshadow -Werror -fno-common -ffreestanding -fno-builtin -fomit-frame-pointer -Isrc/arch/x86/include  -Isrc/arch/x86/include  -c -o build/arch/x86/boot/boot.ramstage.o src/arch/x86/boot/boot.c
@@ -1718,11 +1742,35 @@ rm -f *.o *.s *.d *.iso memtest.bin memtest.elf memtest_shared memtest_shared.bi
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-ld  -T memtest.bin.lds bootsect.o setup.o -b binary memtest_shared.bin -o memtest.bin
 "$SAGE_HOME"/tools/xgcc/bin/i386-elf-ld  -s -T memtest.lds -b binary memtest_shared.bin -o memtest.elf
 popd > /dev/null # payloads/memtest86+
-if [ -e payloads/memtest86+/memtest.elf ]; then build/cbfstool build/coreboot.pre add-payload -f payloads/memtest86+/memtest.elf -n "img/memtest"  -c LZMA ; fi
+# Compression of each stage and payload, LZMA or LZ4. LZ4 takes more flash
+# but decodes many times faster, build/cbfslz4 bench build/coreboot.rom
+# compares both for every file of an image.
+RAMSTAGE_COMPRESS=${RAMSTAGE_COMPRESS:-LZMA}
+SEABIOS_COMPRESS=${SEABIOS_COMPRESS:-LZMA}
+SETUP_COMPRESS=${SETUP_COMPRESS:-LZMA}
+MEMTEST_COMPRESS=${MEMTEST_COMPRESS:-LZMA}
+gcc  -Wall -W -O2 -g -o build/cbfslz4 util/cbfslz4/cbfslz4.c
+# cbfs_add_compressed rom stage|payload file name LZMA|LZ4
+# cbfstool has no LZ4, such files are added uncompressed to a scratch image,
+# extracted and converted.
+cbfs_add_compressed() {
+	if [ "$5" == "LZ4" ]; then
+		rm -f build/lz4.rom.tmp
+		build/cbfstool build/lz4.rom.tmp create -s 2048K -B build/cbfs/fallback/bootblock.bin -a 64 -m x86
+		build/cbfstool build/lz4.rom.tmp add-$2 -f "$3" -n lz4 -c none
+		build/cbfstool build/lz4.rom.tmp extract -n lz4 -f build/lz4.raw
+		build/cbfslz4 $2 build/lz4.raw build/lz4.bin
+		build/cbfstool "$1" add -f build/lz4.bin -n "$4" -t $2
+		rm -f build/lz4.rom.tmp build/lz4.raw build/lz4.bin
+	else
+		build/cbfstool "$1" add-$2 -f "$3" -n "$4" -c $5
+	fi
+}
+if [ -e payloads/memtest86+/memtest.elf ]; then cbfs_add_compressed build/coreboot.pre payload payloads/memtest86+/memtest.elf "img/memtest" $MEMTEST_COMPRESS ; fi
 cp build/coreboot.pre build/coreboot.rom.tmp
-if [ -e build/cbfs/fallback/ramstage.elf ]; then build/cbfstool build/coreboot.rom.tmp add-stage -f build/cbfs/fallback/ramstage.elf -n "fallback"/ramstage -c LZMA ; fi
-if [ -e payloads/seabios/out/bios.bin.elf ]; then build/cbfstool build/coreboot.rom.tmp add-payload -f "payloads/seabios/out/bios.bin.elf" -n "fallback"/payload -c LZMA  ; fi
-if [ -e payloads/sortbootorder/sortbootorder.elf ]; then build/cbfstool build/coreboot.rom.tmp add-payload -f "payloads/sortbootorder/sortbootorder.elf" -n img/"setup"  -c LZMA ; fi
+if [ -e build/cbfs/fallback/ramstage.elf ]; then cbfs_add_compressed build/coreboot.rom.tmp stage build/cbfs/fallback/ramstage.elf "fallback"/ramstage $RAMSTAGE_COMPRESS ; fi
+if [ -e payloads/seabios/out/bios.bin.elf ]; then cbfs_add_compressed build/coreboot.rom.tmp payload "payloads/seabios/out/bios.bin.elf" "fallback"/payload $SEABIOS_COMPRESS ; fi
+if [ -e payloads/sortbootorder/sortbootorder.elf ]; then cbfs_add_compressed build/coreboot.rom.tmp payload "payloads/sortbootorder/sortbootorder.elf" img/"setup" $SETUP_COMPRESS ; fi
 if [ -e src/mainboard/pcengines/apu/bootorder_map ]; then build/cbfstool build/coreboot.rom.tmp add -f src/mainboard/pcengines/apu/bootorder_map -n bootorder_map  -t raw ; fi
 if [ -e src/mainboard/pcengines/apu/bootorder_def ]; then build/cbfstool build/coreboot.rom.tmp add -f src/mainboard/pcengines/apu/bootorder_def -n bootorder_def  -t raw ; fi
 if [ -e src/mainboard/pcengines/apu/no_debug_with_screen ]; then build/cbfstool build/coreboot.rom.tmp add -f src/mainboard/pcengines/apu/no_debug_with_screen -n etc/screen-and-debug  -t raw ; fi
@@ -35,9 +35,12 @@
 #define CONFIG_DEBUG_INTEL_ME 0
 #define CONFIG_SUPPORT_CPU_UCODE_IN_CBFS 0
 #define CONFIG_RELOCATABLE_RAMSTAGE 0
+#define CONFIG_RAMSTAGE_CACHE 1
+#define CONFIG_RAMSTAGE_CACHE_SIZE 0x100000
 #define CONFIG_COREBOOT_ROMSIZE_KB_256 0
 #define CONFIG_GFXUMA_BOARD_256MB 0
 #define CONFIG_DEFAULT_CONSOLE_LOGLEVEL 2
+#define CONFIG_MAX_CONSOLE_LOGLEVEL 2
 #define CONFIG_SB800_FWM_AT_FFF20000 0
 #define CONFIG_EXCLUDE_RAMSTAGE 0
 #define CONFIG_POISON_STACK 1
@@ -56,7 +59,7 @@
 #define CONFIG_VENDOR_PCENGINES 1
 #define CONFIG_YABEL_VIRTMEM_LOCATION 0
 #define CONFIG_DRIVER_MAXIM_MAX77686 0
-#define CONFIG_COLLECT_TIMESTAMPS 0
+#define CONFIG_COLLECT_TIMESTAMPS 1
 #define CONFIG_SUPERIO_ITE_IT8728F 0
 #define CONFIG_PCIEXP_PLUGIN_SUPPORT 1
 #define CONFIG_EXTRA_1ST_COMPRESSED_PAYLOAD_LZMA 1
@@ -128,7 +131,7 @@
 #define CONFIG_SUBSYSTEM_VENDOR_ID 0x0000
 #define CONFIG_SUPERIO_ITE_IT8718F 0
 #define CONFIG_CBFS_5TH_FILE_FILE_OUT "etc/boot-menu-key"
-#define CONFIG_DYNAMIC_CBMEM 0
+#define CONFIG_DYNAMIC_CBMEM 1
 #define CONFIG_LOGICAL_CPUS 1
 #define CONFIG_TIMESTAMP_PRINT_LEVEL 0
 #define CONFIG_TPM 0
@@ -188,7 +191,7 @@
 #define CONFIG_POST_IO_PORT 0x80
 #define CONFIG_SUPERIO_FINTEK_F71869AD 0
 #define CONFIG_MAINBOARD_VENDOR "PC Engines"
-#define CONFIG_NUM_THREADS 0
+#define CONFIG_NUM_THREADS 4
 #define CONFIG_ACPI_SSDTX_NUM 0
 #define CONFIG_CPU_SPECIFIC_OPTIONS 0
 #define CONFIG_CBFS_6TH_FILE_FILE_IN "src/mainboard/pcengines/apu/bootorder"
@@ -259,7 +262,7 @@
 #define CONFIG_CONSOLE_NE2K_IO_PORT 0
 #define CONFIG_CACHE_AS_RAM 1
 #define CONFIG_DRIVERS_I2C_W83793 0
-#define CONFIG_TIMER_QUEUE 0
+#define CONFIG_TIMER_QUEUE 1
 #define CONFIG_STACK_TOP 0
 #define CONFIG_VGA_ROM_RUN 0
 #define CONFIG_COMPRESSED_PAYLOAD_LZMA 1
@@ -311,6 +314,8 @@
 #define CONFIG_SMM_MODULES 0
 #define CONFIG_CPU_AMD_AGESA_FAMILY12 0
 #define CONFIG_CONSOLE_SERIAL 1
+#define CONFIG_CONSOLE_SERIAL_BUFFERED 1
+#define CONFIG_CONSOLE_SERIAL_BUFFER_SIZE 0x4000
 #define CONFIG_UDELAY_LAPIC 1
 #define CONFIG_EARLY_PCI_BRIDGE_DEVICE 0
 #define CONFIG_HIGH_SCRATCH_MEMORY_SIZE 0x71000
@@ -324,7 +329,7 @@
 #define CONFIG_MAINBOARD_HAS_NATIVE_VGA_INIT 0
 #define CONFIG_S3_DATA_POS 0xFFFF0000
 #define CONFIG_SPI_FLASH_STMICRO 1
-#define CONFIG_COOP_MULTITASKING 0
+#define CONFIG_COOP_MULTITASKING 1
 #define CONFIG_FRAMEBUFFER_VESA_MODE_107 0
 #define CONFIG_NEED_LIBRARY_PCI 0
 #define CONFIG_DEFAULT_CONSOLE_LOGLEVEL_0 0
@@ -377,6 +382,8 @@
 #define CONFIG_GFXUMA_MODE_256MB 0
 #define CONFIG_USE_GENERIC_FSP_CAR_INC 0
 #define CONFIG_DEBUG_CBFS 0
+#define CONFIG_CBFS_INDEX 1
+#define CONFIG_CBFS_INDEX_ENTRIES 32
 #define CONFIG_CMOS_POST_EXTRA 0
 #define CONFIG_X86EMU_DEBUG_MEM 0
 #define CONFIG_INTEL_DP 0
@@ -449,7 +456,7 @@
 #define CONFIG_SUPERIO_FINTEK_F71859 0
 #define CONFIG_POWER_BUTTON_DEFAULT_DISABLE 0
 #define CONFIG_PCI_IO_CFG_EXT 1
-#define CONFIG_AMD_SB_SPI_TX_LEN 4
+#define CONFIG_AMD_SB_SPI_TX_LEN 5
 #define CONFIG_X86_BOOTBLOCK_SIMPLE 1
 #define CONFIG_EXTRA_2ND_PAYLOAD_BASE 0
 #define CONFIG_GENERATE_PIRQ_TABLE 1
@@ -5,7 +5,7 @@ pushd build > /dev/null
   find . -name "*.d" -o -name "*.o" -o -name "*.a" | xargs rm -Rf
   find . -type d -empty -delete
   rm -rf mrc.cache build.h ./*.bin ./*pre* ldoptions option_table.h
-  rm -rf cbfstool rmodtool cpu cbfs
+  rm -rf cbfstool cbfslz4 rmodtool cpu cbfs
   rm -rf generated coreboot*.rom soc util/nvramtool/cli util/nvramtool/accessors
   rm -f image.img
 popd > /dev/null
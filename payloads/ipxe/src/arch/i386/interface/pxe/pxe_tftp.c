@@ -56,10 +56,35 @@ struct pxe_tftp_connection {
 	size_t blksize;
 	/** Block index */
 	unsigned int blkidx;
+	/** Blocks received ahead of the reader
+	 *
+	 * When reading a block at a time, the server may send a
+	 * whole TFTP window before the caller asks for the next
+	 * block.  Blocks are held here, indexed by block number
+	 * modulo the window size, until pxenv_tftp_read() wants
+	 * them.
+	 */
+	struct io_buffer *ahead[TFTP_MAX_WINDOWSIZE];
+	/** Reading a block at a time */
+	int blockwise;
 	/** Overall return status code */
 	int rc;
 };
 
+/**
+ * Discard blocks held for the reader
+ *
+ * @v pxe_tftp		PXE TFTP connection
+ */
+static void pxe_tftp_discard ( struct pxe_tftp_connection *pxe_tftp ) {
+	unsigned int i;
+
+	for ( i = 0 ; i < TFTP_MAX_WINDOWSIZE ; i++ ) {
+		free_iob ( pxe_tftp->ahead[i] );
+		pxe_tftp->ahead[i] = NULL;
+	}
+}
+
 /**
  * Close PXE TFTP connection
  *
@@ -82,6 +107,44 @@ static size_t pxe_tftp_xfer_window ( struct pxe_tftp_connection *pxe_tftp ) {
 	return pxe_tftp->blksize;
 }
 
+/**
+ * Hold block for the reader
+ *
+ * @v pxe_tftp		PXE TFTP connection
+ * @v iobuf		I/O buffer
+ * @v offset		File position of block
+ * @ret rc		Return status code
+ *
+ * Takes ownership of I/O buffer.
+ */
+static int pxe_tftp_hold ( struct pxe_tftp_connection *pxe_tftp,
+			   struct io_buffer *iobuf, size_t offset ) {
+	size_t blksize = xfer_window ( &pxe_tftp->xfer );
+	unsigned int slot;
+
+	/* Ignore blocks that have already been read */
+	if ( offset < pxe_tftp->start ) {
+		free_iob ( iobuf );
+		return 0;
+	}
+
+	/* Check that block lies within the window */
+	if ( ( offset % blksize ) ||
+	     ( ( offset - pxe_tftp->start ) >=
+	       ( TFTP_MAX_WINDOWSIZE * blksize ) ) ) {
+		DBG ( " block at %zx beyond window (start %zx)",
+		      offset, pxe_tftp->start );
+		free_iob ( iobuf );
+		return -ENOBUFS;
+	}
+
+	/* Hold block, replacing any duplicate */
+	slot = ( ( offset / blksize ) % TFTP_MAX_WINDOWSIZE );
+	free_iob ( pxe_tftp->ahead[slot] );
+	pxe_tftp->ahead[slot] = iobuf;
+	return 0;
+}
+
 /**
  * Receive new data
  *
@@ -104,6 +167,9 @@ static int pxe_tftp_xfer_deliver ( struct pxe_tftp_connection *pxe_tftp,
 	/* Copy data block to buffer */
 	if ( len == 0 ) {
 		/* No data (pure seek); treat as success */
+	} else if ( pxe_tftp->blockwise ) {
+		rc = pxe_tftp_hold ( pxe_tftp, iob_disown ( iobuf ),
+				     pxe_tftp->offset );
 	} else if ( pxe_tftp->offset < pxe_tftp->start ) {
 		DBG ( " buffer underrun at %zx (min %zx)",
 		      pxe_tftp->offset, pxe_tftp->start );
@@ -178,6 +244,7 @@ static int pxe_tftp_open ( uint32_t ipaddress, unsigned int port,
 	int rc;
 
 	/* Reset PXE TFTP connection structure */
+	pxe_tftp_discard ( &pxe_tftp );
 	memset ( &pxe_tftp, 0, sizeof ( pxe_tftp ) );
 	intf_init ( &pxe_tftp.xfer, &pxe_tftp_xfer_desc, NULL );
 	if ( blksize < TFTP_DEFAULT_BLKSIZE )
@@ -248,6 +315,7 @@ static int pxe_tftp_open ( uint32_t ipaddress, unsigned int port,
  * other PXE API call "if an MTFTP connection is active".
  */
 static PXENV_EXIT_t pxenv_tftp_open ( struct s_PXENV_TFTP_OPEN *tftp_open ) {
+	size_t blksize;
 	int rc;
 
 	DBG ( "PXENV_TFTP_OPEN" );
@@ -264,13 +332,16 @@ static PXENV_EXIT_t pxenv_tftp_open ( struct s_PXENV_TFTP_OPEN *tftp_open ) {
 		tftp_open->Status = PXENV_STATUS ( rc );
 		return PXENV_EXIT_FAILURE;
 	}
+	pxe_tftp.blockwise = 1;
 
 	/* Wait for OACK to arrive so that we have the block size */
 	while ( ( ( rc = pxe_tftp.rc ) == -EINPROGRESS ) &&
 		( pxe_tftp.max_offset == 0 ) ) {
 		step();
 	}
-	pxe_tftp.blksize = xfer_window ( &pxe_tftp.xfer );
+	/* A transfer that has already finished has no window left */
+	if ( ( blksize = xfer_window ( &pxe_tftp.xfer ) ) )
+		pxe_tftp.blksize = blksize;
 	tftp_open->PacketSize = pxe_tftp.blksize;
 	DBG ( " blksize=%d", tftp_open->PacketSize );
 
@@ -303,6 +374,7 @@ static PXENV_EXIT_t pxenv_tftp_close ( struct s_PXENV_TFTP_CLOSE *tftp_close ) {
 	DBG ( "PXENV_TFTP_CLOSE" );
 
 	pxe_tftp_close ( &pxe_tftp, 0 );
+	pxe_tftp_discard ( &pxe_tftp );
 	tftp_close->Status = PXENV_STATUS_SUCCESS;
 	return PXENV_EXIT_SUCCESS;
 }
@@ -369,21 +441,32 @@ static PXENV_EXIT_t pxenv_tftp_close ( struct s_PXENV_TFTP_CLOSE *tftp_close ) {
  * @ref pxe_x86_pmode16 "implementation note" for more details.)
  */
 static PXENV_EXIT_t pxenv_tftp_read ( struct s_PXENV_TFTP_READ *tftp_read ) {
+	struct io_buffer *iobuf;
+	unsigned int slot;
+	size_t len = 0;
 	int rc;
 
 	DBG ( "PXENV_TFTP_READ to %04x:%04x",
 	      tftp_read->Buffer.segment, tftp_read->Buffer.offset );
 
-	/* Read single block into buffer */
-	pxe_tftp.buffer = real_to_user ( tftp_read->Buffer.segment,
-					 tftp_read->Buffer.offset );
-	pxe_tftp.size = pxe_tftp.blksize;
-	pxe_tftp.start = pxe_tftp.offset;
-	while ( ( ( rc = pxe_tftp.rc ) == -EINPROGRESS ) &&
-		( pxe_tftp.offset == pxe_tftp.start ) )
+	/* Wait for the next block, which may already be held */
+	slot = ( ( pxe_tftp.start / pxe_tftp.blksize ) % TFTP_MAX_WINDOWSIZE );
+	while ( ( ( iobuf = pxe_tftp.ahead[slot] ) == NULL ) &&
+		( ( rc = pxe_tftp.rc ) == -EINPROGRESS ) )
 		step();
-	pxe_tftp.buffer = UNULL;
-	tftp_read->BufferSize = ( pxe_tftp.offset - pxe_tftp.start );
+
+	/* Copy single block into buffer */
+	if ( iobuf ) {
+		pxe_tftp.ahead[slot] = NULL;
+		len = iob_len ( iobuf );
+		copy_to_user ( real_to_user ( tftp_read->Buffer.segment,
+					      tftp_read->Buffer.offset ),
+			       0, iobuf->data, len );
+		free_iob ( iobuf );
+		pxe_tftp.start += len;
+		rc = 0;
+	}
+	tftp_read->BufferSize = len;
 	tftp_read->PacketNumber = ++pxe_tftp.blkidx;
 
 	/* EINPROGRESS is normal if we haven't reached EOF yet */
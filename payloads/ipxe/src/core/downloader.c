@@ -29,6 +29,9 @@ FILE_LICENCE ( GPL2_OR_LATER );
 #include <ipxe/uaccess.h>
 #include <ipxe/umalloc.h>
 #include <ipxe/image.h>
+#include <ipxe/process.h>
+#include <ipxe/blockdev.h>
+#include <ipxe/bitmap.h>
 #include <ipxe/profile.h>
 #include <ipxe/downloader.h>
 
@@ -36,8 +39,32 @@ FILE_LICENCE ( GPL2_OR_LATER );
  *
  * Image downloader
  *
+ * If the data transfer interface reports a block device capacity
+ * (as HTTP does for servers accepting byte range requests), the
+ * image is divided into chunks.  The original transfer continues to
+ * fill the image from the start, while additional range connections
+ * read chunks working backwards from the end.  The original transfer
+ * is closed when it reaches a chunk which has already been claimed.
+ *
  */
 
+/** Number of range connections */
+#define DOWNLOADER_RANGES 4
+
+/** Size of a chunk fetched by a single range request */
+#define DOWNLOADER_CHUNK ( 1024 * 1024 )
+
+/** Minimum image size for which range connections are used */
+#define DOWNLOADER_RANGE_MIN ( 4 * DOWNLOADER_CHUNK )
+
+/** Maximum number of failed range requests */
+#define DOWNLOADER_MAX_FAILURES 8
+
+/** Range connection was redirected */
+#define EXDEV_RANGE_REDIRECT __einfo_error ( EINFO_EXDEV_RANGE_REDIRECT )
+#define EINFO_EXDEV_RANGE_REDIRECT \
+	__einfo_uniqify ( EINFO_EXDEV, 0x01, "Range connection redirected" )
+
 /** Receive profiler */
 static struct profiler downloader_rx_profiler __profiler =
 	{ .name = "downloader.rx" };
@@ -46,6 +73,24 @@ static struct profiler downloader_rx_profiler __profiler =
 static struct profiler downloader_copy_profiler __profiler =
 	{ .name = "downloader.copy" };
 
+struct downloader;
+
+/** A range connection */
+struct downloader_range {
+	/** Downloader */
+	struct downloader *downloader;
+	/** Data transfer interface */
+	struct interface xfer;
+	/** Block data interface */
+	struct interface block;
+	/** Connection is open */
+	int open;
+	/** Range request is in progress */
+	int busy;
+	/** Chunk being fetched */
+	unsigned int chunk;
+};
+
 /** A downloader */
 struct downloader {
 	/** Reference count for this object */
@@ -60,6 +105,25 @@ struct downloader {
 	struct image *image;
 	/** Current position within image buffer */
 	size_t pos;
+	/** Allocated size of image buffer */
+	size_t alloc;
+
+	/** Range connections */
+	struct downloader_range range[DOWNLOADER_RANGES];
+	/** Range request process */
+	struct process process;
+	/** Block size for range requests (or zero if not in use) */
+	size_t blksize;
+	/** Completed chunks */
+	struct bitmap chunks;
+	/** Number of completed chunks */
+	unsigned int done;
+	/** Original transfer is still open */
+	int primary;
+	/** Number of chunks fetched by range requests */
+	unsigned int ranged;
+	/** Number of failed range requests */
+	unsigned int failures;
 };
 
 /**
@@ -72,9 +136,60 @@ static void downloader_free ( struct refcnt *refcnt ) {
 		container_of ( refcnt, struct downloader, refcnt );
 
 	image_put ( downloader->image );
+	bitmap_free ( &downloader->chunks );
 	free ( downloader );
 }
 
+/**
+ * Close range connections
+ *
+ * @v downloader	Downloader
+ * @v rc		Reason for close
+ */
+static void downloader_close_ranges ( struct downloader *downloader, int rc ) {
+	struct downloader_range *range;
+	unsigned int i;
+
+	/* Stop issuing range requests */
+	downloader->blksize = 0;
+	process_del ( &downloader->process );
+
+	/* Close all range connections */
+	for ( i = 0 ; i < DOWNLOADER_RANGES ; i++ ) {
+		range = &downloader->range[i];
+		intf_shutdown ( &range->block, rc );
+		intf_shutdown ( &range->xfer, rc );
+		range->busy = 0;
+		range->open = 0;
+	}
+}
+
+/**
+ * Release unused space at end of download buffer
+ *
+ * @v downloader	Downloader
+ */
+static void downloader_trim ( struct downloader *downloader ) {
+	struct image *image = downloader->image;
+	userptr_t new_buffer;
+
+	/* Do nothing unless the buffer was overallocated */
+	if ( ( downloader->alloc <= image->len ) || ( image->len == 0 ) )
+		return;
+
+	DBGC ( downloader, "Downloader %p trimming buffer from %zd to %zd "
+	       "bytes\n", downloader, downloader->alloc, image->len );
+
+	/* Shrink buffer.  Failure is harmless; the extra space is
+	 * just wasted until the image is freed.
+	 */
+	new_buffer = urealloc ( image->data, image->len );
+	if ( ! new_buffer )
+		return;
+	image->data = new_buffer;
+	downloader->alloc = image->len;
+}
+
 /**
  * Terminate download
  *
@@ -92,8 +207,15 @@ static void downloader_finished ( struct downloader *downloader, int rc ) {
 			 downloader->image->name, strerror ( rc ) );
 	}
 
-	/* Shut down interfaces */
+	/* Shut down data transfer interfaces */
+	downloader_close_ranges ( downloader, rc );
 	intf_shutdown ( &downloader->xfer, rc );
+
+	/* Finalise image buffer before handing it back */
+	if ( rc == 0 )
+		downloader_trim ( downloader );
+
+	/* Shut down job control interface */
 	intf_shutdown ( &downloader->job, rc );
 }
 
@@ -103,27 +225,55 @@ static void downloader_finished ( struct downloader *downloader, int rc ) {
  * @v downloader	Downloader
  * @v len		Required minimum size
  * @ret rc		Return status code
+ *
+ * When the file size is not known in advance (e.g. chunked HTTP, or
+ * TFTP without "tsize"), the buffer is grown geometrically so that
+ * the total cost of moving it during reallocation stays linear in
+ * the size of the file.  Any unused space is released once the
+ * download completes.
  */
 static int downloader_ensure_size ( struct downloader *downloader,
 				    size_t len ) {
+	struct image *image = downloader->image;
 	userptr_t new_buffer;
+	size_t alloc;
 
 	/* If buffer is already large enough, do nothing */
-	if ( len <= downloader->image->len )
+	if ( len <= image->len )
 		return 0;
 
-	DBGC ( downloader, "Downloader %p extending to %zd bytes\n",
-	       downloader, len );
+	/* Use existing spare space, if any */
+	if ( len <= downloader->alloc ) {
+		image->len = len;
+		return 0;
+	}
+
+	/* Grow by at least doubling the buffer, unless this is the
+	 * first allocation (which may be the file size).
+	 */
+	alloc = ( downloader->alloc * 2 );
+	if ( alloc < len )
+		alloc = len;
+
+	DBGC ( downloader, "Downloader %p extending to %zd bytes (%zd "
+	       "allocated)\n", downloader, len, alloc );
 
-	/* Extend buffer */
-	new_buffer = urealloc ( downloader->image->data, len );
+	/* Extend buffer, falling back to the exact size if there is
+	 * not enough memory for the spare space.
+	 */
+	new_buffer = urealloc ( image->data, alloc );
+	if ( ( ! new_buffer ) && ( alloc > len ) ) {
+		alloc = len;
+		new_buffer = urealloc ( image->data, alloc );
+	}
 	if ( ! new_buffer ) {
 		DBGC ( downloader, "Downloader %p could not extend buffer to "
 		       "%zd bytes\n", downloader, len );
 		return -ENOSPC;
 	}
-	downloader->image->data = new_buffer;
-	downloader->image->len = len;
+	image->data = new_buffer;
+	image->len = len;
+	downloader->alloc = alloc;
 
 	return 0;
 }
@@ -151,15 +301,351 @@ static int downloader_progress ( struct downloader *downloader,
 	progress->completed = downloader->pos;
 	progress->total = downloader->image->len;
 
+	/* When using range connections, count only completed chunks */
+	if ( downloader->blksize ) {
+		progress->completed = ( downloader->done * DOWNLOADER_CHUNK );
+		if ( progress->completed > progress->total )
+			progress->completed = progress->total;
+	}
+
+	return 0;
+}
+
+/****************************************************************************
+ *
+ * Range connections
+ *
+ */
+
+/**
+ * Check if chunk is being fetched by a range connection
+ *
+ * @v downloader	Downloader
+ * @v chunk		Chunk index
+ * @ret held		Chunk is being fetched
+ */
+static int downloader_held ( struct downloader *downloader,
+			     unsigned int chunk ) {
+	struct downloader_range *range;
+	unsigned int i;
+
+	for ( i = 0 ; i < DOWNLOADER_RANGES ; i++ ) {
+		range = &downloader->range[i];
+		if ( range->busy && ( range->chunk == chunk ) )
+			return 1;
+	}
+	return 0;
+}
+
+/**
+ * Mark chunk as completed
+ *
+ * @v downloader	Downloader
+ * @v chunk		Chunk index
+ * @ret finished	Download is complete
+ */
+static int downloader_chunk_done ( struct downloader *downloader,
+				   unsigned int chunk ) {
+
+	/* Record chunk, ignoring duplicates */
+	if ( ! bitmap_test ( &downloader->chunks, chunk ) ) {
+		bitmap_set ( &downloader->chunks, chunk );
+		downloader->done++;
+	}
+
+	/* Finish download when all chunks are present */
+	if ( ! bitmap_full ( &downloader->chunks ) )
+		return 0;
+	downloader_finished ( downloader, 0 );
+	return 1;
+}
+
+/**
+ * Handle failed range request
+ *
+ * @v downloader	Downloader
+ * @v rc		Reason for failure
+ */
+static void downloader_range_failed ( struct downloader *downloader,
+				      int rc ) {
+
+	DBGC ( downloader, "Downloader %p range request failed: %s\n",
+	       downloader, strerror ( rc ) );
+
+	/* If no range request has ever succeeded, assume that the
+	 * server cannot handle them and let the original transfer
+	 * continue on its own.
+	 */
+	if ( downloader->primary && ( downloader->ranged == 0 ) ) {
+		DBGC ( downloader, "Downloader %p abandoning range "
+		       "requests\n", downloader );
+		downloader_close_ranges ( downloader, rc );
+		return;
+	}
+
+	/* Give up on persistent failures */
+	if ( ++downloader->failures > DOWNLOADER_MAX_FAILURES ) {
+		downloader_finished ( downloader, rc );
+		return;
+	}
+
+	/* Retry the chunk */
+	process_add ( &downloader->process );
+}
+
+/**
+ * Claim next chunk for a range request
+ *
+ * @v downloader	Downloader
+ * @ret chunk		Chunk index, or negative if none remain
+ *
+ * Chunks are claimed from the end of the image, so that range
+ * requests and the original transfer meet in the middle.
+ */
+static int downloader_claim ( struct downloader *downloader ) {
+	unsigned int first = 0;
+	unsigned int chunk;
+
+	/* Leave the chunk currently being filled by the original
+	 * transfer alone.
+	 */
+	if ( downloader->primary )
+		first = ( ( downloader->pos / DOWNLOADER_CHUNK ) + 1 );
+
+	for ( chunk = downloader->chunks.length ; chunk-- > first ; ) {
+		if ( ! ( bitmap_test ( &downloader->chunks, chunk ) ||
+			 downloader_held ( downloader, chunk ) ) )
+			return chunk;
+	}
+	return -1;
+}
+
+/**
+ * Issue range request
+ *
+ * @v range		Range connection
+ * @v chunk		Chunk index
+ * @ret rc		Return status code
+ */
+static int downloader_range_read ( struct downloader_range *range,
+				   unsigned int chunk ) {
+	struct downloader *downloader = range->downloader;
+	size_t blksize = downloader->blksize;
+	size_t offset = ( chunk * DOWNLOADER_CHUNK );
+	size_t len = ( downloader->image->len - offset );
+	int rc;
+
+	/* Calculate chunk length */
+	if ( len > DOWNLOADER_CHUNK )
+		len = DOWNLOADER_CHUNK;
+
+	/* Open connection, if necessary */
+	if ( ! range->open ) {
+		if ( ( rc = xfer_open_uri ( &range->xfer,
+					    downloader->image->uri ) ) != 0 )
+			return rc;
+		range->open = 1;
+	}
+
+	/* Read chunk directly into image buffer */
+	DBGC2 ( downloader, "Downloader %p range %d reading [%zx,%zx)\n",
+		downloader, ( ( int ) ( range - downloader->range ) ),
+		offset, ( offset + len ) );
+	if ( ( rc = block_read ( &range->xfer, &range->block,
+				 ( offset / blksize ),
+				 ( ( len + blksize - 1 ) / blksize ),
+				 userptr_add ( downloader->image->data, offset ),
+				 len ) ) != 0 ) {
+		intf_restart ( &range->xfer, rc );
+		range->open = 0;
+		return rc;
+	}
+	range->chunk = chunk;
+	range->busy = 1;
+
 	return 0;
 }
 
+/**
+ * Issue range requests
+ *
+ * @v downloader	Downloader
+ */
+static void downloader_step ( struct downloader *downloader ) {
+	struct downloader_range *range;
+	unsigned int i;
+	int chunk;
+	int rc;
+
+	for ( i = 0 ; i < DOWNLOADER_RANGES ; i++ ) {
+		range = &downloader->range[i];
+
+		/* Stop if range requests are no longer in use */
+		if ( ! downloader->blksize )
+			return;
+
+		/* Skip busy connections */
+		if ( range->busy )
+			continue;
+
+		/* Stop when all chunks are claimed */
+		chunk = downloader_claim ( downloader );
+		if ( chunk < 0 )
+			return;
+
+		/* Issue range request */
+		if ( ( rc = downloader_range_read ( range, chunk ) ) != 0 )
+			downloader_range_failed ( downloader, rc );
+	}
+}
+
+/**
+ * Handle completed range request
+ *
+ * @v range		Range connection
+ * @v rc		Reason for completion
+ */
+static void downloader_range_done ( struct downloader_range *range, int rc ) {
+	struct downloader *downloader = range->downloader;
+
+	/* Shut down block data interface */
+	intf_restart ( &range->block, rc );
+	range->busy = 0;
+
+	/* Record failure.  The connection itself will have been
+	 * closed by the failing request.
+	 */
+	if ( rc != 0 ) {
+		downloader_range_failed ( downloader, rc );
+		return;
+	}
+
+	/* Record chunk and issue next request */
+	downloader->ranged++;
+	if ( downloader_chunk_done ( downloader, range->chunk ) )
+		return;
+	process_add ( &downloader->process );
+}
+
+/**
+ * Handle closed range connection
+ *
+ * @v range		Range connection
+ * @v rc		Reason for close
+ */
+static void downloader_range_close ( struct downloader_range *range, int rc ) {
+	struct downloader *downloader = range->downloader;
+
+	DBGC ( downloader, "Downloader %p range %d closed: %s\n",
+	       downloader, ( ( int ) ( range - downloader->range ) ),
+	       strerror ( rc ) );
+
+	/* Shut down interface; it will be reopened if needed */
+	intf_restart ( &range->xfer, rc );
+	range->open = 0;
+}
+
+/**
+ * Refuse redirection of range connection
+ *
+ * @v range		Range connection
+ * @v type		New location type
+ * @v args		Remaining arguments depend upon location type
+ * @ret rc		Return status code
+ *
+ * A redirection would leave the range request attached to the
+ * response containing the redirection.
+ */
+static int downloader_range_redirect ( struct downloader_range *range __unused,
+				       int type __unused,
+				       va_list args __unused ) {
+	return -EXDEV_RANGE_REDIRECT;
+}
+
+/** Range connection data transfer interface operations */
+static struct interface_operation downloader_range_xfer_operations[] = {
+	INTF_OP ( xfer_vredirect, struct downloader_range *,
+		  downloader_range_redirect ),
+	INTF_OP ( intf_close, struct downloader_range *,
+		  downloader_range_close ),
+};
+
+/** Range connection data transfer interface descriptor */
+static struct interface_descriptor downloader_range_xfer_desc =
+	INTF_DESC ( struct downloader_range, xfer,
+		    downloader_range_xfer_operations );
+
+/** Range connection block data interface operations */
+static struct interface_operation downloader_range_block_operations[] = {
+	INTF_OP ( intf_close, struct downloader_range *,
+		  downloader_range_done ),
+};
+
+/** Range connection block data interface descriptor */
+static struct interface_descriptor downloader_range_block_desc =
+	INTF_DESC ( struct downloader_range, block,
+		    downloader_range_block_operations );
+
+/** Range request process descriptor */
+static struct process_descriptor downloader_process_desc =
+	PROC_DESC_ONCE ( struct downloader, process, downloader_step );
+
 /****************************************************************************
  *
  * Data transfer interface
  *
  */
 
+/**
+ * Handle received data while using range connections
+ *
+ * @v downloader	Downloader
+ * @v data		Data
+ * @v len		Length of data
+ */
+static void downloader_primary_rx ( struct downloader *downloader,
+				    const void *data, size_t len ) {
+	unsigned int chunk;
+	size_t frag_len;
+	size_t end;
+
+	while ( len && ( downloader->pos < downloader->image->len ) ) {
+
+		/* Stop when reaching a chunk claimed by a range request */
+		chunk = ( downloader->pos / DOWNLOADER_CHUNK );
+		if ( bitmap_test ( &downloader->chunks, chunk ) ||
+		     downloader_held ( downloader, chunk ) ) {
+			DBGC ( downloader, "Downloader %p closing original "
+			       "transfer at %zx\n", downloader,
+			       downloader->pos );
+			downloader->primary = 0;
+			intf_restart ( &downloader->xfer, 0 );
+			process_add ( &downloader->process );
+			return;
+		}
+
+		/* Copy data up to the end of this chunk */
+		end = ( ( chunk + 1 ) * DOWNLOADER_CHUNK );
+		if ( end > downloader->image->len )
+			end = downloader->image->len;
+		frag_len = ( end - downloader->pos );
+		if ( frag_len > len )
+			frag_len = len;
+		profile_start ( &downloader_copy_profiler );
+		copy_to_user ( downloader->image->data, downloader->pos,
+			       data, frag_len );
+		profile_stop ( &downloader_copy_profiler );
+		downloader->pos += frag_len;
+		data += frag_len;
+		len -= frag_len;
+
+		/* Record completed chunk */
+		if ( ( downloader->pos == end ) &&
+		     downloader_chunk_done ( downloader, chunk ) )
+			return;
+	}
+}
+
 /**
  * Handle received data
  *
@@ -183,8 +669,17 @@ static int downloader_xfer_deliver ( struct downloader *downloader,
 		downloader->pos = 0;
 	downloader->pos += meta->offset;
 
-	/* Ensure that we have enough buffer space for this data */
+	/* The image buffer may not move while range requests are
+	 * reading into it.
+	 */
 	len = iob_len ( iobuf );
+	if ( downloader->blksize ) {
+		downloader_primary_rx ( downloader, iobuf->data, len );
+		rc = 0;
+		goto done;
+	}
+
+	/* Ensure that we have enough buffer space for this data */
 	max = ( downloader->pos + len );
 	if ( ( rc = downloader_ensure_size ( downloader, max ) ) != 0 )
 		goto done;
@@ -206,10 +701,88 @@ static int downloader_xfer_deliver ( struct downloader *downloader,
 	return rc;
 }
 
+/**
+ * Handle block device capacity
+ *
+ * @v downloader	Downloader
+ * @v capacity		Block device capacity
+ *
+ * A data transfer interface reporting a capacity once the file size
+ * is known can also be read in parallel using range connections.
+ */
+static void downloader_xfer_capacity ( struct downloader *downloader,
+				       struct block_device_capacity *capacity ) {
+	size_t len = downloader->image->len;
+	size_t blksize = capacity->blksize;
+	unsigned int chunks;
+	int rc;
+
+	/* Use range connections only once, and only at the start of
+	 * a sufficiently large download.
+	 */
+	if ( downloader->chunks.length || downloader->pos ||
+	     ( len < DOWNLOADER_RANGE_MIN ) )
+		return;
+
+	/* Check that capacity matches the file size, and that a
+	 * chunk can be read using a single block read.
+	 */
+	if ( ( blksize == 0 ) || ( DOWNLOADER_CHUNK % blksize ) ||
+	     ( capacity->blocks != ( ( len + blksize - 1 ) / blksize ) ) ||
+	     ( ( DOWNLOADER_CHUNK / blksize ) > capacity->max_count ) ) {
+		DBGC ( downloader, "Downloader %p cannot use capacity %lld "
+		       "x %zd\n", downloader, capacity->blocks, blksize );
+		return;
+	}
+
+	/* Allocate chunk bitmap */
+	chunks = ( ( len + DOWNLOADER_CHUNK - 1 ) / DOWNLOADER_CHUNK );
+	if ( ( rc = bitmap_resize ( &downloader->chunks, chunks ) ) != 0 ) {
+		DBGC ( downloader, "Downloader %p could not allocate %d "
+		       "chunks: %s\n", downloader, chunks, strerror ( rc ) );
+		return;
+	}
+
+	/* Start range connections */
+	DBGC ( downloader, "Downloader %p using %d range connections for "
+	       "%d chunks\n", downloader, DOWNLOADER_RANGES, chunks );
+	downloader->blksize = blksize;
+	downloader->primary = 1;
+	process_add ( &downloader->process );
+}
+
+/**
+ * Handle closed data transfer interface
+ *
+ * @v downloader	Downloader
+ * @v rc		Reason for close
+ */
+static void downloader_xfer_close ( struct downloader *downloader, int rc ) {
+
+	/* Finish download unless range connections remain */
+	if ( ! downloader->blksize ) {
+		downloader_finished ( downloader, rc );
+		return;
+	}
+
+	/* Leave any remaining chunks to the range connections */
+	DBGC ( downloader, "Downloader %p original transfer closed at %zx: "
+	       "%s\n", downloader, downloader->pos, strerror ( rc ) );
+	intf_restart ( &downloader->xfer, rc );
+	downloader->primary = 0;
+	if ( rc != 0 ) {
+		downloader_range_failed ( downloader, rc );
+		return;
+	}
+	process_add ( &downloader->process );
+}
+
 /** Downloader data transfer interface operations */
 static struct interface_operation downloader_xfer_operations[] = {
 	INTF_OP ( xfer_deliver, struct downloader *, downloader_xfer_deliver ),
-	INTF_OP ( intf_close, struct downloader *, downloader_finished ),
+	INTF_OP ( block_capacity, struct downloader *,
+		  downloader_xfer_capacity ),
+	INTF_OP ( intf_close, struct downloader *, downloader_xfer_close ),
 };
 
 /** Downloader data transfer interface descriptor */
@@ -250,6 +823,8 @@ static struct interface_descriptor downloader_job_desc =
  */
 int create_downloader ( struct interface *job, struct image *image ) {
 	struct downloader *downloader;
+	struct downloader_range *range;
+	unsigned int i;
 	int rc;
 
 	/* Allocate and initialise structure */
@@ -261,6 +836,16 @@ int create_downloader ( struct interface *job, struct image *image ) {
 		    &downloader->refcnt );
 	intf_init ( &downloader->xfer, &downloader_xfer_desc,
 		    &downloader->refcnt );
+	for ( i = 0 ; i < DOWNLOADER_RANGES ; i++ ) {
+		range = &downloader->range[i];
+		range->downloader = downloader;
+		intf_init ( &range->xfer, &downloader_range_xfer_desc,
+			    &downloader->refcnt );
+		intf_init ( &range->block, &downloader_range_block_desc,
+			    &downloader->refcnt );
+	}
+	process_init_stopped ( &downloader->process, &downloader_process_desc,
+			       &downloader->refcnt );
 	downloader->image = image_get ( image );
 
 	/* Instantiate child objects and attach to our interfaces */
@@ -92,9 +92,10 @@ size_t freemem;
 /**
  * Heap size
  *
- * Currently fixed at 512kB.
+ * Currently fixed at 2MB, which leaves room for the TCP_MAX_WINDOW_SIZE
+ * of receive window shared by all TCP connections.
  */
-#define HEAP_SIZE ( 512 * 1024 )
+#define HEAP_SIZE ( 2 * 1024 * 1024 )
 
 /** The heap itself */
 static char heap[HEAP_SIZE] __attribute__ (( aligned ( __alignof__(void *) )));
@@ -41,6 +41,7 @@ void xferbuf_done ( struct xfer_buffer *xferbuf ) {
 	free ( xferbuf->data );
 	xferbuf->data = NULL;
 	xferbuf->len = 0;
+	xferbuf->alloc = 0;
 	xferbuf->pos = 0;
 }
 
@@ -50,16 +51,35 @@ void xferbuf_done ( struct xfer_buffer *xferbuf ) {
  * @v xferbuf		Data transfer buffer
  * @v len		Required minimum size
  * @ret rc		Return status code
+ *
+ * The buffer is grown geometrically, so that data arriving in many
+ * small pieces does not cause a reallocation for each piece.  Any
+ * unused space is released by xferbuf_trim() once the transfer
+ * completes.
  */
 static int xferbuf_ensure_size ( struct xfer_buffer *xferbuf, size_t len ) {
 	void *new_data;
+	size_t alloc;
 
 	/* If buffer is already large enough, do nothing */
 	if ( len <= xferbuf->len )
 		return 0;
 
-	/* Extend buffer */
-	new_data = realloc ( xferbuf->data, len );
+	/* Use existing spare space, if any */
+	if ( len <= xferbuf->alloc ) {
+		xferbuf->len = len;
+		return 0;
+	}
+
+	/* Extend buffer, by at least doubling it if memory permits */
+	alloc = ( xferbuf->alloc * 2 );
+	if ( alloc < len )
+		alloc = len;
+	new_data = realloc ( xferbuf->data, alloc );
+	if ( ( ! new_data ) && ( alloc > len ) ) {
+		alloc = len;
+		new_data = realloc ( xferbuf->data, alloc );
+	}
 	if ( ! new_data ) {
 		DBGC ( xferbuf, "XFERBUF %p could not extend buffer to "
 		       "%zd bytes\n", xferbuf, len );
@@ -67,10 +87,36 @@ static int xferbuf_ensure_size ( struct xfer_buffer *xferbuf, size_t len ) {
 	}
 	xferbuf->data = new_data;
 	xferbuf->len = len;
+	xferbuf->alloc = alloc;
 
 	return 0;
 }
 
+/**
+ * Release unused space in data transfer buffer
+ *
+ * @v xferbuf		Data transfer buffer
+ */
+void xferbuf_trim ( struct xfer_buffer *xferbuf ) {
+	void *new_data;
+
+	/* Do nothing unless the buffer was overallocated */
+	if ( ( xferbuf->alloc <= xferbuf->len ) || ( xferbuf->len == 0 ) )
+		return;
+
+	DBGC ( xferbuf, "XFERBUF %p trimming buffer from %zd to %zd bytes\n",
+	       xferbuf, xferbuf->alloc, xferbuf->len );
+
+	/* Shrink buffer.  Failure is harmless; the extra space is
+	 * just wasted until the buffer is freed.
+	 */
+	new_data = realloc ( xferbuf->data, xferbuf->len );
+	if ( ! new_data )
+		return;
+	xferbuf->data = new_data;
+	xferbuf->alloc = xferbuf->len;
+}
+
 /**
  * Add received data to data transfer buffer
  *
@@ -36,6 +36,7 @@ FILE_LICENCE ( GPL2_OR_LATER );
 #include <ipxe/threewire.h>
 #include <ipxe/bitbash.h>
 #include <ipxe/mii.h>
+#include <ipxe/errortab.h>
 #include "realtek.h"
 
 /** @file
@@ -48,6 +49,28 @@ FILE_LICENCE ( GPL2_OR_LATER );
  *    http://www.datasheetarchive.com/indexdl/Datasheet-028/DSA00494723.pdf
  */
 
+/** Card ran out of receive descriptors */
+#define ENOBUFS_RDU __einfo_error ( EINFO_ENOBUFS_RDU )
+#define EINFO_ENOBUFS_RDU __einfo_uniqify \
+	( EINFO_ENOBUFS, 0x01, "Receive descriptors exhausted" )
+
+/** Card receive FIFO overflowed */
+#define ENOBUFS_FOVW __einfo_error ( EINFO_ENOBUFS_FOVW )
+#define EINFO_ENOBUFS_FOVW __einfo_uniqify \
+	( EINFO_ENOBUFS, 0x02, "Receive FIFO overflow" )
+
+/** Receive ring could not be refilled */
+#define ENOMEM_REFILL __einfo_error ( EINFO_ENOMEM_REFILL )
+#define EINFO_ENOMEM_REFILL __einfo_uniqify \
+	( EINFO_ENOMEM, 0x01, "Receive ring refill failed" )
+
+/** Human-readable messages for the receive error counters */
+struct errortab realtek_errors[] __errortab = {
+	__einfo_errortab ( EINFO_ENOBUFS_RDU ),
+	__einfo_errortab ( EINFO_ENOBUFS_FOVW ),
+	__einfo_errortab ( EINFO_ENOMEM_REFILL ),
+};
+
 /******************************************************************************
  *
  * Debugging
@@ -627,11 +650,13 @@ static void realtek_destroy_ring ( struct realtek_nic *rtl,
 /**
  * Refill receive descriptor ring
  *
- * @v rtl		Realtek device
+ * @v netdev		Network device
  */
-static void realtek_refill_rx ( struct realtek_nic *rtl ) {
+static void realtek_refill_rx ( struct net_device *netdev ) {
+	struct realtek_nic *rtl = netdev->priv;
 	struct realtek_descriptor *rx;
 	struct io_buffer *iobuf;
+	unsigned int first;
 	unsigned int rx_idx;
 	physaddr_t address;
 	int is_last;
@@ -640,28 +665,28 @@ static void realtek_refill_rx ( struct realtek_nic *rtl ) {
 	if ( rtl->legacy )
 		return;
 
-	while ( ( rtl->rx.prod - rtl->rx.cons ) < RTL_NUM_RX_DESC ) {
+	/* Populate all free descriptors, leaving them owned by us */
+	first = rtl->rx.prod;
+	while ( ( rtl->rx.prod - rtl->rx.cons ) < rtl->rx.count ) {
 
 		/* Allocate I/O buffer */
 		iobuf = alloc_iob ( RTL_RX_MAX_LEN );
 		if ( ! iobuf ) {
-			/* Wait for next refill */
-			return;
+			/* Record starvation and wait for next refill */
+			netdev_rx_err ( netdev, NULL, -ENOMEM_REFILL );
+			break;
 		}
 
 		/* Get next receive descriptor */
-		rx_idx = ( rtl->rx.prod++ % RTL_NUM_RX_DESC );
-		is_last = ( rx_idx == ( RTL_NUM_RX_DESC - 1 ) );
+		rx_idx = realtek_ring_index ( &rtl->rx, rtl->rx.prod++ );
+		is_last = ( rx_idx == ( rtl->rx.count - 1 ) );
 		rx = &rtl->rx.desc[rx_idx];
 
 		/* Populate receive descriptor */
 		address = virt_to_bus ( iobuf->data );
 		rx->address = cpu_to_le64 ( address );
 		rx->length = cpu_to_le16 ( RTL_RX_MAX_LEN );
-		wmb();
-		rx->flags = ( cpu_to_le16 ( RTL_DESC_OWN ) |
-			      ( is_last ? cpu_to_le16 ( RTL_DESC_EOR ) : 0 ) );
-		wmb();
+		rx->flags = ( is_last ? cpu_to_le16 ( RTL_DESC_EOR ) : 0 );
 
 		/* Record I/O buffer */
 		assert ( rtl->rx_iobuf[rx_idx] == NULL );
@@ -671,6 +696,16 @@ static void realtek_refill_rx ( struct realtek_nic *rtl ) {
 			( ( unsigned long long ) address ),
 			( ( unsigned long long ) address + RTL_RX_MAX_LEN ) );
 	}
+
+	/* Hand the whole batch over to the card */
+	if ( first == rtl->rx.prod )
+		return;
+	wmb();
+	for ( ; first != rtl->rx.prod ; first++ ) {
+		rx = &rtl->rx.desc[ realtek_ring_index ( &rtl->rx, first ) ];
+		rx->flags |= cpu_to_le16 ( RTL_DESC_OWN );
+	}
+	wmb();
 }
 
 /**
@@ -722,7 +757,7 @@ static int realtek_open ( struct net_device *netdev ) {
 	writel ( rcr, rtl->regs + RTL_RCR );
 
 	/* Fill receive ring */
-	realtek_refill_rx ( rtl );
+	realtek_refill_rx ( netdev );
 
 	/* Update link state */
 	realtek_check_link ( netdev );
@@ -783,11 +818,11 @@ static int realtek_transmit ( struct net_device *netdev,
 	int is_last;
 
 	/* Get next transmit descriptor */
-	if ( ( rtl->tx.prod - rtl->tx.cons ) >= RTL_NUM_TX_DESC ) {
+	if ( ( rtl->tx.prod - rtl->tx.cons ) >= rtl->tx.count ) {
 		netdev_tx_defer ( netdev, iobuf );
 		return 0;
 	}
-	tx_idx = ( rtl->tx.prod++ % RTL_NUM_TX_DESC );
+	tx_idx = realtek_ring_index ( &rtl->tx, rtl->tx.prod++ );
 
 	/* Transmit packet */
 	if ( rtl->legacy ) {
@@ -812,7 +847,7 @@ static int realtek_transmit ( struct net_device *netdev,
 
 		/* Populate transmit descriptor */
 		address = virt_to_bus ( iobuf->data );
-		is_last = ( tx_idx == ( RTL_NUM_TX_DESC - 1 ) );
+		is_last = ( tx_idx == ( rtl->tx.count - 1 ) );
 		tx = &rtl->tx.desc[tx_idx];
 		tx->address = cpu_to_le64 ( address );
 		tx->length = cpu_to_le16 ( iob_len ( iobuf ) );
@@ -841,34 +876,34 @@ static int realtek_transmit ( struct net_device *netdev,
  */
 static void realtek_poll_tx ( struct net_device *netdev ) {
 	struct realtek_nic *rtl = netdev->priv;
-	struct realtek_descriptor *tx;
+	unsigned int completed;
 	unsigned int tx_idx;
 
-	/* Check for completed packets */
-	while ( rtl->tx.cons != rtl->tx.prod ) {
-
-		/* Get next transmit descriptor */
-		tx_idx = ( rtl->tx.cons % RTL_NUM_TX_DESC );
-
-		/* Stop if descriptor is still in use */
-		if ( rtl->legacy ) {
+	/* Count completed packets */
+	if ( rtl->legacy ) {
 
-			/* Check ownership bit in transmit status register */
+		/* Check ownership bits in transmit status registers */
+		for ( completed = 0 ;
+		      completed < ( rtl->tx.prod - rtl->tx.cons ) ;
+		      completed++ ) {
+			tx_idx = realtek_ring_index ( &rtl->tx,
+						      ( rtl->tx.cons +
+							completed ) );
 			if ( ! ( readl ( rtl->regs + RTL_TSD ( tx_idx ) ) &
 				 RTL_TSD_OWN ) )
-				return;
-
-		} else {
-
-			/* Check ownership bit in descriptor */
-			tx = &rtl->tx.desc[tx_idx];
-			if ( tx->flags & cpu_to_le16 ( RTL_DESC_OWN ) )
-				return;
+				break;
 		}
 
-		DBGC2 ( rtl, "REALTEK %p TX %d complete\n", rtl, tx_idx );
+	} else {
+
+		/* Check ownership bits in descriptors */
+		completed = realtek_ring_completed ( &rtl->tx );
+	}
 
-		/* Complete TX descriptor */
+	/* Complete all of them at once */
+	while ( completed-- ) {
+		DBGC2 ( rtl, "REALTEK %p TX %d complete\n", rtl,
+			realtek_ring_index ( &rtl->tx, rtl->tx.cons ) );
 		rtl->tx.cons++;
 		netdev_tx_complete_next ( netdev );
 	}
@@ -939,6 +974,7 @@ static void realtek_poll_rx ( struct net_device *netdev ) {
 	struct realtek_nic *rtl = netdev->priv;
 	struct realtek_descriptor *rx;
 	struct io_buffer *iobuf;
+	unsigned int completed;
 	unsigned int rx_idx;
 	size_t len;
 
@@ -948,17 +984,14 @@ static void realtek_poll_rx ( struct net_device *netdev ) {
 		return;
 	}
 
-	/* Check for received packets */
-	while ( rtl->rx.cons != rtl->rx.prod ) {
+	/* Process all received packets in one batch */
+	completed = realtek_ring_completed ( &rtl->rx );
+	while ( completed-- ) {
 
 		/* Get next receive descriptor */
-		rx_idx = ( rtl->rx.cons % RTL_NUM_RX_DESC );
+		rx_idx = realtek_ring_index ( &rtl->rx, rtl->rx.cons );
 		rx = &rtl->rx.desc[rx_idx];
 
-		/* Stop if descriptor is still in use */
-		if ( rx->flags & cpu_to_le16 ( RTL_DESC_OWN ) )
-			return;
-
 		/* Populate I/O buffer */
 		iobuf = rtl->rx_iobuf[rx_idx];
 		rtl->rx_iobuf[rx_idx] = NULL;
@@ -1003,12 +1036,18 @@ static void realtek_poll ( struct net_device *netdev ) {
 	if ( isr & ( RTL_IRQ_RER | RTL_IRQ_ROK ) )
 		realtek_poll_rx ( netdev );
 
+	/* Record receive overflows, if applicable */
+	if ( isr & RTL_IRQ_RDU )
+		netdev_rx_err ( netdev, NULL, -ENOBUFS_RDU );
+	if ( isr & RTL_IRQ_FOVW )
+		netdev_rx_err ( netdev, NULL, -ENOBUFS_FOVW );
+
 	/* Check link state, if applicable */
 	if ( isr & RTL_IRQ_PUN_LINKCHG )
 		realtek_check_link ( netdev );
 
 	/* Refill RX ring */
-	realtek_refill_rx ( rtl );
+	realtek_refill_rx ( netdev );
 }
 
 /**
@@ -1117,7 +1156,6 @@ static int realtek_probe ( struct pci_device *pci ) {
 	pci_set_drvdata ( pci, netdev );
 	netdev->dev = &pci->dev;
 	memset ( rtl, 0, sizeof ( *rtl ) );
-	realtek_init_ring ( &rtl->tx, RTL_NUM_TX_DESC, RTL_TNPDS );
 	realtek_init_ring ( &rtl->rx, RTL_NUM_RX_DESC, RTL_RDSAR );
 
 	/* Fix up PCI device */
@@ -1132,6 +1170,8 @@ static int realtek_probe ( struct pci_device *pci ) {
 
 	/* Detect device type */
 	realtek_detect ( rtl );
+	realtek_init_ring ( &rtl->tx, ( rtl->legacy ? RTL_LEGACY_NUM_TX_DESC :
+					RTL_NUM_TX_DESC ), RTL_TNPDS );
 
 	/* Initialise EEPROM */
 	if ( ( rc = realtek_init_eeprom ( netdev ) ) == 0 ) {
@@ -9,6 +9,7 @@
 
 FILE_LICENCE ( GPL2_OR_LATER );
 
+#include <byteswap.h>
 #include <ipxe/spi.h>
 #include <ipxe/spi_bit.h>
 #include <ipxe/nvo.h>
@@ -86,11 +87,19 @@ enum realtek_legacy_status {
 /** Transmit Normal Priority Descriptors (qword) */
 #define RTL_TNPDS 0x20
 
+/** Number of transmit descriptors in legacy mode
+ *
+ * This is a hardware limit.
+ */
+#define RTL_LEGACY_NUM_TX_DESC 4
+
 /** Number of transmit descriptors
  *
- * This is a hardware limit when using legacy mode.
+ * Must be a power of two.
  */
-#define RTL_NUM_TX_DESC 4
+#ifndef RTL_NUM_TX_DESC
+#define RTL_NUM_TX_DESC 16
+#endif
 
 /** Receive Buffer Start Address (dword, 8139 only) */
 #define RTL_RBSTART 0x30
@@ -123,7 +132,9 @@ enum realtek_legacy_status {
 
 /** Interrupt Mask Register (word) */
 #define RTL_IMR 0x3c
+#define RTL_IRQ_FOVW		0x0040	/**< Receive FIFO overflow */
 #define RTL_IRQ_PUN_LINKCHG	0x0020	/**< Packet underrun / link change */
+#define RTL_IRQ_RDU		0x0010	/**< Receive descriptor unavailable */
 #define RTL_IRQ_TER		0x0008	/**< Transmit error */
 #define RTL_IRQ_TOK		0x0004	/**< Transmit OK */
 #define RTL_IRQ_RER		0x0002	/**< Receive error */
@@ -236,8 +247,19 @@ enum realtek_legacy_status {
 /** Receive Descriptor Start Address Register (qword) */
 #define RTL_RDSAR 0xe4
 
-/** Number of receive descriptors */
-#define RTL_NUM_RX_DESC 4
+/** Number of receive descriptors
+ *
+ * Must be a power of two.  Each descriptor holds an I/O buffer of
+ * RTL_RX_MAX_LEN bytes for as long as the device is open.
+ */
+#ifndef RTL_NUM_RX_DESC
+#define RTL_NUM_RX_DESC 32
+#endif
+
+#if ( ( RTL_NUM_TX_DESC & ( RTL_NUM_TX_DESC - 1 ) ) || \
+      ( RTL_NUM_RX_DESC & ( RTL_NUM_RX_DESC - 1 ) ) )
+#error "RTL_NUM_TX_DESC and RTL_NUM_RX_DESC must be powers of two"
+#endif
 
 /** Receive buffer length */
 #define RTL_RX_MAX_LEN \
@@ -251,6 +273,8 @@ struct realtek_ring {
 	unsigned int prod;
 	/** Consumer index */
 	unsigned int cons;
+	/** Number of descriptors */
+	unsigned int count;
 
 	/** Descriptor start address register */
 	unsigned int reg;
@@ -268,10 +292,44 @@ struct realtek_ring {
 static inline __attribute__ (( always_inline)) void
 realtek_init_ring ( struct realtek_ring *ring, unsigned int count,
 		    unsigned int reg ) {
+	ring->count = count;
 	ring->len = ( count * sizeof ( ring->desc[0] ) );
 	ring->reg = reg;
 }
 
+/**
+ * Get descriptor index
+ *
+ * @v ring		Descriptor ring
+ * @v counter		Producer or consumer counter
+ * @ret idx		Descriptor index
+ */
+static inline __attribute__ (( always_inline )) unsigned int
+realtek_ring_index ( struct realtek_ring *ring, unsigned int counter ) {
+	return ( counter & ( ring->count - 1 ) );
+}
+
+/**
+ * Count descriptors released by the card
+ *
+ * @v ring		Descriptor ring
+ * @ret count		Number of descriptors from the consumer index onwards
+ *			that are no longer owned by the card
+ */
+static inline unsigned int
+realtek_ring_completed ( struct realtek_ring *ring ) {
+	unsigned int fill = ( ring->prod - ring->cons );
+	unsigned int count;
+	unsigned int idx;
+
+	for ( count = 0 ; count < fill ; count++ ) {
+		idx = realtek_ring_index ( ring, ( ring->cons + count ) );
+		if ( ring->desc[idx].flags & cpu_to_le16 ( RTL_DESC_OWN ) )
+			break;
+	}
+	return count;
+}
+
 /** A Realtek network card */
 struct realtek_nic {
 	/** Registers */
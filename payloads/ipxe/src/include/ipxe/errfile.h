@@ -300,6 +300,11 @@ FILE_LICENCE ( GPL2_OR_LATER );
 #define ERRFILE_memmap_settings	      ( ERRFILE_OTHER | 0x003f0000 )
 #define ERRFILE_param_cmd	      ( ERRFILE_OTHER | 0x00400000 )
 #define ERRFILE_deflate		      ( ERRFILE_OTHER | 0x00410000 )
+#define ERRFILE_tcp_test	      ( ERRFILE_OTHER | 0x00420000 )
+#define ERRFILE_downloader_test	      ( ERRFILE_OTHER | 0x00430000 )
+#define ERRFILE_downloader_bench      ( ERRFILE_OTHER | 0x00440000 )
+#define ERRFILE_tftp_test	      ( ERRFILE_OTHER | 0x00450000 )
+#define ERRFILE_downloader_server     ( ERRFILE_OTHER | 0x00460000 )
 
 /** @} */
 
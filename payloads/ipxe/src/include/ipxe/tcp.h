@@ -72,12 +72,57 @@ struct tcp_window_scale_padded_option {
 
 /** Advertised TCP window scale
  *
- * Using a scale factor of 2**9 provides for a maximum window of 32MB,
- * which is sufficient to allow Gigabit-speed transfers with a 200ms
- * RTT.  The minimum advertised window is 512 bytes, which is still
- * less than a single packet.
+ * Using a scale factor of 2**5 provides for a maximum window of 2MB,
+ * which covers TCP_MAX_WINDOW_SIZE.  The window is advertised in
+ * units of 32 bytes, which keeps it close to the amount of memory
+ * actually available for the receive queue.
  */
-#define TCP_RX_WINDOW_SCALE 9
+#define TCP_RX_WINDOW_SCALE 5
+
+/** TCP selective acknowledgement permitted option */
+struct tcp_sack_permitted_option {
+	uint8_t kind;
+	uint8_t length;
+} __attribute__ (( packed ));
+
+/** Padded TCP selective acknowledgement permitted option (used for
+ * sending)
+ */
+struct tcp_sack_permitted_padded_option {
+	uint8_t nop[2];
+	struct tcp_sack_permitted_option spopt;
+} __attribute__ (( packed ));
+
+/** Code for the TCP selective acknowledgement permitted option */
+#define TCP_OPTION_SACK_PERMITTED 4
+
+/** TCP selective acknowledgement option */
+struct tcp_sack_option {
+	uint8_t kind;
+	uint8_t length;
+} __attribute__ (( packed ));
+
+/** TCP selective acknowledgement block */
+struct tcp_sack_block {
+	uint32_t left;
+	uint32_t right;
+} __attribute__ (( packed ));
+
+/** Maximum number of selective acknowledgement blocks
+ *
+ * This allows for the presence of the TCP timestamp option within
+ * the 40 bytes of option space.
+ */
+#define TCP_SACK_MAX 3
+
+/** Padded TCP selective acknowledgement option (used for sending) */
+struct tcp_sack_padded_option {
+	uint8_t nop[2];
+	struct tcp_sack_option sackopt;
+} __attribute__ (( packed ));
+
+/** Code for the TCP selective acknowledgement option */
+#define TCP_OPTION_SACK 5
 
 /** TCP timestamp option */
 struct tcp_timestamp_option {
@@ -102,6 +147,8 @@ struct tcp_options {
 	const struct tcp_mss_option *mssopt;
 	/** Window scale option, if present */
 	const struct tcp_window_scale_option *wsopt;
+	/** SACK permitted option, if present */
+	const struct tcp_sack_permitted_option *spopt;
 	/** Timestamp option, if present */
 	const struct tcp_timestamp_option *tsopt;
 };
@@ -304,14 +351,29 @@ struct tcp_options {
  *       required window 200kB.
  *
  * The maximum possible value for the TCP window size is 1GB (using
- * the maximum window scale of 2**14).  However, it is advisable to
- * keep the window size as small as possible (without limiting
- * bandwidth), since in the event of a lost packet the window size
- * represents the maximum amount that will need to be retransmitted.
+ * the maximum window scale of 2**14).  Without selective
+ * acknowledgements, the window size represents the maximum amount
+ * that will need to be retransmitted in the event of a lost packet.
+ * With selective acknowledgements only the missing segments are
+ * retransmitted, and the window is instead limited by the memory
+ * available to hold out-of-order segments on the receive queue.
+ *
+ * We therefore choose a maximum window size of 1MB, which allows for
+ * WAN links with longer round trip times.  This is also the total
+ * shared between all open connections, so that several parallel
+ * connections cannot together commit more memory than the heap holds.
+ */
+#define TCP_MAX_WINDOW_SIZE	( 1024 * 1024 )
+
+/**
+ * Minimum TCP window size
  *
- * We therefore choose a maximum window size of 256kB.
+ * The window is sized from the available memory when the connection
+ * is opened and shared with any other open connections, but is never
+ * made smaller than this, to allow for reasonable speeds on a local
+ * network.
  */
-#define TCP_MAX_WINDOW_SIZE	( 256 * 1024 )
+#define TCP_MIN_WINDOW_SIZE	( 64 * 1024 )
 
 /**
  * Path MTU
@@ -345,7 +407,10 @@ struct tcp_options {
 	  sizeof ( struct tcp_header ) +			\
 	  sizeof ( struct tcp_mss_option ) +			\
 	  sizeof ( struct tcp_window_scale_padded_option ) +	\
-	  sizeof ( struct tcp_timestamp_padded_option ) )
+	  sizeof ( struct tcp_sack_permitted_padded_option ) +	\
+	  sizeof ( struct tcp_timestamp_padded_option ) +	\
+	  sizeof ( struct tcp_sack_padded_option ) +		\
+	  ( TCP_SACK_MAX * sizeof ( struct tcp_sack_block ) ) )
 
 /**
  * Compare TCP sequence numbers
@@ -11,9 +11,13 @@ FILE_LICENCE ( GPL2_OR_LATER );
 
 #include <stdint.h>
 
+struct bitmap;
+
 #define TFTP_PORT	       69 /**< Default TFTP server port */
 #define	TFTP_DEFAULT_BLKSIZE  512 /**< Default TFTP data block size */
 #define	TFTP_MAX_BLKSIZE     1432
+#define	TFTP_DEFAULT_WINDOWSIZE 1 /**< Default TFTP window size */
+#define	TFTP_MAX_WINDOWSIZE     8 /**< Requested TFTP window size */
 
 #define TFTP_RRQ		1 /**< Read request opcode */
 #define TFTP_WRQ		2 /**< Write request opcode */
@@ -80,4 +84,24 @@ union tftp_any {
 	struct tftp_oack	oack;
 };
 
+/**
+ * A TFTP receive window
+ *
+ * With the "windowsize" option (RFC 7440) the server sends a whole
+ * window of blocks for each ACK.  A window size of one is the
+ * traditional lock-step protocol.
+ */
+struct tftp_window {
+	/** Number of blocks per window */
+	unsigned int size;
+	/** Block index most recently acknowledged */
+	unsigned int acked;
+};
+
+extern unsigned int tftp_window_block ( struct tftp_window *window,
+					struct bitmap *bitmap,
+					unsigned int number );
+extern int tftp_window_rx ( struct tftp_window *window,
+			    struct bitmap *bitmap, unsigned int block );
+
 #endif /* _IPXE_TFTP_H */
@@ -19,11 +19,14 @@ struct xfer_buffer {
 	void *data;
 	/** Size of data */
 	size_t len;
+	/** Allocated size of data buffer */
+	size_t alloc;
 	/** Current offset within data */
 	size_t pos;
 };
 
 extern void xferbuf_done ( struct xfer_buffer *xferbuf );
+extern void xferbuf_trim ( struct xfer_buffer *xferbuf );
 extern int xferbuf_deliver ( struct xfer_buffer *xferbuf,
 			     struct io_buffer *iobuf,
 			     struct xfer_metadata *meta );
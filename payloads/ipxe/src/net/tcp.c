@@ -103,6 +103,10 @@ struct tcp_connection {
 	uint8_t rcv_win_scale;
 	/** Maximum receive window */
 	uint32_t max_rcv_win;
+	/** Selective acknowledgement list (in host-endian order) */
+	struct tcp_sack_block sack[TCP_SACK_MAX];
+	/** Number of selective acknowledgement blocks */
+	unsigned int sack_count;
 
 	/** Transmit queue */
 	struct list_head tx_queue;
@@ -129,6 +133,8 @@ enum tcp_flags {
 	TCP_TS_ENABLED = 0x0002,
 	/** TCP acknowledgement is pending */
 	TCP_ACK_PENDING = 0x0004,
+	/** TCP selective acknowledgement is enabled */
+	TCP_SACK_ENABLED = 0x0008,
 };
 
 /** TCP internal header
@@ -253,6 +259,61 @@ static int tcp_port_available ( int port ) {
 	return ( tcp_demux ( port ) ? -EADDRINUSE : port );
 }
 
+/**
+ * Calculate maximum receive window
+ *
+ * @ret max_win		Maximum receive window
+ *
+ * Segments received out of order are held on the receive queue until
+ * the gap is filled, so the window is limited to what the heap could
+ * hold.  Each queued segment occupies a receive buffer somewhat larger
+ * than its payload, and the heap is shared with everything else, so
+ * allow for half of the free memory.
+ */
+static uint32_t tcp_max_rcv_win ( void ) {
+	size_t max_win = ( freemem / 2 );
+
+	/* Ensure that the largest window can be advertised */
+	linker_assert ( ( TCP_MAX_WINDOW_SIZE <=
+			  ( 0xffffUL << TCP_RX_WINDOW_SCALE ) ),
+			__fix_tcp_rx_window_scale__ );
+
+	if ( max_win > TCP_MAX_WINDOW_SIZE )
+		max_win = TCP_MAX_WINDOW_SIZE;
+	if ( max_win < TCP_MIN_WINDOW_SIZE )
+		max_win = TCP_MIN_WINDOW_SIZE;
+	return max_win;
+}
+
+/**
+ * Calculate share of the total receive window
+ *
+ * @v tcp		TCP connection
+ * @ret max_win		Maximum receive window
+ *
+ * Each connection sizes its window from the heap when it is opened,
+ * but parallel connections (e.g. the ranges of a single download)
+ * would then each claim most of the same free memory.  All open
+ * connections therefore share a total of TCP_MAX_WINDOW_SIZE.  The
+ * share is recalculated whenever the window is expanded, and since
+ * an advertised window is never retracted, a connection whose share
+ * has shrunk simply stops reopening its window beyond the new share.
+ */
+static uint32_t tcp_rcv_win_share ( struct tcp_connection *tcp ) {
+	struct tcp_connection *other;
+	unsigned int count = 0;
+	uint32_t max_win;
+
+	list_for_each_entry ( other, &tcp_conns, list )
+		count++;
+	max_win = ( TCP_MAX_WINDOW_SIZE / ( count ? count : 1 ) );
+	if ( max_win < TCP_MIN_WINDOW_SIZE )
+		max_win = TCP_MIN_WINDOW_SIZE;
+	if ( max_win > tcp->max_rcv_win )
+		max_win = tcp->max_rcv_win;
+	return max_win;
+}
+
 /**
  * Open a TCP connection
  *
@@ -284,7 +345,7 @@ static int tcp_open ( struct interface *xfer, struct sockaddr *peer,
 	tcp->tcp_state = TCP_STATE_SENT ( TCP_SYN );
 	tcp_dump_state ( tcp );
 	tcp->snd_seq = random();
-	tcp->max_rcv_win = TCP_MAX_WINDOW_SIZE;
+	tcp->max_rcv_win = tcp_max_rcv_win();
 	INIT_LIST_HEAD ( &tcp->tx_queue );
 	INIT_LIST_HEAD ( &tcp->rx_queue );
 	memcpy ( &tcp->peer, st_peer, sizeof ( tcp->peer ) );
@@ -308,7 +369,8 @@ static int tcp_open ( struct interface *xfer, struct sockaddr *peer,
 		goto err;
 	}
 	tcp->local_port = port;
-	DBGC ( tcp, "TCP %p bound to port %d\n", tcp, tcp->local_port );
+	DBGC ( tcp, "TCP %p bound to port %d, maximum window %d\n",
+	       tcp, tcp->local_port, tcp->max_rcv_win );
 
 	/* Start timer to initiate SYN */
 	start_timer_nodelay ( &tcp->timer );
@@ -508,9 +570,13 @@ static void tcp_xmit ( struct tcp_connection *tcp ) {
 	struct tcp_header *tcphdr;
 	struct tcp_mss_option *mssopt;
 	struct tcp_window_scale_padded_option *wsopt;
+	struct tcp_sack_permitted_padded_option *spopt;
 	struct tcp_timestamp_padded_option *tsopt;
+	struct tcp_sack_padded_option *sackopt;
+	struct tcp_sack_block *sack;
 	void *payload;
 	unsigned int flags;
+	unsigned int i;
 	size_t len = 0;
 	uint32_t seq_len;
 	uint32_t app_win;
@@ -567,7 +633,7 @@ static void tcp_xmit ( struct tcp_connection *tcp ) {
 	tcp_process_tx_queue ( tcp, len, iobuf, 0 );
 
 	/* Expand receive window if possible */
-	max_rcv_win = tcp->max_rcv_win;
+	max_rcv_win = tcp_rcv_win_share ( tcp );
 	app_win = xfer_window ( &tcp->xfer );
 	if ( max_rcv_win > app_win )
 		max_rcv_win = app_win;
@@ -590,6 +656,29 @@ static void tcp_xmit ( struct tcp_connection *tcp ) {
 		wsopt->wsopt.kind = TCP_OPTION_WS;
 		wsopt->wsopt.length = sizeof ( wsopt->wsopt );
 		wsopt->wsopt.scale = TCP_RX_WINDOW_SCALE;
+		spopt = iob_push ( iobuf, sizeof ( *spopt ) );
+		memset ( spopt->nop, TCP_OPTION_NOP, sizeof ( spopt->nop ) );
+		spopt->spopt.kind = TCP_OPTION_SACK_PERMITTED;
+		spopt->spopt.length = sizeof ( spopt->spopt );
+	}
+	if ( tcp->sack_count && ( len == 0 ) ) {
+		/* Selective acknowledgements are sent only on segments
+		 * without data, which keeps data segments within
+		 * TCP_PATH_MTU.
+		 */
+		sack = iob_push ( iobuf, ( tcp->sack_count *
+					   sizeof ( *sack ) ) );
+		for ( i = 0 ; i < tcp->sack_count ; i++ ) {
+			sack[i].left = htonl ( tcp->sack[i].left );
+			sack[i].right = htonl ( tcp->sack[i].right );
+		}
+		sackopt = iob_push ( iobuf, sizeof ( *sackopt ) );
+		memset ( sackopt->nop, TCP_OPTION_NOP,
+			 sizeof ( sackopt->nop ) );
+		sackopt->sackopt.kind = TCP_OPTION_SACK;
+		sackopt->sackopt.length = ( sizeof ( sackopt->sackopt ) +
+					    ( tcp->sack_count *
+					      sizeof ( *sack ) ) );
 	}
 	if ( ( flags & TCP_SYN ) || ( tcp->flags & TCP_TS_ENABLED ) ) {
 		tsopt = iob_push ( iobuf, sizeof ( *tsopt ) );
@@ -804,6 +893,14 @@ static void tcp_rx_opts ( struct tcp_connection *tcp, const void *data,
 		case TCP_OPTION_WS:
 			options->wsopt = data;
 			break;
+		case TCP_OPTION_SACK_PERMITTED:
+			options->spopt = data;
+			break;
+		case TCP_OPTION_SACK:
+			/* We never have enough data in flight to
+			 * make use of selective acknowledgements
+			 */
+			break;
 		case TCP_OPTION_TS:
 			options->tsopt = data;
 			break;
@@ -864,6 +961,8 @@ static int tcp_rx_syn ( struct tcp_connection *tcp, uint32_t seq,
 			tcp->snd_win_scale = options->wsopt->scale;
 			tcp->rcv_win_scale = TCP_RX_WINDOW_SCALE;
 		}
+		if ( options->spopt )
+			tcp->flags |= TCP_SACK_ENABLED;
 	}
 
 	/* Ignore duplicate SYN */
@@ -1151,6 +1250,96 @@ static void tcp_process_rx_queue ( struct tcp_connection *tcp ) {
 	}
 }
 
+/**
+ * Find selective acknowledgement block
+ *
+ * @v tcp		TCP connection
+ * @v seq		SEQ value in SACK block (in host-endian order)
+ * @v sack		SACK block to fill in (in host-endian order)
+ * @ret len		Length of SACK block, or zero if not found
+ */
+static uint32_t tcp_sack_block ( struct tcp_connection *tcp, uint32_t seq,
+				 struct tcp_sack_block *sack ) {
+	struct io_buffer *iobuf;
+	struct tcp_rx_queued_header *tcpqhdr;
+	uint32_t left = tcp->rcv_ack;
+	uint32_t right = tcp->rcv_ack;
+	uint32_t end;
+
+	/* Find contiguous range of queued sequence space containing
+	 * seq.  The receive queue is sorted by sequence number.
+	 */
+	list_for_each_entry ( iobuf, &tcp->rx_queue, list ) {
+		tcpqhdr = iobuf->data;
+		end = ( tcpqhdr->seq + iob_len ( iobuf ) - sizeof ( *tcpqhdr ) +
+			( ( tcpqhdr->flags & TCP_FIN ) ? 1 : 0 ) );
+
+		/* Start a new range at each gap, unless seq has
+		 * already been passed
+		 */
+		if ( tcp_cmp ( tcpqhdr->seq, right ) > 0 ) {
+			if ( tcp_cmp ( tcpqhdr->seq, seq ) > 0 )
+				break;
+			left = tcpqhdr->seq;
+		}
+		if ( tcp_cmp ( end, right ) > 0 )
+			right = end;
+	}
+
+	/* Check that range contains seq */
+	if ( ( tcp_cmp ( seq, left ) < 0 ) || ( tcp_cmp ( seq, right ) >= 0 ) )
+		return 0;
+
+	sack->left = left;
+	sack->right = right;
+	return ( right - left );
+}
+
+/**
+ * Update selective acknowledgement list
+ *
+ * @v tcp		TCP connection
+ * @v seq		SEQ value in first SACK block (in host-endian order)
+ * @ret count		Number of SACK blocks
+ *
+ * The first block contains the most recently received segment, and
+ * the remaining blocks repeat the most recently reported blocks that
+ * are still outstanding, as per RFC 2018 section 4.
+ */
+static unsigned int tcp_sack ( struct tcp_connection *tcp, uint32_t seq ) {
+	struct tcp_sack_block sack[TCP_SACK_MAX];
+	unsigned int count = 0;
+	unsigned int old;
+	unsigned int i;
+
+	/* Do nothing unless SACK is enabled */
+	if ( ! ( tcp->flags & TCP_SACK_ENABLED ) )
+		return 0;
+
+	/* Report block containing the most recent segment first */
+	if ( tcp_sack_block ( tcp, seq, &sack[count] ) )
+		count++;
+
+	/* Repeat previously reported blocks that are still outstanding */
+	for ( old = 0 ; ( ( old < tcp->sack_count ) &&
+			  ( count < TCP_SACK_MAX ) ) ; old++ ) {
+		if ( ! tcp_sack_block ( tcp, tcp->sack[old].left,
+					&sack[count] ) )
+			continue;
+		for ( i = 0 ; i < count ; i++ ) {
+			if ( sack[i].left == sack[count].left )
+				break;
+		}
+		if ( i == count )
+			count++;
+	}
+
+	/* Record list */
+	memcpy ( tcp->sack, sack, ( count * sizeof ( sack[0] ) ) );
+	tcp->sack_count = count;
+	return count;
+}
+
 /**
  * Process received packet
  *
@@ -1278,6 +1467,9 @@ static int tcp_rx ( struct io_buffer *iobuf,
 	/* Process receive queue */
 	tcp_process_rx_queue ( tcp );
 
+	/* Update selective acknowledgements */
+	tcp_sack ( tcp, seq );
+
 	/* Dump out any state change as a result of the received packet */
 	tcp_dump_state ( tcp );
 
@@ -1350,6 +1542,9 @@ static unsigned int tcp_discard ( void ) {
 			list_del ( &iobuf->list );
 			free_iob ( iobuf );
 
+			/* Stop reporting the discarded data */
+			tcp_sack ( tcp, tcp->rcv_ack );
+
 			/* Report discard */
 			discarded++;
 			break;
@@ -66,6 +66,9 @@ FILE_LICENCE ( GPL2_OR_LATER );
 #define EIO_CONTENT_LENGTH __einfo_error ( EINFO_EIO_CONTENT_LENGTH )
 #define EINFO_EIO_CONTENT_LENGTH \
 	__einfo_uniqify ( EINFO_EIO, 0x02, "Content length mismatch" )
+#define EIO_RANGE __einfo_error ( EINFO_EIO_RANGE )
+#define EINFO_EIO_RANGE \
+	__einfo_uniqify ( EINFO_EIO, 0x03, "Range request ignored" )
 #define EINVAL_RESPONSE __einfo_error ( EINFO_EINVAL_RESPONSE )
 #define EINFO_EINVAL_RESPONSE \
 	__einfo_uniqify ( EINFO_EINVAL, 0x01, "Invalid content length" )
@@ -118,6 +121,8 @@ enum http_flags {
 	HTTP_DIGEST_AUTH = 0x0040,
 	/** Socket must be reopened */
 	HTTP_REOPEN_SOCKET = 0x0080,
+	/** Server accepts byte range requests */
+	HTTP_ACCEPT_RANGES = 0x0100,
 };
 
 /** HTTP receive state */
@@ -518,6 +523,23 @@ static int http_rx_connection ( struct http_request *http, char *value ) {
 	return 0;
 }
 
+/**
+ * Handle HTTP Accept-Ranges header
+ *
+ * @v http		HTTP request
+ * @v value		HTTP header value
+ * @ret rc		Return status code
+ */
+static int http_rx_accept_ranges ( struct http_request *http, char *value ) {
+
+	if ( strcasecmp ( value, "bytes" ) == 0 ) {
+		/* Mark resource as being available in byte ranges */
+		http->flags |= HTTP_ACCEPT_RANGES;
+	}
+
+	return 0;
+}
+
 /**
  * Handle WWW-Authenticate Basic header
  *
@@ -745,6 +767,10 @@ static struct http_header_handler http_header_handlers[] = {
 		.header = "Connection",
 		.rx = http_rx_connection,
 	},
+	{
+		.header = "Accept-Ranges",
+		.rx = http_rx_accept_ranges,
+	},
 	{
 		.header = "WWW-Authenticate",
 		.rx = http_rx_www_authenticate,
@@ -765,6 +791,7 @@ static struct http_header_handler http_header_handlers[] = {
  */
 static int http_rx_header ( struct http_request *http, char *header ) {
 	struct http_header_handler *handler;
+	struct block_device_capacity capacity;
 	char *separator;
 	char *value;
 	int rc;
@@ -784,9 +811,33 @@ static int http_rx_header ( struct http_request *http, char *header ) {
 			DBGC ( http, "HTTP %p start of data\n", http );
 			http->rx_state = ( http->chunked ?
 					   HTTP_RX_CHUNK_LEN : HTTP_RX_DATA );
-			if ( ( http->partial_len != 0 ) &&
-			     ( ! ( http->flags & HTTP_TRY_AGAIN ) ) ) {
+			if ( http->flags & HTTP_TRY_AGAIN )
+				return 0;
+			if ( http->partial_len != 0 ) {
+				/* A server ignoring the Range header
+				 * would overwrite the wrong part of
+				 * the buffer
+				 */
+				if ( http->code != 206 ) {
+					DBGC ( http, "HTTP %p range not "
+					       "satisfied\n", http );
+					return -EIO_RANGE;
+				}
 				http->remaining = http->partial_len;
+			} else if ( ( http->flags & HTTP_ACCEPT_RANGES ) &&
+				    ( http->code == 200 ) &&
+				    ( http->remaining != 0 ) &&
+				    ( ! http->chunked ) ) {
+				/* Report that the resource may also
+				 * be fetched using block reads.  The
+				 * final block may be incomplete.
+				 */
+				capacity.blocks = ( ( http->remaining +
+						      HTTP_BLKSIZE - 1 ) /
+						    HTTP_BLKSIZE );
+				capacity.blksize = HTTP_BLKSIZE;
+				capacity.max_count = -1U;
+				block_capacity ( &http->xfer, &capacity );
 			}
 			return 0;
 		} else {
@@ -1405,8 +1456,12 @@ static int http_partial_read ( struct http_request *http,
 			       struct interface *partial,
 			       size_t offset, userptr_t buffer, size_t len ) {
 
-	/* Sanity check */
-	if ( http_xfer_window ( http ) == 0 )
+	/* Sanity check.  A partial read may also replace an initial
+	 * request which has not yet been transmitted.
+	 */
+	if ( ( http_xfer_window ( http ) == 0 ) &&
+	     ! ( ( http->flags == HTTP_TX_PENDING ) &&
+		 ( http->rx_state == HTTP_RX_RESPONSE ) ) )
 		return -EBUSY;
 
 	/* Initialise partial transfer parameters */
@@ -1416,7 +1471,9 @@ static int http_partial_read ( struct http_request *http,
 
 	/* Schedule request */
 	http->rx_state = HTTP_RX_RESPONSE;
-	http->flags = ( HTTP_TX_PENDING | HTTP_CLIENT_KEEPALIVE );
+	http->flags &= ( HTTP_REOPEN_SOCKET | HTTP_BASIC_AUTH |
+			 HTTP_DIGEST_AUTH );
+	http->flags |= ( HTTP_TX_PENDING | HTTP_CLIENT_KEEPALIVE );
 	if ( ! len )
 		http->flags |= HTTP_HEAD_ONLY;
 	process_add ( &http->process );
@@ -1441,10 +1498,15 @@ static int http_partial_read ( struct http_request *http,
 static int http_block_read ( struct http_request *http,
 			     struct interface *block,
 			     uint64_t lba, unsigned int count,
-			     userptr_t buffer, size_t len __unused ) {
+			     userptr_t buffer, size_t len ) {
+	size_t partial_len = ( count * HTTP_BLKSIZE );
+
+	/* Never read beyond the end of the buffer */
+	if ( partial_len > len )
+		partial_len = len;
 
 	return http_partial_read ( http, block, ( lba * HTTP_BLKSIZE ),
-				   buffer, ( count * HTTP_BLKSIZE ) );
+				   buffer, partial_len );
 }
 
 /**
@@ -71,6 +71,9 @@ FEATURE ( FEATURE_PROTOCOL, "TFTP", DHCP_EB_FEATURE_TFTP, 1 );
 #define EINVAL_MC_INVALID_PORT __einfo_error ( EINFO_EINVAL_MC_INVALID_PORT )
 #define EINFO_EINVAL_MC_INVALID_PORT __einfo_uniqify \
 	( EINFO_EINVAL, 0x07, "Invalid multicast port" )
+#define EINVAL_WINDOWSIZE __einfo_error ( EINFO_EINVAL_WINDOWSIZE )
+#define EINFO_EINVAL_WINDOWSIZE __einfo_uniqify \
+	( EINFO_EINVAL, 0x08, "Invalid windowsize" )
 
 /**
  * A TFTP request
@@ -104,6 +107,13 @@ struct tftp_request {
 	 * "tsize" option, this value will be zero.
 	 */
 	unsigned long tsize;
+	/** Receive window
+	 *
+	 * The window size is the "windowsize" option negotiated with
+	 * the TFTP server.  (If the TFTP server does not support this
+	 * option, this will default to 1).
+	 */
+	struct tftp_window window;
 	
 	/** Server port
 	 *
@@ -336,6 +346,7 @@ static int tftp_send_rrq ( struct tftp_request *tftp ) {
 		+ 5 + 1 /* "octet" + NUL */
 		+ 7 + 1 + 5 + 1 /* "blksize" + NUL + ddddd + NUL */
 		+ 5 + 1 + 1 + 1 /* "tsize" + NUL + "0" + NUL */ 
+		+ 10 + 1 + 5 + 1 /* "windowsize" + NUL + ddddd + NUL */
 		+ 9 + 1 + 1 /* "multicast" + NUL + NUL */ );
 	iobuf = xfer_alloc_iob ( &tftp->socket, len );
 	if ( ! iobuf )
@@ -356,6 +367,13 @@ static int tftp_send_rrq ( struct tftp_request *tftp ) {
 					    iob_tailroom ( iobuf ),
 					    "blksize%c%zd%ctsize%c0",
 					    0, blksize, 0, 0 ) + 1 );
+		/* A multicast server cannot rewind for a single client */
+		if ( ! ( tftp->flags & TFTP_FL_RRQ_MULTICAST ) ) {
+			iob_put ( iobuf, snprintf ( iobuf->tail,
+						    iob_tailroom ( iobuf ),
+						    "windowsize%c%d", 0,
+						    TFTP_MAX_WINDOWSIZE ) + 1 );
+		}
 	}
 	if ( tftp->flags & TFTP_FL_RRQ_MULTICAST ) {
 		iob_put ( iobuf, snprintf ( iobuf->tail,
@@ -385,6 +403,7 @@ static int tftp_send_ack ( struct tftp_request *tftp ) {
 
 	/* Determine next required block number */
 	block = bitmap_first_gap ( &tftp->bitmap );
+	tftp->window.acked = block;
 	DBGC2 ( tftp, "TFTP %p sending ACK for block %d\n", tftp, block );
 
 	/* Allocate buffer */
@@ -511,6 +530,7 @@ static void tftp_timer_expired ( struct retry_timer *timer, int fail ) {
 				bitmap_free ( &tftp->bitmap );
 				memset ( &tftp->bitmap, 0,
 					 sizeof ( tftp->bitmap ) );
+				tftp->window.acked = 0;
 
 				/* Reopen on standard TFTP port */
 				tftp->port = TFTP_PORT;
@@ -556,6 +576,31 @@ static int tftp_process_blksize ( struct tftp_request *tftp,
 	return 0;
 }
 
+/**
+ * Process TFTP "windowsize" option
+ *
+ * @v tftp		TFTP connection
+ * @v value		Option value
+ * @ret rc		Return status code
+ */
+static int tftp_process_windowsize ( struct tftp_request *tftp,
+				     const char *value ) {
+	unsigned long windowsize;
+	char *end;
+
+	windowsize = strtoul ( value, &end, 10 );
+	if ( *end || ( windowsize == 0 ) ||
+	     ( windowsize > TFTP_MAX_WINDOWSIZE ) ) {
+		DBGC ( tftp, "TFTP %p got invalid windowsize \"%s\"\n",
+		       tftp, value );
+		return -EINVAL_WINDOWSIZE;
+	}
+	tftp->window.size = windowsize;
+	DBGC ( tftp, "TFTP %p windowsize=%d\n", tftp, tftp->window.size );
+
+	return 0;
+}
+
 /**
  * Process TFTP "tsize" option
  *
@@ -665,6 +710,7 @@ struct tftp_option {
 static struct tftp_option tftp_options[] = {
 	{ "blksize", tftp_process_blksize },
 	{ "tsize", tftp_process_tsize },
+	{ "windowsize", tftp_process_windowsize },
 	{ "multicast", tftp_process_multicast },
 	{ NULL, NULL }
 };
@@ -776,6 +822,74 @@ static int tftp_rx_oack ( struct tftp_request *tftp, void *buf, size_t len ) {
 	return rc;
 }
 
+/**
+ * Calculate block index of received DATA
+ *
+ * @v window		TFTP receive window
+ * @v bitmap		Block bitmap
+ * @v number		Block number from DATA packet
+ * @ret block		Block index, or -1U for an invalid block number
+ *
+ * The 16-bit block number wraps around, so it is interpreted relative
+ * to the first missing block.  A full window may straddle the wrap,
+ * and stale retransmissions may arrive from before it.
+ */
+unsigned int tftp_window_block ( struct tftp_window *window,
+				 struct bitmap *bitmap,
+				 unsigned int number ) {
+	unsigned int first_gap = bitmap_first_gap ( bitmap );
+	unsigned int block;
+
+	block = ( ( first_gap + 1 ) & ~0xffff );
+	block += ( number - 1 );
+	if ( window->size > 1 ) {
+		if ( ( int ) ( first_gap - block ) > 0x8000 ) {
+			block += 0x10000;
+		} else if ( ( ( int ) ( block - first_gap ) > 0x8000 ) &&
+			    ( block >= 0x10000 ) ) {
+			block -= 0x10000;
+		}
+	}
+	return block;
+}
+
+/**
+ * Record received DATA block
+ *
+ * @v window		TFTP receive window
+ * @v bitmap		Block bitmap
+ * @v block		Block index
+ * @ret ack		Acknowledgement should be sent now
+ *
+ * Blocks are acknowledged once per window.  A block arriving ahead of
+ * the first missing block acknowledges the last in-order block
+ * immediately, which makes the server rewind and resend the window
+ * from there.  Blocks that have already been received are ignored.
+ */
+int tftp_window_rx ( struct tftp_window *window, struct bitmap *bitmap,
+		     unsigned int block ) {
+	unsigned int first_gap = bitmap_first_gap ( bitmap );
+
+	/* Mark block as received */
+	bitmap_set ( bitmap, block );
+
+	/* Acknowledge every block in lock-step mode */
+	if ( window->size <= 1 )
+		return 1;
+
+	/* Acknowledge final block */
+	if ( bitmap_full ( bitmap ) )
+		return 1;
+
+	/* Acknowledge a block ahead of a gap, once per gap */
+	if ( ( block > first_gap ) && ( first_gap != window->acked ) )
+		return 1;
+
+	/* Acknowledge each completed window */
+	return ( ( bitmap_first_gap ( bitmap ) - window->acked ) >=
+		 window->size );
+}
+
 /**
  * Receive DATA
  *
@@ -810,13 +924,13 @@ static int tftp_rx_data ( struct tftp_request *tftp,
 	}
 
 	/* Calculate block number */
-	block = ( ( bitmap_first_gap ( &tftp->bitmap ) + 1 ) & ~0xffff );
-	if ( data->block == 0 && block == 0 ) {
+	block = tftp_window_block ( &tftp->window, &tftp->bitmap,
+				    ntohs ( data->block ) );
+	if ( block == -1U ) {
 		DBGC ( tftp, "TFTP %p received data block 0\n", tftp );
 		rc = -EINVAL;
 		goto done;
 	}
-	block += ( ntohs ( data->block ) - 1 );
 
 	/* Extract data */
 	offset = ( block * tftp->blksize );
@@ -844,11 +958,17 @@ static int tftp_rx_data ( struct tftp_request *tftp,
 	if ( ( rc = tftp_presize ( tftp, ( offset + data_len ) ) ) != 0 )
 		goto done;
 
-	/* Mark block as received */
-	bitmap_set ( &tftp->bitmap, block );
-
-	/* Acknowledge block */
-	tftp_send_packet ( tftp );
+	/* Mark block as received, and acknowledge it if the window
+	 * is complete.  Otherwise, the retransmission timer will
+	 * acknowledge the blocks received so far should the rest of
+	 * the window fail to arrive.
+	 */
+	if ( tftp_window_rx ( &tftp->window, &tftp->bitmap, block ) ) {
+		tftp_send_packet ( tftp );
+	} else {
+		stop_timer ( &tftp->timer );
+		start_timer ( &tftp->timer );
+	}
 
 	/* If all blocks have been received, finish. */
 	if ( bitmap_full ( &tftp->bitmap ) )
@@ -1077,6 +1197,7 @@ static int tftp_core_open ( struct interface *xfer, struct uri *uri,
 	timer_init ( &tftp->timer, tftp_timer_expired, &tftp->refcnt );
 	tftp->uri = uri_get ( uri );
 	tftp->blksize = TFTP_DEFAULT_BLKSIZE;
+	tftp->window.size = TFTP_DEFAULT_WINDOWSIZE;
 	tftp->flags = flags;
 
 	/* Open socket */
@@ -380,6 +380,9 @@ static void validator_xfer_close ( struct validator *validator, int rc ) {
 	}
 	DBGC2 ( validator, "VALIDATOR %p transfer complete\n", validator );
 
+	/* Release unused buffer space */
+	xferbuf_trim ( &validator->buffer );
+
 	/* Process completed download */
 	assert ( validator->done != NULL );
 	if ( ( rc = validator->done ( validator, validator->buffer.data,
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+FILE_LICENCE ( GPL2_OR_LATER );
+
+/** @file
+ *
+ * Image download buffer benchmark
+ *
+ * Downloads a large image from the "dlserver" test server (see
+ * downloader_server.c), once with the file size announced in advance
+ * (as for HTTP with a Content-Length, or TFTP with "tsize") and once
+ * without (as for chunked HTTP, or TFTP without "tsize").  The time
+ * taken should be similar in all cases.
+ *
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include <ipxe/timer.h>
+#include <ipxe/image.h>
+#include "downloader_server.h"
+
+/** Image size (in MB) */
+#define DOWNLOADER_BENCH_MB 256
+
+/** Image size */
+#define DOWNLOADER_BENCH_LEN ( DOWNLOADER_BENCH_MB * 1024 * 1024 )
+
+/** Number of packets delivered per process step */
+#define DOWNLOADER_BENCH_BURST 64
+
+/** A download buffer benchmark */
+struct downloader_bench {
+	/** Name */
+	const char *name;
+	/** Test server download */
+	struct downloader_server server;
+};
+
+/** Define a download buffer benchmark */
+#define DOWNLOADER_BENCH( _name, _blksize, _presize ) {			\
+	.name = _name,							\
+	.server = {							\
+		.len = DOWNLOADER_BENCH_LEN,				\
+		.blksize = _blksize,					\
+		.burst = DOWNLOADER_BENCH_BURST,			\
+		.presize = _presize,					\
+	},								\
+}
+
+/**
+ * Run download buffer benchmark
+ *
+ * @v bench		Benchmark
+ */
+static void downloader_bench_run ( struct downloader_bench *bench ) {
+	struct image *image;
+	unsigned long start;
+	unsigned long elapsed;
+	unsigned long ms;
+	int rc;
+
+	/* Download image */
+	start = currticks();
+	if ( ( rc = downloader_server_fetch ( &bench->server,
+					      &image ) ) != 0 ) {
+		printf ( "%s: failed: %s\n", bench->name, strerror ( rc ) );
+		return;
+	}
+	elapsed = ( currticks() - start );
+
+	/* Report result */
+	if ( image->len != DOWNLOADER_BENCH_LEN ) {
+		printf ( "%s: wrong length %zd\n", bench->name, image->len );
+		goto done;
+	}
+	ms = ( ( elapsed * 1000ULL ) / TICKS_PER_SEC );
+	if ( ! ms )
+		ms = 1;
+	printf ( "%s: %d MB in %ld ms (%ld MB/s)\n", bench->name,
+		 DOWNLOADER_BENCH_MB, ms,
+		 ( ( DOWNLOADER_BENCH_MB * 1000UL ) / ms ) );
+
+ done:
+	image_put ( image );
+}
+
+/** Download buffer benchmarks */
+static struct downloader_bench downloader_benches[] = {
+	DOWNLOADER_BENCH ( "HTTP with Content-Length", 1460, 1 ),
+	DOWNLOADER_BENCH ( "HTTP chunked", 1460, 0 ),
+	DOWNLOADER_BENCH ( "TFTP with tsize", 512, 1 ),
+	DOWNLOADER_BENCH ( "TFTP without tsize", 512, 0 ),
+};
+
+/**
+ * Benchmark image download buffers
+ *
+ */
+void downloader_bench ( void ) {
+	unsigned int i;
+
+	for ( i = 0 ; i < ( sizeof ( downloader_benches ) /
+			    sizeof ( downloader_benches[0] ) ) ; i++ ) {
+		downloader_bench_run ( &downloader_benches[i] );
+	}
+}
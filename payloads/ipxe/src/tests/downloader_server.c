@@ -0,0 +1,425 @@
+/*
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+FILE_LICENCE ( GPL2_OR_LATER );
+
+/** @file
+ *
+ * Image downloader test server
+ *
+ * The "dlserver" URI scheme plays the part of an HTTP server without
+ * touching the network.  Each connection streams the whole file
+ * unless a block read is issued before it starts, in which case it
+ * fills the requested range instead.
+ *
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <ipxe/refcnt.h>
+#include <ipxe/iobuf.h>
+#include <ipxe/xfer.h>
+#include <ipxe/open.h>
+#include <ipxe/uri.h>
+#include <ipxe/process.h>
+#include <ipxe/blockdev.h>
+#include <ipxe/uaccess.h>
+#include <ipxe/image.h>
+#include <ipxe/downloader.h>
+#include "downloader_server.h"
+
+/** Period of the test file contents
+ *
+ * A prime, so that data delivered to the wrong offset by any multiple
+ * of a block or packet size is still detected.
+ */
+#define DOWNLOADER_SERVER_PERIOD 251
+
+/** Maximum number of steps before giving up */
+#define DOWNLOADER_SERVER_MAX_STEPS 100000
+
+/** Current download */
+static struct downloader_server *dlserver;
+
+/** Test file contents, starting at any offset within one period */
+static uint8_t downloader_server_data[ DOWNLOADER_SERVER_MAX_BLKSIZE +
+				       DOWNLOADER_SERVER_PERIOD ];
+
+/** A test server connection */
+struct downloader_server_conn {
+	/** Reference count */
+	struct refcnt refcnt;
+	/** Data transfer interface */
+	struct interface xfer;
+	/** Block data interface */
+	struct interface block;
+	/** Process */
+	struct process process;
+	/** Streaming has started */
+	int streaming;
+	/** Block read is in progress */
+	int reading;
+	/** Block read will fail */
+	int failing;
+	/** Current position */
+	size_t pos;
+	/** End position */
+	size_t end;
+	/** Block read buffer */
+	userptr_t buffer;
+	/** Offset of block read buffer */
+	size_t offset;
+};
+
+/**
+ * Get byte of test file
+ *
+ * @v offset		Offset
+ * @ret byte		Byte at offset
+ */
+uint8_t downloader_server_byte ( size_t offset ) {
+	return ( ( offset % DOWNLOADER_SERVER_PERIOD ) + 1 );
+}
+
+/**
+ * Get test file contents
+ *
+ * @v offset		Offset
+ * @ret data		Test file contents from offset
+ */
+static const void * downloader_server_data_at ( size_t offset ) {
+	return &downloader_server_data[ offset % DOWNLOADER_SERVER_PERIOD ];
+}
+
+/**
+ * Close test server connection
+ *
+ * @v conn		Connection
+ * @v rc		Reason for close
+ */
+static void downloader_server_close ( struct downloader_server_conn *conn,
+				      int rc ) {
+
+	process_del ( &conn->process );
+	intf_shutdown ( &conn->block, rc );
+	intf_shutdown ( &conn->xfer, rc );
+}
+
+/**
+ * Stream data from test server connection
+ *
+ * @v conn		Connection
+ */
+static void downloader_server_stream ( struct downloader_server_conn *conn ) {
+	struct block_device_capacity capacity;
+	struct io_buffer *iobuf;
+	unsigned int i;
+	size_t len;
+
+	/* Report file size and capacity before the data */
+	if ( ! conn->streaming ) {
+		conn->streaming = 1;
+		conn->end = dlserver->len;
+		if ( dlserver->presize ) {
+			xfer_seek ( &conn->xfer, conn->end );
+			xfer_seek ( &conn->xfer, 0 );
+		}
+		if ( dlserver->capacity ) {
+			capacity.blocks = ( ( conn->end +
+					      DOWNLOADER_SERVER_BLKSIZE - 1 ) /
+					    DOWNLOADER_SERVER_BLKSIZE );
+			capacity.blksize = DOWNLOADER_SERVER_BLKSIZE;
+			capacity.max_count = -1U;
+			block_capacity ( &conn->xfer, &capacity );
+		}
+		return;
+	}
+
+	/* Send next packets of file */
+	for ( i = 0 ; i < dlserver->burst ; i++ ) {
+
+		/* Close connection at end of file */
+		if ( conn->pos == conn->end ) {
+			downloader_server_close ( conn, 0 );
+			return;
+		}
+
+		len = ( conn->end - conn->pos );
+		if ( len > dlserver->blksize )
+			len = dlserver->blksize;
+		iobuf = xfer_alloc_iob ( &conn->xfer, len );
+		if ( ! iobuf ) {
+			downloader_server_close ( conn, -ENOMEM );
+			return;
+		}
+		memcpy ( iob_put ( iobuf, len ),
+			 downloader_server_data_at ( conn->pos ), len );
+		conn->pos += len;
+		dlserver->streamed += len;
+		xfer_deliver_iob ( &conn->xfer, iobuf );
+	}
+}
+
+/**
+ * Fill block read buffer from test server connection
+ *
+ * @v conn		Connection
+ */
+static void downloader_server_fill ( struct downloader_server_conn *conn ) {
+	unsigned int i;
+	size_t len;
+
+	/* Fail the request, if applicable */
+	if ( conn->failing ) {
+		downloader_server_close ( conn, -EIO );
+		return;
+	}
+
+	/* Fill next part of range */
+	for ( i = 0 ; ( i < dlserver->burst ) &&
+		      ( conn->pos < conn->end ) ; i++ ) {
+		len = ( conn->end - conn->pos );
+		if ( len > dlserver->blksize )
+			len = dlserver->blksize;
+		copy_to_user ( conn->buffer, ( conn->pos - conn->offset ),
+			       downloader_server_data_at ( conn->pos ), len );
+		conn->pos += len;
+	}
+
+	/* Complete request at end of range */
+	if ( conn->pos == conn->end ) {
+		conn->reading = 0;
+		intf_restart ( &conn->block, 0 );
+	}
+}
+
+/**
+ * Step test server connection
+ *
+ * @v conn		Connection
+ */
+static void downloader_server_step ( struct downloader_server_conn *conn ) {
+
+	if ( conn->reading ) {
+		downloader_server_fill ( conn );
+	} else if ( conn->streaming || ( conn->pos == 0 ) ) {
+		downloader_server_stream ( conn );
+	}
+}
+
+/**
+ * Issue block read to test server connection
+ *
+ * @v conn		Connection
+ * @v data		Block data interface
+ * @v lba		Starting logical block address
+ * @v count		Number of blocks to transfer
+ * @v buffer		Data buffer
+ * @v len		Length of data buffer
+ * @ret rc		Return status code
+ */
+static int downloader_server_read ( struct downloader_server_conn *conn,
+				    struct interface *data, uint64_t lba,
+				    unsigned int count, userptr_t buffer,
+				    size_t len ) {
+
+	/* Refuse reads if applicable, or while busy */
+	if ( dlserver->refuse )
+		return -ENOTSUP;
+	if ( conn->streaming || conn->reading )
+		return -EBUSY;
+
+	/* Start read */
+	conn->offset = ( lba * DOWNLOADER_SERVER_BLKSIZE );
+	conn->pos = conn->offset;
+	conn->end = ( conn->offset + ( count * DOWNLOADER_SERVER_BLKSIZE ) );
+	if ( conn->end > ( conn->offset + len ) )
+		conn->end = ( conn->offset + len );
+	if ( conn->end > dlserver->len )
+		conn->end = dlserver->len;
+	conn->buffer = buffer;
+	conn->reading = 1;
+	conn->failing = ( ++dlserver->reads == dlserver->fail );
+	intf_plug_plug ( &conn->block, data );
+
+	return 0;
+}
+
+/** Test server connection data transfer interface operations */
+static struct interface_operation downloader_server_xfer_op[] = {
+	INTF_OP ( block_read, struct downloader_server_conn *,
+		  downloader_server_read ),
+	INTF_OP ( intf_close, struct downloader_server_conn *,
+		  downloader_server_close ),
+};
+
+/** Test server connection data transfer interface descriptor */
+static struct interface_descriptor downloader_server_xfer_desc =
+	INTF_DESC ( struct downloader_server_conn, xfer,
+		    downloader_server_xfer_op );
+
+/** Test server connection block data interface operations */
+static struct interface_operation downloader_server_block_op[] = {
+	INTF_OP ( intf_close, struct downloader_server_conn *,
+		  downloader_server_close ),
+};
+
+/** Test server connection block data interface descriptor */
+static struct interface_descriptor downloader_server_block_desc =
+	INTF_DESC ( struct downloader_server_conn, block,
+		    downloader_server_block_op );
+
+/** Test server connection process descriptor */
+static struct process_descriptor downloader_server_process_desc =
+	PROC_DESC ( struct downloader_server_conn, process,
+		    downloader_server_step );
+
+/**
+ * Open test server connection
+ *
+ * @v xfer		Data transfer interface
+ * @v uri		URI
+ * @ret rc		Return status code
+ */
+static int downloader_server_open ( struct interface *xfer,
+				    struct uri *uri __unused ) {
+	struct downloader_server_conn *conn;
+
+	conn = zalloc ( sizeof ( *conn ) );
+	if ( ! conn )
+		return -ENOMEM;
+	ref_init ( &conn->refcnt, NULL );
+	intf_init ( &conn->xfer, &downloader_server_xfer_desc,
+		    &conn->refcnt );
+	intf_init ( &conn->block, &downloader_server_block_desc,
+		    &conn->refcnt );
+	process_init ( &conn->process, &downloader_server_process_desc,
+		       &conn->refcnt );
+	dlserver->opens++;
+
+	intf_plug_plug ( &conn->xfer, xfer );
+	ref_put ( &conn->refcnt );
+	return 0;
+}
+
+/** Test server URI opener */
+struct uri_opener downloader_server_uri_opener __uri_opener = {
+	.scheme = "dlserver",
+	.open = downloader_server_open,
+};
+
+/** Download result */
+static int downloader_server_rc;
+
+/** Download has finished */
+static int downloader_server_done;
+
+/**
+ * Record download completion
+ *
+ * @v intf		Job control interface
+ * @v rc		Reason for close
+ */
+static void downloader_server_job_close ( struct interface *intf, int rc ) {
+	intf_restart ( intf, rc );
+	downloader_server_rc = rc;
+	downloader_server_done = 1;
+}
+
+/** Job control interface operations */
+static struct interface_operation downloader_server_job_op[] = {
+	INTF_OP ( intf_close, struct interface *,
+		  downloader_server_job_close ),
+};
+
+/** Job control interface descriptor */
+static struct interface_descriptor downloader_server_job_desc =
+	INTF_DESC_PURE ( downloader_server_job_op );
+
+/** Job control interface */
+static struct interface downloader_server_job =
+	INTF_INIT ( downloader_server_job_desc );
+
+/**
+ * Download image from test server
+ *
+ * @v server		Test server download
+ * @ret image		Downloaded image
+ * @ret rc		Return status code
+ *
+ * On success, the caller must drop the reference to the image.
+ */
+int downloader_server_fetch ( struct downloader_server *server,
+			      struct image **image ) {
+	struct uri *uri;
+	unsigned int steps;
+	unsigned int i;
+	int rc;
+
+	/* Apply defaults and sanity check */
+	*image = NULL;
+	if ( ! server->blksize )
+		server->blksize = DOWNLOADER_SERVER_MAX_BLKSIZE;
+	if ( ! server->burst )
+		server->burst = 1;
+	if ( server->blksize > DOWNLOADER_SERVER_MAX_BLKSIZE )
+		return -EINVAL;
+
+	/* Prepare test file contents */
+	for ( i = 0 ; i < sizeof ( downloader_server_data ) ; i++ )
+		downloader_server_data[i] = downloader_server_byte ( i );
+
+	/* Create image */
+	dlserver = server;
+	server->opens = 0;
+	server->reads = 0;
+	server->streamed = 0;
+	downloader_server_done = 0;
+	uri = parse_uri ( "dlserver://server/image" );
+	if ( ! uri )
+		return -ENOMEM;
+	*image = alloc_image ( uri );
+	uri_put ( uri );
+	if ( ! *image )
+		return -ENOMEM;
+
+	/* Download image */
+	if ( ( rc = create_downloader ( &downloader_server_job,
+					*image ) ) != 0 )
+		goto err;
+	for ( steps = 0 ; ! downloader_server_done ; steps++ ) {
+		if ( steps == DOWNLOADER_SERVER_MAX_STEPS ) {
+			rc = -ETIMEDOUT;
+			intf_restart ( &downloader_server_job, rc );
+			goto err;
+		}
+		step();
+	}
+	if ( ( rc = downloader_server_rc ) != 0 )
+		goto err;
+
+	return 0;
+
+ err:
+	image_put ( *image );
+	*image = NULL;
+	return rc;
+}
@@ -0,0 +1,44 @@
+#ifndef _DOWNLOADER_SERVER_H
+#define _DOWNLOADER_SERVER_H
+
+FILE_LICENCE ( GPL2_OR_LATER );
+
+#include <stdint.h>
+#include <ipxe/image.h>
+
+/** Largest packet delivered by the test server */
+#define DOWNLOADER_SERVER_MAX_BLKSIZE 16384
+
+/** Block size used for range requests to the test server */
+#define DOWNLOADER_SERVER_BLKSIZE 512
+
+/** A test server download */
+struct downloader_server {
+	/** File length */
+	size_t len;
+	/** Packet size (or zero for the largest packet size) */
+	size_t blksize;
+	/** Number of packets delivered per process step (or zero for one) */
+	unsigned int burst;
+	/** Announce file size before the data */
+	int presize;
+	/** Report block device capacity */
+	int capacity;
+	/** Refuse block reads */
+	int refuse;
+	/** Fail the n-th block read (or zero to fail none) */
+	unsigned int fail;
+
+	/** Number of connections opened */
+	unsigned int opens;
+	/** Number of block reads */
+	unsigned int reads;
+	/** Number of bytes streamed */
+	size_t streamed;
+};
+
+extern uint8_t downloader_server_byte ( size_t offset );
+extern int downloader_server_fetch ( struct downloader_server *server,
+				     struct image **image );
+
+#endif /* _DOWNLOADER_SERVER_H */
@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+FILE_LICENCE ( GPL2_OR_LATER );
+
+/** @file
+ *
+ * Image downloader tests
+ *
+ * Downloads are served by the "dlserver" test server (see
+ * downloader_server.c).
+ *
+ */
+
+/* Forcibly enable assertions */
+#undef NDEBUG
+
+#include <stdint.h>
+#include <ipxe/uaccess.h>
+#include <ipxe/image.h>
+#include <ipxe/test.h>
+#include "downloader_server.h"
+
+/**
+ * Run downloader test
+ *
+ * @v test		Downloader test
+ * @v file		Test code file
+ * @v line		Test code line
+ */
+static void downloader_okx ( struct downloader_server *test, const char *file,
+			     unsigned int line ) {
+	struct image *image;
+	uint8_t byte;
+	size_t offset;
+	size_t bad;
+
+	/* Download image */
+	okx ( downloader_server_fetch ( test, &image ) == 0, file, line );
+	if ( ! image )
+		return;
+
+	/* Check downloaded content */
+	okx ( image->len == test->len, file, line );
+	bad = 0;
+	for ( offset = 0 ; offset < image->len ; offset++ ) {
+		copy_from_user ( &byte, image->data, offset, sizeof ( byte ) );
+		if ( byte != downloader_server_byte ( offset ) )
+			bad++;
+	}
+	okx ( bad == 0, file, line );
+
+	image_put ( image );
+}
+#define downloader_ok( test ) \
+	downloader_okx ( test, __FILE__, __LINE__ )
+
+/** Parallel download */
+static struct downloader_server parallel = {
+	.len = ( ( 6 * 1024 * 1024 ) + 12345 ),
+	.presize = 1,
+	.capacity = 1,
+};
+
+/** Parallel download with a failed range request */
+static struct downloader_server retried = {
+	.len = ( ( 6 * 1024 * 1024 ) + 12345 ),
+	.presize = 1,
+	.capacity = 1,
+	.fail = 5,
+};
+
+/** Download without a reported capacity */
+static struct downloader_server single = {
+	.len = ( ( 6 * 1024 * 1024 ) + 12345 ),
+	.presize = 1,
+};
+
+/** Download from a server refusing range requests */
+static struct downloader_server refused = {
+	.len = ( ( 6 * 1024 * 1024 ) + 12345 ),
+	.presize = 1,
+	.capacity = 1,
+	.refuse = 1,
+};
+
+/** Download with an initial range request failing */
+static struct downloader_server abandoned = {
+	.len = ( ( 6 * 1024 * 1024 ) + 12345 ),
+	.presize = 1,
+	.capacity = 1,
+	.fail = 1,
+};
+
+/** Download too small for range requests */
+static struct downloader_server small = {
+	.len = 100000,
+	.presize = 1,
+	.capacity = 1,
+};
+
+/** Download without an announced file size (as for chunked HTTP) */
+static struct downloader_server chunked = {
+	.len = ( ( 6 * 1024 * 1024 ) + 12345 ),
+	.blksize = 1460,
+	.burst = 64,
+};
+
+/** Download without an announced file size (as for TFTP without tsize) */
+static struct downloader_server unsized = {
+	.len = ( ( 1024 * 1024 ) + 1 ),
+	.blksize = 512,
+	.burst = 64,
+};
+
+/**
+ * Perform image downloader self-tests
+ *
+ */
+static void downloader_test_exec ( void ) {
+
+	/* Range connections share the download */
+	downloader_ok ( &parallel );
+	ok ( parallel.opens == 5 );
+	ok ( parallel.reads > 0 );
+	ok ( parallel.streamed < parallel.len );
+
+	/* Failed range requests are retried */
+	downloader_ok ( &retried );
+	ok ( retried.opens > 5 );
+	ok ( retried.reads > retried.fail );
+	ok ( retried.streamed < retried.len );
+
+	/* Without a capacity, the original transfer does everything */
+	downloader_ok ( &single );
+	ok ( single.opens == 1 );
+	ok ( single.reads == 0 );
+	ok ( single.streamed == single.len );
+
+	/* Refused range requests leave the original transfer alone */
+	downloader_ok ( &refused );
+	ok ( refused.reads == 0 );
+	ok ( refused.streamed == refused.len );
+
+	/* Failing before any range request succeeds abandons them */
+	downloader_ok ( &abandoned );
+	ok ( abandoned.streamed == abandoned.len );
+
+	/* Small files are not split */
+	downloader_ok ( &small );
+	ok ( small.opens == 1 );
+	ok ( small.streamed == small.len );
+
+	/* Buffers grown without a file size are trimmed to the data */
+	downloader_ok ( &chunked );
+	ok ( chunked.opens == 1 );
+	ok ( chunked.streamed == chunked.len );
+	downloader_ok ( &unsized );
+	ok ( unsized.streamed == unsized.len );
+}
+
+/** Image downloader self-test */
+struct self_test downloader_test __self_test = {
+	.name = "downloader",
+	.exec = downloader_test_exec,
+};
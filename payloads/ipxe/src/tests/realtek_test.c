@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+FILE_LICENCE ( GPL2_OR_LATER );
+
+/** @file
+ *
+ * Realtek descriptor ring tests
+ *
+ * The rings are exercised on plain memory, with the test playing the
+ * part of the card by clearing ownership bits.
+ *
+ */
+
+/* Forcibly enable assertions */
+#undef NDEBUG
+
+#include <stdint.h>
+#include <string.h>
+#include <byteswap.h>
+#include <ipxe/mii.h>
+#include <ipxe/test.h>
+#include "drivers/net/realtek.h"
+
+/** Number of descriptors in the test ring */
+#define RING_TEST_COUNT 16
+
+/** Test descriptors */
+static struct realtek_descriptor ring_test_desc[RING_TEST_COUNT];
+
+/**
+ * Hand descriptors to the card
+ *
+ * @v ring		Descriptor ring
+ * @v count		Number of descriptors
+ */
+static void ring_test_give ( struct realtek_ring *ring, unsigned int count ) {
+	unsigned int idx;
+
+	while ( count-- ) {
+		idx = realtek_ring_index ( ring, ring->prod++ );
+		ring->desc[idx].flags = cpu_to_le16 ( RTL_DESC_OWN );
+	}
+}
+
+/**
+ * Complete descriptors as the card would
+ *
+ * @v ring		Descriptor ring
+ * @v offset		Offset from consumer counter of first descriptor
+ * @v count		Number of descriptors
+ */
+static void ring_test_release ( struct realtek_ring *ring,
+				unsigned int offset, unsigned int count ) {
+	unsigned int idx;
+
+	while ( count-- ) {
+		idx = realtek_ring_index ( ring, ( ring->cons + offset++ ) );
+		ring->desc[idx].flags &= ~cpu_to_le16 ( RTL_DESC_OWN );
+	}
+}
+
+/**
+ * Reset test ring
+ *
+ * @v ring		Descriptor ring
+ * @v counter		Initial producer and consumer counter
+ */
+static void ring_test_reset ( struct realtek_ring *ring,
+			      unsigned int counter ) {
+
+	memset ( ring_test_desc, 0, sizeof ( ring_test_desc ) );
+	realtek_init_ring ( ring, RING_TEST_COUNT, RTL_RDSAR );
+	ring->desc = ring_test_desc;
+	ring->prod = counter;
+	ring->cons = counter;
+}
+
+/**
+ * Perform Realtek descriptor ring self-tests
+ *
+ */
+static void realtek_test_exec ( void ) {
+	struct realtek_ring ring;
+
+	/* Ring geometry */
+	ring_test_reset ( &ring, 0 );
+	ok ( ring.count == RING_TEST_COUNT );
+	ok ( ring.len == sizeof ( ring_test_desc ) );
+	ok ( realtek_ring_index ( &ring, 0 ) == 0 );
+	ok ( realtek_ring_index ( &ring, 17 ) == 1 );
+	ok ( realtek_ring_index ( &ring, 0xffffffffUL ) ==
+	     ( RING_TEST_COUNT - 1 ) );
+
+	/* Nothing is completed on an empty ring */
+	ok ( realtek_ring_completed ( &ring ) == 0 );
+
+	/* Nothing is completed while the card owns everything */
+	ring_test_give ( &ring, 5 );
+	ok ( realtek_ring_completed ( &ring ) == 0 );
+
+	/* A batch stops at the first descriptor still owned */
+	ring_test_release ( &ring, 0, 3 );
+	ok ( realtek_ring_completed ( &ring ) == 3 );
+	ring_test_release ( &ring, 4, 1 );
+	ok ( realtek_ring_completed ( &ring ) == 3 );
+	ring.cons += 3;
+	ok ( realtek_ring_completed ( &ring ) == 0 );
+	ring_test_release ( &ring, 0, 1 );
+	ok ( realtek_ring_completed ( &ring ) == 2 );
+	ring.cons += 2;
+	ok ( ring.cons == ring.prod );
+
+	/* Descriptors beyond the producer are never counted */
+	ring_test_reset ( &ring, 0 );
+	ring_test_give ( &ring, 4 );
+	ring_test_release ( &ring, 0, RING_TEST_COUNT );
+	ok ( realtek_ring_completed ( &ring ) == 4 );
+
+	/* A full ring can be completed in a single batch */
+	ring_test_reset ( &ring, 0 );
+	ring_test_give ( &ring, RING_TEST_COUNT );
+	ring_test_release ( &ring, 0, RING_TEST_COUNT );
+	ok ( realtek_ring_completed ( &ring ) == RING_TEST_COUNT );
+
+	/* Batches wrap around the end of the ring */
+	ring_test_reset ( &ring, ( RING_TEST_COUNT - 2 ) );
+	ring_test_give ( &ring, 6 );
+	ok ( realtek_ring_index ( &ring, ring.prod ) == 4 );
+	ring_test_release ( &ring, 0, 5 );
+	ok ( realtek_ring_completed ( &ring ) == 5 );
+
+	/* Batches wrap around the counters overflowing */
+	ring_test_reset ( &ring, 0xfffffffdUL );
+	ring_test_give ( &ring, 8 );
+	ok ( ( ring.prod - ring.cons ) == 8 );
+	ring_test_release ( &ring, 0, 8 );
+	ok ( realtek_ring_completed ( &ring ) == 8 );
+	ring.cons += 8;
+	ok ( ring.cons == 5 );
+	ok ( realtek_ring_completed ( &ring ) == 0 );
+}
+
+/** Realtek descriptor ring self-test */
+struct self_test realtek_test __self_test = {
+	.name = "realtek",
+	.exec = realtek_test_exec,
+};
@@ -0,0 +1,482 @@
+/*
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+FILE_LICENCE ( GPL2_OR_LATER );
+
+/** @file
+ *
+ * TCP selective acknowledgement tests
+ *
+ * A connection is opened over a dummy network-layer protocol that
+ * captures transmitted segments, and the peer's segments are fed in
+ * out of order through tcp_rx().
+ *
+ */
+
+/* Forcibly enable assertions */
+#undef NDEBUG
+
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <byteswap.h>
+#include <ipxe/iobuf.h>
+#include <ipxe/xfer.h>
+#include <ipxe/open.h>
+#include <ipxe/process.h>
+#include <ipxe/netdevice.h>
+#include <ipxe/if_ether.h>
+#include <ipxe/tcpip.h>
+#include <ipxe/tcp.h>
+#include <ipxe/test.h>
+
+/** Address family used by the dummy network-layer protocol */
+#define AF_TCP_TEST 0x7e57
+
+/** Peer initial sequence number (chosen to wrap during the test) */
+#define TCP_TEST_ISN 0xffffff00UL
+
+/** Maximum number of steps to wait for a transmitted segment */
+#define TCP_TEST_MAX_STEPS 1000
+
+/** Data stream length */
+#define TCP_TEST_LEN 600
+
+/** Extract the POSIX error code, ignoring the file that raised it */
+#define TCP_TEST_POSIX( rc ) ( ( -(rc) >> 24 ) & 0x7f )
+
+/* The TCP socket opener is the only way to reach tcp_open() */
+extern struct socket_opener tcp_ipv4_socket_opener;
+
+/** Most recently transmitted segment */
+static struct {
+	/** Segment contents */
+	uint8_t data[128];
+	/** Segment length */
+	size_t len;
+	/** Number of segments transmitted */
+	unsigned int count;
+} tcp_test_tx;
+
+/** Data received by the application */
+static struct {
+	/** Received data */
+	uint8_t data[TCP_TEST_LEN];
+	/** Received length */
+	size_t len;
+	/** Close status */
+	int rc;
+} tcp_test_rx;
+
+/** Dummy link-layer protocol */
+static struct ll_protocol tcp_test_ll_protocol = {
+	.name = "TCPTEST",
+	.ll_header_len = ETH_HLEN,
+};
+
+/** Dummy network device */
+static struct net_device tcp_test_netdev = {
+	.ll_protocol = &tcp_test_ll_protocol,
+	.max_pkt_len = ETH_FRAME_LEN,
+};
+
+/** Peer address */
+static struct sockaddr_tcpip tcp_test_peer = {
+	.st_family = AF_TCP_TEST,
+	.st_port = htons ( 80 ),
+};
+
+/** Local address (port filled in from the SYN) */
+static struct sockaddr_tcpip tcp_test_local = {
+	.st_family = AF_TCP_TEST,
+};
+
+/**
+ * Capture transmitted segment
+ *
+ * @v iobuf		I/O buffer
+ * @v tcpip_protocol	Transport-layer protocol
+ * @v st_src		Source address, or NULL to use default
+ * @v st_dest		Destination address
+ * @v netdev		Network device (or NULL to route automatically)
+ * @v trans_csum	Transport-layer checksum to complete, or NULL
+ * @ret rc		Return status code
+ */
+static int tcp_test_net_tx ( struct io_buffer *iobuf,
+			     struct tcpip_protocol *tcpip_protocol __unused,
+			     struct sockaddr_tcpip *st_src __unused,
+			     struct sockaddr_tcpip *st_dest __unused,
+			     struct net_device *netdev __unused,
+			     uint16_t *trans_csum __unused ) {
+	size_t len = iob_len ( iobuf );
+
+	if ( len > sizeof ( tcp_test_tx.data ) )
+		len = sizeof ( tcp_test_tx.data );
+	memcpy ( tcp_test_tx.data, iobuf->data, len );
+	tcp_test_tx.len = len;
+	tcp_test_tx.count++;
+	free_iob ( iobuf );
+	return 0;
+}
+
+/**
+ * Identify network device for dummy address
+ *
+ * @v st_dest		Destination address
+ * @ret netdev		Network device
+ */
+static struct net_device *
+tcp_test_net_netdev ( struct sockaddr_tcpip *st_dest __unused ) {
+	return &tcp_test_netdev;
+}
+
+/** Dummy network-layer protocol */
+struct tcpip_net_protocol tcp_test_net_protocol __tcpip_net_protocol = {
+	.name = "TCPTEST",
+	.sa_family = AF_TCP_TEST,
+	.header_len = 20,
+	.tx = tcp_test_net_tx,
+	.netdev = tcp_test_net_netdev,
+};
+
+/**
+ * Receive data as the application
+ *
+ * @v intf		Interface
+ * @v iobuf		I/O buffer
+ * @v meta		Data transfer metadata
+ * @ret rc		Return status code
+ */
+static int tcp_test_deliver ( struct interface *intf __unused,
+			      struct io_buffer *iobuf,
+			      struct xfer_metadata *meta __unused ) {
+	size_t len = iob_len ( iobuf );
+
+	if ( ( tcp_test_rx.len + len ) <= sizeof ( tcp_test_rx.data ) )
+		memcpy ( &tcp_test_rx.data[tcp_test_rx.len], iobuf->data, len );
+	tcp_test_rx.len += len;
+	free_iob ( iobuf );
+	return 0;
+}
+
+/**
+ * Report application window
+ *
+ * @v intf		Interface
+ * @ret len		Length of window
+ */
+static size_t tcp_test_window ( struct interface *intf __unused ) {
+	return TCP_MAX_WINDOW_SIZE;
+}
+
+/**
+ * Record connection close
+ *
+ * @v intf		Interface
+ * @v rc		Reason for close
+ */
+static void tcp_test_close ( struct interface *intf, int rc ) {
+	intf_restart ( intf, rc );
+	tcp_test_rx.rc = rc;
+}
+
+/** Application interface operations */
+static struct interface_operation tcp_test_xfer_op[] = {
+	INTF_OP ( xfer_deliver, struct interface *, tcp_test_deliver ),
+	INTF_OP ( xfer_window, struct interface *, tcp_test_window ),
+	INTF_OP ( intf_close, struct interface *, tcp_test_close ),
+};
+
+/** Application interface descriptor */
+static struct interface_descriptor tcp_test_xfer_desc =
+	INTF_DESC_PURE ( tcp_test_xfer_op );
+
+/** Application interface */
+static struct interface tcp_test_xfer =
+	INTF_INIT ( tcp_test_xfer_desc );
+
+/**
+ * Get transmitted TCP header
+ *
+ * @ret tcphdr		TCP header
+ */
+static struct tcp_header * tcp_test_header ( void ) {
+	return ( ( struct tcp_header * ) tcp_test_tx.data );
+}
+
+/**
+ * Find option within transmitted segment
+ *
+ * @v kind		Option kind
+ * @ret option		Option, or NULL if not present
+ */
+static struct tcp_option * tcp_test_option ( unsigned int kind ) {
+	struct tcp_header *tcphdr = tcp_test_header();
+	uint8_t *data = ( tcp_test_tx.data + sizeof ( *tcphdr ) );
+	uint8_t *end = ( tcp_test_tx.data +
+			 ( ( tcphdr->hlen & TCP_MASK_HLEN ) / 4 ) );
+	struct tcp_option *option;
+
+	while ( data < end ) {
+		option = ( ( struct tcp_option * ) data );
+		if ( option->kind == TCP_OPTION_END )
+			break;
+		if ( option->kind == TCP_OPTION_NOP ) {
+			data++;
+			continue;
+		}
+		if ( option->kind == kind )
+			return option;
+		data += option->length;
+	}
+	return NULL;
+}
+
+/**
+ * Wait for a segment to be transmitted
+ *
+ * @v count		Number of segments previously transmitted
+ * @ret ok		Segment was transmitted
+ */
+static int tcp_test_wait ( unsigned int count ) {
+	unsigned int steps;
+
+	for ( steps = 0 ; steps < TCP_TEST_MAX_STEPS ; steps++ ) {
+		if ( tcp_test_tx.count != count )
+			return 1;
+		step();
+	}
+	return 0;
+}
+
+/**
+ * Get data stream byte
+ *
+ * @v offset		Offset within data stream
+ * @ret byte		Data byte
+ */
+static uint8_t tcp_test_byte ( size_t offset ) {
+	return ( ( offset * 7 ) + 3 );
+}
+
+/**
+ * Feed segment from peer into tcp_rx()
+ *
+ * @v seq		SEQ value
+ * @v ack		ACK value
+ * @v flags		TCP flags
+ * @v opts		TCP options
+ * @v opts_len		Length of TCP options (a multiple of four)
+ * @v offset		Offset of data within data stream
+ * @v len		Length of data
+ * @ret rc		Return status code from tcp_rx()
+ */
+static int tcp_test_rx_segment ( uint32_t seq, uint32_t ack,
+				  unsigned int flags, const void *opts,
+				  size_t opts_len, size_t offset,
+				  size_t len ) {
+	struct tcp_header *tcphdr;
+	struct io_buffer *iobuf;
+	uint8_t *data;
+	size_t hlen = ( sizeof ( *tcphdr ) + opts_len );
+	unsigned int i;
+
+	iobuf = alloc_iob ( hlen + len );
+	if ( ! iobuf )
+		return -ENOMEM;
+	tcphdr = iob_put ( iobuf, sizeof ( *tcphdr ) );
+	memset ( tcphdr, 0, sizeof ( *tcphdr ) );
+	tcphdr->src = tcp_test_peer.st_port;
+	tcphdr->dest = tcp_test_local.st_port;
+	tcphdr->seq = htonl ( seq );
+	tcphdr->ack = htonl ( ack );
+	tcphdr->hlen = ( hlen << 2 );
+	tcphdr->flags = flags;
+	tcphdr->win = htons ( 0xffff );
+	memcpy ( iob_put ( iobuf, opts_len ), opts, opts_len );
+	data = iob_put ( iobuf, len );
+	for ( i = 0 ; i < len ; i++ )
+		data[i] = tcp_test_byte ( offset + i );
+	tcphdr->csum = tcpip_chksum ( iobuf->data, iob_len ( iobuf ) );
+
+	return tcp_protocol.rx ( iobuf, &tcp_test_netdev, &tcp_test_peer,
+				 &tcp_test_local, TCPIP_EMPTY_CSUM );
+}
+
+/**
+ * Feed data from peer into tcp_rx()
+ *
+ * @v offset		Offset within data stream
+ * @v len		Length of data
+ */
+static void tcp_test_rx_data ( size_t offset, size_t len ) {
+	uint32_t ack = ntohl ( tcp_test_header()->seq );
+
+	ok ( tcp_test_rx_segment ( ( TCP_TEST_ISN + 1 + offset ), ack,
+				   TCP_ACK, NULL, 0, offset, len ) == 0 );
+}
+
+/**
+ * Check most recent acknowledgement
+ *
+ * @v offset		Acknowledged offset within data stream
+ * @v sack		SACK blocks, as offsets within data stream
+ * @v count		Number of SACK blocks
+ * @v file		Test code file
+ * @v line		Test code line
+ */
+static void tcp_ack_okx ( size_t offset, const size_t *sack,
+			  unsigned int count, const char *file,
+			  unsigned int line ) {
+	struct tcp_header *tcphdr = tcp_test_header();
+	struct tcp_option *option = tcp_test_option ( TCP_OPTION_SACK );
+	struct tcp_sack_block *block;
+	unsigned int i;
+
+	okx ( tcphdr->flags & TCP_ACK, file, line );
+	okx ( ntohl ( tcphdr->ack ) == ( TCP_TEST_ISN + 1 + offset ),
+	      file, line );
+	if ( ! count ) {
+		okx ( option == NULL, file, line );
+		return;
+	}
+	okx ( option != NULL, file, line );
+	if ( ! option )
+		return;
+	okx ( option->length == ( sizeof ( struct tcp_sack_option ) +
+				  ( count * sizeof ( *block ) ) ),
+	      file, line );
+	block = ( ( ( void * ) option ) + sizeof ( struct tcp_sack_option ) );
+	for ( i = 0 ; i < count ; i++ ) {
+		okx ( ntohl ( block[i].left ) ==
+		      ( TCP_TEST_ISN + 1 + sack[ 2 * i ] ), file, line );
+		okx ( ntohl ( block[i].right ) ==
+		      ( TCP_TEST_ISN + 1 + sack[ 2 * i + 1 ] ), file, line );
+	}
+}
+#define tcp_ack_ok( offset, sack, count ) \
+	tcp_ack_okx ( offset, sack, count, __FILE__, __LINE__ )
+
+/**
+ * Perform TCP selective acknowledgement self-tests
+ *
+ */
+static void tcp_test_exec ( void ) {
+	static const uint8_t synack_opts[] = {
+		TCP_OPTION_MSS, 4, 0x05, 0xb4,
+		TCP_OPTION_NOP, TCP_OPTION_WS, 3, 0,
+		TCP_OPTION_NOP, TCP_OPTION_NOP, TCP_OPTION_SACK_PERMITTED, 2,
+	};
+	static const size_t sack_b[] = { 100, 200 };
+	static const size_t sack_db[] = { 300, 400, 100, 200 };
+	static const size_t sack_d[] = { 300, 400 };
+	static const size_t sack_ef[] = { 450, 600 };
+	struct tcp_window_scale_option *wsopt;
+	struct tcp_header *tcphdr;
+	uint32_t isn;
+	uint32_t win;
+	unsigned int count;
+	unsigned int i;
+	int rc;
+
+	/* Open connection and capture SYN */
+	memset ( &tcp_test_tx, 0, sizeof ( tcp_test_tx ) );
+	memset ( &tcp_test_rx, 0, sizeof ( tcp_test_rx ) );
+	ok ( tcp_ipv4_socket_opener.open ( &tcp_test_xfer,
+					   ( struct sockaddr * ) &tcp_test_peer,
+					   NULL ) == 0 );
+	ok ( tcp_test_wait ( 0 ) );
+	tcphdr = tcp_test_header();
+	ok ( tcphdr->flags == TCP_SYN );
+	ok ( tcp_test_option ( TCP_OPTION_SACK_PERMITTED ) != NULL );
+	wsopt = ( ( struct tcp_window_scale_option * )
+		  tcp_test_option ( TCP_OPTION_WS ) );
+	ok ( wsopt != NULL );
+	ok ( wsopt && ( wsopt->scale == TCP_RX_WINDOW_SCALE ) );
+	tcp_test_local.st_port = tcphdr->src;
+	isn = ntohl ( tcphdr->seq );
+
+	/* Complete handshake */
+	count = tcp_test_tx.count;
+	ok ( tcp_test_rx_segment ( TCP_TEST_ISN, ( isn + 1 ),
+				   ( TCP_SYN | TCP_ACK ), synack_opts,
+				   sizeof ( synack_opts ), 0, 0 ) == 0 );
+	ok ( tcp_test_wait ( count ) );
+	tcp_ack_ok ( 0, NULL, 0 );
+
+	/* Receive window is sized from memory and scaled to match */
+	win = ( ntohs ( tcp_test_header()->win ) << TCP_RX_WINDOW_SCALE );
+	ok ( win >= TCP_MIN_WINDOW_SIZE );
+	ok ( win <= TCP_MAX_WINDOW_SIZE );
+
+	/* Out-of-order segment is acknowledged immediately with SACK */
+	count = tcp_test_tx.count;
+	tcp_test_rx_data ( 100, 100 );
+	ok ( tcp_test_tx.count != count );
+	tcp_ack_ok ( 0, sack_b, 1 );
+
+	/* Most recent segment is reported first */
+	tcp_test_rx_data ( 300, 100 );
+	tcp_ack_ok ( 0, sack_db, 2 );
+
+	/* Filling the first gap drops the acknowledged block */
+	tcp_test_rx_data ( 0, 100 );
+	tcp_ack_ok ( 200, sack_d, 1 );
+	ok ( tcp_test_rx.len == 200 );
+
+	/* Filling the last gap stops SACK altogether */
+	count = tcp_test_tx.count;
+	tcp_test_rx_data ( 200, 100 );
+	ok ( tcp_test_wait ( count ) );
+	tcp_ack_ok ( 400, NULL, 0 );
+
+	/* Overlapping segments are reported as a single block */
+	tcp_test_rx_data ( 500, 100 );
+	tcp_test_rx_data ( 450, 100 );
+	tcp_ack_ok ( 400, sack_ef, 1 );
+
+	/* Duplicate segment leaves the report unchanged */
+	tcp_test_rx_data ( 100, 100 );
+	tcp_ack_ok ( 400, sack_ef, 1 );
+
+	/* Reassembled stream is complete */
+	count = tcp_test_tx.count;
+	tcp_test_rx_data ( 400, 50 );
+	ok ( tcp_test_wait ( count ) );
+	tcp_ack_ok ( TCP_TEST_LEN, NULL, 0 );
+	ok ( tcp_test_rx.len == TCP_TEST_LEN );
+	for ( i = 0 ; i < TCP_TEST_LEN ; i++ ) {
+		if ( tcp_test_rx.data[i] != tcp_test_byte ( i ) )
+			break;
+	}
+	ok ( i == TCP_TEST_LEN );
+
+	/* Reset connection */
+	rc = tcp_test_rx_segment ( ( TCP_TEST_ISN + 1 + TCP_TEST_LEN ),
+				   ( isn + 1 ), TCP_RST, NULL, 0, 0, 0 );
+	ok ( TCP_TEST_POSIX ( rc ) == TCP_TEST_POSIX ( -ECONNRESET ) );
+	ok ( TCP_TEST_POSIX ( tcp_test_rx.rc ) ==
+	     TCP_TEST_POSIX ( -ECONNRESET ) );
+}
+
+/** TCP selective acknowledgement self-test */
+struct self_test tcp_test __self_test = {
+	.name = "tcp",
+	.exec = tcp_test_exec,
+};
@@ -0,0 +1,664 @@
+/*
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+FILE_LICENCE ( GPL2_OR_LATER );
+
+/** @file
+ *
+ * TFTP receive window tests
+ *
+ * The window helpers are first exercised directly, playing the part
+ * of a server sending one window per ACK with packets dropped and
+ * reordered on the way.  A download is then opened over a dummy
+ * network-layer protocol that captures transmitted packets, and the
+ * server's packets are fed in out of order and duplicated through
+ * udp_rx() and hence tftp_rx().
+ *
+ */
+
+/* Forcibly enable assertions */
+#undef NDEBUG
+
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <byteswap.h>
+#include <ipxe/bitmap.h>
+#include <ipxe/iobuf.h>
+#include <ipxe/xfer.h>
+#include <ipxe/open.h>
+#include <ipxe/socket.h>
+#include <ipxe/process.h>
+#include <ipxe/netdevice.h>
+#include <ipxe/if_ether.h>
+#include <ipxe/tcpip.h>
+#include <ipxe/udp.h>
+#include <ipxe/tftp.h>
+#include <ipxe/test.h>
+
+/** A TFTP transfer test */
+struct tftp_test {
+	/** Window size */
+	unsigned int size;
+	/** Number of blocks in file */
+	unsigned int blocks;
+	/** Drop every n-th packet (or zero to drop none) */
+	unsigned int drop;
+	/** Swap every n-th packet with its successor (or zero) */
+	unsigned int swap;
+	/** Expected number of ACKs (or zero to skip the check) */
+	unsigned int acks;
+};
+
+/** Maximum number of windows sent before giving up */
+#define TFTP_TEST_MAX_WINDOWS 100000
+
+/**
+ * Run TFTP transfer test
+ *
+ * @v test		TFTP transfer test
+ * @v file		Test code file
+ * @v line		Test code line
+ */
+static void tftp_transfer_okx ( struct tftp_test *test, const char *file,
+				unsigned int line ) {
+	struct tftp_window window;
+	struct bitmap bitmap;
+	unsigned int wire[TFTP_MAX_WINDOWSIZE];
+	unsigned int sent = 0;
+	unsigned int acks = 0;
+	unsigned int windows;
+	unsigned int count;
+	unsigned int block;
+	unsigned int tmp;
+	unsigned int i;
+	int acked;
+
+	/* Receiver knows the file size from "tsize" */
+	memset ( &bitmap, 0, sizeof ( bitmap ) );
+	okx ( bitmap_resize ( &bitmap, test->blocks ) == 0, file, line );
+	window.size = test->size;
+	window.acked = 0;
+
+	for ( windows = 0 ; windows < TFTP_TEST_MAX_WINDOWS ; windows++ ) {
+
+		/* Server sends a window following the last ACK */
+		count = 0;
+		for ( i = 0 ; i < test->size ; i++ ) {
+			block = ( window.acked + i );
+			if ( block >= test->blocks )
+				break;
+			sent++;
+			if ( test->drop && ( ( sent % test->drop ) == 0 ) )
+				continue;
+			wire[count++] = block;
+		}
+		for ( i = 0 ; ( i + 1 ) < count ; i++ ) {
+			if ( test->swap && ( ( ( i + 1 ) % test->swap ) == 0 )){
+				tmp = wire[i];
+				wire[i] = wire[ i + 1 ];
+				wire[ i + 1 ] = tmp;
+				i++;
+			}
+		}
+
+		/* Receiver numbers and records each block */
+		acked = 0;
+		for ( i = 0 ; i < count ; i++ ) {
+			block = tftp_window_block ( &window, &bitmap,
+						    ( ( wire[i] + 1 ) & 0xffff ));
+			okx ( block == wire[i], file, line );
+			if ( tftp_window_rx ( &window, &bitmap, block ) ) {
+				window.acked = bitmap_first_gap ( &bitmap );
+				acks++;
+				acked = 1;
+			}
+		}
+		if ( bitmap_full ( &bitmap ) )
+			break;
+
+		/* Receiver's retransmission timer acknowledges the rest */
+		if ( ! acked ) {
+			window.acked = bitmap_first_gap ( &bitmap );
+			acks++;
+		}
+	}
+
+	okx ( bitmap_full ( &bitmap ), file, line );
+	okx ( acks <= test->blocks, file, line );
+	if ( test->acks )
+		okx ( acks == test->acks, file, line );
+	bitmap_free ( &bitmap );
+}
+#define tftp_transfer_ok( test ) \
+	tftp_transfer_okx ( test, __FILE__, __LINE__ )
+
+/** Lock-step transfer */
+static struct tftp_test lockstep = { 1, 100, 0, 0, 100 };
+
+/** Windowed transfer */
+static struct tftp_test windowed = { 8, 100, 0, 0, 13 };
+
+/** Windowed transfer with losses */
+static struct tftp_test lossy = { 8, 1000, 7, 0, 0 };
+
+/** Windowed transfer with losses at the end of each window */
+static struct tftp_test lossy_tail = { 4, 1000, 4, 0, 0 };
+
+/** Windowed transfer with reordering */
+static struct tftp_test reordered = { 8, 1000, 0, 3, 0 };
+
+/** Windowed transfer with losses and reordering */
+static struct tftp_test lossy_reordered = { 8, 1000, 5, 2, 0 };
+
+/** Windowed transfer across the block number wrap */
+static struct tftp_test wrap = { 8, 70000, 0, 0, 8750 };
+
+/** Windowed transfer across the block number wrap, with losses */
+static struct tftp_test lossy_wrap = { 8, 70000, 3, 4, 0 };
+
+/** Address family used by the dummy network-layer protocol */
+#define AF_TFTP_TEST 0x7e58
+
+/** Server name, recognised only by the dummy address converter */
+#define TFTP_TEST_HOST "tftptest"
+
+/** Server transfer ID (i.e. the port it sends from) */
+#define TFTP_TEST_TID 4242
+
+/** Negotiated block size */
+#define TFTP_TEST_BLKSIZE 512
+
+/** File length (ten full blocks and a partial block) */
+#define TFTP_TEST_LEN 5220
+
+/** Maximum number of steps to wait for a transmitted packet */
+#define TFTP_TEST_MAX_STEPS 1000
+
+/* The UDP protocol is not exported by any header */
+extern struct tcpip_protocol udp_protocol;
+
+/** Most recently transmitted packet */
+static struct {
+	/** Packet contents, including the UDP header */
+	uint8_t data[128];
+	/** Packet length */
+	size_t len;
+	/** Number of packets transmitted */
+	unsigned int count;
+} tftp_test_tx;
+
+/** Data received by the application */
+static struct {
+	/** Received data */
+	uint8_t data[TFTP_TEST_LEN];
+	/** Highest offset written */
+	size_t len;
+	/** Close status */
+	int rc;
+} tftp_test_rx;
+
+/** Dummy link-layer protocol */
+static struct ll_protocol tftp_test_ll_protocol = {
+	.name = "TFTPTEST",
+	.ll_header_len = ETH_HLEN,
+};
+
+/** Dummy network device */
+static struct net_device tftp_test_netdev = {
+	.ll_protocol = &tftp_test_ll_protocol,
+	.max_pkt_len = ETH_FRAME_LEN,
+};
+
+/** Server address */
+static struct sockaddr_tcpip tftp_test_server = {
+	.st_family = AF_TFTP_TEST,
+	.st_port = htons ( TFTP_TEST_TID ),
+};
+
+/** Local address (port filled in from the RRQ) */
+static struct sockaddr_tcpip tftp_test_local = {
+	.st_family = AF_TFTP_TEST,
+};
+
+/**
+ * Transcribe dummy socket address
+ *
+ * @v sa		Socket address
+ * @ret string		Socket address string
+ */
+static const char * tftp_test_ntoa ( struct sockaddr *sa __unused ) {
+	return TFTP_TEST_HOST;
+}
+
+/**
+ * Parse dummy socket address
+ *
+ * @v string		Socket address string
+ * @v sa		Socket address to fill in
+ * @ret rc		Return status code
+ */
+static int tftp_test_aton ( const char *string,
+			    struct sockaddr *sa __unused ) {
+	return ( ( strcmp ( string, TFTP_TEST_HOST ) == 0 ) ? 0 : -EINVAL );
+}
+
+/** Dummy socket address converter */
+struct sockaddr_converter tftp_test_sockaddr_converter __sockaddr_converter = {
+	.family = AF_TFTP_TEST,
+	.ntoa = tftp_test_ntoa,
+	.aton = tftp_test_aton,
+};
+
+/** Dummy UDP socket opener */
+struct socket_opener tftp_test_socket_opener __socket_opener = {
+	.semantics = UDP_SOCK_DGRAM,
+	.family = AF_TFTP_TEST,
+	.open = udp_open,
+};
+
+/**
+ * Capture transmitted packet
+ *
+ * @v iobuf		I/O buffer
+ * @v tcpip_protocol	Transport-layer protocol
+ * @v st_src		Source address, or NULL to use default
+ * @v st_dest		Destination address
+ * @v netdev		Network device (or NULL to route automatically)
+ * @v trans_csum	Transport-layer checksum to complete, or NULL
+ * @ret rc		Return status code
+ */
+static int tftp_test_net_tx ( struct io_buffer *iobuf,
+			      struct tcpip_protocol *tcpip_protocol __unused,
+			      struct sockaddr_tcpip *st_src __unused,
+			      struct sockaddr_tcpip *st_dest __unused,
+			      struct net_device *netdev __unused,
+			      uint16_t *trans_csum __unused ) {
+	size_t len = iob_len ( iobuf );
+
+	if ( len > sizeof ( tftp_test_tx.data ) )
+		len = sizeof ( tftp_test_tx.data );
+	memcpy ( tftp_test_tx.data, iobuf->data, len );
+	tftp_test_tx.len = len;
+	tftp_test_tx.count++;
+	free_iob ( iobuf );
+	return 0;
+}
+
+/**
+ * Identify network device for dummy address
+ *
+ * @v st_dest		Destination address
+ * @ret netdev		Network device
+ */
+static struct net_device *
+tftp_test_net_netdev ( struct sockaddr_tcpip *st_dest __unused ) {
+	return &tftp_test_netdev;
+}
+
+/** Dummy network-layer protocol */
+struct tcpip_net_protocol tftp_test_net_protocol __tcpip_net_protocol = {
+	.name = "TFTPTEST",
+	.sa_family = AF_TFTP_TEST,
+	.header_len = 20,
+	.tx = tftp_test_net_tx,
+	.netdev = tftp_test_net_netdev,
+};
+
+/**
+ * Receive data as the application
+ *
+ * @v intf		Interface
+ * @v iobuf		I/O buffer
+ * @v meta		Data transfer metadata
+ * @ret rc		Return status code
+ */
+static int tftp_test_deliver ( struct interface *intf __unused,
+			       struct io_buffer *iobuf,
+			       struct xfer_metadata *meta ) {
+	size_t len = iob_len ( iobuf );
+	size_t end = ( meta->offset + len );
+
+	if ( end <= sizeof ( tftp_test_rx.data ) )
+		memcpy ( &tftp_test_rx.data[meta->offset], iobuf->data, len );
+	if ( len && ( end > tftp_test_rx.len ) )
+		tftp_test_rx.len = end;
+	free_iob ( iobuf );
+	return 0;
+}
+
+/**
+ * Report application window
+ *
+ * @v intf		Interface
+ * @ret len		Length of window
+ *
+ * TFTP takes this as the block size to request.
+ */
+static size_t tftp_test_window ( struct interface *intf __unused ) {
+	return TFTP_TEST_BLKSIZE;
+}
+
+/**
+ * Record download close
+ *
+ * @v intf		Interface
+ * @v rc		Reason for close
+ */
+static void tftp_test_close ( struct interface *intf, int rc ) {
+	intf_restart ( intf, rc );
+	tftp_test_rx.rc = rc;
+}
+
+/** Application interface operations */
+static struct interface_operation tftp_test_xfer_op[] = {
+	INTF_OP ( xfer_deliver, struct interface *, tftp_test_deliver ),
+	INTF_OP ( xfer_window, struct interface *, tftp_test_window ),
+	INTF_OP ( intf_close, struct interface *, tftp_test_close ),
+};
+
+/** Application interface descriptor */
+static struct interface_descriptor tftp_test_xfer_desc =
+	INTF_DESC_PURE ( tftp_test_xfer_op );
+
+/** Application interface */
+static struct interface tftp_test_xfer =
+	INTF_INIT ( tftp_test_xfer_desc );
+
+/**
+ * Get transmitted TFTP packet
+ *
+ * @ret packet		TFTP packet
+ */
+static union tftp_any * tftp_test_packet ( void ) {
+	return ( ( union tftp_any * )
+		 ( tftp_test_tx.data + sizeof ( struct udp_header ) ) );
+}
+
+/**
+ * Find option within transmitted RRQ
+ *
+ * @v name		Option name
+ * @ret value		Option value, or NULL if not present
+ */
+static const char * tftp_test_rrq_option ( const char *name ) {
+	char *data = tftp_test_packet()->rrq.data;
+	char *end = ( ( char * ) tftp_test_tx.data + tftp_test_tx.len );
+	char *value;
+
+	/* Skip filename and mode */
+	data += ( strnlen ( data, ( end - data ) ) + 1 );
+	data += ( strnlen ( data, ( end - data ) ) + 1 );
+	while ( data < end ) {
+		value = ( data + strnlen ( data, ( end - data ) ) + 1 );
+		if ( value >= end )
+			break;
+		if ( strcmp ( data, name ) == 0 )
+			return value;
+		data = ( value + strnlen ( value, ( end - value ) ) + 1 );
+	}
+	return NULL;
+}
+
+/**
+ * Wait for a packet to be transmitted
+ *
+ * @v count		Number of packets previously transmitted
+ * @ret ok		Packet was transmitted
+ */
+static int tftp_test_wait ( unsigned int count ) {
+	unsigned int steps;
+
+	for ( steps = 0 ; steps < TFTP_TEST_MAX_STEPS ; steps++ ) {
+		if ( tftp_test_tx.count != count )
+			return 1;
+		step();
+	}
+	return 0;
+}
+
+/**
+ * Get file byte
+ *
+ * @v offset		Offset within file
+ * @ret byte		Data byte
+ */
+static uint8_t tftp_test_byte ( size_t offset ) {
+	return ( ( offset * 7 ) + 3 );
+}
+
+/**
+ * Feed packet from server into udp_rx()
+ *
+ * @v data		TFTP packet
+ * @v len		Length of TFTP packet
+ * @ret rc		Return status code from udp_rx()
+ */
+static int tftp_test_rx_packet ( const void *data, size_t len ) {
+	struct udp_header *udphdr;
+	struct io_buffer *iobuf;
+
+	iobuf = alloc_iob ( sizeof ( *udphdr ) + len );
+	if ( ! iobuf )
+		return -ENOMEM;
+	udphdr = iob_put ( iobuf, sizeof ( *udphdr ) );
+	udphdr->src = htons ( TFTP_TEST_TID );
+	udphdr->dest = tftp_test_local.st_port;
+	udphdr->len = htons ( sizeof ( *udphdr ) + len );
+	udphdr->chksum = 0;
+	memcpy ( iob_put ( iobuf, len ), data, len );
+
+	return udp_protocol.rx ( iobuf, &tftp_test_netdev, &tftp_test_server,
+				 &tftp_test_local, TCPIP_EMPTY_CSUM );
+}
+
+/**
+ * Feed DATA packet from server into udp_rx()
+ *
+ * @v block		Block index
+ * @v file		Test code file
+ * @v line		Test code line
+ */
+static void tftp_data_okx ( unsigned int block, const char *file,
+			    unsigned int line ) {
+	struct {
+		struct tftp_data data;
+		uint8_t payload[TFTP_TEST_BLKSIZE];
+	} __attribute__ (( packed )) packet;
+	size_t offset = ( block * TFTP_TEST_BLKSIZE );
+	size_t len = ( TFTP_TEST_LEN - offset );
+	unsigned int i;
+
+	if ( len > TFTP_TEST_BLKSIZE )
+		len = TFTP_TEST_BLKSIZE;
+	packet.data.opcode = htons ( TFTP_DATA );
+	packet.data.block = htons ( block + 1 );
+	for ( i = 0 ; i < len ; i++ )
+		packet.payload[i] = tftp_test_byte ( offset + i );
+	okx ( tftp_test_rx_packet ( &packet,
+				    ( sizeof ( packet.data ) + len ) ) == 0,
+	      file, line );
+}
+#define tftp_data_ok( block ) \
+	tftp_data_okx ( block, __FILE__, __LINE__ )
+
+/**
+ * Check most recent acknowledgement
+ *
+ * @v count		Expected number of packets transmitted
+ * @v block		Expected acknowledged block number
+ * @v file		Test code file
+ * @v line		Test code line
+ */
+static void tftp_ack_okx ( unsigned int count, unsigned int block,
+			   const char *file, unsigned int line ) {
+	struct tftp_ack *ack = &tftp_test_packet()->ack;
+
+	okx ( tftp_test_tx.count == count, file, line );
+	okx ( ack->opcode == htons ( TFTP_ACK ), file, line );
+	okx ( ntohs ( ack->block ) == block, file, line );
+}
+#define tftp_ack_ok( count, block ) \
+	tftp_ack_okx ( count, block, __FILE__, __LINE__ )
+
+/**
+ * Perform TFTP download self-test
+ *
+ */
+static void tftp_download_test ( void ) {
+	static const char oack[] = "\0" "\006"
+		"blksize" "\0" "512" "\0"
+		"tsize" "\0" "5220" "\0"
+		"windowsize" "\0" "4";
+	struct udp_header *udphdr;
+	const char *windowsize;
+	unsigned int i;
+
+	/* Open download and capture RRQ */
+	memset ( &tftp_test_tx, 0, sizeof ( tftp_test_tx ) );
+	memset ( &tftp_test_rx, 0, sizeof ( tftp_test_rx ) );
+	tftp_test_rx.rc = -EINPROGRESS;
+	ok ( xfer_open_uri_string ( &tftp_test_xfer,
+				    "tftp://" TFTP_TEST_HOST "/file" ) == 0 );
+	ok ( tftp_test_wait ( 0 ) );
+	ok ( tftp_test_packet()->rrq.opcode == htons ( TFTP_RRQ ) );
+	windowsize = tftp_test_rrq_option ( "windowsize" );
+	ok ( windowsize != NULL );
+	ok ( windowsize && ( strcmp ( windowsize, "8" ) == 0 ) );
+	udphdr = ( ( struct udp_header * ) tftp_test_tx.data );
+	tftp_test_local.st_port = udphdr->src;
+
+	/* Options acknowledgement is acknowledged as block zero */
+	ok ( tftp_test_rx_packet ( oack, sizeof ( oack ) ) == 0 );
+	tftp_ack_ok ( 2, 0 );
+
+	/* A window is acknowledged only once complete */
+	for ( i = 0 ; i < 3 ; i++ )
+		tftp_data_ok ( i );
+	ok ( tftp_test_tx.count == 2 );
+	tftp_data_ok ( 3 );
+	tftp_ack_ok ( 3, 4 );
+
+	/* Reordering within a window does not trigger an ACK */
+	tftp_data_ok ( 5 );
+	tftp_data_ok ( 4 );
+	tftp_data_ok ( 6 );
+	ok ( tftp_test_tx.count == 3 );
+	tftp_data_ok ( 7 );
+	tftp_ack_ok ( 4, 8 );
+
+	/* Duplicates of acknowledged blocks are ignored */
+	tftp_data_ok ( 2 );
+	tftp_data_ok ( 7 );
+	ok ( tftp_test_tx.count == 4 );
+
+	/* A block ahead of a gap rewinds the server to the gap */
+	tftp_data_ok ( 8 );
+	tftp_data_ok ( 10 );
+	tftp_ack_ok ( 5, 9 );
+
+	/* A duplicate ahead of the same gap does not ACK again */
+	tftp_data_ok ( 10 );
+	ok ( tftp_test_tx.count == 5 );
+	ok ( tftp_test_rx.rc == -EINPROGRESS );
+
+	/* Filling the gap completes the download */
+	tftp_data_ok ( 9 );
+	tftp_ack_ok ( 6, 11 );
+	ok ( tftp_test_rx.rc == 0 );
+	ok ( tftp_test_rx.len == TFTP_TEST_LEN );
+	for ( i = 0 ; i < TFTP_TEST_LEN ; i++ ) {
+		if ( tftp_test_rx.data[i] != tftp_test_byte ( i ) )
+			break;
+	}
+	ok ( i == TFTP_TEST_LEN );
+
+	/* Ensure the download is closed even if a check failed */
+	intf_restart ( &tftp_test_xfer, -ECANCELED );
+}
+
+/**
+ * Perform TFTP receive window self-tests
+ *
+ */
+static void tftp_test_exec ( void ) {
+	struct tftp_window window = { 8, 0 };
+	struct tftp_window lockstep_window = { 1, 0 };
+	struct bitmap bitmap;
+	unsigned int i;
+
+	/* Block numbering relative to the first gap */
+	memset ( &bitmap, 0, sizeof ( bitmap ) );
+	ok ( bitmap_resize ( &bitmap, 0x10010 ) == 0 );
+	ok ( tftp_window_block ( &window, &bitmap, 0 ) == -1U );
+	ok ( tftp_window_block ( &lockstep_window, &bitmap, 0 ) == -1U );
+	ok ( tftp_window_block ( &window, &bitmap, 1 ) == 0 );
+	ok ( tftp_window_block ( &window, &bitmap, 8 ) == 7 );
+	for ( i = 0 ; i < 0xfffc ; i++ )
+		bitmap_set ( &bitmap, i );
+	ok ( tftp_window_block ( &window, &bitmap, 0xfffd ) == 0xfffc );
+	ok ( tftp_window_block ( &window, &bitmap, 0xffff ) == 0xfffe );
+	ok ( tftp_window_block ( &window, &bitmap, 0 ) == 0xffff );
+	ok ( tftp_window_block ( &window, &bitmap, 3 ) == 0x10002 );
+	for ( ; i < 0x10002 ; i++ )
+		bitmap_set ( &bitmap, i );
+	ok ( tftp_window_block ( &window, &bitmap, 0xfffa ) == 0xfff9 );
+	ok ( tftp_window_block ( &window, &bitmap, 0 ) == 0xffff );
+	ok ( tftp_window_block ( &window, &bitmap, 3 ) == 0x10002 );
+	bitmap_free ( &bitmap );
+
+	/* Acknowledgements */
+	memset ( &bitmap, 0, sizeof ( bitmap ) );
+	ok ( bitmap_resize ( &bitmap, 20 ) == 0 );
+	for ( i = 0 ; i < 7 ; i++ )
+		ok ( ! tftp_window_rx ( &window, &bitmap, i ) );
+	ok ( tftp_window_rx ( &window, &bitmap, 7 ) );
+	window.acked = 8;
+	ok ( ! tftp_window_rx ( &window, &bitmap, 8 ) );
+	ok ( tftp_window_rx ( &window, &bitmap, 10 ) );
+	window.acked = 9;
+	ok ( ! tftp_window_rx ( &window, &bitmap, 11 ) );
+	ok ( ! tftp_window_rx ( &window, &bitmap, 5 ) );
+	ok ( ! tftp_window_rx ( &window, &bitmap, 9 ) );
+	ok ( bitmap_first_gap ( &bitmap ) == 12 );
+	for ( i = 12 ; i < 19 ; i++ )
+		tftp_window_rx ( &window, &bitmap, i );
+	ok ( tftp_window_rx ( &window, &bitmap, 19 ) );
+	ok ( tftp_window_rx ( &lockstep_window, &bitmap, 3 ) );
+	bitmap_free ( &bitmap );
+
+	/* Transfers */
+	tftp_transfer_ok ( &lockstep );
+	tftp_transfer_ok ( &windowed );
+	tftp_transfer_ok ( &lossy );
+	tftp_transfer_ok ( &lossy_tail );
+	tftp_transfer_ok ( &reordered );
+	tftp_transfer_ok ( &lossy_reordered );
+	tftp_transfer_ok ( &wrap );
+	tftp_transfer_ok ( &lossy_wrap );
+
+	/* Download through tftp_rx() */
+	tftp_download_test();
+}
+
+/** TFTP receive window self-test */
+struct self_test tftp_test __self_test = {
+	.name = "tftp",
+	.exec = tftp_test_exec,
+};
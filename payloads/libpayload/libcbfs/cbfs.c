@@ -35,6 +35,10 @@
 #  include <lzma.h>
 #  define CBFS_CORE_WITH_LZMA
 # endif
+# ifdef CONFIG_LZ4
+#  include <lz4.h>
+#  define CBFS_CORE_WITH_LZ4
+# endif
 # define CBFS_MINI_BUILD
 #elif defined(__SMM__)
 # define CBFS_MINI_BUILD
@@ -146,11 +150,19 @@ void * cbfs_load_stage(struct cbfs_media *media, const char *name)
 			(uint32_t) stage->load, stage->memlen,
 			stage->entry);
 
-	final_size = cbfs_decompress(stage->compression,
-				     ((unsigned char *) stage) +
-				     sizeof(struct cbfs_stage),
-				     (void *) (uint32_t) stage->load,
-				     stage->len);
+#ifdef CBFS_CORE_WITH_LZ4
+	if (stage->compression == CBFS_COMPRESS_LZ4)
+		final_size = ulz4fn(((unsigned char *) stage) +
+				    sizeof(struct cbfs_stage), stage->len,
+				    (void *) (uint32_t) stage->load,
+				    stage->memlen);
+	else
+#endif
+		final_size = cbfs_decompress(stage->compression,
+					     ((unsigned char *) stage) +
+					     sizeof(struct cbfs_stage),
+					     (void *) (uint32_t) stage->load,
+					     stage->len);
 	if (!final_size)
 		return (void *) -1;
 
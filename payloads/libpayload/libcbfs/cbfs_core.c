@@ -34,6 +34,10 @@
  * CBFS_CORE_WITH_LZMA (must be #define)
  *      if defined, ulzma() must exist for decompression of data streams
  *
+ * CBFS_CORE_WITH_LZ4 (must be #define)
+ *      if defined, ulz4fn() and ulz4f_content_size() must exist for
+ *      decompression of data streams
+ *
  * CBFS_HEADER_ROM_ADDRESS
  *	ROM address (offset) of CBFS header. Underlying CBFS media may interpret
  *	it in other way so we call this "address".
@@ -207,6 +211,13 @@ int cbfs_decompress(int algo, void *src, void *dst, int len)
 #ifdef CBFS_CORE_WITH_LZMA
 		case CBFS_COMPRESS_LZMA:
 			return ulzma(src, dst);
+#endif
+#ifdef CBFS_CORE_WITH_LZ4
+		case CBFS_COMPRESS_LZ4:
+			/* The caller gives no destination size, so the
+			 * frame has to announce its own. */
+			return ulz4fn(src, len, dst,
+				      ulz4f_content_size(src, len));
 #endif
 		default:
 			ERROR("tried to decompress %d bytes with algorithm #%x,"
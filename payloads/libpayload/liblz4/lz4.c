@@ -0,0 +1,42 @@
+/*
+ * libpayload interface to the LZ4 frame decoder
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ * Released under the BSD license
+ */
+
+#include <lz4.h>
+#include <stdio.h>
+#include "lz4dec.c"
+
+size_t ulz4fn(const void *src, size_t srcn, void *dst, size_t dstn)
+{
+	size_t size;
+
+	/* Never let the decoder's end pointers wrap around. */
+	if (srcn > (size_t)0 - (size_t)src)
+		srcn = (size_t)0 - (size_t)src;
+	if (dstn > (size_t)0 - (size_t)dst)
+		dstn = (size_t)0 - (size_t)dst;
+
+	size = lz4_decode_frame(src, srcn, dst, dstn);
+	if (!size)
+		printf("lz4: Decoding error.\n");
+	return size;
+}
+
+size_t ulz4f_content_size(const void *src, size_t srcn)
+{
+	if (srcn > (size_t)0 - (size_t)src)
+		srcn = (size_t)0 - (size_t)src;
+	return lz4_frame_content_size(src, srcn);
+}
+
+size_t ulz4f(const void *src, void *dst)
+{
+	size_t dstn = ulz4f_content_size(src, (size_t)-1);
+
+	if (!dstn)
+		return 0;
+	return ulz4fn(src, (size_t)-1, dst, dstn);
+}
@@ -88,6 +88,7 @@
 #define CONFIG_PCIBIOS 1
 #define CONFIG_CBFS_LOCATION 0x0
 #define CONFIG_CHECK_FOR_PXE_LOAD_DISABLED 1
+#define CONFIG_DEFER_NETWORK_ROMS 1
 #define CONFIG_CDROM_BOOT 1
 #define CONFIG_LVDS_NONE 1
 #define CONFIG_USB_MOUSE 1
@@ -101,6 +102,7 @@
 #define CONFIG_CDROM_EMU 1
 #define CONFIG_USB_OHCI 1
 #define CONFIG_LZMA 1
+#define CONFIG_LZ4 1
 #define CONFIG_VGA_PCI 0
 #define CONFIG_VIRTIO_BLK 0
 #define CONFIG_USE_SMM 0
@@ -16,6 +16,7 @@
 #include "hw/virtio-blk.h" // process_virtio_blk_op
 #include "hw/sd_if.h" // process_sd_op
 #include "malloc.h" // malloc_low
+#include "memmap.h" // PAGE_SIZE
 #include "output.h" // dprintf
 #include "stacks.h" // stack_hop
 #include "std/disk.h" // struct dpte_s
@@ -370,9 +371,253 @@ process_atapi_op(struct disk_op_s *op)
     }
 }
 
+/****************************************************************
+ * Disk read cache
+ ****************************************************************/
+
+// Sectors read into a cache slot at once.
+#define BLOCKCACHE_SLOT_SECTORS 64
+#define BLOCKCACHE_SLOT_SIZE (BLOCKCACHE_SLOT_SECTORS * DISK_SECTOR_SIZE)
+// Sectors read on a miss that doesn't continue the previous read.
+#define BLOCKCACHE_RANDOM_SECTORS 8
+#define BLOCKCACHE_DRIVES 4
+
+struct blockcache_slot {
+    struct drive_s *drive_gf;
+    u64 lba;
+    u16 count;          // valid sectors, 0 when empty
+    u32 lastuse;
+    u8 *buf;
+};
+
+struct blockcache_s {
+    u32 tick, hits, misses;
+    // Where the last read of a drive ended, for the read-ahead.
+    struct {
+        struct drive_s *drive_gf;
+        u64 next;
+    } seq[BLOCKCACHE_DRIVES];
+    int slotcount;
+    struct blockcache_slot slots[];
+};
+
+struct blockcache_s *BlockCache VARFSEG;
+
+// A slot fill handed to the driver, then back to blockcache_fill().
+struct blockcache_req_s {
+    struct disk_op_s *op_fl;
+    struct disk_op_s fill;
+    int slot;
+};
+
+// Set up the cache in high memory, just ahead of malloc_prepboot() giving
+// the unused part of ZoneHigh back.
+void
+blockcache_setup(void)
+{
+    ASSERT32FLAT();
+    int count = BUILD_BLOCKCACHE_SIZE / BLOCKCACHE_SLOT_SIZE;
+    if (!CONFIG_DRIVES || !count)
+        return;
+    struct blockcache_s *bc = malloc_high(
+        sizeof(*bc) + count * sizeof(bc->slots[0]));
+    u8 *buf = memalign_high(PAGE_SIZE, count * BLOCKCACHE_SLOT_SIZE);
+    if (!bc || !buf) {
+        warn_noalloc();
+        free(bc);
+        free(buf);
+        return;
+    }
+    memset(bc, 0, sizeof(*bc) + count * sizeof(bc->slots[0]));
+    bc->slotcount = count;
+    int i;
+    for (i=0; i<count; i++)
+        bc->slots[i].buf = buf + i * BLOCKCACHE_SLOT_SIZE;
+    dprintf(1, "Disk read cache: %d slots of %d KiB at %p\n"
+            , count, BLOCKCACHE_SLOT_SIZE / 1024, buf);
+    BlockCache = bc;
+}
+
+// Only 512 byte sector drives whose drivers can DMA above 1MiB are cached.
+static int
+blockcache_drive(struct drive_s *drive_gf)
+{
+    if (GET_GLOBALFLAT(drive_gf->blksize) != DISK_SECTOR_SIZE)
+        return 0;
+    switch (GET_GLOBALFLAT(drive_gf->type)) {
+    case DTYPE_AHCI:
+    case DTYPE_SD:
+    case DTYPE_USB:
+    case DTYPE_USB_32:
+    case DTYPE_UAS:
+    case DTYPE_UAS_32:
+    case DTYPE_VIRTIO_BLK:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+// Pick the slot for a new fill: an empty one, otherwise the least recently
+// used slot of the drive once it holds half of them, else of all drives.
+static int
+blockcache_victim(struct blockcache_s *bc, struct drive_s *drive_gf)
+{
+    int i, own = 0, lru = -1, ownlru = -1;
+    for (i=0; i<bc->slotcount; i++) {
+        struct blockcache_slot *s = &bc->slots[i];
+        if (!s->count)
+            return i;
+        if (s->drive_gf == drive_gf) {
+            own++;
+            if (ownlru < 0 || s->lastuse < bc->slots[ownlru].lastuse)
+                ownlru = i;
+        }
+        if (lru < 0 || s->lastuse < bc->slots[lru].lastuse)
+            lru = i;
+    }
+    return own >= bc->slotcount / 2 ? ownlru : lru;
+}
+
+// Drop the slots overlapping sectors about to be written.
+void VISIBLE32FLAT
+blockcache_invalidate(struct disk_op_s *op)
+{
+    ASSERT32FLAT();
+    struct blockcache_s *bc = BlockCache;
+    int i;
+    for (i=0; i<bc->slotcount; i++) {
+        struct blockcache_slot *s = &bc->slots[i];
+        if (s->count && s->drive_gf == op->drive_gf
+            && s->lba < op->lba + op->count && op->lba < s->lba + s->count)
+            s->count = 0;
+    }
+}
+
+// Copy a read out of the cache (returns 0), or prepare the slot fill for
+// it (returns 1).  Reads larger than a slot aren't cached (returns -1).
+int VISIBLE32FLAT
+blockcache_lookup(struct blockcache_req_s *req)
+{
+    ASSERT32FLAT();
+    struct blockcache_s *bc = BlockCache;
+    struct disk_op_s *op = req->op_fl;
+    if (op->count > BLOCKCACHE_SLOT_SECTORS)
+        return -1;
+
+    int i, d;
+    for (d=0; d<BLOCKCACHE_DRIVES-1; d++)
+        if (!bc->seq[d].drive_gf || bc->seq[d].drive_gf == op->drive_gf)
+            break;
+    int sequential = (bc->seq[d].drive_gf == op->drive_gf
+                      && bc->seq[d].next == op->lba);
+    bc->seq[d].drive_gf = op->drive_gf;
+    bc->seq[d].next = op->lba + op->count;
+    bc->tick++;
+
+    for (i=0; i<bc->slotcount; i++) {
+        struct blockcache_slot *s = &bc->slots[i];
+        if (s->count && s->drive_gf == op->drive_gf && op->lba >= s->lba
+            && op->lba + op->count <= s->lba + s->count) {
+            memcpy(op->buf_fl, s->buf + (op->lba - s->lba) * DISK_SECTOR_SIZE
+                   , op->count * DISK_SECTOR_SIZE);
+            s->lastuse = bc->tick;
+            bc->hits++;
+            return 0;
+        }
+    }
+
+    // Read ahead a whole slot when the reads are sequential.
+    u64 sectors = op->drive_gf->sectors;
+    u32 count = sequential ? BLOCKCACHE_SLOT_SECTORS : BLOCKCACHE_RANDOM_SECTORS;
+    if (count < op->count)
+        count = op->count;
+    if (op->lba + count > sectors)
+        count = op->lba < sectors ? sectors - op->lba : op->count;
+    if (count < op->count)
+        return -1;
+
+    i = blockcache_victim(bc, op->drive_gf);
+    struct blockcache_slot *s = &bc->slots[i];
+    s->count = 0;
+    req->slot = i;
+    req->fill = *op;
+    req->fill.count = count;
+    req->fill.buf_fl = s->buf;
+    bc->misses++;
+    dprintf(6, "blockcache: fill slot %d d=%p lba=%d count=%d"
+            " (%d hits, %d misses)\n", i, op->drive_gf, (u32)op->lba, count
+            , bc->hits, bc->misses);
+    return 1;
+}
+
+// A slot fill succeeded, hand out the requested part.
+void VISIBLE32FLAT
+blockcache_fill(struct blockcache_req_s *req)
+{
+    ASSERT32FLAT();
+    struct blockcache_s *bc = BlockCache;
+    struct blockcache_slot *s = &bc->slots[req->slot];
+    struct disk_op_s *op = req->op_fl;
+    s->drive_gf = op->drive_gf;
+    s->lba = op->lba;
+    s->count = req->fill.count;
+    s->lastuse = bc->tick;
+    memcpy(op->buf_fl, s->buf, op->count * DISK_SECTOR_SIZE);
+}
+
+static int process_driver_op(struct disk_op_s *op);
+
+// Execute a read through the cache, writes go through and invalidate it.
+static int
+process_cached_op(struct disk_op_s *op)
+{
+    extern void _cfunc32flat_blockcache_invalidate(void);
+    extern void _cfunc32flat_blockcache_lookup(void);
+    extern void _cfunc32flat_blockcache_fill(void);
+    struct blockcache_req_s req;
+    int ret;
+
+    switch (op->command) {
+    case CMD_WRITE:
+    case CMD_FORMAT:
+        call32(_cfunc32flat_blockcache_invalidate
+               , (u32)MAKE_FLATPTR(GET_SEG(SS), op), 0);
+        return process_driver_op(op);
+    case CMD_READ:
+        break;
+    default:
+        return process_driver_op(op);
+    }
+
+    req.op_fl = MAKE_FLATPTR(GET_SEG(SS), op);
+    ret = call32(_cfunc32flat_blockcache_lookup
+                 , (u32)MAKE_FLATPTR(GET_SEG(SS), &req), -1);
+    if (ret <= 0)
+        return ret ? process_driver_op(op) : DISK_RET_SUCCESS;
+
+    ret = process_driver_op(&req.fill);
+    if (ret)
+        // Leave the slot empty and let the driver handle the request.
+        return process_driver_op(op);
+    call32(_cfunc32flat_blockcache_fill
+           , (u32)MAKE_FLATPTR(GET_SEG(SS), &req), 0);
+    return DISK_RET_SUCCESS;
+}
+
 // Execute a disk_op request.
 int
 process_op(struct disk_op_s *op)
+{
+    ASSERT16();
+    if (GET_GLOBAL(BlockCache) && blockcache_drive(op->drive_gf))
+        return process_cached_op(op);
+    return process_driver_op(op);
+}
+
+// Hand a disk_op request to the driver of the drive.
+static int
+process_driver_op(struct disk_op_s *op)
 {
     ASSERT16();
     int ret, origcount = op->count;
@@ -124,6 +124,7 @@ void __disk_ret_unimplemented(struct bregs *regs, u32 linecode
 int process_op(struct disk_op_s *op);
 int send_disk_op(struct disk_op_s *op);
 int create_bounce_buf(void);
+void blockcache_setup(void);
 
 // Helper function for setting up a return code.
 #define disk_ret(regs, code) \
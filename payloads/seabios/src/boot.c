@@ -341,6 +341,7 @@ static struct hlist_head BootList VARVERIFY32INIT;
 #define IPL_TYPE_CBFS        0x20
 #define IPL_TYPE_BEV         0x80
 #define IPL_TYPE_BCV         0x81
+#define IPL_TYPE_ROMFILE     0x82
 #define IPL_TYPE_HALT        0xf0
 
 static void
@@ -436,6 +437,15 @@ boot_add_cbfs(void *data, const char *desc, int prio)
     bootentry_add(IPL_TYPE_CBFS, defPrio(prio, DEFAULT_PRIO), (u32)data, desc);
 }
 
+// Add a network rom in CBFS that is only deployed when it is booted
+void
+boot_add_romfile(struct romfile_s *file, int prio)
+{
+    bootentry_add(IPL_TYPE_ROMFILE, defPrio(prio, DefaultBEVPrio)
+                  , (u32)file, file->name);
+    DefaultBEVPrio = DEFAULT_PRIO;
+}
+
 
 /****************************************************************
  * Keyboard calls
@@ -646,6 +656,22 @@ bcv_prepboot(void)
             map_hd_drive(pos->drive);
             add_bev(IPL_TYPE_HARDDISK, 0);
             break;
+        case IPL_TYPE_ROMFILE:
+            if (!BEVCount) {
+                // First to boot (bootorder or boot menu) - deploy it now
+                // while PMM is still available.
+                u32 vector = run_deferred_rom((void*)pos->data);
+                if (vector)
+                    add_bev(IPL_TYPE_BEV, vector);
+            } else {
+                // Only deployed by do_boot() if the devices before it
+                // fail to boot.
+                struct deferred_rom_s *drom;
+                drom = prepare_deferred_rom((void*)pos->data);
+                if (drom)
+                    add_bev(IPL_TYPE_ROMFILE, (u32)drom);
+            }
+            break;
         case IPL_TYPE_CDROM:
             map_cd_drive(pos->drive);
             // NO BREAK
@@ -766,6 +792,20 @@ boot_rom(u32 vector)
     call_boot_entry(so, 0);
 }
 
+// Boot from a network rom that was not deployed during POST.
+static void
+boot_deferred(struct deferred_rom_s *drom)
+{
+    if (!CONFIG_DEFER_NETWORK_ROMS)
+        return;
+    u32 vector = boot_deferred_rom(drom);
+    if (!vector) {
+        printf("Boot failed: could not deploy the network rom\n\n");
+        return;
+    }
+    boot_rom(vector);
+}
+
 // Unable to find bootable device - warn user and eventually retry.
 static void
 boot_fail(void)
@@ -819,6 +859,9 @@ do_boot(int seq_nr)
     case IPL_TYPE_BEV:
         boot_rom(ie->vector);
         break;
+    case IPL_TYPE_ROMFILE:
+        boot_deferred((void*)ie->vector);
+        break;
     case IPL_TYPE_HALT:
         boot_fail();
         break;
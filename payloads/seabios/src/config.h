@@ -18,6 +18,8 @@
 #define BUILD_MAX_E820 32
 // Space to reserve in high-memory for tables
 #define BUILD_MAX_HIGHTABLE (256*1024)
+// Space to reserve in high-memory for the disk read cache (0 to disable)
+#define BUILD_BLOCKCACHE_SIZE (256*1024)
 // Largest supported externaly facing drive id
 #define BUILD_MAX_EXTDRIVE 16
 // Number of bytes the smbios may be and still live in the f-segment
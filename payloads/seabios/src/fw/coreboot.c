@@ -9,6 +9,7 @@
 #include "byteorder.h" // be32_to_cpu
 #include "config.h" // CONFIG_*
 #include "hw/pci.h" // pci_probe_devices
+#include "lz4dec.h" // lz4_decode_frame
 #include "lzmadecode.h" // LzmaDecode
 #include "malloc.h" // free
 #include "memmap.h" // add_e820
@@ -18,6 +19,7 @@
 #include "stacks.h" // yield
 #include "string.h" // memset
 #include "util.h" // coreboot_preinit
+#include "x86.h" // rdtscll
 #include "efi.h" // EFI memory info
 #include "coreboot.h" // cbfs_romfile_s
 
@@ -92,6 +94,7 @@ struct cb_cbmem_ref {
     u64 cbmem_addr;
 };
 
+#define CB_TAG_TIMESTAMPS 0x16
 #define CB_TAG_CBMEM_CONSOLE 0x17
 
 struct cbmem_console {
@@ -101,6 +104,19 @@ struct cbmem_console {
 } PACKED;
 static struct cbmem_console *cbcon = NULL;
 
+struct cb_timestamp_entry {
+    u32 entry_id;
+    u64 entry_stamp;
+} PACKED;
+
+struct cb_timestamp_table {
+    u64 base_time;
+    u32 max_entries;
+    u32 num_entries;
+    struct cb_timestamp_entry entries[0];
+} PACKED;
+static struct cb_timestamp_table *cbts = NULL;
+
 static u16
 ipchksum(char *buf, int count)
 {
@@ -301,6 +317,12 @@ coreboot_preinit(void)
         dprintf(1, "Found coreboot cbmem console @ %llx\n", cbref->cbmem_addr);
     }
 
+    cbref = find_cb_subtable(cbh, CB_TAG_TIMESTAMPS);
+    if (cbref) {
+        cbts = (void*)(u32)cbref->cbmem_addr;
+        coreboot_timestamp(CB_TS_SEABIOS_START);
+    }
+
     struct cb_mainboard *cbmb = find_cb_subtable(cbh, CB_TAG_MAINBOARD);
     if (cbmb) {
         CBvendor = &cbmb->strings[cbmb->vendor_idx];
@@ -317,6 +339,18 @@ fail:
     return;
 }
 
+// Append to the coreboot timestamp table so that the payload shows up in
+// the same boot timeline as the firmware stages before it.
+void
+coreboot_timestamp(u32 id)
+{
+    if (!CONFIG_COREBOOT || !cbts || cbts->num_entries >= cbts->max_entries)
+        return;
+    struct cb_timestamp_entry *e = &cbts->entries[cbts->num_entries++];
+    e->entry_id = id;
+    e->entry_stamp = rdtscll() - cbts->base_time;
+}
+
 void coreboot_debug_putc(char c)
 {
     if (!CONFIG_DEBUG_COREBOOT)
@@ -406,6 +440,20 @@ ulzma(u8 *dst, u32 maxlen, const u8 *src, u32 srclen)
     return dstlen;
 }
 
+// Uncompress an LZ4 frame in memory to an area of memory.
+static int
+ulz4(u8 *dst, u32 maxlen, const u8 *src, u32 srclen)
+{
+    dprintf(3, "Uncompressing LZ4 data %d@%p to %d@%p\n"
+            , srclen, src, maxlen, dst);
+    u32 dstlen = lz4_decode_frame(src, srclen, dst, maxlen);
+    if (!dstlen) {
+        dprintf(1, "LZ4 decoding failed\n");
+        return -1;
+    }
+    return dstlen;
+}
+
 
 /****************************************************************
  * Coreboot flash format
@@ -435,6 +483,10 @@ struct cbfs_file {
     char filename[0];
 } PACKED;
 
+#define CBFS_COMPRESS_NONE  0
+#define CBFS_COMPRESS_LZMA  1
+#define CBFS_COMPRESS_LZ4   2
+
 // Copy a file to memory (uncompressing if necessary)
 static int
 cbfs_copyfile(struct romfile_s *file, void *dst, u32 maxlen)
@@ -454,7 +506,11 @@ cbfs_copyfile(struct romfile_s *file, void *dst, u32 maxlen)
             return -1;
         }
         iomemcpy(temp, src, size);
-        int ret = ulzma(dst, maxlen, temp, size);
+        int ret;
+        if (CONFIG_LZ4 && cfile->flags == CBFS_COMPRESS_LZ4)
+            ret = ulz4(dst, maxlen, temp, size);
+        else
+            ret = ulzma(dst, maxlen, temp, size);
         yield();
         free(temp);
         return ret;
@@ -470,6 +526,50 @@ cbfs_copyfile(struct romfile_s *file, void *dst, u32 maxlen)
     return size;
 }
 
+// Copy a romfile to permanent memory, so that it can still be used
+// with cbfs_copyfile_boot() after the temporary zones are released.
+struct romfile_s *
+cbfs_romfile_keep(struct romfile_s *file)
+{
+    if (!CONFIG_COREBOOT_FLASH)
+        return NULL;
+
+    struct cbfs_romfile_s *cfile, *kept;
+    cfile = container_of(file, struct cbfs_romfile_s, file);
+    kept = malloc_high(sizeof(*kept));
+    if (!kept) {
+        warn_noalloc();
+        return NULL;
+    }
+    memcpy(kept, cfile, sizeof(*kept));
+    return &kept->file;
+}
+
+// Copy a file to memory at boot time (int 19).  Unlike cbfs_copyfile()
+// no temporary ram is available, so compressed data is read straight
+// from flash (as cbfs_run_payload() does).
+int
+cbfs_copyfile_boot(struct romfile_s *file, void *dst, u32 maxlen)
+{
+    if (!CONFIG_COREBOOT_FLASH)
+        return -1;
+
+    struct cbfs_romfile_s *cfile;
+    cfile = container_of(file, struct cbfs_romfile_s, file);
+    u32 size = cfile->rawsize;
+    void *src = cfile->data;
+    if (CONFIG_LZ4 && cfile->flags == CBFS_COMPRESS_LZ4)
+        return ulz4(dst, maxlen, src, size);
+    if (cfile->flags)
+        return ulzma(dst, maxlen, src, size);
+    if (size > maxlen) {
+        warn_noalloc();
+        return -1;
+    }
+    iomemcpy(dst, src, size);
+    return size;
+}
+
 // Process CBFS links file.  The links file is a newline separated
 // file where each line has a "link name" and a "destination name"
 // separated by a space character.
@@ -547,9 +647,23 @@ coreboot_cbfs_init(void)
         int len = strlen(cfile->file.name);
         if (len > 5 && strcmp(&cfile->file.name[len-5], ".lzma") == 0) {
             // Using compression.
-            cfile->flags = 1;
+            cfile->flags = CBFS_COMPRESS_LZMA;
             cfile->file.name[len-5] = '\0';
             cfile->file.size = *(u32*)(cfile->data + LZMA_PROPERTIES_SIZE);
+        } else if (CONFIG_LZ4 && len > 4
+                   && strcmp(&cfile->file.name[len-4], ".lz4") == 0) {
+            // Only frames that carry the content size can be listed.
+            u8 *frame = cfile->data;
+            if (cfile->rawsize >= LZ4_FRAME_MIN_SIZE + 8
+                && *(u32*)frame == LZ4_FRAME_MAGIC
+                && (frame[4] & LZ4_FLG_CONTENT_SIZE)) {
+                cfile->flags = CBFS_COMPRESS_LZ4;
+                cfile->file.name[len-4] = '\0';
+                cfile->file.size = *(u32*)(frame + 6);
+            } else {
+                dprintf(1, "No content size in LZ4 file %s\n"
+                        , cfile->file.name);
+            }
         }
         romfile_add(&cfile->file);
 
@@ -635,9 +749,6 @@ struct cbfs_payload_segment {
 #define PAYLOAD_SEGMENT_BSS    0x20535342
 #define PAYLOAD_SEGMENT_ENTRY  0x52544E45
 
-#define CBFS_COMPRESS_NONE  0
-#define CBFS_COMPRESS_LZMA  1
-
 struct cbfs_payload {
     struct cbfs_payload_segment segments[1];
 };
@@ -759,6 +870,12 @@ cbfs_run_payload(struct cbfs_file *fhdr)
                 if (ret < 0)
                     return;
                 src_len = ret;
+            } else if (CONFIG_LZ4
+                       && seg->compression == cpu_to_be32(CBFS_COMPRESS_LZ4)) {
+                int ret = ulz4(dest, dest_len, src, src_len);
+                if (ret < 0)
+                    return;
+                src_len = ret;
             } else {
                 dprintf(1, "No support for compression type %x\n"
                         , seg->compression);
@@ -36,6 +36,13 @@ struct bootorder_container {
     char bootorder_data[0];     /* Variable size */
 };
 
+// SeaBIOS entries in the coreboot timestamp table.
+#define CB_TS_SEABIOS_START         1100
+#define CB_TS_SEABIOS_DEVICES       1101
+#define CB_TS_SEABIOS_OPTIONROMS    1102
+#define CB_TS_SEABIOS_BOOTMENU      1103
+#define CB_TS_SEABIOS_BOOT          1104
+
 #define CBMEM_ID_BOOTORDER  0x424f4f54
 #define CBMEM_MAGIC         0x434f5245
 
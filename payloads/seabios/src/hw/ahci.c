@@ -31,15 +31,14 @@ static void sata_prep_simple(struct sata_cmd_fis *fis, u8 command)
 }
 
 static void sata_prep_readwrite(struct sata_cmd_fis *fis,
-                                struct disk_op_s *op, int iswrite)
+                                u64 lba, u32 count, int iswrite)
 {
-    u64 lba = op->lba;
     u8 command;
 
     memset_fl(fis, 0, sizeof(*fis));
 
-    if (op->count >= (1<<8) || lba + op->count >= (1<<28)) {
-        fis->sector_count2 = op->count >> 8;
+    if (count >= (1<<8) || lba + count >= (1<<28)) {
+        fis->sector_count2 = count >> 8;
         fis->lba_low2      = lba >> 24;
         fis->lba_mid2      = lba >> 32;
         fis->lba_high2     = lba >> 40;
@@ -52,13 +51,32 @@ static void sata_prep_readwrite(struct sata_cmd_fis *fis,
     }
     fis->feature      = 1; /* dma */
     fis->command      = command;
-    fis->sector_count = op->count;
+    fis->sector_count = count;
     fis->lba_low      = lba;
     fis->lba_mid      = lba >> 8;
     fis->lba_high     = lba >> 16;
     fis->device       = ((lba >> 24) & 0xf) | ATA_CB_DH_LBA;
 }
 
+// first party dma: the count moves to the feature field, the tag takes its place
+static void sata_prep_ncq(struct sata_cmd_fis *fis, u64 lba, u32 count,
+                          u32 tag, int iswrite)
+{
+    memset_fl(fis, 0, sizeof(*fis));
+    fis->command       = (iswrite ? ATA_CMD_WRITE_FPDMA_QUEUED
+                          : ATA_CMD_READ_FPDMA_QUEUED);
+    fis->feature       = count;
+    fis->feature2      = count >> 8;
+    fis->sector_count  = tag << 3;
+    fis->lba_low       = lba;
+    fis->lba_mid       = lba >> 8;
+    fis->lba_high      = lba >> 16;
+    fis->lba_low2      = lba >> 24;
+    fis->lba_mid2      = lba >> 32;
+    fis->lba_high2     = lba >> 40;
+    fis->device        = ATA_CB_DH_LBA;
+}
+
 static void sata_prep_atapi(struct sata_cmd_fis *fis, u16 blocksize)
 {
     memset_fl(fis, 0, sizeof(*fis));
@@ -101,31 +119,92 @@ static void ahci_port_writel(struct ahci_ctrl_s *ctrl, u32 pnr, u32 reg, u32 val
     ahci_ctrl_writel(ctrl, ctrl_reg, val);
 }
 
-// submit ahci command + wait for result
-static int ahci_command(struct ahci_port_s *port_gf, int iswrite, int isatapi,
-                        void *buffer, u32 bsize)
+static struct ahci_cmd_s *ahci_port_cmd(struct ahci_port_s *port_gf, u32 slot)
 {
-    u32 val, status, success, flags, intbits, error;
-    struct ahci_ctrl_s *ctrl = port_gf->ctrl;
-    struct ahci_cmd_s  *cmd  = port_gf->cmd;
-    struct ahci_fis_s  *fis  = port_gf->fis;
+    return (void*)port_gf->cmd + slot * AHCI_CMD_TABLE_SIZE;
+}
+
+// fill the command header of a slot, the buffer gets one prd per 4MB
+static void ahci_prep_slot(struct ahci_port_s *port_gf, u32 slot, int iswrite,
+                           int isatapi, void *buffer, u32 bsize)
+{
+    struct ahci_cmd_s  *cmd  = ahci_port_cmd(port_gf, slot);
     struct ahci_list_s *list = port_gf->list;
-    u32 pnr                  = port_gf->pnr;
+    u32 flags, prds, len;
 
     cmd->fis.reg       = 0x27;
     cmd->fis.pmp_type  = 1 << 7; /* cmd fis */
-    cmd->prdt[0].base  = (u32)buffer;
-    cmd->prdt[0].baseu = 0;
-    cmd->prdt[0].flags = bsize-1;
+    for (prds = 0; bsize && prds < AHCI_MAX_PRDT; prds++) {
+        len = bsize < AHCI_PRD_MAX_BYTES ? bsize : AHCI_PRD_MAX_BYTES;
+        cmd->prdt[prds].base  = (u32)buffer;
+        cmd->prdt[prds].baseu = 0;
+        cmd->prdt[prds].flags = len-1;
+        buffer += len;
+        bsize -= len;
+    }
 
-    flags = ((1 << 16) | /* one prd entry */
+    flags = ((prds << 16) | /* prd entries */
              (iswrite ? (1 << 6) : 0) |
              (isatapi ? (1 << 5) : 0) |
              (5 << 0)); /* fis length (dwords) */
-    list[0].flags  = flags;
-    list[0].bytes  = 0;
-    list[0].base   = (u32)(cmd);
-    list[0].baseu  = 0;
+    list[slot].flags  = flags;
+    list[slot].bytes  = 0;
+    list[slot].base   = (u32)(cmd);
+    list[slot].baseu  = 0;
+}
+
+// non-queued error recovery (AHCI 1.3 section 6.2.2.1)
+static void ahci_port_recover(struct ahci_ctrl_s *ctrl, u32 pnr)
+{
+    u32 val;
+
+    // Clears PxCMD.ST to 0 to reset the PxCI register
+    val = ahci_port_readl(ctrl, pnr, PORT_CMD);
+    ahci_port_writel(ctrl, pnr, PORT_CMD, val & ~PORT_CMD_START);
+
+    // waits for PxCMD.CR to clear to 0
+    while (1) {
+        val = ahci_port_readl(ctrl, pnr, PORT_CMD);
+        if ((val & PORT_CMD_LIST_ON) == 0)
+            break;
+        yield();
+    }
+
+    // Clears any error bits in PxSERR to enable capturing new errors
+    val = ahci_port_readl(ctrl, pnr, PORT_SCR_ERR);
+    ahci_port_writel(ctrl, pnr, PORT_SCR_ERR, val);
+
+    // Clears status bits in PxIS as appropriate
+    val = ahci_port_readl(ctrl, pnr, PORT_IRQ_STAT);
+    ahci_port_writel(ctrl, pnr, PORT_IRQ_STAT, val);
+
+    // If PxTFD.STS.BSY or PxTFD.STS.DRQ is set to 1, issue
+    // a COMRESET to the device to put it in an idle state
+    val = ahci_port_readl(ctrl, pnr, PORT_TFDATA);
+    if (val & (ATA_CB_STAT_BSY | ATA_CB_STAT_DRQ)) {
+        dprintf(2, "AHCI/%d: issue comreset\n", pnr);
+        val = ahci_port_readl(ctrl, pnr, PORT_SCR_CTL);
+        // set Device Detection Initialization (DET) to 1 for 1 ms for comreset
+        ahci_port_writel(ctrl, pnr, PORT_SCR_CTL, val | 1);
+        mdelay (1);
+        ahci_port_writel(ctrl, pnr, PORT_SCR_CTL, val);
+    }
+
+    // Sets PxCMD.ST to 1 to enable issuing new commands
+    val = ahci_port_readl(ctrl, pnr, PORT_CMD);
+    ahci_port_writel(ctrl, pnr, PORT_CMD, val | PORT_CMD_START);
+}
+
+// submit ahci command + wait for result
+static int ahci_command(struct ahci_port_s *port_gf, int iswrite, int isatapi,
+                        void *buffer, u32 bsize)
+{
+    u32 status, success, intbits, error;
+    struct ahci_ctrl_s *ctrl = port_gf->ctrl;
+    struct ahci_fis_s  *fis  = port_gf->fis;
+    u32 pnr                  = port_gf->pnr;
+
+    ahci_prep_slot(port_gf, 0, iswrite, isatapi, buffer, bsize);
 
     dprintf(8, "AHCI/%d: send cmd ...\n", pnr);
     intbits = ahci_port_readl(ctrl, pnr, PORT_IRQ_STAT);
@@ -170,45 +249,89 @@ static int ahci_command(struct ahci_port_s *port_gf, int iswrite, int isatapi,
     } else {
         dprintf(2, "AHCI/%d: ... finished, status 0x%x, ERROR 0x%x\n", pnr,
                 status, error);
+        ahci_port_recover(ctrl, pnr);
+    }
+    return success ? 0 : -1;
+}
 
-        // non-queued error recovery (AHCI 1.3 section 6.2.2.1)
-        // Clears PxCMD.ST to 0 to reset the PxCI register
-        val = ahci_port_readl(ctrl, pnr, PORT_CMD);
-        ahci_port_writel(ctrl, pnr, PORT_CMD, val & ~PORT_CMD_START);
+// read/write sectors with one command per free slot, up to AHCI_MAX_SECTORS
+// each, or AHCI_NCQ_SECTORS each with native command queuing so the drive
+// works on several of them at once.
+static int ahci_queue_readwrite(struct ahci_port_s *port_gf, u64 lba,
+                                u32 count, u8 *buf, int iswrite)
+{
+    struct ahci_ctrl_s *ctrl = port_gf->ctrl;
+    u32 pnr                  = port_gf->pnr;
+    u32 ncq                  = port_gf->ncq;
+    u32 allslots = (1 << port_gf->slots) - 1;
+    u32 chunk = ncq ? AHCI_NCQ_SECTORS : AHCI_MAX_SECTORS;
+    u32 pending = 0, intbits, slot, n, tf;
 
-        // waits for PxCMD.CR to clear to 0
-        while (1) {
-            val = ahci_port_readl(ctrl, pnr, PORT_CMD);
-            if ((val & PORT_CMD_LIST_ON) == 0)
-                break;
-            yield();
-        }
+    intbits = ahci_port_readl(ctrl, pnr, PORT_IRQ_STAT);
+    if (intbits)
+        ahci_port_writel(ctrl, pnr, PORT_IRQ_STAT, intbits);
 
-        // Clears any error bits in PxSERR to enable capturing new errors
-        val = ahci_port_readl(ctrl, pnr, PORT_SCR_ERR);
-        ahci_port_writel(ctrl, pnr, PORT_SCR_ERR, val);
+    u32 end = timer_calc(AHCI_REQUEST_TIMEOUT);
+    for (;;) {
+        // hand the next pieces of the request to the free slots
+        while (count && (allslots & ~pending)) {
+            slot = __ffs(allslots & ~pending);
+            n = count < chunk ? count : chunk;
+            struct ahci_cmd_s *cmd = ahci_port_cmd(port_gf, slot);
+            if (ncq)
+                sata_prep_ncq(&cmd->fis, lba, n, slot, iswrite);
+            else
+                sata_prep_readwrite(&cmd->fis, lba, n, iswrite);
+            ahci_prep_slot(port_gf, slot, iswrite, 0, buf,
+                           n * DISK_SECTOR_SIZE);
+            if (ncq)
+                ahci_port_writel(ctrl, pnr, PORT_SCR_ACT, 1 << slot);
+            ahci_port_writel(ctrl, pnr, PORT_CMD_ISSUE, 1 << slot);
+            dprintf(8, "AHCI/%d: slot %d, lba %6x, count %4x\n",
+                    pnr, slot, (u32)lba, n);
+            pending |= 1 << slot;
+            lba += n;
+            count -= n;
+            buf += n * DISK_SECTOR_SIZE;
+        }
+        if (!pending)
+            break;
 
-        // Clears status bits in PxIS as appropriate
-        val = ahci_port_readl(ctrl, pnr, PORT_IRQ_STAT);
-        ahci_port_writel(ctrl, pnr, PORT_IRQ_STAT, val);
+        intbits = ahci_port_readl(ctrl, pnr, PORT_IRQ_STAT);
+        if (intbits)
+            ahci_port_writel(ctrl, pnr, PORT_IRQ_STAT, intbits);
+        if (intbits & (PORT_IRQ_ERROR | PORT_IRQ_TF_ERR)) {
+            dprintf(2, "AHCI/%d: ... error, intbits 0x%x, tf 0x%x\n", pnr,
+                    intbits, ahci_port_readl(ctrl, pnr, PORT_TFDATA));
+            ahci_port_recover(ctrl, pnr);
+            return -1;
+        }
 
-        // If PxTFD.STS.BSY or PxTFD.STS.DRQ is set to 1, issue
-        // a COMRESET to the device to put it in an idle state
-        val = ahci_port_readl(ctrl, pnr, PORT_TFDATA);
-        if (val & (ATA_CB_STAT_BSY | ATA_CB_STAT_DRQ)) {
-            dprintf(2, "AHCI/%d: issue comreset\n", pnr);
-            val = ahci_port_readl(ctrl, pnr, PORT_SCR_CTL);
-            // set Device Detection Initialization (DET) to 1 for 1 ms for comreset
-            ahci_port_writel(ctrl, pnr, PORT_SCR_CTL, val | 1);
-            mdelay (1);
-            ahci_port_writel(ctrl, pnr, PORT_SCR_CTL, val);
+        // queued commands finish when they leave PxSACT, others with PxCI
+        n = ahci_port_readl(ctrl, pnr, PORT_CMD_ISSUE);
+        if (ncq)
+            n |= ahci_port_readl(ctrl, pnr, PORT_SCR_ACT);
+        if (pending & ~n)
+            // refill the finished slots right away
+            end = timer_calc(AHCI_REQUEST_TIMEOUT);
+        pending &= n;
+        if (pending == allslots || (pending && !count)) {
+            if (timer_check(end)) {
+                warn_timeout();
+                ahci_port_recover(ctrl, pnr);
+                return -1;
+            }
+            yield();
         }
+    }
 
-        // Sets PxCMD.ST to 1 to enable issuing new commands
-        val = ahci_port_readl(ctrl, pnr, PORT_CMD);
-        ahci_port_writel(ctrl, pnr, PORT_CMD, val | PORT_CMD_START);
+    tf = ahci_port_readl(ctrl, pnr, PORT_TFDATA);
+    if (tf & (ATA_CB_STAT_BSY | ATA_CB_STAT_DF | ATA_CB_STAT_ERR)) {
+        dprintf(2, "AHCI/%d: ... finished, tf 0x%x, ERROR\n", pnr, tf);
+        ahci_port_recover(ctrl, pnr);
+        return -1;
     }
-    return success ? 0 : -1;
+    return 0;
 }
 
 #define CDROM_CDB_SIZE 12
@@ -235,18 +358,20 @@ int ahci_cmd_data(struct disk_op_s *op, void *cdbcmd, u16 blocksize)
     return DISK_RET_SUCCESS;
 }
 
+// Bounce buffer for unaligned requests, a run of sectors per command.
+u8 *ahci_bounce_fl VARFSEG;
+u32 ahci_bounce_size VARFSEG;
+
 // read/write count blocks from a harddrive, op->buf_fl must be word aligned
 static int
 ahci_disk_readwrite_aligned(struct disk_op_s *op, int iswrite)
 {
     struct ahci_port_s *port_gf = container_of(
         op->drive_gf, struct ahci_port_s, drive);
-    struct ahci_cmd_s *cmd = port_gf->cmd;
     int rc;
 
-    sata_prep_readwrite(&cmd->fis, op, iswrite);
-    rc = ahci_command(port_gf, iswrite, 0, op->buf_fl,
-                      op->count * DISK_SECTOR_SIZE);
+    rc = ahci_queue_readwrite(port_gf, op->lba, op->count, op->buf_fl,
+                              iswrite);
     dprintf(8, "ahci disk %s, lba %6x, count %3x, buf %p, rc %d\n",
             iswrite ? "write" : "read", (u32)op->lba, op->count, op->buf_fl, rc);
     if (rc < 0)
@@ -265,32 +390,31 @@ ahci_disk_readwrite(struct disk_op_s *op, int iswrite)
     // Use a word aligned buffer for AHCI I/O
     int rc;
     struct disk_op_s localop = *op;
-    u8 *alignedbuf_fl = bounce_buf_fl;
+    u8 *alignedbuf_fl = ahci_bounce_fl;
+    u32 max = ahci_bounce_size / DISK_SECTOR_SIZE;
     u8 *position = op->buf_fl;
+    u16 left = op->count;
+    u32 bytes;
 
+    if (!alignedbuf_fl) {
+        alignedbuf_fl = bounce_buf_fl;
+        max = CDROM_SECTOR_SIZE / DISK_SECTOR_SIZE;
+    }
     localop.buf_fl = alignedbuf_fl;
-    localop.count = 1;
-
-    if (iswrite) {
-        u16 block;
-        for (block = 0; block < op->count; block++) {
-            memcpy_fl (alignedbuf_fl, position, DISK_SECTOR_SIZE);
-            rc = ahci_disk_readwrite_aligned (&localop, 1);
-            if (rc)
-                return rc;
-            position += DISK_SECTOR_SIZE;
-            localop.lba++;
-        }
-    } else { // read
-        u16 block;
-        for (block = 0; block < op->count; block++) {
-            rc = ahci_disk_readwrite_aligned (&localop, 0);
-            if (rc)
-                return rc;
-            memcpy_fl (position, alignedbuf_fl, DISK_SECTOR_SIZE);
-            position += DISK_SECTOR_SIZE;
-            localop.lba++;
-        }
+
+    while (left) {
+        localop.count = left < max ? left : max;
+        bytes = localop.count * DISK_SECTOR_SIZE;
+        if (iswrite)
+            memcpy_fl (alignedbuf_fl, position, bytes);
+        rc = ahci_disk_readwrite_aligned (&localop, iswrite);
+        if (rc)
+            return rc;
+        if (!iswrite)
+            memcpy_fl (position, alignedbuf_fl, bytes);
+        position += bytes;
+        localop.lba += localop.count;
+        left -= localop.count;
     }
     return DISK_RET_SUCCESS;
 }
@@ -359,14 +483,15 @@ ahci_port_alloc(struct ahci_ctrl_s *ctrl, u32 pnr)
     port->ctrl = ctrl;
     port->list = memalign_tmp(1024, 1024);
     port->fis = memalign_tmp(256, 256);
-    port->cmd = memalign_tmp(256, 256);
+    port->cmd = memalign_tmp(256, AHCI_CMD_TABLE_SIZE);
     if (port->list == NULL || port->fis == NULL || port->cmd == NULL) {
         warn_noalloc();
         return NULL;
     }
     memset(port->list, 0, 1024);
     memset(port->fis, 0, 256);
-    memset(port->cmd, 0, 256);
+    memset(port->cmd, 0, AHCI_CMD_TABLE_SIZE);
+    port->slots = 1;
 
     ahci_port_writel(ctrl, pnr, PORT_LST_ADDR, (u32)port->list);
     ahci_port_writel(ctrl, pnr, PORT_FIS_ADDR, (u32)port->fis);
@@ -404,7 +529,13 @@ static struct ahci_port_s* ahci_port_realloc(struct ahci_port_s *port)
     free(port->cmd);
     port->list = memalign_high(1024, 1024);
     port->fis = memalign_high(256, 256);
-    port->cmd = memalign_high(256, 256);
+    port->cmd = memalign_high(256, AHCI_CMD_TABLE_SIZE * port->slots);
+    if (port->list == NULL || port->fis == NULL || port->cmd == NULL) {
+        warn_noalloc();
+        ahci_port_release(port);
+        return NULL;
+    }
+    memset(port->cmd, 0, AHCI_CMD_TABLE_SIZE * port->slots);
 
     ahci_port_writel(port->ctrl, port->pnr, PORT_LST_ADDR, (u32)port->list);
     ahci_port_writel(port->ctrl, port->pnr, PORT_FIS_ADDR, (u32)port->fis);
@@ -503,6 +634,18 @@ static int ahci_port_setup(struct ahci_port_s *port)
         else
             sectors = *(u32*)&buffer[60]; // word 60 and word 61
         port->drive.sectors = sectors;
+
+        // word 76 bit 8 - native command queuing, word 75 - queue depth - 1
+        if ((ctrl->caps & HOST_CAP_NCQ) && (buffer[76] & (1 << 8))) {
+            u32 slots = ((ctrl->caps >> HOST_CAP_NCS_SHIFT)
+                         & HOST_CAP_NCS_MASK) + 1;
+            u32 depth = (buffer[75] & 0x1f) + 1;
+            port->ncq = 1;
+            port->slots = slots < depth ? slots : depth;
+            if (port->slots > AHCI_MAX_SLOTS)
+                port->slots = AHCI_MAX_SLOTS;
+            dprintf(2, "AHCI/%d: ncq, %d slots\n", port->pnr, port->slots);
+        }
         u64 adjsize = sectors >> 11;
         char adjprefix = 'M';
         if (adjsize >= (1 << 16)) {
@@ -583,6 +726,12 @@ ahci_controller_setup(struct pci_device *pci)
         free(ctrl);
         return;
     }
+    if (!ahci_bounce_fl) {
+        // optional, unaligned requests fall back to bounce_buf_fl without it
+        ahci_bounce_fl = memalign_high(DISK_SECTOR_SIZE, AHCI_BOUNCE_SIZE);
+        if (ahci_bounce_fl)
+            ahci_bounce_size = AHCI_BOUNCE_SIZE;
+    }
 
     ctrl->pci_tmp = pci;
     ctrl->pci_bdf = bdf;
@@ -78,6 +78,8 @@ struct ahci_port_s {
     struct ahci_cmd_s  *cmd;
     u32                pnr;
     u32                atapi;
+    u32                ncq;   /* drive and controller do native command queuing */
+    u32                slots; /* command slots in use, 1 without ncq */
     char               *desc;
     int                prio;
 };
@@ -86,6 +88,15 @@ void ahci_setup(void);
 int process_ahci_op(struct disk_op_s *op);
 int ahci_cmd_data(struct disk_op_s *op, void *cdbcmd, u16 blocksize);
 
+/* each command table holds the fis, the atapi cdb and AHCI_MAX_PRDT prds */
+#define AHCI_CMD_TABLE_SIZE       256
+#define AHCI_MAX_PRDT             8
+#define AHCI_PRD_MAX_BYTES        (4 * 1024 * 1024) /* 22 bit byte count */
+#define AHCI_MAX_SLOTS            8
+#define AHCI_MAX_SECTORS          65536 /* ata 48 bit command limit */
+#define AHCI_NCQ_SECTORS          2048  /* per queued command */
+#define AHCI_BOUNCE_SIZE          (64 * 1024)
+
 #define AHCI_IRQ_ON_SG            (1 << 31)
 #define AHCI_CMD_ATAPI            (1 << 5)
 #define AHCI_CMD_WRITE            (1 << 6)
@@ -110,6 +121,8 @@ int ahci_cmd_data(struct disk_op_s *op, void *cdbcmd, u16 blocksize);
 #define HOST_CTL_AHCI_EN          (1 << 31) /* AHCI enabled */
 
 /* HOST_CAP bits */
+#define HOST_CAP_NCS_SHIFT        8         /* number of command slots - 1 */
+#define HOST_CAP_NCS_MASK         0x1f
 #define HOST_CAP_SSC              (1 << 14) /* Slumber capable */
 #define HOST_CAP_AHCI             (1 << 18) /* AHCI only */
 #define HOST_CAP_CLO              (1 << 24) /* Command List Override support */
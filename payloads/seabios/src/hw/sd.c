@@ -25,10 +25,12 @@
 
 // Host controller access functions cmd/data and acmd
 static bool sdHostXfer( sdHc_t* pHost, sdXfer_t* pXfer );
-static bool sdAppSpecificHostXfer( sdHc_t* pHost, sdXfer_t* pXfer );
+static bool sdAppSpecificHostXfer( sdCard_t* pCard, sdXfer_t* pXfer );
 
 // Card control functions
 static bool sdSelectDeselectCard( sdCard_t* pCard );
+static bool sdTransferState( sdCard_t* pCard );
+static uint32_t sdBlockAddr( sdCard_t* pCard, uint32_t lba );
 
 // Card intialization functions
 static bool sdIdle( sdCard_t* pCard );
@@ -101,19 +103,21 @@ static bool sdHostXfer( sdHc_t* pHost, sdXfer_t* pXfer )
  *                 sends CMD55 prior to sending the ACMD<XX>.  CMD55 puts the card into
  *                 application specific mode.
  *
- * @param     sdHc_t* pHost - pointer to the host controller abstraction structure
+ * @param     sdCard_t* pCard - pointer to the sd card abstraction structure, the
+ *                 RCA is 0 until the card has been assigned one
  * @param     sdXfer_t* pXfer - pointer to the host style transfer structure
  *
  * @return    bool - true if successful, false otherwise
  */
-static bool sdAppSpecificHostXfer( sdHc_t* pHost, sdXfer_t* pXfer )
+static bool sdAppSpecificHostXfer( sdCard_t* pCard, sdXfer_t* pXfer )
 {
     bool status = false;
     sdXfer_t xfer;
+    sdHc_t* pHost = pCard->pHost;
 
     memset( &xfer, 0, sizeof( sdXfer_t ) );
     xfer.cmdIdx = MMC_APP_CMD55;
-    xfer.arg1 = 0;
+    xfer.arg1 = (uint32_t)(pCard->rca) << 16;
     xfer.cmdType = eCmdNormal;
     xfer.rspType = eRsp48;
     xfer.xferType = eWrXfer;
@@ -163,6 +167,39 @@ static bool sdSelectDeselectCard( sdCard_t* pCard )
     return status;
 }
 
+/**
+ * @brief    sdTransferState - make sure the card is selected (in transfer state)
+ *                 before a data transfer
+ *
+ * @param    sdCard_t* pCard - pointer to the sd card abstraction structure
+ *
+ * @return   bool - true if the card is selected, false otherwise
+ */
+static bool sdTransferState( sdCard_t* pCard )
+{
+    if( !pCard->isSelected )
+    {
+        // select the card (CMD7)
+        sdSelectDeselectCard( pCard );
+    }
+    return pCard->isSelected;
+}
+
+/**
+ * @brief    sdBlockAddr - convert a logical block address into the data address
+ *                 argument of the card, SDHC/SDXC cards are block addressed and
+ *                 standard capacity cards byte addressed
+ *
+ * @param    sdCard_t* pCard - pointer to the sd card abstraction structure
+ * @param    uint32_t lba - logical block address
+ *
+ * @return   uint32_t - the address argument for CMD17/18/24/25
+ */
+static uint32_t sdBlockAddr( sdCard_t* pCard, uint32_t lba )
+{
+    return pCard->xchcCard ? lba : lba * BLOCK_SIZE8;
+}
+
 /**
  * @brief    sdReadSingleBlock - read a single block from the card
  *
@@ -173,43 +210,197 @@ static bool sdSelectDeselectCard( sdCard_t* pCard )
  * @return   bool - true on success false otherwise
  */
 bool sdReadSingleBlock( sdCard_t* pCard, uint8_t* pData, uint32_t addr )
+{
+    return sdReadMultipleBlock( pCard, pData, addr, 1 );
+}
+
+/**
+ * @brief    sdReadMultipleBlock - read consecutive blocks from the card with one
+ *                 command, CMD18 READ_MULTIPLE_BLOCK (the host sends CMD12 after the
+ *                 last block), or CMD17 READ_SINGLE_BLOCK for a single block
+ *
+ * @param    sdCard_t* pCard - pointer to the sd card abstraction structure
+ * @param    uint8_t* pData - pointer to the data buffer to read into
+ * @param    uint32_t addr - logical block address of the first block
+ * @param    uint16_t count - number of blocks, at most SD_MAX_BLOCK_COUNT
+ *
+ * @return   bool - true on success false otherwise
+ */
+bool sdReadMultipleBlock( sdCard_t* pCard, uint8_t* pData, uint32_t addr, uint16_t count )
 {
     bool status = false;
     sdXfer_t xfer;
 
-    if( !pCard->isSelected )
+    if( !sdTransferState( pCard ) )
     {
-        // select the card (CMD7)
-        sdSelectDeselectCard( pCard );
+        return status;
     }
 
     // set up a transaction structure
     memset( &xfer, 0, sizeof( sdXfer_t ) );
-    xfer.cmdIdx = MMC_READ_SINGLE_BLOCK_CMD17;
-    xfer.arg1 = addr;
+    xfer.cmdIdx = ( count > 1 ) ? MMC_READ_MULTIPLE_BLOCK_CMD18 : MMC_READ_SINGLE_BLOCK_CMD17;
+    xfer.arg1 = sdBlockAddr( pCard, addr );
     xfer.cmdType = eCmdNormal;
     xfer.rspType = eRsp48;
     xfer.xferType = eRdXfer;
     xfer.pData = pData;
-    dprintf( DEBUG_HDL_SD, "---- pData address: 0x%08x ----\n", (uint32_t)pData);
+    xfer.blkCnt = count;
+    dprintf( DEBUG_HDL_SD, "---- pData address: 0x%08x, count %u ----\n", (uint32_t)pData, count );
 
     // invoke the host controller callback
     status = sdHostXfer( pCard->pHost, &xfer );
 
+    // a failed multiple block read leaves the card sending data
+    if( !status && count > 1 )
+    {
+        sdStopTransmission( pCard );
+    }
+
     return status;
 }
 
-bool sdReadMultipleBlock( sdCard_t* pCard )
+/**
+ * @brief    sdWriteMultipleBlock - write consecutive blocks to the card with one
+ *                 command, CMD25 WRITE_MULTIPLE_BLOCK (the host sends CMD12 after the
+ *                 last block), or CMD24 WRITE_BLOCK for a single block
+ *
+ * @param    sdCard_t* pCard - pointer to the sd card abstraction structure
+ * @param    uint8_t* pData - pointer to the data to write
+ * @param    uint32_t addr - logical block address of the first block
+ * @param    uint16_t count - number of blocks, at most SD_MAX_BLOCK_COUNT
+ *
+ * @return   bool - true on success false otherwise
+ */
+bool sdWriteMultipleBlock( sdCard_t* pCard, uint8_t* pData, uint32_t addr, uint16_t count )
 {
     bool status = false;
-    // stub
+    sdXfer_t xfer;
+
+    if( !sdTransferState( pCard ) )
+    {
+        return status;
+    }
+
+    // set up a transaction structure
+    memset( &xfer, 0, sizeof( sdXfer_t ) );
+    xfer.cmdIdx = ( count > 1 ) ? MMC_WRITE_MULTIPLE_BLOCK_CMD25 : MMC_WRITE_SINGLE_BLOCK_CMD24;
+    xfer.arg1 = sdBlockAddr( pCard, addr );
+    xfer.cmdType = eCmdNormal;
+    xfer.rspType = eRsp48;
+    xfer.xferType = eWrXfer;
+    xfer.pData = pData;
+    xfer.blkCnt = count;
+
+    // invoke the host controller callback
+    status = sdHostXfer( pCard->pHost, &xfer );
+
+    // a failed multiple block write leaves the card receiving data
+    if( !status && count > 1 )
+    {
+        sdStopTransmission( pCard );
+    }
+
     return status;
 }
 
+/**
+ * @brief    sdStopTransmission - this function implements CMD12 STOP_TRANSMISSION
+ *                 to return the card to transfer state after an aborted multiple
+ *                 block transfer
+ *
+ * @param    sdCard_t* pCard - pointer to the sd card abstraction structure
+ *
+ * @return   bool - true if successful, false otherwise
+ */
 bool sdStopTransmission( sdCard_t* pCard )
 {
     bool status = false;
-    // stub
+    sdXfer_t xfer;
+
+    memset( &xfer, 0, sizeof( sdXfer_t ) );
+    xfer.cmdIdx = MMC_STOP_TRANSMISSION_CMD12;
+    xfer.arg1 = 0;
+    xfer.cmdType = eCmdAbort;
+    xfer.rspType = eRsp48_busy;
+    xfer.xferType = eWrXfer;
+    xfer.pData = NULL;
+
+    status = sdHostXfer( pCard->pHost, &xfer );
+
+    return status;
+}
+
+/**
+ * @brief    sdSetBusWidth4 - this function executes ACMD6 SET_BUS_WIDTH to switch
+ *                 the card to the 4 bit data bus, which all SD memory cards support
+ *
+ * @param    sdCard_t* pCard - pointer to the sd card abstraction structure
+ *
+ * @return   bool - true if the card switched, the host must follow
+ */
+bool sdSetBusWidth4( sdCard_t* pCard )
+{
+    bool status = false;
+    sdXfer_t xfer;
+
+    if( !sdTransferState( pCard ) )
+    {
+        return status;
+    }
+
+    memset( &xfer, 0, sizeof( sdXfer_t ) );
+    xfer.cmdIdx = SD_APP_SET_BUS_WIDTH_CMD6;
+    xfer.arg1 = SD_BUS_WIDTH_4;
+    xfer.cmdType = eCmdNormal;
+    xfer.rspType = eRsp48;
+    xfer.xferType = eWrXfer;
+    xfer.pData = NULL;
+
+    status = sdAppSpecificHostXfer( pCard, &xfer );
+    if( status && ( xfer.response[0] & SDCARD_ERROR ) )
+    {
+        status = false;
+    }
+
+    return status;
+}
+
+/**
+ * @brief    sdSwitchHighSpeed - this function executes CMD6 SWITCH_FUNC to switch
+ *                 the card to high speed (50MHz) timing.  Version 1.0 cards don't
+ *                 know the command and stay at default speed.
+ *
+ * @param    sdCard_t* pCard - pointer to the sd card abstraction structure
+ *
+ * @return   bool - true if the card switched, the host must follow
+ */
+bool sdSwitchHighSpeed( sdCard_t* pCard )
+{
+    bool status = false;
+    sdXfer_t xfer;
+    uint8_t switchStatus[SD_SWITCH_STATUS_LEN] __aligned(4);
+
+    if( !sdTransferState( pCard ) )
+    {
+        return status;
+    }
+
+    memset( &xfer, 0, sizeof( sdXfer_t ) );
+    xfer.cmdIdx = SD_SWITCH_FUNC_CMD6;
+    xfer.arg1 = SD_SWITCH_HIGH_SPEED;
+    xfer.cmdType = eCmdNormal;
+    xfer.rspType = eRsp48;
+    xfer.xferType = eRdXfer;
+    xfer.pData = switchStatus;
+    xfer.blkSize = sizeof( switchStatus );
+
+    status = sdHostXfer( pCard->pHost, &xfer );
+    if( status )
+    {
+        // the status block is big endian, bits 379:376 hold the group 1 result
+        status = ( switchStatus[SD_SWITCH_GROUP1_RESULT] & 0x0F ) == SD_SWITCH_GROUP1_HIGH_SPEED;
+    }
+
     return status;
 }
 
@@ -328,7 +519,7 @@ static bool sdSendOpCond( sdCard_t* pCard )
 
     while( cycleTries-- )
     {
-        status = sdAppSpecificHostXfer( pCard->pHost, &xfer );
+        status = sdAppSpecificHostXfer( pCard, &xfer );
         if( status )
         {
             // initialization takes 1 second to complete, and we query the busy bit
@@ -341,7 +532,7 @@ static bool sdSendOpCond( sdCard_t* pCard )
             }
             else
             {
-                udelay(100);
+                usleep(100);
             }
         }
     }
@@ -578,6 +769,7 @@ bool sdCardBusInit( sdHc_t* pHc )
         dprintf( DEBUG_HDL_SD, "SD: card failed to allocate\n" );
         return status;
     }
+    memset( pCard, 0, sizeof( *pCard ) );
     dprintf( DEBUG_HDL_SD, "SD:  pCard address: 0x%08x\n", (uint32_t)pCard);
 
     // set the host pointer
@@ -65,6 +65,21 @@ typedef struct
     bool crcChkEn;
 }sdXferFlags_t;
 
+typedef enum
+{
+    eDmaNone = 0,
+    eDmaSdma,
+    eDmaAdma2
+}sdDmaMode_e;
+
+/** @brief 32 bit ADMA2 descriptor (see SD Host Controller Specification 1.13) */
+typedef struct
+{
+    uint16_t                    attr;
+    uint16_t                    len;
+    uint32_t                    addr;
+}PACKED sdAdma2Desc_t;
+
 /** @brief struct used for host to card and card to host transfers */
 typedef struct
 {
@@ -76,6 +91,8 @@ typedef struct
     uint32_t                    response[4];
     bool                        rspValid;
     void*                       pData;
+    uint16_t                    blkSize;    // 0 for BLOCK_SIZE8
+    uint16_t                    blkCnt;     // 0 for a single block
 }sdXfer_t;
 
 /** @brief struct to hold decoded CID and CSD registers (see SD Specification) */
@@ -104,6 +121,10 @@ typedef struct sdHc_t
     bool                     isInitialized;
     uint8_t                  hostVendorId;
     uint8_t                  hostSpecId;
+    bool                     busWidth4;
+    bool                     highSpeed;
+    sdDmaMode_e              dmaMode;
+    sdAdma2Desc_t*           pAdmaDesc;
     sdCard_t*                pCard;
 
     // call back to host for sending commands to the card via the host controller interface
@@ -135,6 +156,11 @@ typedef struct sdCard_t
 #define KHZ 1000
 #define BLOCK_MASK 0x00000FFF
 
+// largest multi-block transfer, ADMA2 descriptors cover it in SD_ADMA2_DESC_LEN pieces
+#define SD_MAX_BLOCK_COUNT  1024
+#define SD_ADMA2_DESC_LEN   0x8000
+#define SD_ADMA2_DESC_COUNT ((SD_MAX_BLOCK_COUNT * BLOCK_SIZE8) / SD_ADMA2_DESC_LEN)
+
 // MMC Card Commands that mostly overlap with the SD specification, some have slightly different meaning or results
 #define MMC_GO_IDLE_STATE_CMD0            0
 #define MMC_SEND_OP_COND_CMD1             1
@@ -176,6 +202,16 @@ typedef struct sdCard_t
 #define SD_STATE_CHANGE_ATTEMPTS          1000
 #define SD_TRY_AGAIN                      10
 
+// ACMD6 bus widths
+#define SD_BUS_WIDTH_1                    0x00000000
+#define SD_BUS_WIDTH_4                    0x00000002
+
+// CMD6 mode 1, function group 1 set to high speed, the other groups unchanged
+#define SD_SWITCH_HIGH_SPEED              0x80FFFFF1
+#define SD_SWITCH_STATUS_LEN              64
+#define SD_SWITCH_GROUP1_RESULT           16
+#define SD_SWITCH_GROUP1_HIGH_SPEED       0x01
+
 
 // ACMD41 bit shifts and masks
 #define OCR_DONE_BSY_N        (1 << 31)
@@ -262,8 +298,11 @@ typedef enum
 
 bool sdCardBusInit( sdHc_t* pHc );
 bool sdReadSingleBlock( sdCard_t* pCard, uint8_t* pData, uint32_t addr );
-bool sdReadMultipleBlock( sdCard_t* pCard );
+bool sdReadMultipleBlock( sdCard_t* pCard, uint8_t* pData, uint32_t addr, uint16_t count );
+bool sdWriteMultipleBlock( sdCard_t* pCard, uint8_t* pData, uint32_t addr, uint16_t count );
 bool sdStopTransmission( sdCard_t* pCard );
+bool sdSetBusWidth4( sdCard_t* pCard );
+bool sdSwitchHighSpeed( sdCard_t* pCard );
 
 #endif // __SD_H
 
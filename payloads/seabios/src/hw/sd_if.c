@@ -29,11 +29,12 @@
 
 sdDiskIf_t* g_pDev;
 
-static int sd_disk_read( struct disk_op_s* op );
-static int sd_disk_read_aligned( struct disk_op_s* op );
+static int sd_disk_xfer( struct disk_op_s* op, bool write );
+static int sd_disk_xfer_aligned( struct disk_op_s* op, bool write );
 
 /**
- * @brief    sd_disk_init - finalize the SeaBIOS drive initialization and register the drive
+ * @brief    sd_disk_init - finalize the SeaBIOS drive information, the drive
+ *                 is registered by sd_config_setup once the setup is complete
  *
  * @param    sdDiskIf_t* pSdIf - pointer to sd disk interface structure
  *
@@ -57,9 +58,41 @@ static void sd_disk_init( sdDiskIf_t* pSdIf )
 
     pSdIf->bootPriority = bootprio_find_pci_device( (struct pci_device*)pSdIf->pPci );
     dprintf( DEBUG_HDL_SD, "SD card boot priority: 0x%08x\n", pSdIf->bootPriority );
+}
+
+/**
+ * @brief    sd_measure_read - time a 1MB read from the start of the card to
+ *                 report the throughput of the bus setup in the debug log
+ *
+ * @param    sdDiskIf_t* pSdIf - pointer to sd disk interface structure
+ *
+ * @return   none
+ */
+static void sd_measure_read( sdDiskIf_t* pSdIf )
+{
+    uint8_t* pBuf = NULL;
+    uint32_t count = (1024 * 1024) / BLOCK_SIZE8;
+    uint32_t start = 0;
+    uint32_t ms = 0;
+
+    if( CONFIG_DEBUG_LEVEL < DEBUG_HDL_SD || pSdIf->drive.sectors < count )
+    {
+        return;
+    }
+    pBuf = memalign_tmphigh( 4, count * BLOCK_SIZE8 );
+    if( !pBuf )
+    {
+        return;
+    }
 
-    // register the device as a hard disk
-    boot_add_hd(&pSdIf->drive, pSdIf->desc, (int)pSdIf->bootPriority );
+    start = timer_calc( 0 );
+    if( sdReadMultipleBlock( pSdIf->pHostCtrl->pCard, pBuf, 0, count ) )
+    {
+        ms = ticks_to_ms( timer_calc( 0 ) - start );
+        dprintf( DEBUG_HDL_SD, "SD: read %u KiB in %u ms (%u KiB/s)\n",
+                 count / 2, ms, ms ? ( count / 2 ) * 1000 / ms : 0 );
+    }
+    free( pBuf );
 }
 
 /**
@@ -85,6 +118,7 @@ static bool sd_host_setup( sdDiskIf_t* pSdIf)
 
             // the card is now enumerated, prepare it for boot (operational mode)
             sdhc_prepBoot( pSdIf->pHostCtrl );
+            sd_measure_read( pSdIf );
             status = true;
         }
     }
@@ -119,61 +153,70 @@ static bool sd_card_detect( sdDiskIf_t* pSdIf )
 
 
 /**
- * @brief    sd_config_setup - setup the sd host controller driver and allocate resources.
+ * @brief    sd_config_setup - setup the sd host controller driver and allocate resources,
+ *                 this runs as a thread so the card power up and identification
+ *                 delays overlap with the rest of POST
  *
- * @param    struct pci_device* pci - pointer to the sdhci controller pci device.
+ * @param    void* data - pointer to the sdhci controller pci device.
  *
  * @return   none
  */
-static void sd_config_setup(struct pci_device* pci)
+static void sd_config_setup( void* data )
 {
+    struct pci_device* pci = data;
+    sdDiskIf_t* pSdIf = NULL;
+
     dprintf(6, "sd_config_setup: 0x%04x\n", pci->bdf );
 
     // allocate the pci to sd interface structure
-    g_pDev = (sdDiskIf_t*)malloc_fseg( sizeof(*g_pDev) );
-    if( !g_pDev )
+    pSdIf = (sdDiskIf_t*)malloc_fseg( sizeof(*pSdIf) );
+    if( !pSdIf )
     {
         warn_noalloc();
         return;
     }
-    memset( g_pDev, 0, sizeof( *g_pDev ) );
+    memset( pSdIf, 0, sizeof( *pSdIf ) );
 
     // allocate the host controller
-    g_pDev->pHostCtrl = (sdHc_t*)malloc_fseg( sizeof(*g_pDev->pHostCtrl) );
-    if( !(g_pDev->pHostCtrl) )
+    pSdIf->pHostCtrl = (sdHc_t*)malloc_fseg( sizeof(*pSdIf->pHostCtrl) );
+    if( !(pSdIf->pHostCtrl) )
     {
         warn_noalloc();
-        free(g_pDev);
+        free(pSdIf);
         return;
     }
-    memset( g_pDev->pHostCtrl, 0, sizeof( *g_pDev->pHostCtrl) );
-    g_pDev->pHostCtrl->isInitialized = false;
+    memset( pSdIf->pHostCtrl, 0, sizeof( *pSdIf->pHostCtrl) );
+    pSdIf->pHostCtrl->isInitialized = false;
 
     // assign the pci device and set up the host controller
-    g_pDev->pPci = pci;
+    pSdIf->pPci = pci;
 
     // setup bar0
-    g_pDev->pHostCtrl->barAddress = pci_config_readl(g_pDev->pPci->bdf, 0x10) & 0xFFFFFF00;
+    pSdIf->pHostCtrl->barAddress = pci_config_readl(pSdIf->pPci->bdf, 0x10) & 0xFFFFFF00;
 
     // check for card detect
-    if( !sd_card_detect(g_pDev) )
+    if( !sd_card_detect(pSdIf) )
     {
         dprintf( DEBUG_HDL_SD, "No SD card detected\n");
-        free( g_pDev->pHostCtrl );
-        free( g_pDev );
+        free( pSdIf->pHostCtrl );
+        free( pSdIf );
+        return;
     }
 
-    else
-    {
-        dprintf( DEBUG_HDL_SD, "SD card is inserted\n");
+    dprintf( DEBUG_HDL_SD, "SD card is inserted\n");
 
-        // initialize bounce buffer
-        if( create_bounce_buf() < 0 )
-        {
-            warn_noalloc();
-            free( g_pDev);
-        }
+    // initialize bounce buffer
+    if( create_bounce_buf() < 0 )
+    {
+        warn_noalloc();
+        free( pSdIf->pHostCtrl );
+        free( pSdIf );
+        return;
     }
+
+    // the card is ready, publish it and register it as a hard disk
+    g_pDev = pSdIf;
+    boot_add_hd( &pSdIf->drive, pSdIf->desc, (int)pSdIf->bootPriority );
 }
 
 
@@ -203,8 +246,8 @@ static void sd_scan(void)
         }
         dprintf(6, "Found PCI SDHCI controller\n");
 
-        // setup the sd host controller hardware
-        sd_config_setup(pci);
+        // setup the sd host controller hardware and card in the background
+        run_thread(sd_config_setup, pci);
     }
 }
 
@@ -243,9 +286,10 @@ int sd_cmd_data( struct disk_op_s *op, void *cdbcmd, uint16_t blocksize )
     switch( op->command )
     {
         case CMD_READ:
-            retVal = sd_disk_read( op );
+            retVal = sd_disk_xfer( op, false );
             break;
         case CMD_WRITE:
+            retVal = sd_disk_xfer( op, true );
             break;
         case CMD_RESET:
         case CMD_ISREADY:
@@ -263,82 +307,107 @@ int sd_cmd_data( struct disk_op_s *op, void *cdbcmd, uint16_t blocksize )
 
 
 /**
- * @brief    sd_disk_read_aligned - read into an aligned buffer a block of data from the sd card
+ * @brief    sd_disk_xfer_aligned - transfer blocks between the sd card and an aligned buffer,
+ *                 as many blocks per command as the card and host allow
  *
  * @param    struct disk_op_s* op - pointer to the disk operation request
+ * @param    bool write - true to write to the card, false to read from it
  *
  * @return   int - disk operation status
  */
-static int sd_disk_read_aligned( struct disk_op_s* op )
+static int sd_disk_xfer_aligned( struct disk_op_s* op, bool write )
 {
     int retVal = DISK_RET_SUCCESS;
     sdDiskIf_t* pSdIf = GET_GLOBAL( g_pDev );
-    uint16_t i = 0;
+    uint32_t lba = (uint32_t)op->lba;
+    uint32_t left = op->count;
+    uint32_t count = 0;
     uint8_t* curPosition = (uint8_t*)op->buf_fl;
+    bool ok = false;
 
-    for( i = 0; i < op->count; i++ )
+    while( left > 0 )
     {
-        if( !sdReadSingleBlock( pSdIf->pHostCtrl->pCard, curPosition, (uint32_t)(op->lba + i)) )
+        count = ( left < SD_MAX_BLOCK_COUNT ) ? left : SD_MAX_BLOCK_COUNT;
+        if( write )
         {
-            dprintf( DEBUG_HDL_SD, "SD Read Fail\n");
-            retVal = DISK_RET_EPARAM;
-            break;
+            ok = sdWriteMultipleBlock( pSdIf->pHostCtrl->pCard, curPosition, lba, count );
         }
         else
         {
-            dprintf( DEBUG_HDL_SD, "sd disk %s, lba %6x, count %3x, buf %p, rc %d\n",
-                           "read", (u32)op->lba + i, op->count - i, curPosition, retVal);
-            curPosition += BLOCK_SIZE8;
+            ok = sdReadMultipleBlock( pSdIf->pHostCtrl->pCard, curPosition, lba, count );
         }
+        dprintf( DEBUG_HDL_SD, "sd disk %s, lba %6x, count %3x, buf %p, ok %d\n",
+                       write ? "write" : "read", lba, count, curPosition, ok );
+        if( !ok )
+        {
+            dprintf( DEBUG_HDL_SD, "SD %s Fail\n", write ? "Write" : "Read" );
+            retVal = DISK_RET_EPARAM;
+            break;
+        }
+        curPosition += count * BLOCK_SIZE8;
+        lba += count;
+        left -= count;
     }
-    dprintf( DEBUG_HDL_SD, "return from read retval = %u\n", retVal );
+    dprintf( DEBUG_HDL_SD, "return from %s retval = %u\n", write ? "write" : "read", retVal );
     return retVal;
 }
 
 /**
- * @brief    sd_disk_read - if the requested buffer is word aligned, performs the disk read operation
+ * @brief    sd_disk_xfer - if the requested buffer is dword aligned, performs the disk operation
+ *                 directly on it, otherwise through the bounce buffer
  *
  * @param    struct disk_op_s* op - pointer to the disk operation request
+ * @param    bool write - true to write to the card, false to read from it
  *
  * @return   int - disk operation status
  */
-static int sd_disk_read( struct disk_op_s* op )
+static int sd_disk_xfer( struct disk_op_s* op, bool write )
 {
-    int retVal = DISK_RET_EPARAM;
+    int retVal = DISK_RET_SUCCESS;
     struct disk_op_s localOp;
     uint8_t* alignedBuf = NULL;
     uint8_t* curPosition = NULL;
-    uint16_t i = 0;
+    uint16_t left = 0;
 
-    // check if the callers buffer is word aligned, if so use it directly
-    if( ( (uint32_t)op->buf_fl & 1 ) == 0 )
+    // check if the callers buffer is dword aligned (DMA needs it), if so use it directly
+    if( ( (uint32_t)op->buf_fl & 3 ) == 0 )
     {
-        dprintf( DEBUG_HDL_SD, "sd read: buffer already alligned\n");
-        retVal = sd_disk_read_aligned( op );
+        dprintf( DEBUG_HDL_SD, "sd %s: buffer already alligned\n", write ? "write" : "read" );
+        retVal = sd_disk_xfer_aligned( op, write );
     }
     else
     {
-        dprintf( DEBUG_HDL_SD, "sd read: unaligned buffer, performing realligend read\n");
+        dprintf( DEBUG_HDL_SD, "sd %s: unaligned buffer, performing realligend transfer\n",
+                 write ? "write" : "read" );
         // get access to an aligned buffer for the disk operation
         localOp = *op;
         alignedBuf = GET_GLOBAL( bounce_buf_fl );
         curPosition = op->buf_fl;
+        left = op->count;
 
-        // execute the aligned to unaligned access one operation at a time
+        // execute the aligned to unaligned access a bounce buffer at a time
         localOp.buf_fl = alignedBuf;
-        localOp.count = 1;
 
-        for( i = 0; i < op->count; i++ )
+        while( left > 0 )
         {
-            retVal = sd_disk_read_aligned( &localOp );
+            localOp.count = ( left < CDROM_SECTOR_SIZE / BLOCK_SIZE8 ) ? left : CDROM_SECTOR_SIZE / BLOCK_SIZE8;
+            if( write )
+            {
+                memcpy_fl( alignedBuf, curPosition, localOp.count * BLOCK_SIZE8 );
+            }
+            retVal = sd_disk_xfer_aligned( &localOp, write );
             if( retVal )
             {
-                dprintf( DEBUG_HDL_SD, "  - aligned read fail\n");
+                dprintf( DEBUG_HDL_SD, "  - aligned transfer fail\n");
                 break;
             }
-            memcpy_fl( curPosition, alignedBuf, BLOCK_SIZE8 );
-            curPosition += BLOCK_SIZE8;
-            localOp.lba++;
+            if( !write )
+            {
+                memcpy_fl( curPosition, alignedBuf, localOp.count * BLOCK_SIZE8 );
+            }
+            curPosition += localOp.count * BLOCK_SIZE8;
+            localOp.lba += localOp.count;
+            left -= localOp.count;
         }
 
     }
@@ -373,9 +442,10 @@ int VISIBLE32FLAT process_sd_op( struct disk_op_s *op  )
             dprintf( DEBUG_HDL_SD,
                     "SD CMD_READ: lba: 0x%08x%08x\n", (uint32_t)(op->lba >> 32), (uint32_t)(op->lba) );
             dprintf( DEBUG_HDL_SD, "  op->count = %d\n", op->count );
-            retVal = sd_disk_read( op );
+            retVal = sd_disk_xfer( op, false );
             break;
         case CMD_WRITE:
+            retVal = sd_disk_xfer( op, true );
             break;
         case CMD_RESET:
         case CMD_ISREADY:
@@ -21,6 +21,7 @@
 #include "biosvar.h"
 #include "pci.h"
 #include "pci_ids.h"
+#include "stacks.h"
 #include "std/disk.h"
 #include "bar.h"
 #include "sdhci.h"
@@ -34,7 +35,11 @@ static void sdhc_getVerInfo( sdHc_t* pSdCtrl );
 static void sdhc_setClock( sdHc_t* pSdCtrl, uint32_t clockVal );
 static void sdhc_setPower( sdHc_t* pSdCtrl, uint32_t pwrMode );
 static bool sdhc_reset( sdHc_t* pSdCtrl, uint8_t resetFlags );
-static void sdhc_readBlock( sdHc_t* pSdCtrl, uint8_t* pBuf, uint32_t count );
+static uint32_t sdhc_waitIntr( sdHc_t* pSdCtrl, uint32_t intrMsk, uint32_t uSecTmo );
+static void sdhc_pioBlock( sdHc_t* pSdCtrl, uint8_t* pBuf, uint32_t count, bool read );
+static bool sdhc_prepDma( sdHc_t* pSdCtrl, sdXfer_t* pXfer );
+static bool sdhc_xferData( sdHc_t* pSdCtrl, sdXfer_t* pXfer, bool useDma );
+static void sdhc_setupDma( sdHc_t* pSdCtrl );
 
 // callback function for performing command/response transactions
 static bool sdhc_Cmd( sdHc_t* pSdCtrl, sdXfer_t* pXfer );
@@ -115,10 +120,8 @@ static bool sdhc_pollIntrStatus( sdHc_t* pSdCtrl, sdXfer_t* pXfer, uint32_t intr
                 sdhc_readResponse( pSdCtrl, pXfer);
             }
 
-            // clear the interrupt flag(s)
-            // @NOTE: some interrupts will not be cleared by writing them to 0
-            regVal32 &= ~intrNum;
-            barWrite32( pSdCtrl->barAddress, SDHCI_INT_STATUS, regVal32 );
+            // clear the interrupt flag(s), the status bits are write 1 to clear
+            barWrite32( pSdCtrl->barAddress, SDHCI_INT_STATUS, intrNum );
             status = true;
             dprintf( DEBUG_HDL_SD, "SD: requested interrupt occured: %u\n", intrNum );
             break;
@@ -137,12 +140,12 @@ static bool sdhc_pollIntrStatus( sdHc_t* pSdCtrl, sdXfer_t* pXfer, uint32_t intr
                     "SD: ERROR interrupt occured, clearing interrupt and resetting card\n" );
                     sdhc_reset( pSdCtrl, SDHCI_RESET_CMD | SDHCI_RESET_DATA );
             }
-            barWrite32( pSdCtrl->barAddress, SDHCI_INT_STATUS, ~SDHCI_INT_ERROR_MASK );
+            barWrite32( pSdCtrl->barAddress, SDHCI_INT_STATUS, regVal32 & SDHCI_INT_ERROR_MASK );
             status = false;
             break;
         }
 
-        udelay( uSecTmo );
+        usleep( uSecTmo );
     }
     // in the case of errors, reset the card and clear out the error interrupts
     dprintf( DEBUG_HDL_SD, "SD: Current interrupt status register: 0x%08x\n", regVal32 );
@@ -150,6 +153,48 @@ static bool sdhc_pollIntrStatus( sdHc_t* pSdCtrl, sdXfer_t* pXfer, uint32_t intr
     return status;
 }
 
+/**
+ * @brief    sdhc_waitIntr - wait for any of a set of interrupts, unlike
+ *                 sdhc_pollIntrStatus this returns as soon as one of them is set
+ *
+ * @param    sdHc_t* pSdCtrl - pointer to the host controller struct
+ * @param    uint32_t intrMsk - the interrupts to wait for
+ * @param    uint32_t uSecTmo - microseconds to wait in total
+ *
+ * @return   uint32_t - the interrupts out of intrMsk that were set (and are
+ *              now cleared), 0 on an error interrupt or timeout
+ */
+static uint32_t sdhc_waitIntr( sdHc_t* pSdCtrl, uint32_t intrMsk, uint32_t uSecTmo )
+{
+    uint32_t regVal32 = 0;
+    uint32_t end = timer_calc_usec( uSecTmo );
+
+    while( true )
+    {
+        regVal32 = barRead32( pSdCtrl->barAddress, SDHCI_INT_STATUS );
+        if( regVal32 & SDHCI_INT_ERROR_MASK )
+        {
+            dprintf( DEBUG_HDL_SD, "SD: ERROR interrupt during data transfer: 0x%08x, adma 0x%02x\n",
+                    regVal32, barRead8( pSdCtrl->barAddress, SDHCI_ADMA_ERROR ) );
+            barWrite32( pSdCtrl->barAddress, SDHCI_INT_STATUS, regVal32 & SDHCI_INT_ERROR_MASK );
+            sdhc_reset( pSdCtrl, SDHCI_RESET_CMD | SDHCI_RESET_DATA );
+            return 0;
+        }
+        if( regVal32 & intrMsk )
+        {
+            barWrite32( pSdCtrl->barAddress, SDHCI_INT_STATUS, regVal32 & intrMsk );
+            return regVal32 & intrMsk;
+        }
+        if( timer_check( end ) )
+        {
+            dprintf( DEBUG_HDL_SD, "SD: ERROR Timeout waiting for 0x%08x\n", intrMsk );
+            sdhc_reset( pSdCtrl, SDHCI_RESET_CMD | SDHCI_RESET_DATA );
+            return 0;
+        }
+        yield();
+    }
+}
+
 /**
  * @brief    sdhc_getVerInfo - read the host controller vendor specific id and host
  *                 sd specification supported by the controller
@@ -262,7 +307,7 @@ static void sdhc_setClock( sdHc_t* pSdCtrl, uint32_t clockVal )
             break;
         }
         timeout--;
-        udelay(1000);
+        msleep(1);
     }
 
     if( timeout > 0)
@@ -304,7 +349,7 @@ static bool sdhc_reset( sdHc_t* pSdCtrl, uint8_t resetFlags )
                     "SDHC Reset Timeout for reset request type: 0x%02x\n", resetFlags );
         }
         timeout--;
-        udelay(100);
+        usleep(100);
     }
     if( timeout > 0)
     {
@@ -334,16 +379,19 @@ static bool sdhc_Cmd( sdHc_t* pSdCtrl, sdXfer_t* pXfer )
     uint8_t tmo = 10;
     uint16_t mode = 0;
     bool status = false;
+    bool useDma = false;
     uint32_t intFlags = 0;
 
-    // setup the state mask for the transfer
+    // setup the state mask for the transfer, data transfers wait for the
+    // data lines as well (the card may still be programming a write)
     stateMsk = SDHCI_CMD_INHIBIT;
-    if( pXfer->rspType == eRsp48_busy )
+    if( pXfer->rspType == eRsp48_busy || pXfer->pData )
     {
         stateMsk |= SDHCI_DAT_INHIBIT;
     }
 
     // wait for the state mask to clear
+    curState = barRead32( pSdCtrl->barAddress, SDHCI_PRESENT_STATE );
     while( curState & stateMsk )
     {
         if( tmo == 0 )
@@ -353,7 +401,7 @@ static bool sdhc_Cmd( sdHc_t* pSdCtrl, sdXfer_t* pXfer )
             break;
         }
         tmo--;
-        udelay(1000);
+        msleep(1);
         curState = barRead32( pSdCtrl->barAddress, SDHCI_PRESENT_STATE );
     }
 
@@ -362,21 +410,34 @@ static bool sdhc_Cmd( sdHc_t* pSdCtrl, sdXfer_t* pXfer )
         //Set command argument
         barWrite32(pSdCtrl->barAddress, SDHCI_ARGUMENT, pXfer->arg1);
 
-        if( pXfer->pData && pXfer->xferType == eRdXfer )
+        mode = barRead16( pSdCtrl->barAddress, SDHCI_TRANSFER_MODE );
+        mode &= ~( SDHCI_TRNS_READ | SDHCI_TRNS_MULTI | SDHCI_TRNS_DMA |
+                   SDHCI_TRNS_BLK_CNT_EN | SDHCI_TRNS_ACMD12 );
+        if( pXfer->pData )
         {
-            //Set data transfer mode for reading data
-            mode = barRead16( pSdCtrl->barAddress, SDHCI_TRANSFER_MODE );
-            mode |= ( SDHCI_TRNS_READ );
-            mode &= ~( SDHCI_TRNS_MULTI | SDHCI_TRNS_DMA );
-            barWrite16(pSdCtrl->barAddress, SDHCI_TRANSFER_MODE, mode );
-        }
-        else
-        {
-            //Set data transfer mode for commanding
-            mode = barRead16( pSdCtrl->barAddress, SDHCI_TRANSFER_MODE );
-            mode &= ~( SDHCI_TRNS_READ | SDHCI_TRNS_MULTI | SDHCI_TRNS_DMA );
-            barWrite16(pSdCtrl->barAddress, SDHCI_TRANSFER_MODE, mode );
+            // block size, with the SDMA buffer boundary, and block count
+            barWrite16( pSdCtrl->barAddress, SDHCI_BLOCK_SIZE,
+                        SDHCI_MAKE_BLKSZ( SDHCI_SDMA_BOUNDARY_512K,
+                                          pXfer->blkSize ? pXfer->blkSize : BLOCK_SIZE8 ) );
+            barWrite16( pSdCtrl->barAddress, SDHCI_BLOCK_COUNT, pXfer->blkCnt ? pXfer->blkCnt : 1 );
+
+            //Set data transfer mode for reading or writing data
+            if( pXfer->xferType == eRdXfer )
+            {
+                mode |= SDHCI_TRNS_READ;
+            }
+            if( pXfer->blkCnt > 1 )
+            {
+                // the host stops the card with CMD12 after the last block
+                mode |= SDHCI_TRNS_MULTI | SDHCI_TRNS_BLK_CNT_EN | SDHCI_TRNS_ACMD12;
+            }
+            useDma = sdhc_prepDma( pSdCtrl, pXfer );
+            if( useDma )
+            {
+                mode |= SDHCI_TRNS_DMA;
+            }
         }
+        barWrite16(pSdCtrl->barAddress, SDHCI_TRANSFER_MODE, mode );
 
         // build the command transaction type
         regVal8 = (pSdCtrl->crcCheckEnable) ? SDHCI_CMD_CRC : 0;
@@ -393,12 +454,6 @@ static bool sdhc_Cmd( sdHc_t* pSdCtrl, sdXfer_t* pXfer )
         if( pXfer->rspType != eRspNone )
         {
             intFlags = SDHCI_INT_RESPONSE;
-            if( (pXfer->pData) && (pXfer->xferType == eRdXfer) )
-            {
-                // wait for the transfer to be complete in the case of a read command
-                intFlags |= SDHCI_INT_DATA_AVAIL;
-            }
-
             while( !sdhc_pollIntrStatus( pSdCtrl, pXfer, intFlags, 100, 1000) )
             {
                 if( tmo == 0 )
@@ -409,10 +464,10 @@ static bool sdhc_Cmd( sdHc_t* pSdCtrl, sdXfer_t* pXfer )
                 tmo--;
             }
 
-            // if this is a read block transaction break out here to get the data
-            if( (pXfer->pData) && (pXfer->xferType == eRdXfer) )
+            // the response is in, move the data
+            if( tmo > 0 && pXfer->pData && !sdhc_xferData( pSdCtrl, pXfer, useDma ) )
             {
-                sdhc_readBlock( pSdCtrl, pXfer->pData, BLOCK_SIZE8 );
+                tmo = 0;
             }
         }
 
@@ -423,67 +478,157 @@ static bool sdhc_Cmd( sdHc_t* pSdCtrl, sdXfer_t* pXfer )
 }
 
 /**
- * @brief    sdhc_readBlock - read a block from the SD card, this function is only
- *                 executed if the data pointer and read flag are set in the sdhc_Cmd
- *                 request
+ * @brief    sdhc_prepDma - program the DMA engine for the data of a transfer.
+ *                 SDMA takes the start address and stops at every 512KB boundary,
+ *                 ADMA2 walks a descriptor table covering the whole buffer.
  *
  * @param    sdHc_t* pSdCtrl - pointer to the host controller abstraction
- * @param    uint8_t* pBuf - buffer to fill in with data (typically a block)
- * @param    uint32_t count - number of bytes to read in the transaction
+ * @param    sdXfer_t* pXfer - pointer to the transfer, the buffer must be dword aligned
  *
- * @return   none
+ * @return   bool - true if the transfer uses DMA, false for PIO
  */
-static void sdhc_readBlock( sdHc_t* pSdCtrl, uint8_t* pBuf, uint32_t count )
+static bool sdhc_prepDma( sdHc_t* pSdCtrl, sdXfer_t* pXfer )
 {
-    uint32_t lim = 0;
-    uint32_t dataReg = 0;
-    uint8_t* pBufLocal = NULL;
-
-    pBufLocal = pBuf;
-
-    //lim = min(BLOCK_SIZE8, count);
-    lim = BLOCK_SIZE8;
-
-    // ensure that there is data available
-    //usleep(10000);
-    // @NOTE: This usleep call was to throttle transactions during development,
-    //        it can be commented back in to throttle block read transactions
-    //        while modifying the driver
-    if( barRead32( pSdCtrl->barAddress, SDHCI_PRESENT_STATE ) & SDHCI_DATA_AVAILABLE )
+    uint32_t addr = (uint32_t)pXfer->pData;
+    uint32_t len = 0;
+    uint32_t chunk = 0;
+    sdAdma2Desc_t* pDesc = NULL;
+
+    // short transfers (like the CMD6 status) and unaligned buffers use PIO
+    if( pSdCtrl->dmaMode == eDmaNone || ( addr & 3 ) ||
+        ( pXfer->blkSize && pXfer->blkSize != BLOCK_SIZE8 ) )
     {
-        dprintf( DEBUG_HDL_SD, "SD: reading %d bytes of data\n", lim );
+        return false;
+    }
 
-        // calculate the number of 32 bit values to read by converting the limit to
-        // dwords (additional bytes handled later)
-        lim >>= 2;
-        while( lim > 0 )
+    if( pSdCtrl->dmaMode == eDmaAdma2 )
+    {
+        len = ( pXfer->blkCnt ? pXfer->blkCnt : 1 ) * BLOCK_SIZE8;
+        pDesc = pSdCtrl->pAdmaDesc;
+        while( len )
         {
-            dataReg = barRead32(pSdCtrl->barAddress, SDHCI_BUFFER);
-            pBufLocal[0] = (uint8_t)(dataReg);
-            pBufLocal[1] = (uint8_t)(dataReg >> 8);
-            pBufLocal[2] = (uint8_t)(dataReg >> 16);
-            pBufLocal[3] = (uint8_t)(dataReg >> 24);
-            pBufLocal += 4;
-            lim--;
+            chunk = ( len < SD_ADMA2_DESC_LEN ) ? len : SD_ADMA2_DESC_LEN;
+            pDesc->attr = SDHCI_ADMA2_VALID | SDHCI_ADMA2_TRAN;
+            pDesc->len = (uint16_t)chunk;
+            pDesc->addr = addr;
+            addr += chunk;
+            len -= chunk;
+            pDesc++;
         }
+        (pDesc - 1)->attr |= SDHCI_ADMA2_END;
+        barWrite32( pSdCtrl->barAddress, SDHCI_ADMA_ADDRESS, (uint32_t)pSdCtrl->pAdmaDesc );
+    }
+    else
+    {
+        barWrite32( pSdCtrl->barAddress, SDHCI_DMA_ADDRESS, addr );
+    }
+    return true;
+}
 
-        // handle the remainder
-        lim = count & 0x03;
-        if( lim > 0 )
+/**
+ * @brief    sdhc_xferData - data phase of a command, after the response has arrived
+ *
+ * @param    sdHc_t* pSdCtrl - pointer to the host controller abstraction
+ * @param    sdXfer_t* pXfer - pointer to the transfer
+ * @param    bool useDma - true if sdhc_prepDma set up the DMA engine
+ *
+ * @return   bool - true if all blocks were transferred
+ */
+static bool sdhc_xferData( sdHc_t* pSdCtrl, sdXfer_t* pXfer, bool useDma )
+{
+    uint32_t blkSize = pXfer->blkSize ? pXfer->blkSize : BLOCK_SIZE8;
+    uint32_t blkCnt = pXfer->blkCnt ? pXfer->blkCnt : 1;
+    uint32_t bufIntr = ( pXfer->xferType == eRdXfer ) ? SDHCI_INT_DATA_AVAIL : SDHCI_INT_SPACE_AVAIL;
+    uint32_t intr = 0;
+    uint32_t sdmaNext = 0;
+    uint8_t* pBuf = pXfer->pData;
+
+    if( useDma )
+    {
+        sdmaNext = ( (uint32_t)pBuf & ~( SDHCI_SDMA_BOUNDARY_SIZE - 1 ) ) + SDHCI_SDMA_BOUNDARY_SIZE;
+        while( true )
         {
-            dataReg = barRead32(pSdCtrl->barAddress, SDHCI_BUFFER);
-            while( lim > 0 )
+            intr = sdhc_waitIntr( pSdCtrl, SDHCI_INT_DATA_END | SDHCI_INT_DMA_END, 1000000 );
+            if( !intr || ( intr & SDHCI_INT_DATA_END ) )
             {
-                *(pBufLocal++) = (uint8_t)dataReg;
-                dataReg >>= 8;
-                lim--;
+                break;
             }
+            // SDMA paused at a buffer boundary, restart it at the next one
+            barWrite32( pSdCtrl->barAddress, SDHCI_DMA_ADDRESS, sdmaNext );
+            sdmaNext += SDHCI_SDMA_BOUNDARY_SIZE;
         }
+        return intr != 0;
     }
+
+    while( blkCnt-- )
+    {
+        if( !sdhc_waitIntr( pSdCtrl, bufIntr, 1000000 ) )
+        {
+            return false;
+        }
+        sdhc_pioBlock( pSdCtrl, pBuf, blkSize, pXfer->xferType == eRdXfer );
+        pBuf += blkSize;
+    }
+
 #if( CONFIG_DEBUG_LEVEL > 9 )
-    hexdump( pBuf, BLOCK_SIZE8 );
+    hexdump( pXfer->pData, blkSize );
 #endif
 
+    return sdhc_waitIntr( pSdCtrl, SDHCI_INT_DATA_END, 1000000 ) != 0;
+}
+
+/**
+ * @brief    sdhc_pioBlock - move a block through the buffer data port register,
+ *                 the host must have signalled buffer read or write ready
+ *
+ * @param    sdHc_t* pSdCtrl - pointer to the host controller abstraction
+ * @param    uint8_t* pBuf - buffer to fill in with data, or to take data from
+ * @param    uint32_t count - number of bytes in the block
+ * @param    bool read - true to read from the card, false to write
+ *
+ * @return   none
+ */
+static void sdhc_pioBlock( sdHc_t* pSdCtrl, uint8_t* pBuf, uint32_t count, bool read )
+{
+    uint32_t lim = 0;
+    uint32_t dataReg = 0;
+    uint8_t* pBufLocal = pBuf;
+
+    // calculate the number of 32 bit values to move by converting the count to
+    // dwords (additional bytes handled later)
+    lim = count >> 2;
+    while( lim > 0 )
+    {
+        if( read )
+        {
+            *(uint32_t*)pBufLocal = barRead32( pSdCtrl->barAddress, SDHCI_BUFFER );
+        }
+        else
+        {
+            barWrite32( pSdCtrl->barAddress, SDHCI_BUFFER, *(uint32_t*)pBufLocal );
+        }
+        pBufLocal += 4;
+        lim--;
+    }
+
+    // handle the remainder
+    lim = count & 0x03;
+    if( lim > 0 && read )
+    {
+        dataReg = barRead32( pSdCtrl->barAddress, SDHCI_BUFFER );
+        while( lim > 0 )
+        {
+            *(pBufLocal++) = (uint8_t)dataReg;
+            dataReg >>= 8;
+            lim--;
+        }
+    }
+    else if( lim > 0 )
+    {
+        dataReg = 0;
+        memcpy( &dataReg, pBufLocal, lim );
+        barWrite32( pSdCtrl->barAddress, SDHCI_BUFFER, dataReg );
+    }
 }
 
 /**
@@ -497,11 +642,76 @@ static void sdhc_readBlock( sdHc_t* pSdCtrl, uint8_t* pBuf, uint32_t count )
  */
 void sdhc_prepBoot( sdHc_t* pSdCtrl )
 {
-    // boost the clock speed for boot
-    //@TODO:  should check if this speed is supported first, (most newer cards do)
-    sdhc_setClock( pSdCtrl, 25 * MHZ );
+    uint8_t regVal8 = 0;
+
+    // all SD memory cards have the 4 bit bus, the host follows once the card switched
+    pSdCtrl->busWidth4 = sdSetBusWidth4( pSdCtrl->pCard );
+    if( pSdCtrl->busWidth4 )
+    {
+        regVal8 = barRead8( pSdCtrl->barAddress, SDHCI_HOST_CONTROL );
+        barWrite8( pSdCtrl->barAddress, SDHCI_HOST_CONTROL, regVal8 | SDHCI_CTRL_4BITBUS );
+    }
+
+    // switch to high speed timing if both the host and the card have it
+    if( pSdCtrl->cardCapabilities.cap1 & SDHCI_CAN_DO_HISPD )
+    {
+        pSdCtrl->highSpeed = sdSwitchHighSpeed( pSdCtrl->pCard );
+    }
+
+    if( pSdCtrl->highSpeed )
+    {
+        regVal8 = barRead8( pSdCtrl->barAddress, SDHCI_HOST_CONTROL );
+        barWrite8( pSdCtrl->barAddress, SDHCI_HOST_CONTROL, regVal8 | SDHCI_CTRL_HISPD );
+        sdhc_setClock( pSdCtrl, 50 * MHZ );
+    }
+    else
+    {
+        // boost the clock speed to default speed for boot
+        sdhc_setClock( pSdCtrl, 25 * MHZ );
+    }
+
+    dprintf( DEBUG_HDL_SD, "SD: %u bit bus, %s speed, %s\n",
+             pSdCtrl->busWidth4 ? 4 : 1, pSdCtrl->highSpeed ? "high" : "default",
+             pSdCtrl->dmaMode == eDmaAdma2 ? "ADMA2" :
+             pSdCtrl->dmaMode == eDmaSdma ? "SDMA" : "PIO" );
+}
+
+/**
+ * @brief    sdhc_setupDma - pick the DMA engine for data transfers, ADMA2 if
+ *                 the host has it, SDMA otherwise, or PIO without either
+ *
+ * @param    sdHc_t* pSdCtrl - pointer to the host controller struct
+ *
+ * @return   none
+ */
+static void sdhc_setupDma( sdHc_t* pSdCtrl )
+{
+    uint8_t regVal8 = 0;
 
-    //@TODO: do other changes to card operating mode here
+    pSdCtrl->dmaMode = eDmaNone;
+    if( ( pSdCtrl->cardCapabilities.cap1 & SDHCI_CAN_DO_ADMA2 ) &&
+        pSdCtrl->hostSpecId >= SDHCI_SPEC_200 )
+    {
+        // the table is rewritten for every transfer, so it can't live in the f-segment
+        pSdCtrl->pAdmaDesc = memalign_high( 4, sizeof( sdAdma2Desc_t ) * SD_ADMA2_DESC_COUNT );
+        if( pSdCtrl->pAdmaDesc )
+        {
+            pSdCtrl->dmaMode = eDmaAdma2;
+        }
+    }
+    if( pSdCtrl->dmaMode == eDmaNone &&
+        ( pSdCtrl->cardCapabilities.cap1 & SDHCI_CAN_DO_DMA ) )
+    {
+        pSdCtrl->dmaMode = eDmaSdma;
+    }
+
+    regVal8 = barRead8( pSdCtrl->barAddress, SDHCI_HOST_CONTROL );
+    regVal8 &= ~SDHCI_CTRL_DMA_MASK;
+    if( pSdCtrl->dmaMode == eDmaAdma2 )
+    {
+        regVal8 |= SDHCI_CTRL_ADMA2;
+    }
+    barWrite8( pSdCtrl->barAddress, SDHCI_HOST_CONTROL, regVal8 );
 }
 
 /**
@@ -657,7 +867,7 @@ bool sdhc_init( sdHc_t* pSdCtrl )
         SDHCI_INT_CARD_REMOVE | SDHCI_INT_CARD_INSERT |
         SDHCI_INT_DATA_AVAIL | SDHCI_INT_SPACE_AVAIL |
         SDHCI_INT_DMA_END | SDHCI_INT_DATA_END | SDHCI_INT_RESPONSE |
-        SDHCI_INT_ACMD12ERR );
+        SDHCI_INT_ACMD12ERR | SDHCI_INT_ADMAERR );
 
         // and signals
         barWrite32( pSdCtrl->barAddress, SDHCI_SIGNAL_ENABLE, SDHCI_INT_BUS_POWER |
@@ -681,6 +891,9 @@ bool sdhc_init( sdHc_t* pSdCtrl )
         // record the vendor and sd spec info of the host controller
         sdhc_getVerInfo( pSdCtrl );
 
+        // data transfers use DMA where the host has it
+        sdhc_setupDma( pSdCtrl );
+
         // setup the callback(s) for the underlying card bus
         pSdCtrl->sdhcCmd = &sdhc_Cmd;
 
@@ -61,6 +61,8 @@
 
 #define SDHCI_BLOCK_SIZE    0x04
 #define  SDHCI_MAKE_BLKSZ(dma, blksz) (((dma & 0x7) << 12) | (blksz & 0xFFF))
+#define  SDHCI_SDMA_BOUNDARY_512K    7
+#define  SDHCI_SDMA_BOUNDARY_SIZE    (512 * 1024)
 
 #define SDHCI_BLOCK_COUNT    0x06
 
@@ -116,6 +118,7 @@
 #define  SDHCI_CTRL_SDMA    0x08
 #define  SDHCI_CTRL_ADMA2    0x10
 #define  SDHCI_CTRL_ADMA264    0x18
+#define  SDHCI_CTRL_DMA_MASK    0x18
 #define  SDHCI_CTRL_CARD_DET    0x40
 #define  SDHCI_CTRL_FORCE_CARD    0x80
 
@@ -198,6 +201,20 @@
 
 #define SDHCI_MAX_CURRENT    0x48
 
+#define SDHCI_ADMA_ERROR    0x54
+
+#define SDHCI_ADMA_ADDRESS    0x58
+
+/*
+ * 32 bit ADMA2 descriptor attributes
+ */
+#define  SDHCI_ADMA2_VALID    0x0001
+#define  SDHCI_ADMA2_END    0x0002
+#define  SDHCI_ADMA2_INT    0x0004
+#define  SDHCI_ADMA2_NOP    0x0000
+#define  SDHCI_ADMA2_TRAN    0x0020
+#define  SDHCI_ADMA2_LINK    0x0030
+
 #define SDHCI_SLOT_INT_STATUS    0xFC
 
 #define SDHCI_HOST_VERSION    0xFE
@@ -205,3 +222,6 @@
 #define  SDHCI_VENDOR_VER_SHIFT    8
 #define  SDHCI_SPEC_VER_MASK    0x00FF
 #define  SDHCI_SPEC_VER_SHIFT    0
+#define  SDHCI_SPEC_100        0
+#define  SDHCI_SPEC_200        1
+#define  SDHCI_SPEC_300        2
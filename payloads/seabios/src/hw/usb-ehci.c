@@ -32,6 +32,9 @@ struct ehci_pipe {
     struct usb_pipe pipe;
 };
 
+// Bulk tds per pipe, each one covers 16-20KB of data.
+#define EHCI_BULK_QTDS 8
+
 static int PendingEHCIPorts;
 
 
@@ -216,6 +219,7 @@ ehci_free_pipes(struct usb_ehci_s *cntl)
             break;
         cntl->usb.freelist = usbpipe->freenext;
         struct ehci_pipe *pipe = container_of(usbpipe, struct ehci_pipe, pipe);
+        free(pipe->tds);
         free(pipe);
     }
 }
@@ -484,6 +488,19 @@ ehci_alloc_pipe(struct usbdevice_s *usbdev
     ehci_desc2pipe(pipe, usbdev, epdesc);
     pipe->qh.qtd_next = pipe->qh.alt_next = EHCI_PTR_TERM;
 
+    if (eptype == USB_ENDPOINT_XFER_BULK) {
+        // Bulk transfers reuse a ring of tds reachable from 16bit mode.
+        struct ehci_qtd *tds = memalign_low(EHCI_QTD_ALIGN
+                                            , sizeof(*tds) * EHCI_BULK_QTDS);
+        if (!tds) {
+            warn_noalloc();
+            free(pipe);
+            return NULL;
+        }
+        memset(tds, 0, sizeof(*tds) * EHCI_BULK_QTDS);
+        pipe->tds = tds;
+    }
+
     // Add queue head to controller list.
     struct ehci_qh *async_qh = cntl->async_qh;
     pipe->qh.next = async_qh->next;
@@ -507,7 +524,7 @@ ehci_wait_td(struct ehci_pipe *pipe, struct ehci_qtd *td, int timeout)
     u32 end = timer_calc(timeout);
     u32 status;
     for (;;) {
-        status = td->token;
+        status = GET_LOWFLAT(td->token);
         if (!(status & QTD_STS_ACTIVE))
             break;
         if (timer_check(end)) {
@@ -616,48 +633,46 @@ ehci_control(struct usb_pipe *p, int dir, const void *cmd, int cmdsize
     return ret;
 }
 
-#define STACKQTDS 4
-
-int
-ehci_send_bulk(struct usb_pipe *p, int dir, void *data, int datasize)
+// Run one or two buffers through the ring of bulk tds of a pipe.  The
+// second buffer is queued right behind the first one, so a mass storage
+// status phase starts without another pass through the schedule.
+static int
+ehci_bulk_chain(struct ehci_pipe *pipe, int dir, void *data, int datasize
+                , void *data2, int datasize2)
 {
-    if (! CONFIG_USB_EHCI)
-        return -1;
-    struct ehci_pipe *pipe = container_of(p, struct ehci_pipe, pipe);
-    dprintf(7, "ehci_send_bulk qh=%p dir=%d data=%p size=%d\n"
-            , &pipe->qh, dir, data, datasize);
-
-    // Allocate 4 tds on stack (with required alignment)
-    u8 tdsbuf[sizeof(struct ehci_qtd) * STACKQTDS + EHCI_QTD_ALIGN - 1];
-    struct ehci_qtd *tds = (void*)ALIGN((u32)tdsbuf, EHCI_QTD_ALIGN);
-    memset(tds, 0, sizeof(*tds) * STACKQTDS);
-    barrier();
-    SET_LOWFLAT(pipe->qh.qtd_next, (u32)MAKE_FLATPTR(GET_SEG(SS), tds));
-
+    struct ehci_qtd *tds = GET_LOWFLAT(pipe->tds);
     u16 maxpacket = GET_LOWFLAT(pipe->pipe.maxpacket);
+    u32 token = (dir ? QTD_PID_IN : QTD_PID_OUT) | ehci_maxerr(3);
+    struct ehci_qtd newtd;
     int tdpos = 0;
-    while (datasize) {
-        struct ehci_qtd *td = &tds[tdpos++ % STACKQTDS];
+
+    SET_LOWFLAT(pipe->qh.qtd_next, (u32)tds);
+    while (datasize || datasize2) {
+        if (!datasize) {
+            data = data2;
+            datasize = datasize2;
+            datasize2 = 0;
+        }
+        struct ehci_qtd *td = &tds[tdpos++ % EHCI_BULK_QTDS];
         int ret = ehci_wait_td(pipe, td, 5000);
         if (ret)
             return -1;
 
-        struct ehci_qtd *nexttd_fl = MAKE_FLATPTR(GET_SEG(SS)
-                                                 , &tds[tdpos % STACKQTDS]);
-
-        int transfer = fillTDbuffer(td, maxpacket, data, datasize);
-        td->qtd_next = (transfer==datasize ? EHCI_PTR_TERM : (u32)nexttd_fl);
-        td->alt_next = EHCI_PTR_TERM;
-        barrier();
-        td->token = (ehci_explen(transfer) | QTD_STS_ACTIVE
-                     | (dir ? QTD_PID_IN : QTD_PID_OUT) | ehci_maxerr(3));
-
+        memset(&newtd, 0, sizeof(newtd));
+        int transfer = fillTDbuffer(&newtd, maxpacket, data, datasize);
         data += transfer;
         datasize -= transfer;
+        newtd.qtd_next = ((datasize || datasize2) ? (u32)&tds[tdpos % EHCI_BULK_QTDS]
+                          : EHCI_PTR_TERM);
+        newtd.alt_next = EHCI_PTR_TERM;
+        memcpy_fl(td, MAKE_FLATPTR(GET_SEG(SS), &newtd), sizeof(newtd));
+        barrier();
+        SET_LOWFLAT(td->token, ehci_explen(transfer) | QTD_STS_ACTIVE | token);
     }
+
     int i;
-    for (i=0; i<STACKQTDS; i++) {
-        struct ehci_qtd *td = &tds[tdpos++ % STACKQTDS];
+    for (i=0; i<EHCI_BULK_QTDS; i++) {
+        struct ehci_qtd *td = &tds[tdpos++ % EHCI_BULK_QTDS];
         int ret = ehci_wait_td(pipe, td, 5000);
         if (ret)
             return -1;
@@ -666,6 +681,29 @@ ehci_send_bulk(struct usb_pipe *p, int dir, void *data, int datasize)
     return 0;
 }
 
+int
+ehci_send_bulk(struct usb_pipe *p, int dir, void *data, int datasize)
+{
+    if (! CONFIG_USB_EHCI)
+        return -1;
+    struct ehci_pipe *pipe = container_of(p, struct ehci_pipe, pipe);
+    dprintf(7, "ehci_send_bulk qh=%p dir=%d data=%p size=%d\n"
+            , &pipe->qh, dir, data, datasize);
+    return ehci_bulk_chain(pipe, dir, data, datasize, NULL, 0);
+}
+
+int
+ehci_send_bulk2(struct usb_pipe *p, int dir, void *data, int datasize
+                , void *data2, int datasize2)
+{
+    if (! CONFIG_USB_EHCI)
+        return -1;
+    struct ehci_pipe *pipe = container_of(p, struct ehci_pipe, pipe);
+    dprintf(7, "ehci_send_bulk2 qh=%p dir=%d data=%p size=%d data2=%p size2=%d\n"
+            , &pipe->qh, dir, data, datasize, data2, datasize2);
+    return ehci_bulk_chain(pipe, dir, data, datasize, data2, datasize2);
+}
+
 int
 ehci_poll_intr(struct usb_pipe *p, void *data)
 {
@@ -11,6 +11,8 @@ struct usb_pipe;
 int ehci_control(struct usb_pipe *p, int dir, const void *cmd, int cmdsize
                  , void *data, int datasize);
 int ehci_send_bulk(struct usb_pipe *p, int dir, void *data, int datasize);
+int ehci_send_bulk2(struct usb_pipe *p, int dir, void *data, int datasize
+                    , void *data2, int datasize2);
 int ehci_poll_intr(struct usb_pipe *p, void *data);
 
 
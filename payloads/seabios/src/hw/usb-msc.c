@@ -61,6 +61,19 @@ usb_msc_send(struct usbdrive_s *udrive_gf, int dir, void *buf, u32 bytes)
     return usb_send_bulk(pipe, dir, buf, bytes);
 }
 
+// Send two phases of a command with one transfer.
+static int
+usb_msc_send2(struct usbdrive_s *udrive_gf, int dir, void *buf, u32 bytes
+              , void *buf2, u32 bytes2)
+{
+    struct usb_pipe *pipe;
+    if (dir == USB_DIR_OUT)
+        pipe = GET_GLOBALFLAT(udrive_gf->bulkout);
+    else
+        pipe = GET_GLOBALFLAT(udrive_gf->bulkin);
+    return usb_send_bulk2(pipe, dir, buf, bytes, buf2, bytes2);
+}
+
 // Low-level usb command transmit function.
 int
 usb_cmd_data(struct disk_op_s *op, void *cdbcmd, u16 blocksize)
@@ -85,23 +98,28 @@ usb_cmd_data(struct disk_op_s *op, void *cdbcmd, u16 blocksize)
     cbw.bCBWLUN = GET_GLOBALFLAT(udrive_gf->lun);
     cbw.bCBWCBLength = USB_CDB_SIZE;
 
-    // Transfer cbw to device.
-    int ret = usb_msc_send(udrive_gf, USB_DIR_OUT
-                           , MAKE_FLATPTR(GET_SEG(SS), &cbw), sizeof(cbw));
-    if (ret)
-        goto fail;
-
-    // Transfer data to/from device.
-    if (bytes) {
-        ret = usb_msc_send(udrive_gf, cbw.bmCBWFlags, op->buf_fl, bytes);
+    // Transfer cbw, data and csw.  Phases in the same direction share a
+    // transfer, so the controller runs them back-to-back.
+    struct csw_s csw;
+    void *cbw_fl = MAKE_FLATPTR(GET_SEG(SS), &cbw);
+    void *csw_fl = MAKE_FLATPTR(GET_SEG(SS), &csw);
+    int ret;
+    if (bytes && cbw.bmCBWFlags == USB_DIR_OUT) {
+        ret = usb_msc_send2(udrive_gf, USB_DIR_OUT, cbw_fl, sizeof(cbw)
+                            , op->buf_fl, bytes);
         if (ret)
             goto fail;
+        ret = usb_msc_send(udrive_gf, USB_DIR_IN, csw_fl, sizeof(csw));
+    } else {
+        ret = usb_msc_send(udrive_gf, USB_DIR_OUT, cbw_fl, sizeof(cbw));
+        if (ret)
+            goto fail;
+        if (bytes)
+            ret = usb_msc_send2(udrive_gf, USB_DIR_IN, op->buf_fl, bytes
+                                , csw_fl, sizeof(csw));
+        else
+            ret = usb_msc_send(udrive_gf, USB_DIR_IN, csw_fl, sizeof(csw));
     }
-
-    // Transfer csw info.
-    struct csw_s csw;
-    ret = usb_msc_send(udrive_gf, USB_DIR_IN
-                       , MAKE_FLATPTR(GET_SEG(SS), &csw), sizeof(csw));
     if (ret)
         goto fail;
 
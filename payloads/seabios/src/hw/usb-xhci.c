@@ -25,6 +25,14 @@
 #define XHCI_RING_ITEMS          16
 #define XHCI_RING_SIZE           (XHCI_RING_ITEMS*sizeof(struct xhci_trb))
 
+/*
+ *  bulk transfers are split into tds of up to XHCI_BULK_TD_SIZE bytes,
+ *  which take at most 3 normal trbs (they can't cross 64k boundaries).
+ *  Up to XHCI_BULK_TRBS trbs are queued before waiting for completion.
+ */
+#define XHCI_BULK_TD_SIZE        (128*1024)
+#define XHCI_BULK_TRBS           (XHCI_RING_ITEMS-4)
+
 /*
  *  xhci_ring structs are allocated with XHCI_RING_SIZE alignment,
  *  then we can get it from a trb pointer (provided by evt ring).
@@ -407,9 +415,12 @@ static void xhci_trb_queue(struct xhci_ring *ring,
     u32 control;
 
     if (nidx == XHCI_RING_ITEMS-1) {
+        // a td that goes on past the link has to chain the link trb too
+        u32 chain = GET_LOWFLAT(ring->ring[nidx-1].control) & TRB_TR_CH;
         dst = ring->ring + nidx;
         control  = (TR_LINK << 10); // trb type
         control |= TRB_LK_TC;
+        control |= chain;
         control |= (cs ? TRB_C : 0);
         SET_LOWFLAT(dst->ptr_low,  (u32)&ring[0]);
         SET_LOWFLAT(dst->ptr_high, 0);
@@ -420,7 +431,8 @@ static void xhci_trb_queue(struct xhci_ring *ring,
         SET_LOWFLAT(ring->nidx, nidx);
         SET_LOWFLAT(ring->cs,   cs);
 
-        dprintf(5, "%s: ring %p [linked]\n", __func__, ring);
+        dprintf(5, "%s: ring %p [linked%s]\n", __func__, ring,
+                chain ? ", td continues" : "");
     }
 
     dst = ring->ring + nidx;
@@ -471,6 +483,32 @@ static void xhci_xfer_normal(struct xhci_pipe *pipe,
     xhci_xfer_kick(pipe);
 }
 
+// queue one td for a bulk buffer, returns the number of trbs used
+static int xhci_xfer_bulk(struct xhci_pipe *pipe,
+                          void *data, int datalen)
+{
+    struct xhci_trb trb;
+    u32 addr = (u32)data;
+    int trbs = 0;
+
+    while (datalen) {
+        u32 len = 0x10000 - (addr & 0xffff);
+        if (len > datalen)
+            len = datalen;
+        addr += len;
+        datalen -= len;
+
+        memset(&trb, 0, sizeof(trb));
+        trb.ptr_low  = addr - len;
+        trb.status   = len;
+        trb.control  |= (TR_NORMAL << 10); // trb type
+        trb.control  |= (datalen ? TRB_TR_CH : TRB_TR_IOC);
+        xhci_xfer_queue(pipe, MAKE_FLATPTR(GET_SEG(SS), &trb));
+        trbs++;
+    }
+    return trbs;
+}
+
 // --------------------------------------------------------------
 // internal functions, pure 32bit
 
@@ -1051,6 +1089,41 @@ xhci_control(struct usb_pipe *p, int dir, const void *cmd, int cmdsize
     return 0;
 }
 
+// Send one or two buffers over a bulk pipe.  The tds are queued (and the
+// doorbell rung) ahead of waiting, so the controller moves from one to the
+// next, including from the first buffer to the second, without a pause.
+static int
+xhci_bulk_chain(struct xhci_pipe *pipe, void *data, int datalen
+                , void *data2, int datalen2)
+{
+    struct usb_xhci_s *xhci = container_of(
+        GET_LOWFLAT(pipe->pipe.cntl), struct usb_xhci_s, usb);
+    int queued = 0;
+
+    while (datalen || datalen2) {
+        if (!datalen) {
+            data = data2;
+            datalen = datalen2;
+            datalen2 = 0;
+        }
+        int len = datalen < XHCI_BULK_TD_SIZE ? datalen : XHCI_BULK_TD_SIZE;
+        queued += xhci_xfer_bulk(pipe, data, len);
+        xhci_xfer_kick(pipe);
+        data += len;
+        datalen -= len;
+        if ((datalen || datalen2) && queued + 3 <= XHCI_BULK_TRBS)
+            continue;
+
+        int cc = xhci_event_wait(xhci, &pipe->reqs, 1000);
+        if (cc != CC_SUCCESS) {
+            dprintf(1, "%s: bulk xfer failed (cc %d)\n", __func__, cc);
+            return -1;
+        }
+        queued = 0;
+    }
+    return 0;
+}
+
 int VISIBLE32FLAT
 xhci_send_bulk(struct usb_pipe *p, int dir, void *data, int datalen)
 {
@@ -1058,16 +1131,18 @@ xhci_send_bulk(struct usb_pipe *p, int dir, void *data, int datalen)
         return -1;
 
     struct xhci_pipe *pipe = container_of(p, struct xhci_pipe, pipe);
-    struct usb_xhci_s *xhci = container_of(
-        GET_LOWFLAT(pipe->pipe.cntl), struct usb_xhci_s, usb);
+    return xhci_bulk_chain(pipe, data, datalen, NULL, 0);
+}
 
-    xhci_xfer_normal(pipe, data, datalen);
-    int cc = xhci_event_wait(xhci, &pipe->reqs, 1000);
-    if (cc != CC_SUCCESS) {
-        dprintf(1, "%s: bulk xfer failed (cc %d)\n", __func__, cc);
+int VISIBLE32FLAT
+xhci_send_bulk2(struct usb_pipe *p, int dir, void *data, int datalen
+                , void *data2, int datalen2)
+{
+    if (!CONFIG_USB_XHCI)
         return -1;
-    }
-    return 0;
+
+    struct xhci_pipe *pipe = container_of(p, struct xhci_pipe, pipe);
+    return xhci_bulk_chain(pipe, data, datalen, data2, datalen2);
 }
 
 int VISIBLE32FLAT
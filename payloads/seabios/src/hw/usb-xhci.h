@@ -17,6 +17,8 @@ struct usb_pipe *xhci_update_pipe(struct usbdevice_s *usbdev
 int xhci_control(struct usb_pipe *p, int dir, const void *cmd, int cmdsize
                  , void *data, int datasize);
 int xhci_send_bulk(struct usb_pipe *p, int dir, void *data, int datasize);
+int xhci_send_bulk2(struct usb_pipe *p, int dir, void *data, int datasize
+                    , void *data2, int datasize2);
 int xhci_poll_intr(struct usb_pipe *p, void *data);
 
 // --------------------------------------------------------------
@@ -95,6 +95,30 @@ usb_send_bulk(struct usb_pipe *pipe_fl, int dir, void *data, int datasize)
     }
 }
 
+// Send two buffers back-to-back in the same direction, like a mass
+// storage data phase followed by its status.
+int
+usb_send_bulk2(struct usb_pipe *pipe_fl, int dir, void *data, int datasize
+               , void *data2, int datasize2)
+{
+    int ret;
+    switch (GET_LOWFLAT(pipe_fl->type)) {
+    default:
+    case USB_TYPE_UHCI:
+    case USB_TYPE_OHCI:
+        ret = usb_send_bulk(pipe_fl, dir, data, datasize);
+        if (ret)
+            return ret;
+        return usb_send_bulk(pipe_fl, dir, data2, datasize2);
+    case USB_TYPE_EHCI:
+        return ehci_send_bulk2(pipe_fl, dir, data, datasize, data2, datasize2);
+    case USB_TYPE_XHCI:
+        if (MODESEGMENT)
+            return -1;
+        return xhci_send_bulk2(pipe_fl, dir, data, datasize, data2, datasize2);
+    }
+}
+
 int
 usb_poll_intr(struct usb_pipe *pipe_fl, void *data)
 {
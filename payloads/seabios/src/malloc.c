@@ -394,6 +394,10 @@ rom_confirm(u32 size)
  * Setup
  ****************************************************************/
 
+// The tables and the disk read cache share the high zone, whatever is
+// left unused of it is given back in malloc_prepboot().
+#define HIGHZONE_SIZE (BUILD_MAX_HIGHTABLE + BUILD_BLOCKCACHE_SIZE)
+
 void
 malloc_preinit(void)
 {
@@ -418,7 +422,7 @@ malloc_preinit(void)
             continue;
         u32 s = en->start, e = end;
         if (!highram) {
-            u32 newe = ALIGN_DOWN(e - BUILD_MAX_HIGHTABLE, MALLOC_MIN_ALIGN);
+            u32 newe = ALIGN_DOWN(e - HIGHZONE_SIZE, MALLOC_MIN_ALIGN);
             if (newe <= e && newe >= s) {
                 highram = newe;
                 e = newe;
@@ -431,8 +435,8 @@ malloc_preinit(void)
     addSpace(&ZoneTmpLow, (void*)BUILD_STACK_ADDR, (void*)BUILD_EBDA_MINIMUM);
     if (highram) {
         addSpace(&ZoneHigh, (void*)highram
-                 , (void*)highram + BUILD_MAX_HIGHTABLE);
-        add_e820(highram, BUILD_MAX_HIGHTABLE, E820_RESERVED);
+                 , (void*)highram + HIGHZONE_SIZE);
+        add_e820(highram, HIGHZONE_SIZE, E820_RESERVED);
     }
 }
 
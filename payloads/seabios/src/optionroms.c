@@ -242,6 +242,14 @@ run_file_roms(const char *prefix, int isvga, u64 *sources)
         if ( pxe_skip && strstr(file->name,"pxe"))
                 continue;
 
+        if (CONFIG_DEFER_NETWORK_ROMS && CONFIG_COREBOOT_FLASH && !isvga
+            && strstr(file->name, "pxe")) {
+            // Deployed once it is chosen for boot (see bcv_prepboot()).
+            // A "pxen0" in bootorder has already dropped it above.
+            boot_add_romfile(file, bootprio_find_named_rom(file->name, 0));
+            continue;
+        }
+
         struct rom_header *rom = deploy_romfile(file);
         if (rom) {
             setRomSource(sources, rom, (u32)file);
@@ -251,6 +259,72 @@ run_file_roms(const char *prefix, int isvga, u64 *sources)
 }
 
 
+// Deploy a rom registered with boot_add_romfile() and return the
+// vector of its first BEV, or 0 if it has none.
+u32
+run_deferred_rom(struct romfile_s *file)
+{
+    dprintf(1, "Deploying deferred rom %s\n", file->name);
+    struct rom_header *rom = deploy_romfile(file);
+    if (!rom || init_optionrom(rom, 0, 0))
+        return 0;
+    rom_reserve(0);
+    struct pnp_data *pnp = get_pnp_rom(rom);
+    if (!pnp || !pnp->bev)
+        return 0;
+    return SEGOFF(FLATPTR_TO_SEG(rom), pnp->bev).segoff;
+}
+
+// A deferred rom that is deployed from do_boot() if its BEV is reached.
+struct deferred_rom_s {
+    struct romfile_s *file;
+    struct rom_header *rom;
+};
+
+// Keep option rom space and the CBFS location of a rom registered with
+// boot_add_romfile(), so that boot_deferred_rom() can deploy it at
+// int 19 time.
+struct deferred_rom_s *
+prepare_deferred_rom(struct romfile_s *file)
+{
+    struct deferred_rom_s *drom = malloc_high(sizeof(*drom));
+    if (!drom) {
+        warn_noalloc();
+        return NULL;
+    }
+    drom->file = cbfs_romfile_keep(file);
+    drom->rom = rom_reserve(file->size);
+    if (!drom->file || !drom->rom || rom_confirm(file->size)) {
+        free(drom->file);
+        free(drom);
+        return NULL;
+    }
+    dprintf(1, "Reserved %d bytes at %p for deferred rom %s\n"
+            , file->size, drom->rom, file->name);
+    return drom;
+}
+
+// Deploy a rom kept with prepare_deferred_rom() and return the vector
+// of its first BEV, or 0 if it has none.  PMM is finalized by now, so
+// the rom has to manage without it (iPXE then uses its default
+// decompression area in high memory) and keeps its full size.
+u32
+boot_deferred_rom(struct deferred_rom_s *drom)
+{
+    struct romfile_s *file = drom->file;
+    struct rom_header *rom = drom->rom;
+    dprintf(1, "Deploying deferred rom %s at boot\n", file->name);
+    int ret = cbfs_copyfile_boot(file, rom, file->size);
+    if (ret <= 0 || !is_valid_rom(rom) || rom->size * 512 > file->size)
+        return 0;
+    struct pnp_data *pnp = get_pnp_rom(rom);
+    if (!pnp || !pnp->bev)
+        return 0;
+    callrom(rom, 0);
+    return SEGOFF(FLATPTR_TO_SEG(rom), pnp->bev).segoff;
+}
+
+
 /****************************************************************
  * PCI roms
  ****************************************************************/
@@ -7,6 +7,7 @@
 // This file may be distributed under the terms of the GNU LGPLv3 license.
 
 #include "biosvar.h" // SET_BDA
+#include "block.h" // blockcache_setup
 #include "bregs.h" // struct bregs
 #include "config.h" // CONFIG_*
 #include "fw/paravirt.h" // qemu_cfg_preinit
@@ -202,6 +203,7 @@ prepareboot(void)
     // Finalize data structures before boot
     cdrom_prepboot();
     pmm_prepboot();
+    blockcache_setup();
     malloc_prepboot();
     memmap_prepboot();
 
@@ -259,9 +261,11 @@ maininit(void)
         device_hardware_setup();
         wait_threads();
     }
+    coreboot_timestamp(CB_TS_SEABIOS_DEVICES);
 
     // Run option roms
     optionrom_setup();
+    coreboot_timestamp(CB_TS_SEABIOS_OPTIONROMS);
 
     // show system info before the F12 menu
     if (CONFIG_DISPLAY_SYSTEM_INFO)
@@ -270,6 +274,7 @@ maininit(void)
     // Allow user to modify overall boot order.
     interactive_bootmenu();
     wait_threads();
+    coreboot_timestamp(CB_TS_SEABIOS_BOOTMENU);
 
     // Prepare for boot.
     prepareboot();
@@ -278,6 +283,7 @@ maininit(void)
     make_bios_readonly();
 
     // Invoke int 19 to start boot process.
+    coreboot_timestamp(CB_TS_SEABIOS_BOOT);
     startBoot();
 }
 
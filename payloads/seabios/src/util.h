@@ -25,6 +25,8 @@ void boot_add_floppy(struct drive_s *drive_g, const char *desc, int prio);
 void boot_add_hd(struct drive_s *drive_g, const char *desc, int prio);
 void boot_add_cd(struct drive_s *drive_g, const char *desc, int prio);
 void boot_add_cbfs(void *data, const char *desc, int prio);
+struct romfile_s;
+void boot_add_romfile(struct romfile_s *file, int prio);
 void interactive_bootmenu(void);
 void bcv_prepboot(void);
 struct pci_device;
@@ -80,9 +82,12 @@ extern const char *CBvendor, *CBpart;
 struct cbfs_file;
 void coreboot_debug_putc(char c);
 void cbfs_run_payload(struct cbfs_file *file);
+struct romfile_s *cbfs_romfile_keep(struct romfile_s *file);
+int cbfs_copyfile_boot(struct romfile_s *file, void *dst, u32 maxlen);
 void coreboot_platform_setup(void);
 void cbfs_payload_setup(void);
 void coreboot_preinit(void);
+void coreboot_timestamp(u32 id);
 void coreboot_cbfs_init(void);
 void update_cbmem(void);
 
@@ -187,6 +192,10 @@ void callrom(struct rom_header *rom, u16 bdf);
 void call_bcv(u16 seg, u16 ip);
 int is_pci_vga(struct pci_device *pci);
 void optionrom_setup(void);
+u32 run_deferred_rom(struct romfile_s *file);
+struct deferred_rom_s;
+struct deferred_rom_s *prepare_deferred_rom(struct romfile_s *file);
+u32 boot_deferred_rom(struct deferred_rom_s *drom);
 void vgarom_setup(void);
 void s3_resume_vga(void);
 extern int ScreenAndDebug;
@@ -15,6 +15,7 @@
 #define CONFIG_USB_MSC 1
 #define CONFIG_SERIAL_CONSOLE 1
 #define CONFIG_LZMA 1
+#define CONFIG_LZ4 1
 #define CONFIG_PC_KEYBOARD 1
 #define CONFIG_ARCH_X86 1
 #define CONFIG_STORAGE_ATA 1
@@ -44,6 +44,7 @@ static void update_tag_value(char buffer[MAX_DEVICES][MAX_LENGTH], u8 max_lines,
 /*** local variables ***/
 static u8 ipxe_toggle;
 static u8 serial_toggle;
+static u8 fast_boot_toggle;
 static char bootlist_def[MAX_DEVICES][MAX_LENGTH];
 static char bootlist_map[MAX_DEVICES][MAX_LENGTH];
 static char id[MAX_DEVICES] = {0};
@@ -59,6 +60,7 @@ static int flash_address;
  *        - Restore order defaults,
  *        - Serial console disable / enable
  *        - Network / IPXE disable / enable
+ *        - Fast boot (reuse of the DRAM training) disable / enable
  *        - Exit with or without saving order
  */
 
@@ -71,6 +73,7 @@ int main(void) {
 	u8 bootlist_map_ln = 0;
 	char *ipxe_str;
 	char *scon_str;
+	char *fben_str;
 
 #ifdef CONFIG_USB /* this needs to be done in order to use the USB keyboard */
 	usb_initialize();
@@ -101,6 +104,9 @@ int main(void) {
 	scon_str += strlen("scon");
 	serial_toggle = scon_str ? strtoul(scon_str, NULL, 10) : 1;
 
+	fben_str = cbfs_find_string("fben", BOOTORDER_FILE);
+	fast_boot_toggle = fben_str ? strtoul(fben_str + strlen("fben"), NULL, 10) : 0;
+
 	show_boot_device_list( bootlist, max_lines, bootlist_def_ln );
 	int_ids( bootlist, max_lines, bootlist_def_ln );
 
@@ -121,9 +127,13 @@ int main(void) {
 			case 'N':
 				ipxe_toggle ^= 0x1;
 				break;
+			case 'F':
+				fast_boot_toggle ^= 0x1;
+				break;
 			case 'E':
 				update_tag_value(bootlist, max_lines, "scon", serial_toggle + '0');
 				update_tag_value(bootlist, max_lines, "pxen", ipxe_toggle + '0');
+				update_tag_value(bootlist, max_lines, "fben", fast_boot_toggle + '0');
 				save_flash( bootlist, max_lines );
 				// fall through to exit ...
 			case 'X':
@@ -197,6 +207,7 @@ static void show_boot_device_list( char buffer[MAX_DEVICES][MAX_LENGTH], u8 line
 	printf("  R Restore boot order defaults\n");
 	printf("  N Network/PXE boot - Currently %s\n", (ipxe_toggle) ? "Enabled" : "Disabled");
 	printf("  S Serial console - Currently %s\n", (serial_toggle) ? "Enabled" : "Disabled");
+	printf("  F Fast boot (reuse DRAM training) - Currently %s\n", (fast_boot_toggle) ? "Enabled" : "Disabled");
 	printf("  E Exit setup with save\n");
 	printf("  X Exit setup without save\n");
 }
@@ -286,9 +297,11 @@ static void save_flash(char buffer[MAX_DEVICES][MAX_LENGTH], u8 max_lines) {
 	int i = 0;
 	int k = 0;
 	int j;
-	char cbfs_formatted_list[MAX_DEVICES * MAX_LENGTH];
+	char cbfs_formatted_list[FLASH_SIZE_CHUNK];
 	struct spi_flash *flash;
-	u32 nvram_pos;
+
+	// the rest of the chunk reads back as erased flash
+	memset(cbfs_formatted_list, 0xff, sizeof(cbfs_formatted_list));
 
 	// compact the table into the expected packed list
 	for (j = 0; j < max_lines; j++) {
@@ -308,14 +321,12 @@ static void save_flash(char buffer[MAX_DEVICES][MAX_LENGTH], u8 max_lines) {
 	if (!flash)
 		printf("Could not find SPI device\n");
 	else {
-		printf("Erasing Flash size 0x%x @ 0x%x\n", FLASH_SIZE_CHUNK, flash_address);
-		flash->erase(flash, flash_address, FLASH_SIZE_CHUNK);
+		printf("Updating flash size 0x%x @ 0x%x\n", FLASH_SIZE_CHUNK, flash_address);
 		flash->spi->rw = SPI_WRITE_FLAG;
-		printf("Writing %d bytes @ 0x%x\n", i, flash_address);
-		for (nvram_pos = 0; nvram_pos < (i & 0xFC); nvram_pos += 4) {
-			flash->write(flash, nvram_pos + flash_address, sizeof(u32), (u32 *)(cbfs_formatted_list + nvram_pos));
-		}
-		flash->write(flash, nvram_pos + flash_address, sizeof(i % 4), (u32 *)(cbfs_formatted_list + nvram_pos));
+		spi_claim_bus(flash->spi);
+		spi_flash_update(flash, flash_address, FLASH_SIZE_CHUNK,
+				 cbfs_formatted_list, (void *)flash_address);
+		spi_release_bus(flash->spi);
 	}
 }
 
@@ -72,6 +72,12 @@ struct spi_slave {
 void spi_init(void);
 struct spi_flash *spi_flash_probe(unsigned int bus, unsigned int cs,unsigned int max_hz, unsigned int spi_mode);
 
+/* Bring len bytes at offset to the contents of buf, where current maps the
+ * present contents of that range. Only changed bytes are programmed and a
+ * sector is only erased when some bit has to go from 0 to 1. */
+int spi_flash_update(struct spi_flash *flash, u32 offset, size_t len,
+		const void *buf, const void *current);
+
 /*-----------------------------------------------------------------------
  * Set up communications parameters for a SPI slave.
  *
@@ -46,6 +46,10 @@
 #define CONTROLLER_PAGE_LIMIT	((int)(~0U>>1))
 #endif
 
+/* Largest payload of one page program command: the SB800 SPI FIFO is 8
+ * bytes deep and three of them carry the address. */
+#define SPI_FLASH_PROG_CHUNK	5
+
 static inline int spi_flash_read(struct spi_flash *flash, u32 offset, size_t len, void *buf)
 {
 	return flash->read(flash, offset, len, buf);
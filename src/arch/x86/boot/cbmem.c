@@ -22,6 +22,21 @@
 #include <cbmem.h>
 #include <arch/acpi.h>
 
+#if !defined(__PRE_RAM__)
+void __attribute__((weak)) backup_top_of_ram(uint64_t ramtop)
+{
+	/* Do nothing. Chipset may have implementation to save ramtop in NVRAM. */
+}
+#endif
+
+#if CONFIG_BROKEN_CAR_MIGRATE || !defined(__PRE_RAM__)
+unsigned long __attribute__((weak)) get_top_of_ram(void)
+{
+	printk(BIOS_WARNING, "WARNING: you need to define get_top_of_ram() for your chipset\n");
+	return 0;
+}
+#endif
+
 #if !CONFIG_DYNAMIC_CBMEM
 void get_cbmem_table(uint64_t *base, uint64_t *size)
 {
@@ -37,11 +52,6 @@ void get_cbmem_table(uint64_t *base, uint64_t *size)
 }
 
 #if !defined(__PRE_RAM__)
-void __attribute__((weak)) backup_top_of_ram(uint64_t ramtop)
-{
-	/* Do nothing. Chipset may have implementation to save ramtop in NVRAM. */
-}
-
 /* This is for compatibility with old boards only. Any new chipset and board
  * must implement get_top_of_ram() for both romstage and ramstage to support
  * early features like COLLECT_TIMESTAMPS and CBMEM_CONSOLE.
@@ -53,21 +63,32 @@ void set_top_of_ram(uint64_t ramtop)
 }
 #endif /* !__PRE_RAM__ */
 
-#if CONFIG_BROKEN_CAR_MIGRATE || !defined(__PRE_RAM__)
-unsigned long __attribute__((weak)) get_top_of_ram(void)
+#else
+
+#if !defined(__PRE_RAM__)
+static uint64_t ramstage_top_of_ram;
+
+/* The northbridge reports the top of RAM while reading resources. Before
+ * that there is only get_top_of_ram(), which may only know it on resume. */
+void set_top_of_ram(uint64_t ramtop)
 {
-	printk(BIOS_WARNING, "WARNING: you need to define get_top_of_ram() for your chipset\n");
-	return 0;
+	backup_top_of_ram(ramtop);
+	ramstage_top_of_ram = ramtop;
 }
-#endif
 
+void *cbmem_top(void)
+{
+	if (ramstage_top_of_ram)
+		return (void *)(uintptr_t)ramstage_top_of_ram;
+	return (void *)get_top_of_ram();
+}
 #else
-
 void *cbmem_top(void)
 {
 	/* Top of cbmem is at lowest usable DRAM address below 4GiB. */
 	return (void *)get_top_of_ram();
 }
+#endif /* !__PRE_RAM__ */
 
 #endif /* DYNAMIC_CBMEM */
 
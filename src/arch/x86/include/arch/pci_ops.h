@@ -7,6 +7,11 @@ extern const struct pci_bus_operations pci_cf8_conf1;
 
 #if CONFIG_MMCONF_SUPPORT
 extern const struct pci_bus_operations pci_ops_mmconf;
+
+/* Number of buses MMCONFIG was set up for before ramstage, 0 if it wasn't.
+ * Those buses are accessed through it without CONFIG_MMCONF_SUPPORT_DEFAULT.
+ */
+unsigned int pci_mmconf_buses(void);
 #endif
 
 const struct pci_bus_operations *pci_bus_default_ops(device_t dev);
@@ -57,6 +57,17 @@ static inline __attribute__((always_inline)) void spin_unlock(spinlock_t *lock)
 		:"=m" (lock->lock) : : "memory");
 }
 
+/* Take the lock only if it is free, returns non-zero when it was taken. */
+static inline __attribute__((always_inline)) int spin_trylock(spinlock_t *lock)
+{
+	char oldval;
+	__asm__ __volatile__(
+		"xchgb %b0,%1"
+		:"=q" (oldval), "=m" (lock->lock)
+		:"0" (0) : "memory");
+	return oldval > 0;
+}
+
 /* REP NOP (PAUSE) is a good thing to insert into busy-wait loops. */
 static inline __attribute__((always_inline)) void cpu_relax(void)
 {
@@ -71,6 +82,7 @@ static inline __attribute__((always_inline)) void cpu_relax(void)
 #define spin_unlock_wait(lock)	do {} while(0)
 #define spin_lock(lock)		do {} while(0)
 #define spin_unlock(lock)	do {} while(0)
+#define spin_trylock(lock)	1
 #define cpu_relax()		do {} while(0)
 
 #endif /* !__PRE_RAM__ */
@@ -47,9 +47,31 @@ void console_tx_byte(unsigned char byte)
 	__usb_tx_byte(byte);
 }
 
+void console_tx_bytes(const unsigned char *data, size_t len)
+{
+	size_t i;
+
+	__cbmemc_tx_bytes(data, len);
+	__uart_tx_bytes(data, len);
+
+	for (i = 0; i < len; i++) {
+		__spkmodem_tx_byte(data[i]);
+		__qemu_debugcon_tx_byte(data[i]);
+		__ne2k_tx_byte(data[i]);
+		__usb_tx_byte(data[i]);
+	}
+}
+
 void console_tx_flush(void)
 {
 	__uart_tx_flush();
 	__ne2k_tx_flush();
 	__usb_tx_flush();
 }
+
+void console_tx_drain(void)
+{
+	__uart_tx_drain();
+	__ne2k_tx_flush();
+	__usb_tx_flush();
+}
@@ -33,6 +33,7 @@
 void NORETURN die(const char *msg)
 {
 	print_emerg(msg);
+	console_sync();
 	do {
 		hlt();
 	} while(1);
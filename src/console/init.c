@@ -30,6 +30,10 @@
 #include <device/pci.h>
 #endif
 
+#if CONFIG_MAX_CONSOLE_LOGLEVEL < CONFIG_DEFAULT_CONSOLE_LOGLEVEL
+#error "CONFIG_MAX_CONSOLE_LOGLEVEL is below CONFIG_DEFAULT_CONSOLE_LOGLEVEL"
+#endif
+
 #if !defined(__ROMCC__)
 /* While in romstage, console loglevel is built-time constant. */
 static ROMSTAGE_CONST int console_loglevel = CONFIG_DEFAULT_CONSOLE_LOGLEVEL;
@@ -23,13 +23,42 @@ void do_putchar(unsigned char byte)
 	console_tx_byte(byte);
 }
 
-static void wrap_putchar(unsigned char byte, void *data)
+/* Messages are formatted into a line on the stack, the console drivers
+ * get a whole line at a time. */
+#define CONSOLE_LINE_SIZE	128
+
+struct console_line {
+	size_t len;
+	unsigned char buf[CONSOLE_LINE_SIZE];
+};
+
+static void line_flush(struct console_line *line)
+{
+	if (line->len) {
+		console_tx_bytes(line->buf, line->len);
+		line->len = 0;
+	}
+}
+
+static void line_putchar(unsigned char byte, void *data)
 {
-	do_putchar(byte);
+	struct console_line *line = data;
+
+	/* Leave room for a "\r\n". */
+	if (line->len >= sizeof(line->buf) - 1)
+		line_flush(line);
+
+	if (byte == '\n')
+		line->buf[line->len++] = '\r';
+	line->buf[line->len++] = byte;
+
+	if (byte == '\n')
+		line_flush(line);
 }
 
 int do_printk(int msg_level, const char *fmt, ...)
 {
+	struct console_line line;
 	va_list args;
 	int i;
 
@@ -44,9 +73,11 @@ int do_printk(int msg_level, const char *fmt, ...)
 	DISABLE_TRACE;
 	spin_lock(&console_lock);
 
+	line.len = 0;
 	va_start(args, fmt);
-	i = vtxprintf(wrap_putchar, fmt, args, NULL);
+	i = vtxprintf(line_putchar, fmt, args, &line);
 	va_end(args);
+	line_flush(&line);
 
 	console_tx_flush();
 
@@ -56,6 +87,7 @@ int do_printk(int msg_level, const char *fmt, ...)
 	if ( (CONFIG_DIE_CONSOLE_LOGLEVEL >= 0 )
 	  && (msg_level <= CONFIG_DIE_CONSOLE_LOGLEVEL)) {
 		printk(console_log_level(msg_level), "System Halted: DIE_CONSOLE_LOGLEVEL");
+		console_sync();
 		do {
 			hlt();
 		} while(1);
@@ -64,10 +96,32 @@ int do_printk(int msg_level, const char *fmt, ...)
 	return i;
 }
 
+#if CONFIG_CONSOLE_SERIAL_BUFFERED && ENV_RAMSTAGE
+/* Called from delays and the like, skipped while another CPU prints. */
+void console_poll(void)
+{
+	if (!spin_trylock(&console_lock))
+		return;
+	console_tx_flush();
+	spin_unlock(&console_lock);
+}
+
+void console_sync(void)
+{
+	spin_lock(&console_lock);
+	console_tx_drain();
+	spin_unlock(&console_lock);
+}
+#endif
+
 #if IS_ENABLED(CONFIG_CHROMEOS)
 void do_vtxprintf(const char *fmt, va_list args)
 {
-	vtxprintf(wrap_putchar, fmt, args, NULL);
+	struct console_line line;
+
+	line.len = 0;
+	vtxprintf(line_putchar, fmt, args, &line);
+	line_flush(&line);
 	console_tx_flush();
 }
 #endif
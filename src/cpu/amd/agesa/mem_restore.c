@@ -0,0 +1,138 @@
+/*
+ * This file is part of the coreboot project.
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,  MA 02110-1301 USA
+ */
+
+#include <string.h>
+#include "mem_restore.h"
+
+/* Size of AGESA's DEVICE_BLOCK_HEADER at the start of the context. */
+#define DEVICE_BLOCK_HEADER_SIZE	6
+
+/* Bitwise so that romstage does not carry a table, the blocks are small. */
+uint32_t mem_restore_crc32(uint32_t crc, const void *buf, size_t len)
+{
+	const uint8_t *p = buf;
+	int i;
+
+	crc = ~crc;
+	while (len--) {
+		crc ^= *p++;
+		for (i = 0; i < 8; i++)
+			crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+	}
+	return ~crc;
+}
+
+void mem_restore_id_init(struct mem_restore_id *id, uint32_t cpuid,
+			 const char *board, uint32_t spd_index,
+			 const void *spd, size_t spd_len)
+{
+	id->cpuid = cpuid;
+	id->board = mem_restore_crc32(0, board, strlen(board));
+	id->spd_index = spd_index;
+	id->spd_crc = mem_restore_crc32(0, spd, spd_len);
+}
+
+void mem_restore_sig_fill(struct mem_restore_sig *sig,
+			  const struct mem_restore_id *id,
+			  const void *ctx, uint32_t ctx_size)
+{
+	sig->magic = MEM_RESTORE_SIG_MAGIC;
+	sig->version = MEM_RESTORE_SIG_VERSION;
+	sig->size = sizeof(*sig);
+	sig->id = *id;
+	sig->ctx_size = ctx_size;
+	sig->ctx_crc = mem_restore_crc32(0, ctx, ctx_size);
+	sig->crc = mem_restore_crc32(0, sig, offsetof(struct mem_restore_sig, crc));
+}
+
+static uint16_t get_le16(const uint8_t *p)
+{
+	return p[0] | (p[1] << 8);
+}
+
+enum mem_restore_result mem_restore_validate(const struct mem_restore_sig *sig,
+					     const struct mem_restore_id *id,
+					     const void *ctx, uint32_t ctx_size,
+					     uint32_t ctx_max)
+{
+	const uint8_t *hdr = ctx;
+	uint16_t num_devices, or_mask_offset;
+
+	/* Erased flash or a block saved before signatures existed. */
+	if (sig->magic != MEM_RESTORE_SIG_MAGIC ||
+	    sig->version != MEM_RESTORE_SIG_VERSION ||
+	    sig->size != sizeof(*sig))
+		return MEM_RESTORE_NO_SIG;
+
+	if (sig->crc != mem_restore_crc32(0, sig,
+				offsetof(struct mem_restore_sig, crc)))
+		return MEM_RESTORE_BAD_SIG;
+
+	if (sig->id.cpuid != id->cpuid)
+		return MEM_RESTORE_CPU_CHANGED;
+	if (sig->id.board != id->board)
+		return MEM_RESTORE_BOARD_CHANGED;
+	if (sig->id.spd_index != id->spd_index ||
+	    sig->id.spd_crc != id->spd_crc)
+		return MEM_RESTORE_SPD_CHANGED;
+
+	/* The size word is read from flash before the data it describes, so
+	 * bound it before it is used for anything. */
+	if (ctx_size != sig->ctx_size || ctx_size < DEVICE_BLOCK_HEADER_SIZE ||
+	    ctx_size > ctx_max)
+		return MEM_RESTORE_CTX_SIZE;
+
+	if (sig->ctx_crc != mem_restore_crc32(0, ctx, ctx_size))
+		return MEM_RESTORE_CTX_CORRUPT;
+
+	/* AGESA walks the device list up to RelativeOrMaskOffset and then
+	 * reads the register values behind it. */
+	num_devices = get_le16(hdr + 2);
+	or_mask_offset = get_le16(hdr + 4);
+	if (num_devices == 0 || or_mask_offset < DEVICE_BLOCK_HEADER_SIZE ||
+	    or_mask_offset >= ctx_size)
+		return MEM_RESTORE_CTX_INVALID;
+
+	return MEM_RESTORE_OK;
+}
+
+const char *mem_restore_result_str(enum mem_restore_result result)
+{
+	switch (result) {
+	case MEM_RESTORE_OK:
+		return "valid";
+	case MEM_RESTORE_NO_SIG:
+		return "no signature";
+	case MEM_RESTORE_BAD_SIG:
+		return "signature checksum mismatch";
+	case MEM_RESTORE_CPU_CHANGED:
+		return "CPU changed";
+	case MEM_RESTORE_BOARD_CHANGED:
+		return "board changed";
+	case MEM_RESTORE_SPD_CHANGED:
+		return "SPD changed";
+	case MEM_RESTORE_CTX_SIZE:
+		return "context size mismatch";
+	case MEM_RESTORE_CTX_CORRUPT:
+		return "context checksum mismatch";
+	case MEM_RESTORE_CTX_INVALID:
+		return "context malformed";
+	}
+	return "unknown";
+}
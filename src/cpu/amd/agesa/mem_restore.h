@@ -0,0 +1,82 @@
+/*
+ * This file is part of the coreboot project.
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,  MA 02110-1301 USA
+ */
+
+#ifndef MEM_RESTORE_H
+#define MEM_RESTORE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * The S3 non-volatile block saved by AmdS3Save() is the memory context that
+ * AmdInitPost() can restore instead of training (MemRestoreCtl). Before it is
+ * handed back on a cold boot it has to be proven to belong to this machine:
+ * the signature below is stored at the end of the same flash sector and
+ * binds the block to the CPU, the board and the SPD it was trained with.
+ *
+ * This file and mem_restore.c have no coreboot dependencies so that the
+ * validation can be replayed on the host (util/memrestore).
+ */
+
+#define MEM_RESTORE_SIG_MAGIC	0x5453524d	/* "MRST" */
+#define MEM_RESTORE_SIG_VERSION	1
+
+struct mem_restore_id {
+	uint32_t cpuid;		/* CPUID Fn0000_0001 EAX */
+	uint32_t board;		/* crc32 of vendor and part number */
+	uint32_t spd_index;	/* which SPD of spd.bin the board strapped */
+	uint32_t spd_crc;	/* crc32 of the whole SPD */
+} __attribute__((packed));
+
+struct mem_restore_sig {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t size;
+	struct mem_restore_id id;
+	uint32_t ctx_size;	/* must match the size word of the NV block */
+	uint32_t ctx_crc;
+	uint32_t crc;		/* crc32 of everything above */
+} __attribute__((packed));
+
+enum mem_restore_result {
+	MEM_RESTORE_OK = 0,
+	MEM_RESTORE_NO_SIG,
+	MEM_RESTORE_BAD_SIG,
+	MEM_RESTORE_CPU_CHANGED,
+	MEM_RESTORE_BOARD_CHANGED,
+	MEM_RESTORE_SPD_CHANGED,
+	MEM_RESTORE_CTX_SIZE,
+	MEM_RESTORE_CTX_CORRUPT,
+	MEM_RESTORE_CTX_INVALID,
+};
+
+uint32_t mem_restore_crc32(uint32_t crc, const void *buf, size_t len);
+void mem_restore_id_init(struct mem_restore_id *id, uint32_t cpuid,
+			 const char *board, uint32_t spd_index,
+			 const void *spd, size_t spd_len);
+void mem_restore_sig_fill(struct mem_restore_sig *sig,
+			  const struct mem_restore_id *id,
+			  const void *ctx, uint32_t ctx_size);
+enum mem_restore_result mem_restore_validate(const struct mem_restore_sig *sig,
+					     const struct mem_restore_id *id,
+					     const void *ctx, uint32_t ctx_size,
+					     uint32_t ctx_max);
+const char *mem_restore_result_str(enum mem_restore_result result);
+
+#endif
@@ -28,10 +28,12 @@
 #include <device/device.h>
 #include <arch/io.h>
 #include <arch/acpi.h>
+#include <stdlib.h>
 #include <string.h>
 #include "Porting.h"
 #include "BiosCallOuts.h"
 #include "s3_resume.h"
+#include "mem_restore.h"
 #include "agesawrapper.h"
 
 #ifndef __PRE_RAM__
@@ -127,20 +129,10 @@ void move_stack_high_mem(void)
 }
 
 #ifndef __PRE_RAM__
-void write_mtrr(struct spi_flash *flash, u32 *p_nvram_pos, unsigned idx)
+void write_mtrr(msr_t **p_mtrr_data, unsigned idx)
 {
-	msr_t  msr_data;
-	msr_data = rdmsr(idx);
-
-#if CONFIG_AMD_SB_SPI_TX_LEN >= 8
-	flash->write(flash, *p_nvram_pos, 8, &msr_data);
-	*p_nvram_pos += 8;
-#else
-	flash->write(flash, *p_nvram_pos, 4, &msr_data.lo);
-	*p_nvram_pos += 4;
-	flash->write(flash, *p_nvram_pos, 4, &msr_data.hi);
-	*p_nvram_pos += 4;
-#endif
+	**p_mtrr_data = rdmsr(idx);
+	(*p_mtrr_data)++;
 }
 
 static int check_mtrr(u32 *p_nvram_pos, unsigned idx)
@@ -197,25 +189,14 @@ void OemAgesaSaveMtrr(void)
 {
 #ifndef __PRE_RAM__
 	msr_t  msr_data;
-	u32 nvram_pos = S3_DATA_MTRR_POS;
+	msr_t  mtrr_data[ARRAY_SIZE(mtrr_table_fixed_MTRR) +
+			 ARRAY_SIZE(mtrr_table_var_MTRR)];
+	msr_t  *p_mtrr_data = mtrr_data;
 	u32 i;
 	struct spi_flash *flash;
 
-	if (!check_saved_mtrr_data(nvram_pos))
-		return;
-
-	spi_init();
-
-	flash = spi_flash_probe(0, 0, 0, 0);
-	if (!flash) {
-		printk(BIOS_DEBUG, "Could not find SPI device\n");
+	if (!check_saved_mtrr_data(S3_DATA_MTRR_POS))
 		return;
-	}
-
-	flash->spi->rw = SPI_WRITE_FLAG;
-	spi_claim_bus(flash->spi);
-
-	flash->erase(flash, S3_DATA_MTRR_POS, S3_DATA_MTRR_SIZE);
 
 	/* Enable access to AMD RdDram and WrDram extension bits */
 	msr_data = rdmsr(SYS_CFG);
@@ -224,7 +205,7 @@ void OemAgesaSaveMtrr(void)
 
 	/* Fixed MTRRs */
 	for (i = 0; i < (u32)sizeof(mtrr_table_fixed_MTRR)/sizeof(u32); i++)
-		write_mtrr(flash, &nvram_pos, mtrr_table_fixed_MTRR[i]);
+		write_mtrr(&p_mtrr_data, mtrr_table_fixed_MTRR[i]);
 
 	/* Disable access to AMD RdDram and WrDram extension bits */
 	msr_data = rdmsr(SYS_CFG);
@@ -233,7 +214,21 @@ void OemAgesaSaveMtrr(void)
 
 	/* Variable MTRRs, SYS_CFG, TOM, TOM2 */
 	for (i = 0; i < (u32)sizeof(mtrr_table_var_MTRR)/sizeof(u32); i++)
-		write_mtrr(flash, &nvram_pos, mtrr_table_var_MTRR[i]);
+		write_mtrr(&p_mtrr_data, mtrr_table_var_MTRR[i]);
+
+	spi_init();
+
+	flash = spi_flash_probe(0, 0, 0, 0);
+	if (!flash) {
+		printk(BIOS_DEBUG, "Could not find SPI device\n");
+		return;
+	}
+
+	flash->spi->rw = SPI_WRITE_FLAG;
+	spi_claim_bus(flash->spi);
+
+	spi_flash_update(flash, S3_DATA_MTRR_POS, sizeof(mtrr_data),
+			 mtrr_data, (void *)S3_DATA_MTRR_POS);
 
 	flash->spi->rw = SPI_WRITE_FLAG;
 	spi_release_bus(flash->spi);
@@ -261,14 +256,19 @@ u32 OemAgesaSaveS3Info(S3_DATA_TYPE S3DataType, u32 DataSize, void *Data)
 	u32 pos;
 	struct spi_flash *flash;
 	u8 *new_data;
-	u32 bytes_to_process;
-	u32 nvram_pos;
 
 	if (S3DataType == S3DataTypeNonVolatile)
 		pos = S3_DATA_NONVOLATILE_POS;
 	else
 		pos = S3_DATA_VOLATILE_POS;
 
+	/* Keep clear of the memory restore signature at the end. */
+	if (S3DataType == S3DataTypeNonVolatile &&
+	    DataSize + (u32)sizeof(DataSize) > S3_DATA_NONVOLATILE_SIZE - S3_DATA_MEM_RESTORE_SIZE) {
+		printk(BIOS_ERR, "%s: nvram data too large (%x)\n", __func__, DataSize);
+		return AGESA_SUCCESS;
+	}
+
 	spi_init();
 	flash = spi_flash_probe(0, 0, 0, 0);
 	if (!flash) {
@@ -286,26 +286,10 @@ u32 OemAgesaSaveS3Info(S3_DATA_TYPE S3DataType, u32 DataSize, void *Data)
 	memcpy(new_data + (u32)sizeof(DataSize), Data, DataSize);
 	DataSize += (u32)sizeof(DataSize); // add in the size of the data
 
-	for ( ; DataSize > 0; DataSize -= bytes_to_process) {
-		bytes_to_process = ( DataSize >= flash->sector_size) ? flash->sector_size : DataSize;
-		if (memcmp((u8 *)pos, (u8 *)new_data, bytes_to_process)) {
-			printk(BIOS_DEBUG, "%s: Data mismatch - write the data\n", __func__);
-			flash->erase(flash, pos, flash->sector_size);
-			for (nvram_pos = 0; \
-			     nvram_pos < bytes_to_process - (bytes_to_process % CONFIG_AMD_SB_SPI_TX_LEN); \
-			     nvram_pos += CONFIG_AMD_SB_SPI_TX_LEN) {
-				flash->write(flash, pos + nvram_pos, CONFIG_AMD_SB_SPI_TX_LEN, \
-				             (u8 *)(new_data + nvram_pos));
-			}
-			flash->write(flash, pos + nvram_pos, bytes_to_process % CONFIG_AMD_SB_SPI_TX_LEN, \
-			             (u8 *)(new_data + nvram_pos));
-		}
-		else
-			printk(BIOS_DEBUG, "%s: existing nvram data matched\n", __func__);
+	/* Only the sectors and bytes that changed reach the flash part. */
+	if (spi_flash_update(flash, pos, DataSize, new_data, (void *)pos))
+		printk(BIOS_DEBUG, "%s: failed to update nvram data\n", __func__);
 
-		new_data += bytes_to_process;
-		pos += bytes_to_process;
-	}
 	free(new_data);
 	flash->spi->rw = SPI_WRITE_FLAG;
 	spi_release_bus(flash->spi);
@@ -314,6 +298,35 @@ u32 OemAgesaSaveS3Info(S3_DATA_TYPE S3DataType, u32 DataSize, void *Data)
 }
 #endif
 
+const struct mem_restore_sig *s3_get_mem_restore_sig(void)
+{
+	return (const struct mem_restore_sig *)S3_DATA_MEM_RESTORE_POS;
+}
+
+void s3_save_mem_restore_sig(const struct mem_restore_sig *sig)
+{
+#ifndef __PRE_RAM__
+	struct spi_flash *flash;
+
+	spi_init();
+	flash = spi_flash_probe(0, 0, 0, 0);
+	if (!flash) {
+		printk(BIOS_DEBUG, "%s: Could not find SPI device\n", __func__);
+		return;
+	}
+
+	flash->spi->rw = SPI_WRITE_FLAG;
+	spi_claim_bus(flash->spi);
+
+	if (spi_flash_update(flash, S3_DATA_MEM_RESTORE_POS, sizeof(*sig),
+			     sig, (void *)S3_DATA_MEM_RESTORE_POS))
+		printk(BIOS_DEBUG, "%s: failed to update signature\n", __func__);
+
+	flash->spi->rw = SPI_WRITE_FLAG;
+	spi_release_bus(flash->spi);
+#endif
+}
+
 void set_resume_cache(void)
 {
 	msr_t msr;
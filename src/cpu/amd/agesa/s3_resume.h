@@ -30,6 +30,11 @@
 #define S3_DATA_MTRR_POS	(CONFIG_S3_DATA_POS + S3_DATA_VOLATILE_SIZE)
 #define S3_DATA_NONVOLATILE_POS	(CONFIG_S3_DATA_POS + S3_DATA_VOLATILE_SIZE + S3_DATA_MTRR_SIZE)
 
+/* The end of the non-volatile sector holds the signature that allows the
+ * memory context to be restored on a cold boot, see mem_restore.h. */
+#define S3_DATA_MEM_RESTORE_SIZE	0x40
+#define S3_DATA_MEM_RESTORE_POS	(S3_DATA_NONVOLATILE_POS + S3_DATA_NONVOLATILE_SIZE - S3_DATA_MEM_RESTORE_SIZE)
+
 #if (S3_DATA_VOLATILE_SIZE + S3_DATA_MTRR_SIZE + S3_DATA_NONVOLATILE_SIZE) > CONFIG_S3_DATA_SIZE
 #error "Please increase the value of S3_DATA_SIZE"
 #endif
@@ -49,9 +54,13 @@ u32 OemAgesaSaveS3Info (S3_DATA_TYPE S3DataType, u32 DataSize, void *Data);
 void OemAgesaGetS3Info (S3_DATA_TYPE S3DataType, u32 *DataSize, void **Data);
 void OemAgesaSaveMtrr (void);
 
+struct mem_restore_sig;
+const struct mem_restore_sig *s3_get_mem_restore_sig(void);
+void s3_save_mem_restore_sig(const struct mem_restore_sig *sig);
+
 #ifndef __PRE_RAM__
-#include <spi_flash.h>
-void write_mtrr(struct spi_flash *flash, u32 *p_nvram_pos, unsigned idx);
+#include <cpu/x86/msr.h>
+void write_mtrr(msr_t **p_mtrr_data, unsigned idx);
 #endif
 
 #endif
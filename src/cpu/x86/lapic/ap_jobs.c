@@ -0,0 +1,209 @@
+/*
+ * This file is part of the coreboot project.
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stddef.h>
+#include <bootstate.h>
+#include <console/console.h>
+#include <delay.h>
+#include <timestamp.h>
+#include <smp/spinlock.h>
+#include <cpu/x86/ap_jobs.h>
+
+enum ap_state {
+	AP_OFFLINE = 0,
+	AP_IDLE,
+	AP_BUSY,
+};
+
+/* The mailbox of every CPU. The AP posts its state, the BSP asks it to
+ * leave ap_jobs_run() with stop. */
+static struct ap_mailbox {
+	volatile int state;
+	volatile int stop;
+} mailboxes[CONFIG_MAX_CPUS];
+
+/* The queue of jobs no CPU has started yet, oldest first. */
+DECLARE_SPIN_LOCK(ap_job_lock)
+static struct ap_job *volatile job_head;
+static struct ap_job *job_tail;
+static int jobs_stopped;
+
+#define compiler_barrier() asm volatile ("" ::: "memory")
+
+/* Remove the oldest job from the queue. The lock must be held. */
+static struct ap_job *ap_job_take(void)
+{
+	struct ap_job *job = job_head;
+
+	if (job == NULL)
+		return NULL;
+
+	job_head = job->next;
+	if (job_head == NULL)
+		job_tail = NULL;
+	job->next = NULL;
+	return job;
+}
+
+/* Remove job from the queue if nobody has started it yet. */
+static int ap_job_take_back(struct ap_job *job)
+{
+	struct ap_job **p, *prev = NULL;
+	int found = 0;
+
+	spin_lock(&ap_job_lock);
+	for (p = (struct ap_job **)&job_head; *p; prev = *p, p = &(*p)->next) {
+		if (*p != job)
+			continue;
+		*p = job->next;
+		if (job_tail == job)
+			job_tail = prev;
+		job->next = NULL;
+		found = 1;
+		break;
+	}
+	spin_unlock(&ap_job_lock);
+	return found;
+}
+
+static void ap_job_run(struct ap_job *job, unsigned int index)
+{
+	job->cpu = index;
+	job->start = rdtsc();
+	job->func(job->arg);
+	job->end = rdtsc();
+	/* x86 keeps the order of stores, everything the job wrote is visible
+	 * once done is. Only the compiler needs to be kept from moving them. */
+	compiler_barrier();
+	job->done = 1;
+}
+
+void ap_job_queue(struct ap_job *job, void (*func)(void *), void *arg)
+{
+	job->func = func;
+	job->arg = arg;
+	job->next = NULL;
+	job->done = 0;
+	job->cpu = 0;
+
+	spin_lock(&ap_job_lock);
+	if (job_tail != NULL)
+		job_tail->next = job;
+	else
+		job_head = job;
+	job_tail = job;
+	spin_unlock(&ap_job_lock);
+}
+
+void ap_job_wait(struct ap_job *job)
+{
+	if (ap_job_take_back(job)) {
+		ap_job_run(job, 0);
+		return;
+	}
+
+	/* udelay() lets other coreboot threads run while waiting. */
+	while (!job->done)
+		udelay(10);
+
+	if (job->cpu == 0)
+		return;
+
+	timestamp_add(TS_START_AP_JOB, job->start);
+	timestamp_add(TS_END_AP_JOB, job->end);
+}
+
+void ap_jobs_run(unsigned int index)
+{
+	struct ap_mailbox *mb = &mailboxes[index];
+	struct ap_job *job;
+
+	spin_lock(&ap_job_lock);
+	if (jobs_stopped) {
+		spin_unlock(&ap_job_lock);
+		return;
+	}
+	mb->state = AP_IDLE;
+	spin_unlock(&ap_job_lock);
+
+	printk(BIOS_DEBUG, "CPU%d: waiting for jobs\n", index);
+
+	while (!mb->stop) {
+		/* Only take the lock when there is something to take. */
+		if (job_head == NULL) {
+			cpu_relax();
+			continue;
+		}
+
+		spin_lock(&ap_job_lock);
+		job = ap_job_take();
+		spin_unlock(&ap_job_lock);
+
+		if (job == NULL)
+			continue;
+
+		mb->state = AP_BUSY;
+		ap_job_run(job, index);
+		mb->state = AP_IDLE;
+	}
+
+	mb->state = AP_OFFLINE;
+}
+
+void ap_jobs_stop(void)
+{
+	struct ap_job *job;
+	int i;
+
+	spin_lock(&ap_job_lock);
+	jobs_stopped = 1;
+	spin_unlock(&ap_job_lock);
+
+	for (i = 1; i < CONFIG_MAX_CPUS; i++)
+		mailboxes[i].stop = 1;
+
+	/* Whatever is still queued runs here rather than waiting for an AP
+	 * to finish its current job. */
+	while (1) {
+		spin_lock(&ap_job_lock);
+		job = ap_job_take();
+		spin_unlock(&ap_job_lock);
+		if (job == NULL)
+			break;
+		ap_job_run(job, 0);
+	}
+
+	for (i = 1; i < CONFIG_MAX_CPUS; i++) {
+		while (mailboxes[i].state != AP_OFFLINE)
+			cpu_relax();
+	}
+}
+
+/* The APs run in memory the OS or the payload is about to take over. */
+static void ap_jobs_stop_cb(void *unused)
+{
+	ap_jobs_stop();
+}
+
+BOOT_STATE_INIT_ENTRIES(ap_jobs_bscb) = {
+	BOOT_STATE_INIT_ENTRY(BS_OS_RESUME, BS_ON_ENTRY,
+	                      ap_jobs_stop_cb, NULL),
+	BOOT_STATE_INIT_ENTRY(BS_PAYLOAD_BOOT, BS_ON_ENTRY,
+	                      ap_jobs_stop_cb, NULL),
+};
@@ -104,6 +104,8 @@ void udelay(u32 usecs)
 {
 	u32 start, value, ticks, timer_fsb;
 
+	console_poll();
+
 	if (!thread_yield_microseconds(usecs))
 		return;
 
@@ -20,6 +20,7 @@
  * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <cpu/x86/ap_jobs.h>
 #include <cpu/x86/cr.h>
 #include <cpu/x86/lapic.h>
 #include <delay.h>
@@ -427,6 +428,9 @@ void asmlinkage secondary_cpu_init(unsigned int index)
 
 	atomic_dec(&active_cpus);
 
+	/* Help out the BSP until the payload or the OS takes over. */
+	ap_jobs_run(index);
+
 	stop_this_cpu();
 }
 
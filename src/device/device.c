@@ -228,61 +228,102 @@ static void read_resources(struct bus *bus)
 	       dev_path(bus->dev), bus->secondary, bus->link_num);
 }
 
-struct pick_largest_state {
-	struct resource *last;
-	struct device *result_dev;
-	struct resource *result;
-	int seen_last;
+struct sorted_resource {
+	struct device *dev;
+	struct resource *res;
 };
 
-static void pick_largest_resource(void *gp, struct device *dev,
-				  struct resource *resource)
+/*
+ * The resources of the bus being placed, ordered the way they are placed.
+ * compute_resources() and allocate_resources() only use this around loops
+ * that don't recurse, so one list serves the whole tree. It grows as
+ * needed and stays allocated for the next bus.
+ */
+static struct {
+	struct sorted_resource *list;
+	struct sorted_resource *tmp;
+	unsigned int count;
+	unsigned int max;
+} sorted;
+
+static void add_sorted_resource(void *gp, struct device *dev,
+				struct resource *resource)
 {
-	struct pick_largest_state *state = gp;
-	struct resource *last;
+	struct sorted_resource *list;
+	unsigned int max;
 
-	last = state->last;
-
-	/* Be certain to pick the successor to last. */
-	if (resource == last) {
-		state->seen_last = 1;
-		return;
-	}
 	if (resource->flags & IORESOURCE_FIXED)
 		return;	/* Skip it. */
-	if (last && ((last->align < resource->align) ||
-		     ((last->align == resource->align) &&
-		      (last->size < resource->size)) ||
-		     ((last->align == resource->align) &&
-		      (last->size == resource->size) && (!state->seen_last)))) {
-		return;
-	}
-	if (!state->result ||
-	    (state->result->align < resource->align) ||
-	    ((state->result->align == resource->align) &&
-	     (state->result->size < resource->size))) {
-		state->result_dev = dev;
-		state->result = resource;
+
+	if (sorted.count == sorted.max) {
+		max = sorted.max ? sorted.max * 2 : 64;
+		list = malloc(2 * max * sizeof(*list));
+		if (sorted.count)
+			memcpy(list, sorted.list,
+			       sorted.count * sizeof(*list));
+		sorted.list = list;
+		sorted.tmp = list + max;
+		sorted.max = max;
 	}
+
+	sorted.list[sorted.count].dev = dev;
+	sorted.list[sorted.count].res = resource;
+	sorted.count++;
 }
 
-static struct device *largest_resource(struct bus *bus,
-				       struct resource **result_res,
+/* Largest alignment first, then largest size. */
+static int resource_before(const struct resource *a, const struct resource *b)
+{
+	if (a->align != b->align)
+		return a->align > b->align;
+	return a->size > b->size;
+}
+
+/**
+ * Collect the non-fixed resources below a bus and sort them.
+ *
+ * The sort is a stable merge sort, so resources that are equal in
+ * alignment and size stay in the order search_bus_resources() finds them.
+ * That is the order the allocator always placed them in, just without
+ * walking the whole bus again for every resource.
+ *
+ * @param bus The bus we are traversing.
+ * @param type_mask This value gets ANDed with the resource type.
+ * @param type This value must match the result of the AND.
+ * @return The number of resources in sorted.list.
+ */
+static unsigned int sort_bus_resources(struct bus *bus,
 				       unsigned long type_mask,
 				       unsigned long type)
 {
-	struct pick_largest_state state;
-
-	state.last = *result_res;
-	state.result_dev = NULL;
-	state.result = NULL;
-	state.seen_last = 0;
-
-	search_bus_resources(bus, type_mask, type, pick_largest_resource,
-			     &state);
+	struct sorted_resource *src, *dst, *swap;
+	unsigned int width, lo, mid, hi, i, j, k;
+
+	sorted.count = 0;
+	search_bus_resources(bus, type_mask, type, add_sorted_resource, NULL);
+
+	src = sorted.list;
+	dst = sorted.tmp;
+	for (width = 1; width < sorted.count; width *= 2) {
+		for (lo = 0; lo < sorted.count; lo += 2 * width) {
+			mid = MIN(lo + width, sorted.count);
+			hi = MIN(lo + 2 * width, sorted.count);
+			for (i = lo, j = mid, k = lo; k < hi; k++) {
+				if (i < mid && (j >= hi ||
+				    !resource_before(src[j].res, src[i].res)))
+					dst[k] = src[i++];
+				else
+					dst[k] = src[j++];
+			}
+		}
+		swap = src;
+		src = dst;
+		dst = swap;
+	}
+	if (src != sorted.list)
+		memcpy(sorted.list, src, sorted.count * sizeof(*src));
 
-	*result_res = state.result;
-	return state.result_dev;
+	return sorted.count;
 }
 
 /**
@@ -323,6 +364,7 @@ static void compute_resources(struct bus *bus, struct resource *bridge,
 {
 	struct device *dev;
 	struct resource *resource;
+	unsigned int count, i;
 	resource_t base;
 	base = round(bridge->base, bridge->align);
 
@@ -373,15 +415,15 @@ static void compute_resources(struct bus *bus, struct resource *bridge,
 		}
 	}
 
-	/* Remember we haven't found anything yet. */
-	resource = NULL;
-
 	/*
-	 * Walk through all the resources on the current bus and compute the
-	 * amount of address space taken by them. Take granularity and
-	 * alignment into account.
+	 * Walk through all the resources on the current bus, largest first,
+	 * and compute the amount of address space taken by them. Take
+	 * granularity and alignment into account.
 	 */
-	while ((dev = largest_resource(bus, &resource, type_mask, type))) {
+	count = sort_bus_resources(bus, type_mask, type);
+	for (i = 0; i < count; i++) {
+		dev = sorted.list[i].dev;
+		resource = sorted.list[i].res;
 
 		/* Size 0 resources can be skipped. */
 		if (!resource->size)
@@ -471,6 +513,7 @@ static void allocate_resources(struct bus *bus, struct resource *bridge,
 {
 	struct device *dev;
 	struct resource *resource;
+	unsigned int count, i;
 	resource_t base;
 	base = bridge->base;
 
@@ -480,14 +523,14 @@ static void allocate_resources(struct bus *bus, struct resource *bridge,
 	       "prefmem" : "mem",
 	       base, bridge->size, bridge->align, bridge->gran, bridge->limit);
 
-	/* Remember we haven't found anything yet. */
-	resource = NULL;
-
 	/*
-	 * Walk through all the resources on the current bus and allocate them
-	 * address space.
+	 * Walk through all the resources on the current bus, largest first,
+	 * and allocate them address space.
 	 */
-	while ((dev = largest_resource(bus, &resource, type_mask, type))) {
+	count = sort_bus_resources(bus, type_mask, type);
+	for (i = 0; i < count; i++) {
+		dev = sorted.list[i].dev;
+		resource = sorted.list[i].res;
 
 		/* Propagate the bridge limit to the resource register. */
 		if (resource->limit > bridge->limit)
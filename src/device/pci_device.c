@@ -35,6 +35,7 @@
 #include <device/pci_ids.h>
 #include <bootmode.h>
 #include <delay.h>
+#include <timer.h>
 #if CONFIG_HYPERTRANSPORT_PLUGIN_SUPPORT
 #include <device/hypertransport.h>
 #endif
@@ -997,6 +998,7 @@ device_t pci_probe_dev(device_t dev, struct bus *bus, unsigned devfn)
 		dummy.bus = bus;
 		dummy.path.type = DEVICE_PATH_PCI;
 		dummy.path.pci.devfn = devfn;
+		dummy.hdr_cache_on = 0;
 
 		id = pci_read_config32(&dummy, PCI_VENDOR_ID);
 		/*
@@ -1013,6 +1015,10 @@ device_t pci_probe_dev(device_t dev, struct bus *bus, unsigned devfn)
 			return NULL;
 		}
 		dev = alloc_dev(bus, &dummy.path);
+
+		pci_hdr_cache_start(dev);
+		dev->hdr_cache[PCI_VENDOR_ID >> 2] = id;
+		dev->hdr_cache_valid = 1 << (PCI_VENDOR_ID >> 2);
 	} else {
 		/*
 		 * Enable/disable the device. Once we have found the device-
@@ -1026,10 +1032,13 @@ device_t pci_probe_dev(device_t dev, struct bus *bus, unsigned devfn)
 		 * it may be absent and enable_dev() must cope.
 		 */
 		/* Run the magic enable sequence for the device. */
-		if (dev->chip_ops && dev->chip_ops->enable_dev)
+		if (dev->chip_ops && dev->chip_ops->enable_dev) {
 			dev->chip_ops->enable_dev(dev);
+			pci_hdr_cache_drop_bus(bus);
+		}
 
 		/* Now read the vendor and device ID. */
+		pci_hdr_cache_start(dev);
 		id = pci_read_config32(dev, PCI_VENDOR_ID);
 
 		/*
@@ -1074,8 +1083,10 @@ device_t pci_probe_dev(device_t dev, struct bus *bus, unsigned devfn)
 	set_pci_ops(dev);
 
 	/* Now run the magic enable/disable sequence for the device. */
-	if (dev->ops && dev->ops->enable)
+	if (dev->ops && dev->ops->enable) {
 		dev->ops->enable(dev);
+		pci_hdr_cache_drop_bus(bus);
+	}
 
 	/* Display the device. */
 	printk(BIOS_DEBUG, "%s [%04x/%04x] %s%s\n", dev_path(dev),
@@ -1119,6 +1130,11 @@ unsigned int pci_scan_bus(struct bus *bus, unsigned min_devfn,
 	unsigned int devfn;
 	struct device *old_devices;
 	struct device *child;
+#if CONFIG_HAVE_MONOTONIC_TIMER
+	struct mono_time start, end;
+
+	timer_monotonic_get(&start);
+#endif
 
 #if CONFIG_PCI_BUS_SEGN_BITS
 	printk(BIOS_DEBUG, "PCI: pci_scan_bus for bus %04x:%02x\n",
@@ -1187,6 +1203,15 @@ unsigned int pci_scan_bus(struct bus *bus, unsigned min_devfn,
 	for (child = bus->children; child; child = child->sibling)
 		max = scan_bus(child, max);
 
+	for (child = bus->children; child; child = child->sibling)
+		pci_hdr_cache_stop(child);
+
+#if CONFIG_HAVE_MONOTONIC_TIMER
+	timer_monotonic_get(&end);
+	printk(BIOS_INFO, "PCI: bus %02x and below scanned in %ld usecs\n",
+	       bus->secondary, mono_time_diff_microseconds(&start, &end));
+#endif
+
 	/*
 	 * We've scanned the bus and so we know all about what's on the other
 	 * side of any bridges that may be on this bus plus any devices.
@@ -25,10 +25,28 @@
 #include <device/pci_ids.h>
 #include <device/pci_ops.h>
 
+#if CONFIG_MMCONF_SUPPORT && !CONFIG_MMCONF_SUPPORT_DEFAULT
+unsigned int __attribute__((weak)) pci_mmconf_buses(void)
+{
+	return 0;
+}
+#endif
+
 const struct pci_bus_operations *pci_bus_default_ops(device_t dev)
 {
 #if CONFIG_MMCONF_SUPPORT_DEFAULT
 	return &pci_ops_mmconf;
+#elif CONFIG_MMCONF_SUPPORT
+	static int mmconf_buses = -1;
+
+	if (mmconf_buses < 0) {
+		mmconf_buses = pci_mmconf_buses();
+		printk(BIOS_DEBUG, "PCI: Using MMCONFIG for %d buses\n",
+		       mmconf_buses);
+	}
+	if (dev && dev->bus && dev->bus->secondary < mmconf_buses)
+		return &pci_ops_mmconf;
+	return &pci_cf8_conf1;
 #else
 	return &pci_cf8_conf1;
 #endif
@@ -82,23 +100,108 @@ static struct bus *get_pbus(device_t dev)
 	return pbus;
 }
 
+/*
+ * While a bus is scanned the registers of the standard header that only
+ * software changes are kept in the device, so the probe, the driver and
+ * bridge lookups and the capability walks read each of them once. Command,
+ * status and the bridge secondary status are always read from the device.
+ * A write to the header drops the dword written, a write anywhere else all
+ * of them, as chipset registers may change the header.
+ */
+#define PCI_HDR_CACHE_SIZE	(sizeof(((struct device *)0)->hdr_cache))
+#define PCI_HDR_CACHED \
+	((1 << (PCI_VENDOR_ID >> 2)) | (1 << (PCI_CLASS_REVISION >> 2)) | \
+	 (1 << (PCI_CACHE_LINE_SIZE >> 2)) | \
+	 (1 << (PCI_SUBSYSTEM_VENDOR_ID >> 2)) | \
+	 (1 << (PCI_CAPABILITY_LIST >> 2)) | (1 << (PCI_INTERRUPT_LINE >> 2)))
+
+void pci_hdr_cache_start(device_t dev)
+{
+	dev->hdr_cache_valid = 0;
+	dev->hdr_cache_on = 1;
+}
+
+void pci_hdr_cache_stop(device_t dev)
+{
+	dev->hdr_cache_on = 0;
+	dev->hdr_cache_valid = 0;
+}
+
+/*
+ * Chip enable hooks may rewrite the config space of the other devices on
+ * the bus with raw accesses, which bypass the cache: the SB800 runs the
+ * CIMx sbBeforePciInit from the enable of 0:16.2, after 0:11.0 to 0:14.x
+ * were probed. Forget what was read for all of them.
+ */
+void pci_hdr_cache_drop_bus(struct bus *bus)
+{
+	struct device *child;
+
+	for (child = bus->children; child; child = child->sibling)
+		child->hdr_cache_valid = 0;
+}
+
+static int pci_hdr_cached(device_t dev, unsigned int where)
+{
+	return dev->hdr_cache_on && where < PCI_HDR_CACHE_SIZE &&
+		(PCI_HDR_CACHED & (1 << (where >> 2)));
+}
+
+static u32 pci_hdr_cache_read(device_t dev, unsigned int where)
+{
+	unsigned int n = where >> 2;
+	struct bus *pbus;
+
+	if (!(dev->hdr_cache_valid & (1 << n))) {
+		pbus = get_pbus(dev);
+		dev->hdr_cache[n] = pci_bus_ops(pbus, dev)->read32(pbus,
+				dev->bus->secondary, dev->path.pci.devfn,
+				where & ~3);
+		dev->hdr_cache_valid |= 1 << n;
+	}
+	return dev->hdr_cache[n] >> ((where & 3) * 8);
+}
+
+static void pci_hdr_cache_drop(device_t dev, unsigned int where)
+{
+	if (where < PCI_HDR_CACHE_SIZE)
+		dev->hdr_cache_valid &= ~(1 << (where >> 2));
+	else
+		dev->hdr_cache_valid = 0;
+}
+
 u8 pci_read_config8(device_t dev, unsigned int where)
 {
-	struct bus *pbus = get_pbus(dev);
+	struct bus *pbus;
+
+	if (pci_hdr_cached(dev, where))
+		return pci_hdr_cache_read(dev, where);
+
+	pbus = get_pbus(dev);
 	return pci_bus_ops(pbus, dev)->read8(pbus, dev->bus->secondary,
 					dev->path.pci.devfn, where);
 }
 
 u16 pci_read_config16(device_t dev, unsigned int where)
 {
-	struct bus *pbus = get_pbus(dev);
+	struct bus *pbus;
+
+	if (pci_hdr_cached(dev, where))
+		return pci_hdr_cache_read(dev, where & ~1);
+
+	pbus = get_pbus(dev);
 	return pci_bus_ops(pbus, dev)->read16(pbus, dev->bus->secondary,
 					 dev->path.pci.devfn, where);
 }
 
 u32 pci_read_config32(device_t dev, unsigned int where)
 {
-	struct bus *pbus = get_pbus(dev);
+	struct bus *pbus;
+
+	if (pci_hdr_cached(dev, where))
+		return pci_hdr_cache_read(dev, where & ~3);
+
+	pbus = get_pbus(dev);
 	return pci_bus_ops(pbus, dev)->read32(pbus, dev->bus->secondary,
 					 dev->path.pci.devfn, where);
 }
@@ -106,6 +209,7 @@ u32 pci_read_config32(device_t dev, unsigned int where)
 void pci_write_config8(device_t dev, unsigned int where, u8 val)
 {
 	struct bus *pbus = get_pbus(dev);
+	pci_hdr_cache_drop(dev, where);
 	pci_bus_ops(pbus, dev)->write8(pbus, dev->bus->secondary,
 				  dev->path.pci.devfn, where, val);
 }
@@ -113,6 +217,7 @@ void pci_write_config8(device_t dev, unsigned int where, u8 val)
 void pci_write_config16(device_t dev, unsigned int where, u16 val)
 {
 	struct bus *pbus = get_pbus(dev);
+	pci_hdr_cache_drop(dev, where);
 	pci_bus_ops(pbus, dev)->write16(pbus, dev->bus->secondary,
 				   dev->path.pci.devfn, where, val);
 }
@@ -120,6 +225,7 @@ void pci_write_config16(device_t dev, unsigned int where, u16 val)
 void pci_write_config32(device_t dev, unsigned int where, u32 val)
 {
 	struct bus *pbus = get_pbus(dev);
+	pci_hdr_cache_drop(dev, where);
 	pci_bus_ops(pbus, dev)->write32(pbus, dev->bus->secondary,
 				   dev->path.pci.devfn, where, val);
 }
@@ -149,6 +255,7 @@ u32 pci_mmio_read_config32(device_t dev, unsigned int where)
 void pci_mmio_write_config8(device_t dev, unsigned int where, u8 val)
 {
 	struct bus *pbus = get_pbus(dev);
+	pci_hdr_cache_drop(dev, where);
 	pci_ops_mmconf.write8(pbus, dev->bus->secondary, dev->path.pci.devfn,
 			      where, val);
 }
@@ -156,6 +263,7 @@ void pci_mmio_write_config8(device_t dev, unsigned int where, u8 val)
 void pci_mmio_write_config16(device_t dev, unsigned int where, u16 val)
 {
 	struct bus *pbus = get_pbus(dev);
+	pci_hdr_cache_drop(dev, where);
 	pci_ops_mmconf.write16(pbus, dev->bus->secondary, dev->path.pci.devfn,
 			       where, val);
 }
@@ -163,6 +271,7 @@ void pci_mmio_write_config16(device_t dev, unsigned int where, u16 val)
 void pci_mmio_write_config32(device_t dev, unsigned int where, u32 val)
 {
 	struct bus *pbus = get_pbus(dev);
+	pci_hdr_cache_drop(dev, where);
 	pci_ops_mmconf.write32(pbus, dev->bus->secondary, dev->path.pci.devfn,
 			       where, val);
 }
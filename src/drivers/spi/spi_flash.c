@@ -351,3 +351,110 @@ err_read_id:
 err_claim_bus:
 	return NULL;
 }
+
+/*
+ * Program the dirty runs of one sector. When the sector was just erased
+ * every byte that is not 0xff is dirty, otherwise only the bytes that differ
+ * from the current contents. Runs separated by less than one program chunk
+ * are merged, since re-programming an unchanged byte is harmless and a
+ * separate command would cost more than the few extra bytes.
+ */
+static int spi_flash_program_dirty(struct spi_flash *flash, u32 offset,
+		const u8 *data, const u8 *current, size_t len, int erased)
+{
+	size_t start, end, gap;
+	int ret;
+
+	for (start = 0; start < len; start = end) {
+		while (start < len && (erased ? data[start] == 0xff :
+				       data[start] == current[start]))
+			start++;
+		if (start == len)
+			break;
+
+		for (end = start + 1, gap = 0;
+		     end < len && gap < SPI_FLASH_PROG_CHUNK; end++) {
+			if (erased ? data[end] == 0xff :
+			    data[end] == current[end])
+				gap++;
+			else
+				gap = 0;
+		}
+		end -= gap;
+
+		while (start < end) {
+			size_t chunk = min(end - start, SPI_FLASH_PROG_CHUNK);
+
+			ret = flash->write(flash, offset + start, chunk,
+					   data + start);
+			if (ret)
+				return ret;
+			start += chunk;
+		}
+	}
+	return 0;
+}
+
+int spi_flash_update(struct spi_flash *flash, u32 offset, size_t len,
+		const void *buf, const void *current)
+{
+	static u8 *sector_buf;
+	static u32 sector_buf_size;
+	const u8 *data = buf;
+	const u8 *old = current;
+	u32 sector = flash->sector_size;
+	u32 sector_start, skip;
+	size_t chunk, i;
+	int erase, ret;
+
+	while (len) {
+		sector_start = offset - (offset % sector);
+		skip = offset - sector_start;
+		chunk = min(len, sector - skip);
+
+		if (memcmp(old, data, chunk) == 0)
+			goto next;
+
+		/* NOR flash can only clear bits without an erase. */
+		for (erase = 0, i = 0; i < chunk; i++) {
+			if (data[i] & ~old[i]) {
+				erase = 1;
+				break;
+			}
+		}
+
+		if (!erase) {
+			ret = spi_flash_program_dirty(flash, offset, data,
+						      old, chunk, 0);
+			if (ret)
+				return ret;
+			goto next;
+		}
+
+		/* Preserve the rest of the sector across the erase. */
+		if (sector_buf_size < sector) {
+			sector_buf = malloc(sector);
+			if (!sector_buf) {
+				sector_buf_size = 0;
+				return -1;
+			}
+			sector_buf_size = sector;
+		}
+		memcpy(sector_buf, old - skip, sector);
+		memcpy(sector_buf + skip, data, chunk);
+
+		ret = flash->erase(flash, sector_start, sector);
+		if (ret)
+			return ret;
+		ret = spi_flash_program_dirty(flash, sector_start, sector_buf,
+					      NULL, sector, 1);
+		if (ret)
+			return ret;
+next:
+		offset += chunk;
+		data += chunk;
+		old += chunk;
+		len -= chunk;
+	}
+	return 0;
+}
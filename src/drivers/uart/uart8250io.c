@@ -20,6 +20,7 @@
 
 #include <rules.h>
 #include <stdlib.h>
+#include <string.h>
 #include <arch/io.h>
 #include <console/uart.h>
 #include <trace.h>
@@ -46,17 +47,21 @@
 #define SINGLE_CHAR_TIMEOUT	(50 * 1000)
 #define FIFO_TIMEOUT		(16 * SINGLE_CHAR_TIMEOUT)
 
+#define UART_TX_BUFFERED	(CONFIG_CONSOLE_SERIAL_BUFFERED && ENV_RAMSTAGE)
+
 static int uart8250_can_tx_byte(unsigned base_port)
 {
 	return inb(base_port + UART_LSR) & UART_LSR_THRE;
 }
 
+#if !UART_TX_BUFFERED
 static void uart8250_tx_byte(unsigned base_port, unsigned char data)
 {
 	unsigned long int i = SINGLE_CHAR_TIMEOUT;
 	while (i-- && !uart8250_can_tx_byte(base_port));
 	outb(data, base_port + UART_TBR);
 }
+#endif
 
 static void uart8250_tx_flush(unsigned base_port)
 {
@@ -64,6 +69,89 @@ static void uart8250_tx_flush(unsigned base_port)
 	while (i-- && !(inb(base_port + UART_LSR) & UART_LSR_TEMT));
 }
 
+#if UART_TX_BUFFERED
+/* In ramstage the output goes into a ring buffer first. It is moved into
+ * the FIFO a FIFO full at a time whenever the transmitter is empty, so the
+ * caller only waits for the UART when the buffer is full.
+ */
+#define UART_FIFO_SIZE		16
+#define TX_RING_MASK		(CONFIG_CONSOLE_SERIAL_BUFFER_SIZE - 1)
+
+#if CONFIG_CONSOLE_SERIAL_BUFFER_SIZE & TX_RING_MASK
+#error "CONFIG_CONSOLE_SERIAL_BUFFER_SIZE must be a power of 2"
+#endif
+
+/* head and tail run freely, tail - head bytes are waiting. */
+static struct {
+	unsigned int head;
+	unsigned int tail;
+	unsigned char data[CONFIG_CONSOLE_SERIAL_BUFFER_SIZE];
+} tx_ring;
+
+static void uart8250_tx_fill(unsigned base_port)
+{
+	unsigned int n;
+
+	for (n = 0; n < UART_FIFO_SIZE && tx_ring.head != tx_ring.tail; n++)
+		outb(tx_ring.data[tx_ring.head++ & TX_RING_MASK],
+		     base_port + UART_TBR);
+}
+
+/* With the FIFO enabled THRE is set once the whole FIFO is empty. */
+static void uart8250_tx_poll(unsigned base_port)
+{
+	if (tx_ring.head != tx_ring.tail && uart8250_can_tx_byte(base_port))
+		uart8250_tx_fill(base_port);
+}
+
+static void uart8250_tx_wait_fill(unsigned base_port)
+{
+	unsigned long int i = FIFO_TIMEOUT;
+	while (i-- && !uart8250_can_tx_byte(base_port));
+	uart8250_tx_fill(base_port);
+}
+
+static void uart8250_tx_queue(unsigned base_port, unsigned char data)
+{
+	if (tx_ring.tail - tx_ring.head == CONFIG_CONSOLE_SERIAL_BUFFER_SIZE)
+		uart8250_tx_wait_fill(base_port);
+	tx_ring.data[tx_ring.tail++ & TX_RING_MASK] = data;
+}
+
+static void uart8250_tx_queue_bytes(unsigned base_port,
+				    const unsigned char *data, size_t len)
+{
+	unsigned int pos, n;
+
+	while (len) {
+		if (tx_ring.tail - tx_ring.head ==
+		    CONFIG_CONSOLE_SERIAL_BUFFER_SIZE)
+			uart8250_tx_wait_fill(base_port);
+
+		/* Up to the end of the free space or of the buffer. */
+		pos = tx_ring.tail & TX_RING_MASK;
+		n = CONFIG_CONSOLE_SERIAL_BUFFER_SIZE -
+			(tx_ring.tail - tx_ring.head);
+		if (n > CONFIG_CONSOLE_SERIAL_BUFFER_SIZE - pos)
+			n = CONFIG_CONSOLE_SERIAL_BUFFER_SIZE - pos;
+		if (n > len)
+			n = len;
+
+		memcpy(&tx_ring.data[pos], data, n);
+		tx_ring.tail += n;
+		data += n;
+		len -= n;
+	}
+}
+
+static void uart8250_tx_drain(unsigned base_port)
+{
+	while (tx_ring.head != tx_ring.tail)
+		uart8250_tx_wait_fill(base_port);
+	uart8250_tx_flush(base_port);
+}
+#endif
+
 static int uart8250_can_rx_byte(unsigned base_port)
 {
 	return inb(base_port + UART_LSR) & UART_LSR_DR;
@@ -122,7 +210,23 @@ void uart_init(int idx)
 
 void uart_tx_byte(int idx, unsigned char data)
 {
+#if UART_TX_BUFFERED
+	uart8250_tx_queue(uart_platform_base(idx), data);
+#else
 	uart8250_tx_byte(uart_platform_base(idx), data);
+#endif
+}
+
+void uart_tx_bytes(int idx, const unsigned char *data, size_t len)
+{
+#if UART_TX_BUFFERED
+	uart8250_tx_queue_bytes(uart_platform_base(idx), data, len);
+#else
+	unsigned base_port = uart_platform_base(idx);
+
+	while (len--)
+		uart8250_tx_byte(base_port, *data++);
+#endif
 }
 
 unsigned char uart_rx_byte(int idx)
@@ -130,9 +234,25 @@ unsigned char uart_rx_byte(int idx)
 	return uart8250_rx_byte(uart_platform_base(idx));
 }
 
+/* Buffered output is only passed on as far as the FIFO takes it, use
+ * uart_tx_drain() to wait until all of it is sent.
+ */
 void uart_tx_flush(int idx)
 {
+#if UART_TX_BUFFERED
+	uart8250_tx_poll(uart_platform_base(idx));
+#else
 	uart8250_tx_flush(uart_platform_base(idx));
+#endif
+}
+
+void uart_tx_drain(int idx)
+{
+#if UART_TX_BUFFERED
+	uart8250_tx_drain(uart_platform_base(idx));
+#else
+	uart8250_tx_flush(uart_platform_base(idx));
+#endif
 }
 
 #if ENV_RAMSTAGE
@@ -63,6 +63,7 @@
 
 #define CBFS_COMPRESS_NONE  0
 #define CBFS_COMPRESS_LZMA  1
+#define CBFS_COMPRESS_LZ4   2
 
 /** These are standard component types for well known
     components (i.e - those that coreboot needs to consume.
@@ -222,6 +223,16 @@ struct cbfs_media {
 /* returns pointer to a file entry inside CBFS or NULL */
 struct cbfs_file *cbfs_get_file(struct cbfs_media *media, const char *name);
 
+#define CBFS_INVALID_OFFSET	0xffffffff
+
+/* Finds file 'name' without mapping it. Returns the media offset of its
+ * header and copies the header to *file, or CBFS_INVALID_OFFSET. When *media
+ * is CBFS_DEFAULT_MEDIA, default_media is initialized and *media points to
+ * it on return, so the caller can read the file contents through it. */
+uint32_t cbfs_locate_file(struct cbfs_media **media,
+			  struct cbfs_media *default_media, const char *name,
+			  struct cbfs_file *file);
+
 /* returns pointer to file content inside CBFS after if type is correct */
 void *cbfs_get_file_content(struct cbfs_media *media, const char *name,
 			    int type, size_t *sz);
@@ -239,6 +250,36 @@ const struct cbfs_header *cbfs_get_header(struct cbfs_media *media);
  */
 char *cbfs_find_string(const char *string, const char *filename);
 
+/* Directory index of the default CBFS media. It is built by a single walk
+ * over all file headers on the first lookup, after which cbfs_get_file()
+ * resolves names without scanning the flash again. Every hit is verified
+ * against the file header it points to, so a stale index (e.g. one recovered
+ * from memory after the ROM was reflashed) only costs a rebuild. */
+#define CBFS_INDEX_MAGIC	0x58444e49	/* "INDX" */
+#define CBFS_INDEX_COMPLETE	(1 << 0)
+
+struct cbfs_index_entry {
+	uint32_t hash;		/* FNV-1a hash of the file name */
+	uint32_t offset;	/* media offset of the file header */
+	uint32_t data_offset;	/* file.offset: header + name length */
+	uint32_t len;
+	uint32_t type;
+};
+
+struct cbfs_index {
+	uint32_t magic;
+	uint32_t flags;
+	uint32_t first_offset;	/* header->offset the index was built for */
+	uint32_t romsize;	/* header->romsize the index was built for */
+	uint32_t count;
+	/* sorted by hash, equal hashes in media order */
+	struct cbfs_index_entry entries[CONFIG_CBFS_INDEX_ENTRIES];
+};
+
+/* Returns the index storage for the current stage, or NULL if there is none.
+ * Defined by the environment that enables CBFS_CORE_WITH_INDEX. */
+struct cbfs_index *cbfs_get_index(void);
+
 #endif /* __ROMCC__ */
 
 #endif
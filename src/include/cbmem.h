@@ -67,6 +67,7 @@
 #define CBMEM_ID_AGESA_RUNTIME	0x41474553
 #define CBMEM_ID_HOB_POINTER		0x484f4221
 #define CBMEM_ID_BOOTORDER		0x424f4f54
+#define CBMEM_ID_CBFS_INDEX		0x43424958
 
 #ifndef __ASSEMBLER__
 #include <stddef.h>
@@ -81,24 +82,27 @@ struct cbmem_entry;
  * things are added. It requires an external function, cbmem_top(), to be
  * implemented by the board or chipset to define the upper address where
  * cbmem lives. This address is required to be a 32-bit address. Additionally,
- * the address needs to be consistent in both romstage and ramstage.  The
- * dynamic cbmem infrastructure allocates new regions below the last allocated
- * region. Regions are defined by a cbmem_entry struct that is opaque. Regions
- * may be removed, but the last one added is the only that can be removed.
+ * the address needs to be consistent in both romstage and ramstage. Regions
+ * are defined by a cbmem_entry struct that is opaque. Any region may be
+ * removed or resized.
  *
- * Dynamic cbmem has two allocators within it. All allocators use a top down
- * allocation scheme. However, there are 2 modes for each allocation depending
- * on the requested size. There are large allocations and small allocations.
- * An allocation is considered to be small when it is less than or equal to
- * DYN_CBMEM_ALIGN_SIZE / 2. The smaller allocations are fit into a larger
- * allocation region.
+ * The regions are kept in a directory just below cbmem_top() (see
+ * cbmem_dir.h), which is looked up by binary search. New regions go to the
+ * highest free place below the directory, so holes left by removed regions
+ * are reused.
+ *
+ * With EARLY_CBMEM_INIT romstage creates cbmem right after raminit and
+ * ramstage recovers it. Without it cbmem is created in ramstage, and
+ * romstage only recovers it on S3 resume with cbmem_recovery(1). The
+ * pcengines/apu is such a board, so the romstage creation is not used in
+ * this tree.
  */
 
-#define DYN_CBMEM_ALIGN_SIZE (4096)
-
+#if CONFIG_EARLY_CBMEM_INIT || !defined(__PRE_RAM__)
 /* By default cbmem is attempted to be recovered. Returns 0 if cbmem was
  * recovered or 1 if cbmem had to be reinitialized. */
 int cbmem_initialize(void);
+#endif
 /* Initialize cbmem to be empty. */
 void cbmem_initialize_empty(void);
 
@@ -116,10 +120,14 @@ const struct cbmem_entry *cbmem_entry_add(u32 id, u64 size);
 const struct cbmem_entry *cbmem_entry_find(u32 id);
 
 /* Remove a region defined by a cbmem_entry. Returns 0 on success, < 0 on
- * error. Note: A cbmem_entry cannot be removed unless it was the last one
- * added. */
+ * error. */
 int cbmem_entry_remove(const struct cbmem_entry *entry);
 
+/* Resize a region defined by a cbmem_entry. The contents are kept, but the
+ * region may move when it grows, so its start has to be looked up again.
+ * Returns 0 on success, < 0 on error. */
+int cbmem_entry_resize(const struct cbmem_entry *entry, u64 size);
+
 /* cbmem_entry accessors to get pointer and size of a cbmem_entry. */
 void *cbmem_entry_start(const struct cbmem_entry *entry);
 u64 cbmem_entry_size(const struct cbmem_entry *entry);
@@ -139,15 +147,20 @@ u64 cbmem_entry_size(const struct cbmem_entry *entry);
 #define _CBMEM_SZ_RESUME	0
 #endif
 
+#if CONFIG_HAVE_ACPI_RESUME && CONFIG_RAMSTAGE_CACHE
+#define _CBMEM_SZ_RAMSTAGE_CACHE	CONFIG_RAMSTAGE_CACHE_SIZE
+#else
+#define _CBMEM_SZ_RAMSTAGE_CACHE	0
+#endif
+
 #define _CBMEM_SZ_TOTAL	\
-	(_CBMEM_SZ_MINIMAL + _CBMEM_SZ_RESUME + CONFIG_CONSOLE_CBMEM_BUFFER_SIZE)
+	(_CBMEM_SZ_MINIMAL + _CBMEM_SZ_RESUME + _CBMEM_SZ_RAMSTAGE_CACHE + \
+	 CONFIG_CONSOLE_CBMEM_BUFFER_SIZE)
 
 #define HIGH_MEMORY_SIZE	ALIGN_UP(_CBMEM_SZ_TOTAL, 0x10000)
 
 
 #ifndef __PRE_RAM__
-void set_top_of_ram(uint64_t ramtop);
-void backup_top_of_ram(uint64_t ramtop);
 void cbmem_late_set_table(uint64_t base, uint64_t size);
 #endif
 
@@ -164,6 +177,12 @@ static inline const struct cbmem_entry *cbmem_entry_find(uint32_t id)
 
 unsigned long get_top_of_ram(void);
 
+#ifndef __PRE_RAM__
+/* Called by the northbridge once it knows where usable RAM ends. */
+void set_top_of_ram(uint64_t ramtop);
+void backup_top_of_ram(uint64_t ramtop);
+#endif
+
 /* Returns 0 if old cbmem was recovered. Recovery is only attempted if
  * s3resume is non-zero. */
 int cbmem_recovery(int s3resume);
@@ -0,0 +1,116 @@
+/*
+ * This file is part of the coreboot project.
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#ifndef CBMEM_DIR_H
+#define CBMEM_DIR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * The directory behind dynamic cbmem. It lives in the CBMEM_DIR_ROOT_SIZE
+ * bytes just below the top, the entries are allocated below it. Entries
+ * are stored as offsets from the top, so a directory can be recovered no
+ * matter where it was created from.
+ *
+ * The entries stay in the slot they were added to, so an entry pointer is
+ * valid until that entry is removed. Lookups go through an index of the
+ * slots sorted by id, which is binary searched.
+ *
+ * Allocation is first fit from the top, so the holes left by removed or
+ * shrunk entries are reused and the directory otherwise grows down. Small
+ * entries are aligned to CBMEM_DIR_ALIGN, entries of at least
+ * CBMEM_DIR_LARGE_ALIGN to that. Nothing is allocated more than limit
+ * bytes below the top.
+ *
+ * There is no locking and no dependency on the rest of coreboot, the same
+ * code runs in a host test harness (util/cbmemtest).
+ */
+
+#define CBMEM_DIR_MAGIC		0x434d4452
+#define CBMEM_DIR_ENTRIES	64
+#define CBMEM_DIR_ROOT_SIZE	4096
+#define CBMEM_DIR_ALIGN		32
+#define CBMEM_DIR_LARGE_ALIGN	4096
+
+struct cbmem_entry {
+	uint32_t id;
+	/* The entry covers [top - offset, top - offset + size). */
+	uint32_t offset;
+	uint32_t size;
+};
+
+struct cbmem_dir {
+	uint32_t magic;
+	uint32_t num_entries;
+	/* Nothing is allocated below top - limit. */
+	uint32_t limit;
+	/* Slot numbers sorted by id, num_entries are used. */
+	uint8_t index[CBMEM_DIR_ENTRIES];
+	/* Unused slots have an id of 0. */
+	struct cbmem_entry slots[CBMEM_DIR_ENTRIES];
+};
+
+/* Create an empty directory below top, which must be aligned to
+ * CBMEM_DIR_LARGE_ALIGN. The root itself is the first entry, with root_id.
+ * Returns NULL if the root doesn't fit into limit. */
+struct cbmem_dir *cbmem_dir_create(void *top, uint32_t limit,
+				   uint32_t root_id);
+
+/* Return the directory below top if it is intact, NULL otherwise. */
+struct cbmem_dir *cbmem_dir_recover(void *top);
+
+/* The entry with id, or NULL. */
+const struct cbmem_entry *cbmem_dir_find(const struct cbmem_dir *dir,
+					 uint32_t id);
+
+/* Add an entry of size bytes. An existing entry with the same id is
+ * returned as it is, whatever its size. NULL when the directory or the
+ * space below the top is full. */
+const struct cbmem_entry *cbmem_dir_add(struct cbmem_dir *dir, uint32_t id,
+					uint32_t size);
+
+/* Free an entry and its slot. The root can't be removed. Returns 0 on
+ * success, < 0 on error. */
+int cbmem_dir_remove(struct cbmem_dir *dir, const struct cbmem_entry *entry);
+
+/* Change the size of an entry. Its contents up to the smaller of the two
+ * sizes are kept, but it may move when it grows. Returns 0 on success and
+ * < 0 with the entry unchanged when there is no space. */
+int cbmem_dir_resize(struct cbmem_dir *dir, const struct cbmem_entry *entry,
+		     uint32_t size);
+
+/* The n-th entry in id order, NULL past the last one. */
+const struct cbmem_entry *cbmem_dir_entry(const struct cbmem_dir *dir,
+					  unsigned int n);
+
+/* Bytes below the top used by the directory and all entries. */
+uint32_t cbmem_dir_used(const struct cbmem_dir *dir);
+
+static inline void *cbmem_dir_top(const struct cbmem_dir *dir)
+{
+	return (uint8_t *)dir + CBMEM_DIR_ROOT_SIZE;
+}
+
+static inline void *cbmem_dir_entry_start(const struct cbmem_dir *dir,
+					  const struct cbmem_entry *entry)
+{
+	return (uint8_t *)cbmem_dir_top(dir) - entry->offset;
+}
+
+#endif /* CBMEM_DIR_H */
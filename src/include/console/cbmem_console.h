@@ -20,10 +20,12 @@
 #define _CONSOLE_CBMEM_CONSOLE_H_
 
 #include <rules.h>
+#include <stddef.h>
 #include <stdint.h>
 
 void cbmemc_init(void);
 void cbmemc_tx_byte(unsigned char data);
+void cbmemc_tx_bytes(const unsigned char *data, size_t len);
 
 #if CONFIG_CONSOLE_CBMEM
 void cbmemc_reinit(void);
@@ -37,9 +39,14 @@ static inline void cbmemc_reinit(void) {}
 #if __CBMEM_CONSOLE_ENABLE__
 static inline void __cbmemc_init(void)	{ cbmemc_init(); }
 static inline void __cbmemc_tx_byte(u8 data)	{ cbmemc_tx_byte(data); }
+static inline void __cbmemc_tx_bytes(const u8 *data, size_t len)
+{
+	cbmemc_tx_bytes(data, len);
+}
 #else
 static inline void __cbmemc_init(void)	{}
 static inline void __cbmemc_tx_byte(u8 data)	{}
+static inline void __cbmemc_tx_bytes(const u8 *data, size_t len) {}
 #endif
 
 #endif
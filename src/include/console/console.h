@@ -50,11 +50,28 @@ int console_log_level(int msg_level);
 int do_printk(int msg_level, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
 void do_putchar(unsigned char byte);
 
+/* Messages above CONFIG_MAX_CONSOLE_LOGLEVEL can't be printed with any
+ * run-time log level, so they are left out of the build. */
 #define printk(LEVEL, fmt, args...)	\
-	do { do_printk(LEVEL, fmt, ##args); } while(0)
+	do { \
+		if ((LEVEL) <= CONFIG_MAX_CONSOLE_LOGLEVEL) \
+			do_printk(LEVEL, fmt, ##args); \
+	} while(0)
+
+#if CONFIG_CONSOLE_SERIAL_BUFFERED && ENV_RAMSTAGE
+/* Pass buffered output on to the hardware, console_poll() as far as it
+ * takes it without waiting, console_sync() all of it. */
+void console_poll(void);
+void console_sync(void);
+#else
+static inline void console_poll(void) {}
+static inline void console_sync(void) {}
+#endif
 
 #else
 static inline void console_init(void) {}
+static inline void console_poll(void) {}
+static inline void console_sync(void) {}
 static inline int console_log_level(int msg_level) { return 0; }
 static inline void printk(int LEVEL, const char *fmt, ...) {}
 static inline void do_putchar(unsigned char byte) {}
@@ -18,9 +18,13 @@
 #ifndef _CONSOLE_STREAMS_H_
 #define _CONSOLE_STREAMS_H_
 
+#include <stddef.h>
+
 void console_hw_init(void);
 void console_tx_byte(unsigned char byte);
+void console_tx_bytes(const unsigned char *data, size_t len);
 void console_tx_flush(void);
+void console_tx_drain(void);
 
 /* Helpers for ROMCC console. */
 void console_tx_nibble(unsigned nibble);
@@ -21,6 +21,7 @@
 #define CONSOLE_UART_H
 
 #include <rules.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /* Return the clock frequency UART uses as reference clock for
@@ -42,7 +43,9 @@ unsigned int uart_baudrate_divisor(unsigned int baudrate,
 
 void uart_init(int idx);
 void uart_tx_byte(int idx, unsigned char data);
+void uart_tx_bytes(int idx, const unsigned char *data, size_t len);
 void uart_tx_flush(int idx);
+void uart_tx_drain(int idx);
 unsigned char uart_rx_byte(int idx);
 
 unsigned int uart_platform_base(int idx);
@@ -62,11 +65,18 @@ void oxford_remap(unsigned int new_base);
 #if __CONSOLE_SERIAL_ENABLE__
 static inline void __uart_init(void)		{ uart_init(CONFIG_UART_FOR_CONSOLE); }
 static inline void __uart_tx_byte(u8 data)	{ uart_tx_byte(CONFIG_UART_FOR_CONSOLE, data); }
+static inline void __uart_tx_bytes(const u8 *data, size_t len)
+{
+	uart_tx_bytes(CONFIG_UART_FOR_CONSOLE, data, len);
+}
 static inline void __uart_tx_flush(void)	{ uart_tx_flush(CONFIG_UART_FOR_CONSOLE); }
+static inline void __uart_tx_drain(void)	{ uart_tx_drain(CONFIG_UART_FOR_CONSOLE); }
 #else
 static inline void __uart_init(void)		{}
 static inline void __uart_tx_byte(u8 data)	{}
+static inline void __uart_tx_bytes(const u8 *data, size_t len) {}
 static inline void __uart_tx_flush(void)	{}
+static inline void __uart_tx_drain(void)	{}
 #endif
 
 #endif /* __ROMCC__ */
@@ -1,7 +1,11 @@
 #ifndef _CPU_AMD_CAR_H
 #define _CPU_AMD_CAR_H
 
-void cache_as_ram_main(unsigned long bist, unsigned long cpu_init_detectedx);
+#include <cpu/x86/tsc.h>
+
+/* car_tsc[0] and car_tsc[1] hold the TSC before and after CAR setup. */
+void cache_as_ram_main(unsigned long bist, unsigned long cpu_init_detectedx,
+		       const tsc_t *car_tsc);
 void done_cache_as_ram_main(void);
 void post_cache_as_ram(void);
 
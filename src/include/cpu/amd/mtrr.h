@@ -27,6 +27,11 @@
 
 #define TOP_MEM_MSR			0xC001001A
 #define TOP_MEM2_MSR			0xC001001D
+#define MMIO_CONF_BASE			0xC0010058
+#define MMIO_CONF_BASE_ADDR_MASK	0xfff00000
+#define MMIO_CONF_BUS_RANGE_SHIFT	2
+#define MMIO_CONF_BUS_RANGE_MASK	0xf
+#define MMIO_CONF_ENABLE		(1 << 0)
 #ifndef TOP_MEM
   #define TOP_MEM			TOP_MEM_MSR
 #endif
@@ -0,0 +1,61 @@
+/*
+ * This file is part of the coreboot project.
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#ifndef CPU_X86_AP_JOBS_H
+#define CPU_X86_AP_JOBS_H
+
+#include <cpu/x86/tsc.h>
+
+/*
+ * Once the APs are initialized they wait for jobs instead of halting, until
+ * the OS resume or the payload boot. Jobs run in the order they were queued.
+ *
+ * A job runs on an AP without the coreboot threads and without a timer, so
+ * it must not use udelay() or the boot state machine. Work that touches
+ * devices the BSP may use at the same time does not belong there either;
+ * bulk copies and decompression do.
+ */
+
+struct ap_job {
+	void (*func)(void *arg);
+	void *arg;
+	/* Not for public use. */
+	struct ap_job *next;
+	volatile int done;
+	unsigned int cpu;	/* index of the CPU that ran it, 0 for the BSP */
+	tsc_t start;
+	tsc_t end;
+};
+
+/* Queue func(arg) for the next free AP. job must stay valid until
+ * ap_job_wait() returned. Jobs can be queued before the APs are up. */
+void ap_job_queue(struct ap_job *job, void (*func)(void *), void *arg);
+
+/* Wait for job to complete. A job no AP has started yet is taken back and
+ * run on the calling CPU, so this always returns with the job done. When
+ * it ran on an AP its start and end are added to the timestamp table. */
+void ap_job_wait(struct ap_job *job);
+
+/* AP side: run queued jobs until ap_jobs_stop() is called. */
+void ap_jobs_run(unsigned int index);
+
+/* Run the jobs left in the queue on the BSP and wait for all APs to leave
+ * ap_jobs_run(). Jobs queued afterwards run when they are waited for. */
+void ap_jobs_stop(void);
+
+#endif /* CPU_X86_AP_JOBS_H */
@@ -0,0 +1,50 @@
+#ifndef CPU_X86_TSC_H
+#define CPU_X86_TSC_H
+
+#include <stdint.h>
+
+#if CONFIG_TSC_SYNC_MFENCE
+#define TSC_SYNC "mfence\n"
+#elif CONFIG_TSC_SYNC_LFENCE
+#define TSC_SYNC "lfence\n"
+#else
+#define TSC_SYNC
+#endif
+
+struct tsc_struct {
+	unsigned lo;
+	unsigned hi;
+};
+typedef struct tsc_struct tsc_t;
+
+static inline tsc_t rdtsc(void)
+{
+	tsc_t res;
+	asm volatile (
+		TSC_SYNC
+		"rdtsc"
+		: "=a" (res.lo), "=d"(res.hi) /* outputs */
+		);
+	return res;
+}
+
+#if !defined(__ROMCC__)
+/* Too many registers for ROMCC */
+static inline unsigned long long rdtscll(void)
+{
+	unsigned long long val;
+	asm volatile (
+		TSC_SYNC
+		"rdtsc"
+		: "=A" (val)
+		);
+	return val;
+}
+
+static inline uint64_t tsc_to_uint64(tsc_t tstamp)
+{
+	return (((uint64_t)tstamp.hi) << 32) + tstamp.lo;
+}
+#endif
+
+#endif /* CPU_X86_TSC_H */
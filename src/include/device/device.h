@@ -146,6 +146,11 @@ struct device {
 #ifndef __PRE_RAM__
 	struct chip_operations *chip_ops;
 	const char *name;
+
+	/* Stable PCI header registers, see pci_ops.c. */
+	u8 hdr_cache_on;
+	u16 hdr_cache_valid;
+	u32 hdr_cache[16];
 #endif
 	ROMSTAGE_CONST void *chip_info;
 };
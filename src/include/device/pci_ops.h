@@ -13,6 +13,10 @@ void pci_write_config8(device_t dev, unsigned int where, u8 val);
 void pci_write_config16(device_t dev, unsigned int where, u16 val);
 void pci_write_config32(device_t dev, unsigned int where, u32 val);
 
+void pci_hdr_cache_start(device_t dev);
+void pci_hdr_cache_stop(device_t dev);
+void pci_hdr_cache_drop_bus(struct bus *bus);
+
 #if CONFIG_MMCONF_SUPPORT
 u8 pci_mmio_read_config8(device_t dev, unsigned int where);
 u16 pci_mmio_read_config16(device_t dev, unsigned int where);
@@ -32,6 +32,14 @@ unsigned long log2_ceil(unsigned long x);
 
 /* Defined in src/lib/lzma.c */
 unsigned long ulzma(unsigned char *src, unsigned char *dst);
+/* Same, but bounded by the srcn compressed and dstn decompressed bytes. */
+size_t ulzman(const void *src, size_t srcn, void *dst, size_t dstn);
+
+/* Defined in src/lib/lz4.c, all return 0 on error. ulz4f() is bounded by the
+ * content size of the frame and refuses frames that do not carry one. */
+size_t ulz4f(const void *src, void *dst);
+size_t ulz4fn(const void *src, size_t srcn, void *dst, size_t dstn);
+size_t ulz4f_content_size(const void *src, size_t srcn);
 
 /* Defined in src/arch/x86/boot/gdt.c */
 void move_gdt(void);
@@ -0,0 +1,51 @@
+#ifndef LZMA_H
+#define LZMA_H
+
+#include <stddef.h>
+#include <cbfs_core.h>
+#include <lib/lzmadecode.h>
+
+/*
+ * Streaming LZMA decoder. The compressed data is pulled through
+ * media->read() one cache line at a time into a buffer in RAM (or CAR)
+ * instead of being decoded byte by byte from the ROM window, and the output
+ * can be produced in steps:
+ *
+ *	lzma_stream_init(s, media, offset, len, dst, dst_size);
+ *	lzma_stream_decode(s, n);	as often as needed, n growing
+ *	size = lzma_stream_finish(s);
+ *
+ * A NULL media means offset is a memory address. The struct holds the
+ * probability tables, so romstage keeps it on the stack and ramstage in
+ * .bss, and it can be reinitialized for the next stream.
+ */
+
+#define LZMA_STREAM_CHUNK	64
+/* lc + lp <= 3, which is what cbfstool and every LZMA preset produce */
+#define LZMA_STREAM_PROBS	(LZMA_BASE_SIZE + (LZMA_LIT_SIZE << 3))
+
+struct lzma_stream {
+	CLzmaStreamState dec;
+	struct cbfs_media *media;
+	struct cbfs_media mem_media;
+	size_t offset;
+	size_t remaining;
+	unsigned char *dst;
+	size_t out_size;
+	int error;
+	unsigned char chunk[LZMA_STREAM_CHUNK]
+		__attribute__((aligned(LZMA_STREAM_CHUNK)));
+	CProb probs[LZMA_STREAM_PROBS];
+};
+
+int lzma_stream_init(struct lzma_stream *s, struct cbfs_media *media,
+		     size_t offset, size_t len, void *dst, size_t dst_size);
+size_t lzma_stream_decode(struct lzma_stream *s, size_t out);
+size_t lzma_stream_finish(struct lzma_stream *s);
+
+/* Decode a whole stream of srcn bytes at offset in media into dst, which
+ * holds dstn bytes. Returns the size of the output, or 0 on error. */
+size_t ulzma_media(struct cbfs_media *media, size_t offset, size_t srcn,
+		   void *dst, size_t dstn);
+
+#endif
@@ -0,0 +1,51 @@
+/*
+ * This file is part of the coreboot project.
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#ifndef RAMSTAGE_CACHE_H
+#define RAMSTAGE_CACHE_H
+
+#include <stdint.h>
+#include <cbfs_core.h>
+
+/*
+ * A decompressed copy of the ramstage kept in CBMEM for S3 resume. The
+ * ramstage isn't relocatable, so the copy is the image exactly as it is
+ * loaded to its link address. ramstage saves it during a normal boot and
+ * romstage copies it into place on resume instead of decompressing the
+ * stage from the flash again.
+ */
+struct ramstage_cache {
+	uint32_t magic;
+	/* Header of the stage in the flash the copy was made from. */
+	struct cbfs_stage stage;
+	/* Bytes in program[], the rest of stage.memlen is zero. */
+	uint32_t size;
+	/* compute_ip_checksum() of program[] */
+	uint32_t checksum;
+	uint8_t program[0];
+} __attribute__((packed));
+
+#define RAMSTAGE_CACHE_MAGIC	0xf3c3a02a
+
+#if defined(__PRE_RAM__)
+/* Load the cached copy of the stage name to its link address. Returns the
+ * entry point, or NULL when there is no valid copy of that stage. */
+void *ramstage_cache_load(const char *name);
+#endif
+
+#endif /* RAMSTAGE_CACHE_H */
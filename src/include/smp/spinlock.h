@@ -11,6 +11,7 @@
 #define spin_unlock_wait(lock)	do {} while(0)
 #define spin_lock(lock)		do {} while(0)
 #define spin_unlock(lock)	do {} while(0)
+#define spin_trylock(lock)	1
 #define cpu_relax()		do {} while(0)
 #endif
 
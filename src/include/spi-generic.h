@@ -120,6 +120,17 @@ int spi_claim_bus(struct spi_slave *slave);
  */
 void spi_release_bus(struct spi_slave *slave);
 
+/*-----------------------------------------------------------------------
+ * Keep the SPI bus from being claimed
+ *
+ * For memory mapped reads of the flash on another CPU: a read while a
+ * program or erase is in progress does not return the flash contents.
+ * The lock is held from the outermost spi_claim_bus() to the matching
+ * spi_release_bus(), and should only be held for short reads.
+ */
+void spi_flash_bus_lock(void);
+void spi_flash_bus_unlock(void);
+
 /*-----------------------------------------------------------------------
  * SPI transfer
  *
@@ -49,6 +49,10 @@
 #define CONTROLLER_PAGE_LIMIT	((int)(~0U>>1))
 #endif
 
+/* Largest payload of one page program command. The SB800 SPI FIFO holds
+ * CONFIG_AMD_SB_SPI_TX_LEN bytes after the three address bytes. */
+#define SPI_FLASH_PROG_CHUNK	CONFIG_AMD_SB_SPI_TX_LEN
+
 struct spi_flash {
 	struct spi_slave *spi;
 
@@ -69,6 +73,15 @@ struct spi_flash {
 struct spi_flash *spi_flash_probe(unsigned int bus, unsigned int cs,
 		unsigned int max_hz, unsigned int spi_mode);
 
+/*
+ * Bring len bytes at offset to the contents of buf, where current maps the
+ * present contents of that range. Unchanged sectors are left alone, sectors
+ * that only need bits cleared are programmed without an erase, and only the
+ * dirty bytes are sent to the part. Returns 0 on success.
+ */
+int spi_flash_update(struct spi_flash *flash, u32 offset, size_t len,
+		const void *buf, const void *current);
+
 static inline int spi_flash_read(struct spi_flash *flash, u32 offset,
 		size_t len, void *buf)
 {
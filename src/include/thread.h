@@ -58,6 +58,18 @@ int thread_yield_microseconds(unsigned microsecs);
 void thread_cooperate(void);
 void thread_prevent_coop(void);
 
+/* A lock that is held across yields. A thread that finds it taken yields
+ * until the holder releases it. It is not recursive. */
+struct thread_mutex {
+	int locked;
+	struct thread *owner;
+};
+
+void thread_mutex_lock(struct thread_mutex *mutex);
+void thread_mutex_unlock(struct thread_mutex *mutex);
+/* Return 1 if the current thread holds the mutex. */
+int thread_mutex_held(const struct thread_mutex *mutex);
+
 static inline void thread_init_cpu_info_non_bsp(struct cpu_info *ci)
 {
 	ci->thread = NULL;
@@ -70,12 +82,26 @@ void asmlinkage switch_to_thread(uintptr_t new_stack, uintptr_t *saved_stack);
  * saved_stack field in the struct thread needs to be updated accordingly. */
 void arch_prepare_thread(struct thread *t,
                          void asmlinkage (*thread_entry)(void *), void *arg);
+/* Return the base of the CONFIG_NUM_THREADS stacks of CONFIG_STACK_SIZE
+ * bytes each. The base needs to be aligned to CONFIG_STACK_SIZE so that
+ * cpu_info() works on a thread stack. */
+void *arch_get_thread_stackbase(void);
 #else
 static inline void threads_initialize(void) {}
 static inline int thread_run(void (*func)(void *), void *arg) { return -1; }
+static inline int thread_run_until(void (*func)(void *), void *arg,
+                                   boot_state_t state,
+                                   boot_state_sequence_t seq) { return -1; }
 static inline int thread_yield_microseconds(unsigned microsecs) { return -1; }
 static inline void thread_cooperate(void) {}
 static inline void thread_prevent_coop(void) {}
+struct thread_mutex {
+	int locked;
+};
+static inline void thread_mutex_lock(struct thread_mutex *mutex) {}
+static inline void thread_mutex_unlock(struct thread_mutex *mutex) {}
+static inline int thread_mutex_held(const struct thread_mutex *mutex)
+{ return 0; }
 struct cpu_info;
 static inline void thread_init_cpu_info_non_bsp(struct cpu_info *ci) { }
 #endif
@@ -59,6 +59,15 @@ enum timestamp_id {
 	TS_START_RAMSTAGE = 10,
 	TS_BEFORE_CAR_INIT = 15,
 	TS_AFTER_CAR_INIT = 16,
+	TS_BEFORE_CAR_TEARDOWN = 17,
+	TS_START_CBFS_LOAD = 20,
+	TS_END_CBFS_LOAD = 21,
+	TS_START_ULZMA = 22,
+	TS_END_ULZMA = 23,
+	TS_START_ULZ4F = 24,
+	TS_END_ULZ4F = 25,
+	TS_START_AP_JOB = 26,
+	TS_END_AP_JOB = 27,
 	TS_DEVICE_ENUMERATE = 30,
 	TS_FSP_BEFORE_ENUMERATE,
 	TS_FSP_AFTER_ENUMERATE,
@@ -71,27 +80,72 @@ enum timestamp_id {
 	TS_FSP_BEFORE_FINALIZE,
 	TS_FSP_AFTER_FINALIZE,
 	TS_LOAD_PAYLOAD = 90,
+	TS_START_SELF_SEGMENTS = 91,
+	TS_END_SELF_SEGMENTS = 92,
 	TS_ACPI_WAKE_JUMP = 98,
 	TS_SELFBOOT_JUMP = 99,
+
+	/* AGESA entry points */
+	TS_AGESA_INIT_RESET_START = 955,
+	TS_AGESA_INIT_RESET_DONE = 956,
+	TS_AGESA_INIT_EARLY_START = 957,
+	TS_AGESA_INIT_EARLY_DONE = 958,
+	TS_AGESA_INIT_POST_START = 959,
+	TS_AGESA_INIT_POST_DONE = 960,
+	TS_AGESA_INIT_ENV_START = 961,
+	TS_AGESA_INIT_ENV_DONE = 962,
+	TS_AGESA_INIT_MID_START = 963,
+	TS_AGESA_INIT_MID_DONE = 964,
+	TS_AGESA_INIT_LATE_START = 965,
+	TS_AGESA_INIT_LATE_DONE = 966,
+	TS_AGESA_INIT_RESUME_START = 969,
+	TS_AGESA_INIT_RESUME_DONE = 970,
+	TS_AGESA_S3_LATE_START = 971,
+	TS_AGESA_S3_LATE_DONE = 972,
+	TS_AGESA_S3_SAVE_START = 973,
+	TS_AGESA_S3_SAVE_DONE = 974,
+
+	/* Payloads append to the same table, SeaBIOS uses 1100 and up. */
+	TS_SEABIOS_START = 1100,
+	TS_SEABIOS_DEVICES = 1101,
+	TS_SEABIOS_OPTIONROMS = 1102,
+	TS_SEABIOS_BOOTMENU = 1103,
+	TS_SEABIOS_BOOT = 1104,
 };
 
-#if CONFIG_COLLECT_TIMESTAMPS && (CONFIG_EARLY_CBMEM_INIT || !defined(__PRE_RAM__))
+/* Without early CBMEM, romstage collects its timestamps in CAR and leaves
+ * them at a fixed spot below CONFIG_RAMTOP, which ramstage owns until it
+ * imports them into the CBMEM table. */
+#define TIMESTAMP_HANDOFF_MAGIC		0x54534846	/* "TSHF" */
+#define TIMESTAMP_HANDOFF_ENTRIES	48
+#define TIMESTAMP_HANDOFF_SIZE		0x400
+#define TIMESTAMP_HANDOFF_ADDR		(CONFIG_RAMTOP - TIMESTAMP_HANDOFF_SIZE)
+
+struct timestamp_handoff {
+	uint32_t	magic;
+	struct timestamp_table table;
+	struct timestamp_entry entries[TIMESTAMP_HANDOFF_ENTRIES];
+} __attribute__((packed));
+
+#if CONFIG_COLLECT_TIMESTAMPS
 #include <cpu/x86/tsc.h>
 void timestamp_init(tsc_t base);
 void timestamp_add(enum timestamp_id id, tsc_t ts_time);
 void timestamp_add_now(enum timestamp_id id);
 void timestamp_reinit(void);
-tsc_t get_initial_timestamp(void);
-void timestamp_show_entry(uint32_t entry);
-void timestamp_show_id(enum timestamp_id id);
+#endif
+#if CONFIG_COLLECT_TIMESTAMPS && defined(__PRE_RAM__)
+/* Leave romstage timestamps for ramstage when CBMEM is not up yet. */
+void timestamp_handoff(void);
 #else
+#define timestamp_handoff()
+#endif
+#if !CONFIG_COLLECT_TIMESTAMPS
 #define timestamp_init(base)
 #define timestamp_add(id, time)
 #define timestamp_add_now(id)
 #define timestamp_reinit()
-#define timestamp_show_entry(entry)
-#define timestamp_show_id(id)
-#endif /* CONFIG_COLLECT_TIMESTAMPS && (CONFIG_EARLY_CBMEM_INIT || !defined...*/
+#endif /* !CONFIG_COLLECT_TIMESTAMPS */
 #endif /* #if defined(__GNUC__) */
 #endif /* #ifndef __ASSEMBLER__ */
 
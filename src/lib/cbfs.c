@@ -33,12 +33,21 @@
   /* No LZMA in romstage if ramstage is not compressed. */
 #else
 # define CBFS_CORE_WITH_LZMA
+# define CBFS_CORE_WITH_LZ4
 # include <lib.h>
+# include <lzma.h>
+#endif
+
+#if !defined(LIBPAYLOAD) && !defined(__SMM__) && !defined(__BOOT_BLOCK__) && \
+	CONFIG_CBFS_INDEX
+# define CBFS_CORE_WITH_INDEX
+# include <arch/early_variables.h>
 #endif
 
 #include <cbfs.h>
 #include <string.h>
 #include <cbmem.h>
+#include <timestamp.h>
 
 #ifdef LIBPAYLOAD
 # include <stdio.h>
@@ -65,6 +74,44 @@
 
 #include "cbfs_core.c"
 
+#ifdef CBFS_CORE_WITH_INDEX
+/* Each stage keeps its own index. With EARLY_CBMEM_INIT romstage also hands
+ * its index over through CBMEM and ramstage adopts that copy. Without it
+ * (e.g. the APU boards, where CBMEM is first set up in ramstage) there is no
+ * handoff: romstage and ramstage each walk the flash once. */
+static struct cbfs_index cbfs_index CAR_GLOBAL;
+
+struct cbfs_index *cbfs_get_index(void)
+{
+#if !defined(__PRE_RAM__) && CONFIG_EARLY_CBMEM_INIT
+	struct cbfs_index *saved;
+
+	if (cbfs_index.magic != CBFS_INDEX_MAGIC) {
+		saved = cbmem_find(CBMEM_ID_CBFS_INDEX);
+		if (saved != NULL && saved->magic == CBFS_INDEX_MAGIC)
+			memcpy(&cbfs_index, saved, sizeof(cbfs_index));
+	}
+#endif
+	return car_get_var_ptr(&cbfs_index);
+}
+
+#if defined(__PRE_RAM__) && CONFIG_EARLY_CBMEM_INIT
+static void cbfs_index_migrate(void)
+{
+	struct cbfs_index *index = car_get_var_ptr(&cbfs_index);
+	struct cbfs_index *saved;
+
+	if (index->magic != CBFS_INDEX_MAGIC)
+		return;
+
+	saved = cbmem_add(CBMEM_ID_CBFS_INDEX, sizeof(*saved));
+	if (saved != NULL)
+		memcpy(saved, index, sizeof(*saved));
+}
+CAR_MIGRATE(cbfs_index_migrate)
+#endif
+#endif /* CBFS_CORE_WITH_INDEX */
+
 #ifndef __SMM__
 static inline int tohex4(unsigned int c)
 {
@@ -89,6 +136,7 @@ void *cbfs_load_optionrom(struct cbfs_media *media, uint16_t vendor,
 	tohex16(vendor, name+3);
 	tohex16(device, name+8);
 
+	timestamp_add_now(TS_START_CBFS_LOAD);
 	orom = (struct cbfs_optionrom *)
 	  cbfs_get_file_content(media, name, CBFS_TYPE_OPTIONROM, NULL);
 
@@ -105,8 +153,10 @@ void *cbfs_load_optionrom(struct cbfs_media *media, uint16_t vendor,
 	/* BUG: the cbfstool is (not yet) including a cbfs_optionrom header */
 	src = (uint8_t *)orom; // + sizeof(struct cbfs_optionrom);
 
-	if (! dest)
+	if (! dest) {
+		timestamp_add_now(TS_END_CBFS_LOAD);
 		return src;
+	}
 
 	if (!cbfs_decompress(ntohl(orom->compression),
 			     src,
@@ -114,42 +164,91 @@ void *cbfs_load_optionrom(struct cbfs_media *media, uint16_t vendor,
 			     ntohl(orom->len)))
 		return NULL;
 
+	timestamp_add_now(TS_END_CBFS_LOAD);
 	return dest;
 }
 
 void * cbfs_load_stage(struct cbfs_media *media, const char *name)
 {
-	struct cbfs_stage *stage = (struct cbfs_stage *)
-		cbfs_get_file_content(media, name, CBFS_TYPE_STAGE, NULL);
+	struct cbfs_media default_media;
+	struct cbfs_file file;
+	struct cbfs_stage stage;
+	void *data;
 	/* this is a mess. There is no ntohll. */
 	/* for now, assume compatible byte order until we solve this. */
 	uint32_t entry;
+	uint32_t offset;
 	uint32_t final_size;
 
-	if (stage == NULL)
+	timestamp_add_now(TS_START_CBFS_LOAD);
+	offset = cbfs_locate_file(&media, &default_media, name, &file);
+	if (offset == CBFS_INVALID_OFFSET)
+		return (void *) -1;
+	if (ntohl(file.type) != CBFS_TYPE_STAGE) {
+		ERROR("File '%s' is of type %x, but we requested %x.\n", name,
+		      ntohl(file.type), CBFS_TYPE_STAGE);
+		return (void *) -1;
+	}
+
+	/* Only the stage header is read here, the data follows it. */
+	offset += ntohl(file.offset);
+	media->open(media);
+	if (media->read(media, &stage, offset, sizeof(stage)) !=
+	    sizeof(stage)) {
+		media->close(media);
+		ERROR("Failed to read stage header of '%s'.\n", name);
 		return (void *) -1;
+	}
+	media->close(media);
+	offset += sizeof(stage);
 
 	LOG("loading stage %s @ 0x%x (%d bytes), entry @ 0x%llx\n",
 			name,
-			(uint32_t) stage->load, stage->memlen,
-			stage->entry);
-
-	final_size = cbfs_decompress(stage->compression,
-				     ((unsigned char *) stage) +
-				     sizeof(struct cbfs_stage),
-				     (void *) (uint32_t) stage->load,
-				     stage->len);
+			(uint32_t) stage.load, stage.memlen,
+			stage.entry);
+
+#ifdef CBFS_CORE_WITH_LZMA
+	/* The compressed data is streamed from the media one cache line at a
+	 * time, and the decoder is bounded by the stage so a bad stream
+	 * can't overrun. */
+	if (stage.compression == CBFS_COMPRESS_LZMA) {
+		final_size = ulzma_media(media, offset, stage.len,
+					 (void *) (uint32_t) stage.load,
+					 stage.memlen);
+	} else
+#endif
+	{
+		media->open(media);
+		data = media->map(media, offset, stage.len);
+		media->close(media);
+		if (data == CBFS_MEDIA_INVALID_MAP_ADDRESS) {
+			ERROR("Failed to map stage '%s'.\n", name);
+			return (void *) -1;
+		}
+#ifdef CBFS_CORE_WITH_LZ4
+		if (stage.compression == CBFS_COMPRESS_LZ4)
+			final_size = ulz4fn(data, stage.len,
+					    (void *) (uint32_t) stage.load,
+					    stage.memlen);
+		else
+#endif
+			final_size = cbfs_decompress(stage.compression, data,
+						     (void *) (uint32_t) stage.load,
+						     stage.len);
+		media->unmap(media, data);
+	}
 	if (!final_size)
 		return (void *) -1;
 
 	/* Stages rely the below clearing so that the bss is initialized. */
-	memset((void *)((uintptr_t)stage->load + final_size), 0,
-	       stage->memlen - final_size);
+	memset((void *)((uintptr_t)stage.load + final_size), 0,
+	       stage.memlen - final_size);
 
 	DEBUG("stage loaded.\n");
+	timestamp_add_now(TS_END_CBFS_LOAD);
 
-	entry = stage->entry;
-	// entry = ntohll(stage->entry);
+	entry = stage.entry;
+	// entry = ntohll(stage.entry);
 
 	return (void *) entry;
 }
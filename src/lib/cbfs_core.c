@@ -35,6 +35,10 @@
  * CBFS_CORE_WITH_LZMA (must be #define)
  *      if defined, ulzma() must exist for decompression of data streams
  *
+ * CBFS_CORE_WITH_LZ4 (must be #define)
+ *      if defined, ulz4fn() and ulz4f_content_size() must exist for
+ *      decompression of data streams
+ *
  * CBFS_HEADER_ROM_ADDRESS
  *	ROM address (offset) of CBFS header. Underlying CBFS media may interpret
  *	it in other way so we call this "address".
@@ -92,44 +96,170 @@ const struct cbfs_header *cbfs_get_header(struct cbfs_media *media)
 	return header;
 }
 
-/* public API starts here*/
-struct cbfs_file *cbfs_get_file(struct cbfs_media *media, const char *name)
+#ifdef CBFS_CORE_WITH_INDEX
+static uint32_t cbfs_name_hash(const char *name)
 {
-	const char *file_name;
-	uint32_t offset, align, romsize, name_len;
-	const struct cbfs_header *header;
-	struct cbfs_file file, *file_ptr;
-	struct cbfs_media default_media;
+	uint32_t hash = 0x811c9dc5;
 
-	if (media == CBFS_DEFAULT_MEDIA) {
-		media = &default_media;
-		if (init_default_cbfs_media(media) != 0) {
-			ERROR("Failed to initialize default media.\n");
-			return NULL;
-		}
+	while (*name) {
+		hash ^= (uint8_t)*name++;
+		hash *= 0x01000193;
 	}
+	return hash;
+}
 
-	if (CBFS_HEADER_INVALID_ADDRESS == (header = cbfs_get_header(media)))
-		return NULL;
+/* Returns the first entry whose hash is not below 'hash'. The entries are
+ * kept sorted by hash, so this is a binary search. */
+static struct cbfs_index_entry *cbfs_index_find(struct cbfs_index *index,
+						uint32_t hash)
+{
+	uint32_t lo = 0, hi = index->count, mid;
 
-	// Logical offset (for source media) of first file.
-	offset = ntohl(header->offset);
-	align = ntohl(header->align);
-	romsize = ntohl(header->romsize);
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		if (index->entries[mid].hash < hash)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return &index->entries[lo];
+}
 
-	// TODO Add a "size" in CBFS header for a platform independent way to
-	// determine the end of CBFS data.
-#if defined(CONFIG_ARCH_X86) && CONFIG_ARCH_X86
-	romsize -= htonl(header->bootblocksize);
-#endif
-	DEBUG("CBFS location: 0x%x~0x%x, align: %d\n", offset, romsize, align);
+/* Makes room for a new entry with 'hash', after the ones with the same hash
+ * so that files of the same name stay in media order. */
+static struct cbfs_index_entry *cbfs_index_insert(struct cbfs_index *index,
+						  uint32_t hash)
+{
+	struct cbfs_index_entry *entry = &index->entries[index->count++];
 
-	DEBUG("Looking for '%s' starting from 0x%x.\n", name, offset);
-	media->open(media);
+	while (entry > index->entries && entry[-1].hash > hash) {
+		*entry = entry[-1];
+		entry--;
+	}
+	entry->hash = hash;
+	return entry;
+}
+
+/* Walk all file headers once and record them in the index. */
+static void cbfs_index_build(struct cbfs_index *index,
+			     struct cbfs_media *media, uint32_t offset,
+			     uint32_t align, uint32_t romsize)
+{
+	const char *file_name;
+	struct cbfs_file file;
+	struct cbfs_index_entry *entry;
+	uint32_t name_len;
+
+	index->magic = 0;
+	index->flags = CBFS_INDEX_COMPLETE;
+	index->first_offset = offset;
+	index->romsize = romsize;
+	index->count = 0;
+
+	DEBUG("Building index starting from 0x%x.\n", offset);
 	while (offset < romsize &&
 	       media->read(media, &file, offset, sizeof(file)) == sizeof(file)) {
 		if (memcmp(CBFS_FILE_MAGIC, file.magic,
 			   sizeof(file.magic)) != 0) {
+			offset += align;
+			if (offset % align)
+				offset -= offset % align;
+			continue;
+		}
+		if (index->count == CONFIG_CBFS_INDEX_ENTRIES) {
+			LOG("index full, falling back to linear lookups "
+			    "beyond 0x%x.\n", offset);
+			index->flags &= ~CBFS_INDEX_COMPLETE;
+			break;
+		}
+		name_len = ntohl(file.offset) - sizeof(file);
+		file_name = (const char *)media->map(
+				media, offset + sizeof(file), name_len);
+		if (file_name == CBFS_MEDIA_INVALID_MAP_ADDRESS) {
+			ERROR("ERROR: Failed to get filename: 0x%x.\n", offset);
+			index->flags &= ~CBFS_INDEX_COMPLETE;
+		} else {
+			entry = cbfs_index_insert(index,
+						  cbfs_name_hash(file_name));
+			entry->offset = offset;
+			entry->data_offset = ntohl(file.offset);
+			entry->len = ntohl(file.len);
+			entry->type = ntohl(file.type);
+			media->unmap(media, file_name);
+		}
+
+		offset += ntohl(file.len) + ntohl(file.offset);
+		if (offset % align)
+			offset += align - (offset % align);
+	}
+	index->magic = CBFS_INDEX_MAGIC;
+	DEBUG("Indexed %d files.\n", index->count);
+}
+
+/* Look a file up through the index. Returns the media offset of the file
+ * header and copies it to *file, CBFS_INVALID_OFFSET if the index proves the
+ * file does not exist, or CBFS_INDEX_MISS if the caller has to fall back to
+ * walking the media. */
+#define CBFS_INDEX_MISS		0xfffffffe
+
+static uint32_t cbfs_index_lookup(struct cbfs_index *index,
+				  struct cbfs_media *media, const char *name,
+				  struct cbfs_file *file)
+{
+	struct cbfs_index_entry *entry, *end;
+	const char *file_name;
+	uint32_t hash = cbfs_name_hash(name);
+	int match;
+
+	end = &index->entries[index->count];
+	for (entry = cbfs_index_find(index, hash);
+	     entry < end && entry->hash == hash; entry++) {
+		if (media->read(media, file, entry->offset,
+				sizeof(*file)) != sizeof(*file))
+			return CBFS_INDEX_MISS;
+		if (memcmp(CBFS_FILE_MAGIC, file->magic,
+			   sizeof(file->magic)) != 0 ||
+		    ntohl(file->offset) != entry->data_offset ||
+		    ntohl(file->len) != entry->len) {
+			/* The media changed under us, rebuild next time. */
+			index->magic = 0;
+			return CBFS_INDEX_MISS;
+		}
+		file_name = media->map(media, entry->offset + sizeof(*file),
+				       entry->data_offset - sizeof(*file));
+		if (file_name == CBFS_MEDIA_INVALID_MAP_ADDRESS)
+			return CBFS_INDEX_MISS;
+		match = strcmp(file_name, name) == 0;
+		media->unmap(media, file_name);
+		if (match) {
+			DEBUG("Found file '%s' in index (offset=0x%x, "
+			      "len=%d).\n", name,
+			      entry->offset + entry->data_offset, entry->len);
+			return entry->offset;
+		}
+		/* Hash collision, keep looking. */
+	}
+
+	if (index->flags & CBFS_INDEX_COMPLETE)
+		return CBFS_INVALID_OFFSET;
+	return CBFS_INDEX_MISS;
+}
+#endif /* CBFS_CORE_WITH_INDEX */
+
+/* Walk the file headers from 'offset' on. Returns the media offset of the
+ * header of file 'name' and copies it to *file, or CBFS_INVALID_OFFSET. */
+static uint32_t cbfs_walk(struct cbfs_media *media, const char *name,
+			  uint32_t offset, uint32_t align, uint32_t romsize,
+			  struct cbfs_file *file)
+{
+	const char *file_name;
+	uint32_t name_len;
+
+	DEBUG("Looking for '%s' starting from 0x%x.\n", name, offset);
+	while (offset < romsize &&
+	       media->read(media, file, offset, sizeof(*file)) == sizeof(*file)) {
+		if (memcmp(CBFS_FILE_MAGIC, file->magic,
+			   sizeof(file->magic)) != 0) {
 			uint32_t new_align = align;
 			if (offset % align)
 				new_align += align - (offset % align);
@@ -139,25 +269,20 @@ struct cbfs_file *cbfs_get_file(struct cbfs_media *media, const char *name)
 			offset += new_align;
 			continue;
 		}
-		name_len = ntohl(file.offset) - sizeof(file);
+		name_len = ntohl(file->offset) - sizeof(*file);
 		DEBUG(" - load entry 0x%x file name (%d bytes)...\n", offset,
 		      name_len);
 
 		// load file name (arbitrary length).
 		file_name = (const char *)media->map(
-				media, offset + sizeof(file), name_len);
+				media, offset + sizeof(*file), name_len);
 		if (file_name == CBFS_MEDIA_INVALID_MAP_ADDRESS) {
 			ERROR("ERROR: Failed to get filename: 0x%x.\n", offset);
 		} else if (strcmp(file_name, name) == 0) {
-			int file_offset = ntohl(file.offset),
-			    file_len = ntohl(file.len);
 			DEBUG("Found file (offset=0x%x, len=%d).\n",
-			    offset + file_offset, file_len);
+			      offset + ntohl(file->offset), ntohl(file->len));
 			media->unmap(media, file_name);
-			file_ptr = media->map(media, offset,
-					      file_offset + file_len);
-			media->close(media);
-			return file_ptr;
+			return offset;
 		} else {
 			DEBUG(" (unmatched file @0x%x: %s)\n", offset,
 			      file_name);
@@ -165,13 +290,91 @@ struct cbfs_file *cbfs_get_file(struct cbfs_media *media, const char *name)
 		}
 
 		// Move to next file.
-		offset += ntohl(file.len) + ntohl(file.offset);
+		offset += ntohl(file->len) + ntohl(file->offset);
 		if (offset % align)
 			offset += align - (offset % align);
 	}
+	return CBFS_INVALID_OFFSET;
+}
+
+/* public API starts here*/
+uint32_t cbfs_locate_file(struct cbfs_media **media_ptr,
+			  struct cbfs_media *default_media, const char *name,
+			  struct cbfs_file *file)
+{
+	uint32_t offset, align, romsize, found;
+	const struct cbfs_header *header;
+	struct cbfs_media *media = *media_ptr;
+#ifdef CBFS_CORE_WITH_INDEX
+	struct cbfs_index *index = NULL;
+#endif
+
+	if (media == CBFS_DEFAULT_MEDIA) {
+		media = default_media;
+		if (init_default_cbfs_media(media) != 0) {
+			ERROR("Failed to initialize default media.\n");
+			return CBFS_INVALID_OFFSET;
+		}
+		*media_ptr = media;
+#ifdef CBFS_CORE_WITH_INDEX
+		/* Only the default media is stable enough to be indexed. */
+		index = cbfs_get_index();
+#endif
+	}
+
+	if (CBFS_HEADER_INVALID_ADDRESS == (header = cbfs_get_header(media)))
+		return CBFS_INVALID_OFFSET;
+
+	// Logical offset (for source media) of first file.
+	offset = ntohl(header->offset);
+	align = ntohl(header->align);
+	romsize = ntohl(header->romsize);
+
+	// TODO Add a "size" in CBFS header for a platform independent way to
+	// determine the end of CBFS data.
+#if defined(CONFIG_ARCH_X86) && CONFIG_ARCH_X86
+	romsize -= htonl(header->bootblocksize);
+#endif
+	DEBUG("CBFS location: 0x%x~0x%x, align: %d\n", offset, romsize, align);
+
+	media->open(media);
+#ifdef CBFS_CORE_WITH_INDEX
+	found = CBFS_INDEX_MISS;
+	if (index != NULL) {
+		if (index->magic != CBFS_INDEX_MAGIC ||
+		    index->first_offset != offset ||
+		    index->romsize != romsize)
+			cbfs_index_build(index, media, offset, align, romsize);
+		found = cbfs_index_lookup(index, media, name, file);
+	}
+	if (found == CBFS_INDEX_MISS)
+#endif
+		found = cbfs_walk(media, name, offset, align, romsize, file);
 	media->close(media);
-	LOG("WARNING: '%s' not found.\n", name);
-	return NULL;
+
+	if (found == CBFS_INVALID_OFFSET) {
+		LOG("WARNING: '%s' not found.\n", name);
+	}
+	return found;
+}
+
+struct cbfs_file *cbfs_get_file(struct cbfs_media *media, const char *name)
+{
+	struct cbfs_media default_media;
+	struct cbfs_file file, *file_ptr;
+	uint32_t offset;
+
+	offset = cbfs_locate_file(&media, &default_media, name, &file);
+	if (offset == CBFS_INVALID_OFFSET)
+		return NULL;
+
+	media->open(media);
+	file_ptr = media->map(media, offset,
+			      ntohl(file.offset) + ntohl(file.len));
+	media->close(media);
+	if (file_ptr == CBFS_MEDIA_INVALID_MAP_ADDRESS)
+		return NULL;
+	return file_ptr;
 }
 
 void *cbfs_get_file_content(struct cbfs_media *media, const char *name,
@@ -214,6 +417,13 @@ int cbfs_decompress(int algo, void *src, void *dst, int len)
 #ifdef CBFS_CORE_WITH_LZMA
 		case CBFS_COMPRESS_LZMA:
 			return ulzma(src, dst);
+#endif
+#ifdef CBFS_CORE_WITH_LZ4
+		case CBFS_COMPRESS_LZ4:
+			/* The caller gives no destination size, so the
+			 * frame has to announce its own. */
+			return ulz4fn(src, len, dst,
+				      ulz4f_content_size(src, len));
 #endif
 		default:
 			ERROR("tried to decompress %d bytes with algorithm #%x,"
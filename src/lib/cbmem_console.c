@@ -55,7 +55,7 @@ static struct cbmem_console car_cbmem_console CAR_CBMEM;
  * during the ROM stage, once CBMEM becomes available at RAM stage.
  */
 
-#if CONFIG_DYNAMIC_CBMEM
+#if CONFIG_DYNAMIC_CBMEM && CONFIG_EARLY_CBMEM_INIT
 #define STATIC_CONSOLE_SIZE 1024
 #else
 #define STATIC_CONSOLE_SIZE CONFIG_CONSOLE_CBMEM_BUFFER_SIZE
@@ -109,6 +109,24 @@ void cbmemc_tx_byte(unsigned char data)
 		cbm_cons_p->buffer_body[cursor] = data;
 }
 
+void cbmemc_tx_bytes(const unsigned char *data, size_t len)
+{
+	struct cbmem_console *cbm_cons_p = current_console();
+	u32 cursor;
+
+	if (!cbm_cons_p)
+		return;
+
+	cursor = cbm_cons_p->buffer_cursor;
+	cbm_cons_p->buffer_cursor += len;
+	if (cursor >= cbm_cons_p->buffer_size)
+		return;
+
+	if (len > cbm_cons_p->buffer_size - cursor)
+		len = cbm_cons_p->buffer_size - cursor;
+	memcpy(&cbm_cons_p->buffer_body[cursor], data, len);
+}
+
 /*
  * Copy the current console buffer (either from the cache as RAM area, or from
  * the static buffer, pointed at by cbmem_console_p) into the CBMEM console
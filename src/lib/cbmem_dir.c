@@ -0,0 +1,343 @@
+/*
+ * This file is part of the coreboot project.
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <cbmem_dir.h>
+
+#define ROOT_SLOT	0
+
+static uint32_t entry_align(uint32_t size)
+{
+	return size >= CBMEM_DIR_LARGE_ALIGN ?
+		CBMEM_DIR_LARGE_ALIGN : CBMEM_DIR_ALIGN;
+}
+
+/* Round size up to its alignment, 0 if it doesn't fit into 32 bits. */
+static uint32_t entry_size(uint32_t size)
+{
+	uint32_t align;
+
+	if (size == 0)
+		size = 1;
+	align = entry_align(size);
+	if (size > UINT32_MAX - (align - 1))
+		return 0;
+	return (size + align - 1) & ~(align - 1);
+}
+
+static int entry_slot(const struct cbmem_dir *dir,
+		      const struct cbmem_entry *entry)
+{
+	if (entry < &dir->slots[0] || entry >= &dir->slots[CBMEM_DIR_ENTRIES])
+		return -1;
+	if (entry->id == 0)
+		return -1;
+	return entry - &dir->slots[0];
+}
+
+/* Position in the index of the first entry with an id not below id. */
+static unsigned int index_search(const struct cbmem_dir *dir, uint32_t id)
+{
+	unsigned int lo = 0;
+	unsigned int hi = dir->num_entries;
+	unsigned int mid;
+
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		if (dir->slots[dir->index[mid]].id < id)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+/* Fill order with the slots sorted by offset, the one nearest to the top
+ * first. The slot skip is left out. Returns the number of slots. */
+static unsigned int sort_by_offset(const struct cbmem_dir *dir,
+				   uint8_t *order, int skip)
+{
+	unsigned int i, j, n = 0;
+	uint8_t slot;
+
+	for (i = 0; i < dir->num_entries; i++) {
+		slot = dir->index[i];
+		if (slot == skip)
+			continue;
+		for (j = n; j > 0; j--) {
+			if (dir->slots[order[j - 1]].offset <
+			    dir->slots[slot].offset)
+				break;
+			order[j] = order[j - 1];
+		}
+		order[j] = slot;
+		n++;
+	}
+	return n;
+}
+
+/* Find the place nearest to the top where size bytes fit, ignoring the
+ * entry in slot skip. Returns its offset or 0 if there is none. */
+static uint32_t entry_place(const struct cbmem_dir *dir, uint32_t size,
+			    int skip)
+{
+	uint8_t order[CBMEM_DIR_ENTRIES];
+	const struct cbmem_entry *e;
+	uint32_t align = entry_align(size);
+	uint32_t free_end = 0;
+	uint32_t offset;
+	unsigned int i, n;
+
+	n = sort_by_offset(dir, order, skip);
+
+	for (i = 0; i <= n; i++) {
+		/* Everything from free_end down to the next entry is free. */
+		if (free_end > UINT32_MAX - size - (align - 1))
+			return 0;
+		offset = (free_end + size + align - 1) & ~(align - 1);
+
+		if (i == n)
+			return offset <= dir->limit ? offset : 0;
+
+		e = &dir->slots[order[i]];
+		if (offset <= e->offset - e->size)
+			return offset;
+		if (e->offset > free_end)
+			free_end = e->offset;
+	}
+	return 0;
+}
+
+struct cbmem_dir *cbmem_dir_create(void *top, uint32_t limit,
+				   uint32_t root_id)
+{
+	struct cbmem_dir *dir;
+
+	if ((uintptr_t)top % CBMEM_DIR_LARGE_ALIGN ||
+	    (uintptr_t)top < CBMEM_DIR_ROOT_SIZE ||
+	    limit < CBMEM_DIR_ROOT_SIZE || root_id == 0)
+		return NULL;
+
+	dir = (struct cbmem_dir *)((uint8_t *)top - CBMEM_DIR_ROOT_SIZE);
+	memset(dir, 0, sizeof(*dir));
+
+	dir->slots[ROOT_SLOT].id = root_id;
+	dir->slots[ROOT_SLOT].offset = CBMEM_DIR_ROOT_SIZE;
+	dir->slots[ROOT_SLOT].size = CBMEM_DIR_ROOT_SIZE;
+	dir->index[0] = ROOT_SLOT;
+	dir->num_entries = 1;
+	dir->limit = limit;
+	dir->magic = CBMEM_DIR_MAGIC;
+
+	return dir;
+}
+
+struct cbmem_dir *cbmem_dir_recover(void *top)
+{
+	struct cbmem_dir *dir;
+	const struct cbmem_entry *e;
+	uint8_t order[CBMEM_DIR_ENTRIES];
+	uint64_t seen = 0;
+	uint32_t free_end = 0;
+	unsigned int i, n = 0;
+	uint8_t slot;
+
+	if (top == NULL || (uintptr_t)top % CBMEM_DIR_LARGE_ALIGN)
+		return NULL;
+
+	dir = (struct cbmem_dir *)((uint8_t *)top - CBMEM_DIR_ROOT_SIZE);
+
+	if (dir->magic != CBMEM_DIR_MAGIC || dir->num_entries == 0 ||
+	    dir->num_entries > CBMEM_DIR_ENTRIES ||
+	    dir->limit < CBMEM_DIR_ROOT_SIZE)
+		return NULL;
+
+	if (dir->slots[ROOT_SLOT].id == 0 ||
+	    dir->slots[ROOT_SLOT].offset != CBMEM_DIR_ROOT_SIZE ||
+	    dir->slots[ROOT_SLOT].size != CBMEM_DIR_ROOT_SIZE)
+		return NULL;
+
+	/* The index holds each used slot once, in ascending id order. */
+	for (i = 0; i < dir->num_entries; i++) {
+		slot = dir->index[i];
+		if (slot >= CBMEM_DIR_ENTRIES || (seen & (1ULL << slot)))
+			return NULL;
+		seen |= 1ULL << slot;
+
+		e = &dir->slots[slot];
+		if (e->id == 0 || e->size == 0 || e->size > e->offset ||
+		    e->offset > dir->limit || e->offset % CBMEM_DIR_ALIGN)
+			return NULL;
+		if (i > 0 && dir->slots[dir->index[i - 1]].id >= e->id)
+			return NULL;
+	}
+	for (i = 0; i < CBMEM_DIR_ENTRIES; i++) {
+		if (dir->slots[i].id != 0)
+			n++;
+	}
+	if (n != dir->num_entries)
+		return NULL;
+
+	/* No two entries overlap. */
+	n = sort_by_offset(dir, order, -1);
+	for (i = 0; i < n; i++) {
+		e = &dir->slots[order[i]];
+		if (e->offset - e->size < free_end)
+			return NULL;
+		free_end = e->offset;
+	}
+
+	return dir;
+}
+
+const struct cbmem_entry *cbmem_dir_find(const struct cbmem_dir *dir,
+					 uint32_t id)
+{
+	unsigned int pos = index_search(dir, id);
+	const struct cbmem_entry *e;
+
+	if (pos == dir->num_entries)
+		return NULL;
+
+	e = &dir->slots[dir->index[pos]];
+	return e->id == id ? e : NULL;
+}
+
+const struct cbmem_entry *cbmem_dir_add(struct cbmem_dir *dir, uint32_t id,
+					uint32_t size)
+{
+	const struct cbmem_entry *found;
+	struct cbmem_entry *e;
+	unsigned int pos, slot;
+	uint32_t offset;
+
+	if (id == 0)
+		return NULL;
+
+	found = cbmem_dir_find(dir, id);
+	if (found != NULL)
+		return found;
+
+	if (dir->num_entries == CBMEM_DIR_ENTRIES)
+		return NULL;
+
+	size = entry_size(size);
+	if (size == 0)
+		return NULL;
+
+	offset = entry_place(dir, size, -1);
+	if (offset == 0)
+		return NULL;
+
+	for (slot = 0; dir->slots[slot].id != 0; slot++)
+		;
+
+	e = &dir->slots[slot];
+	e->id = id;
+	e->offset = offset;
+	e->size = size;
+
+	pos = index_search(dir, id);
+	memmove(&dir->index[pos + 1], &dir->index[pos],
+		dir->num_entries - pos);
+	dir->index[pos] = slot;
+	dir->num_entries++;
+
+	return e;
+}
+
+int cbmem_dir_remove(struct cbmem_dir *dir, const struct cbmem_entry *entry)
+{
+	int slot = entry_slot(dir, entry);
+	unsigned int pos;
+
+	if (slot < 0 || slot == ROOT_SLOT)
+		return -1;
+
+	pos = index_search(dir, entry->id);
+	if (pos == dir->num_entries || dir->index[pos] != slot)
+		return -1;
+
+	memmove(&dir->index[pos], &dir->index[pos + 1],
+		dir->num_entries - pos - 1);
+	dir->num_entries--;
+	memset(&dir->slots[slot], 0, sizeof(dir->slots[slot]));
+
+	return 0;
+}
+
+int cbmem_dir_resize(struct cbmem_dir *dir, const struct cbmem_entry *entry,
+		     uint32_t size)
+{
+	int slot = entry_slot(dir, entry);
+	struct cbmem_entry *e;
+	uint8_t *top;
+	uint32_t offset;
+
+	if (slot < 0 || slot == ROOT_SLOT)
+		return -1;
+
+	size = entry_size(size);
+	if (size == 0)
+		return -1;
+
+	e = &dir->slots[slot];
+
+	/* Shrinking keeps the start, the tail becomes free. */
+	if (size <= e->size) {
+		e->size = size;
+		return 0;
+	}
+
+	/* The entry itself counts as free, so it may also grow in place or
+	 * move to a place that overlaps the old one. */
+	offset = entry_place(dir, size, slot);
+	if (offset == 0)
+		return -1;
+
+	top = cbmem_dir_top(dir);
+	if (offset != e->offset)
+		memmove(top - offset, top - e->offset, e->size);
+	e->offset = offset;
+	e->size = size;
+
+	return 0;
+}
+
+const struct cbmem_entry *cbmem_dir_entry(const struct cbmem_dir *dir,
+					  unsigned int n)
+{
+	if (n >= dir->num_entries)
+		return NULL;
+	return &dir->slots[dir->index[n]];
+}
+
+uint32_t cbmem_dir_used(const struct cbmem_dir *dir)
+{
+	uint32_t used = 0;
+	unsigned int i;
+
+	for (i = 0; i < dir->num_entries; i++) {
+		if (dir->slots[dir->index[i]].offset > used)
+			used = dir->slots[dir->index[i]].offset;
+	}
+	return used;
+}
@@ -1,7 +1,11 @@
 #include <delay.h>
+#include <thread.h>
 void mdelay(unsigned msecs)
 {
 	unsigned i;
+	/* Yield once for the whole delay instead of once per millisecond. */
+	if (!thread_yield_microseconds(msecs * 1000))
+		return;
 	for(i = 0; i < msecs; i++) {
 		udelay(1000);
 	}
@@ -0,0 +1,267 @@
+/*
+ * This file is part of the coreboot project.
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <types.h>
+#include <string.h>
+#include <bootmem.h>
+#include <bootstate.h>
+#include <cbmem.h>
+#include <cbmem_dir.h>
+#include <console/console.h>
+#include <console/cbmem_console.h>
+#include <arch/early_variables.h>
+#if CONFIG_HAVE_ACPI_RESUME && !defined(__PRE_RAM__)
+#include <arch/acpi.h>
+#endif
+
+/* Entries added after the memory map was written have to fit into what
+ * was reported there, so a bit more than the used part is reported. */
+#define CBMEM_BOOTMEM_SLACK	(64 * KiB)
+
+/* CBMEM must never grow down into the ramstage. */
+static uint32_t cbmem_limit(void *top)
+{
+	if ((uintptr_t)top <= CONFIG_RAMTOP)
+		return 0;
+	return (uintptr_t)top - CONFIG_RAMTOP;
+}
+
+static struct cbmem_dir *cbmem_get_dir(void)
+{
+	uint8_t *top = cbmem_top();
+	struct cbmem_dir *dir;
+
+	if (top == NULL)
+		return NULL;
+
+	/* Full validation is left to the recovery. */
+	dir = (struct cbmem_dir *)(top - CBMEM_DIR_ROOT_SIZE);
+	if (dir->magic != CBMEM_DIR_MAGIC)
+		return NULL;
+
+	return dir;
+}
+
+void cbmem_initialize_empty(void)
+{
+	void *top = cbmem_top();
+	struct cbmem_dir *dir = NULL;
+
+	if (top != NULL)
+		dir = cbmem_dir_create(top, cbmem_limit(top), CBMEM_ID_ROOT);
+
+	if (dir == NULL) {
+		printk(BIOS_CRIT, "Unable to set location for CBMEM.\n");
+		return;
+	}
+
+	printk(BIOS_DEBUG, "CBMEM: root @ %p, top @ %p\n", dir, top);
+}
+
+static int cbmem_check_dir(void)
+{
+	void *top = cbmem_top();
+
+	return top != NULL && cbmem_dir_recover(top) != NULL;
+}
+
+/* In romstage only used with EARLY_CBMEM_INIT, which the APU does not use. */
+#if CONFIG_EARLY_CBMEM_INIT || !defined(__PRE_RAM__)
+int cbmem_initialize(void)
+{
+	int found = cbmem_check_dir();
+
+	if (!found)
+		cbmem_initialize_empty();
+
+	cbmem_arch_init();
+	car_migrate_variables();
+	return !found;
+}
+#endif
+
+/* Returns True if it was not initialized before. */
+int cbmem_recovery(int is_wakeup)
+{
+	int found = cbmem_check_dir();
+	int wipe = 0;
+
+	/* CBMEM is wiped clean when we are not waking up from S3 suspend.
+	 * Boards with EARLY_CBMEM_INIT do this in romstage, boards without
+	 * EARLY_CBMEM_INIT do this in ramstage.
+	 */
+#if defined(__PRE_RAM__) && CONFIG_EARLY_CBMEM_INIT
+	wipe = 1;
+#endif
+#if !defined(__PRE_RAM__) && !CONFIG_EARLY_CBMEM_INIT
+	wipe = 1;
+#endif
+
+	if (!is_wakeup && wipe)
+		cbmem_initialize_empty();
+
+	if (is_wakeup && !found) {
+		cbmem_initialize_empty();
+		cbmem_fail_resume();
+	}
+
+	cbmem_arch_init();
+	car_migrate_variables();
+	return !found;
+}
+
+const struct cbmem_entry *cbmem_entry_add(u32 id, u64 size)
+{
+	struct cbmem_dir *dir = cbmem_get_dir();
+	const struct cbmem_entry *entry = NULL;
+
+	if (dir == NULL) {
+		printk(BIOS_ERR, "ERROR: CBMEM was not initialized yet.\n");
+		return NULL;
+	}
+
+	if (size <= UINT32_MAX)
+		entry = cbmem_dir_add(dir, id, size);
+
+	if (entry == NULL)
+		printk(BIOS_ERR, "ERROR: Not enough memory for table %x\n", id);
+
+	return entry;
+}
+
+const struct cbmem_entry *cbmem_entry_find(u32 id)
+{
+	struct cbmem_dir *dir = cbmem_get_dir();
+
+	if (dir == NULL)
+		return NULL;
+
+	return cbmem_dir_find(dir, id);
+}
+
+int cbmem_entry_remove(const struct cbmem_entry *entry)
+{
+	struct cbmem_dir *dir = cbmem_get_dir();
+
+	if (dir == NULL)
+		return -1;
+
+	return cbmem_dir_remove(dir, entry);
+}
+
+int cbmem_entry_resize(const struct cbmem_entry *entry, u64 size)
+{
+	struct cbmem_dir *dir = cbmem_get_dir();
+
+	if (dir == NULL || size > UINT32_MAX)
+		return -1;
+
+	return cbmem_dir_resize(dir, entry, size);
+}
+
+void *cbmem_entry_start(const struct cbmem_entry *entry)
+{
+	struct cbmem_dir *dir = cbmem_get_dir();
+
+	if (dir == NULL)
+		return NULL;
+
+	return cbmem_dir_entry_start(dir, entry);
+}
+
+u64 cbmem_entry_size(const struct cbmem_entry *entry)
+{
+	return entry->size;
+}
+
+void *cbmem_add(u32 id, u64 size)
+{
+	const struct cbmem_entry *entry;
+
+	entry = cbmem_entry_add(id, size);
+	if (entry == NULL)
+		return NULL;
+
+	return cbmem_entry_start(entry);
+}
+
+void *cbmem_find(u32 id)
+{
+	const struct cbmem_entry *entry;
+
+	entry = cbmem_entry_find(id);
+	if (entry == NULL)
+		return NULL;
+
+	return cbmem_entry_start(entry);
+}
+
+#ifndef __PRE_RAM__
+static void init_cbmem_post_device(void *unused)
+{
+#if CONFIG_HAVE_ACPI_RESUME
+	cbmem_recovery(acpi_is_wakeup());
+#else
+	cbmem_recovery(0);
+#endif
+#if CONFIG_CONSOLE_CBMEM
+	cbmemc_reinit();
+#endif
+}
+
+BOOT_STATE_INIT_ENTRIES(cbmem_bscb) = {
+	BOOT_STATE_INIT_ENTRY(BS_POST_DEVICE, BS_ON_ENTRY,
+	                      init_cbmem_post_device, NULL),
+};
+
+void cbmem_add_bootmem(void)
+{
+	struct cbmem_dir *dir = cbmem_get_dir();
+	uint32_t size;
+
+	if (dir == NULL)
+		return;
+
+	/* Allocations beyond the reported part fail from now on. */
+	size = cbmem_dir_used(dir) + CBMEM_BOOTMEM_SLACK;
+	if (size < dir->limit)
+		dir->limit = size;
+	else
+		size = dir->limit;
+
+	bootmem_add_range((uintptr_t)cbmem_dir_top(dir) - size, size,
+			  LB_MEM_TABLE);
+}
+
+void cbmem_list(void)
+{
+	struct cbmem_dir *dir = cbmem_get_dir();
+	const struct cbmem_entry *entry;
+	unsigned int i;
+
+	if (dir == NULL)
+		return;
+
+	for (i = 0; (entry = cbmem_dir_entry(dir, i)) != NULL; i++) {
+		cbmem_print_entry(i, entry->id,
+				  (uintptr_t)cbmem_dir_entry_start(dir, entry),
+				  entry->size);
+	}
+}
+#endif
@@ -205,6 +205,7 @@ static boot_state_t bs_os_resume_check(void *arg)
 static boot_state_t bs_os_resume(void *wake_vector)
 {
 #if CONFIG_HAVE_ACPI_RESUME
+	console_sync();
 	acpi_resume(wake_vector);
 #endif
 	return BS_WRITE_TABLES;
@@ -364,6 +365,8 @@ static void bs_walk_state_machine(void)
 
 		bs_run_timers(0);
 
+		console_poll();
+
 		bs_sample_time(state);
 
 		bs_call_callbacks(state, current_phase.seq);
@@ -19,10 +19,16 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+#include <arch/acpi.h>
+#include <bootstate.h>
 #include <console/console.h>
+#include <cpu/x86/ap_jobs.h>
 #include <fallback.h>
 #include <lib.h>
 #include <payload_loader.h>
+#include <smp/spinlock.h>
+#include <spi-generic.h>
 #include <timestamp.h>
 
 extern const struct payload_loader_ops vboot_payload_loader;
@@ -44,12 +50,10 @@ void __attribute__((weak)) mirror_payload(struct payload *payload)
 	return;
 }
 
-struct payload *payload_load(void)
+static int payload_locate(struct payload *payload)
 {
 	int i;
-	void *entry;
 	const struct payload_loader_ops *ops;
-	struct payload *payload = &global_payload;
 
 	for (i = 0; i < ARRAY_SIZE(payload_ops); i++) {
 		ops = payload_ops[i];
@@ -65,7 +69,113 @@ struct payload *payload_load(void)
 	}
 
 	if (i == ARRAY_SIZE(payload_ops))
+		return -1;
+
+	return 0;
+}
+
+/*
+ * The payload is read from the flash while the BSP initializes the devices,
+ * by an AP when there is one. The copy has to be done before the tables are
+ * written, as the S3 data is saved to the flash then.
+ *
+ * The copy goes to the heap. A payload bigger than PAYLOAD_PREFETCH_MAX, or
+ * one the heap has no room for, is loaded from the flash as before. It is copied in chunks with the SPI bus locked, so the BSP cannot
+ * program or erase the flash in the middle of one. The BSP takes what is
+ * left once it needs the payload, and only waits for the AP to finish its
+ * current chunk.
+ */
+#define PAYLOAD_PREFETCH_MAX	(CONFIG_HEAP_SIZE / 4)
+#define PAYLOAD_PREFETCH_CHUNK	(4 * KiB)
+
+static struct {
+	struct ap_job job;
+	struct buffer_area copy;
+	const char *src;
+	size_t next;		/* offset of the first chunk nobody has taken */
+	int queued;
+	int ready;
+} prefetch;
+
+DECLARE_SPIN_LOCK(prefetch_lock)
+
+static void payload_prefetch_copy(void *unused)
+{
+	size_t offset, size;
+
+	while (1) {
+		spin_lock(&prefetch_lock);
+		offset = prefetch.next;
+		size = MIN(prefetch.copy.size - offset, PAYLOAD_PREFETCH_CHUNK);
+		prefetch.next += size;
+		spin_unlock(&prefetch_lock);
+
+		if (size == 0)
+			break;
+
+		spi_flash_bus_lock();
+		memcpy((char *)prefetch.copy.data + offset,
+		       prefetch.src + offset, size);
+		spi_flash_bus_unlock();
+	}
+}
+
+static void payload_prefetch_start(void *unused)
+{
+	struct payload *payload = &global_payload;
+
+	if (acpi_slp_type == 3)
+		return;
+
+	if (payload_locate(payload) < 0)
+		return;
+
+	if (payload->backing_store.size > PAYLOAD_PREFETCH_MAX) {
+		printk(BIOS_DEBUG, "Payload too big to prefetch.\n");
+		return;
+	}
+
+	prefetch.src = payload->backing_store.data;
+	prefetch.copy.size = payload->backing_store.size;
+	prefetch.copy.data = malloc(prefetch.copy.size);
+	if (prefetch.copy.data == NULL) {
+		printk(BIOS_DEBUG, "No memory to prefetch the payload.\n");
+		return;
+	}
+	ap_job_queue(&prefetch.job, payload_prefetch_copy, NULL);
+	prefetch.queued = 1;
+}
+
+static void payload_prefetch_finish(void *unused)
+{
+	if (!prefetch.queued)
+		return;
+
+	/* Copy the rest here rather than wait for the AP to do it. */
+	payload_prefetch_copy(NULL);
+	ap_job_wait(&prefetch.job);
+	prefetch.ready = 1;
+}
+
+BOOT_STATE_INIT_ENTRIES(payload_prefetch_bscb) = {
+	BOOT_STATE_INIT_ENTRY(BS_DEV_INIT, BS_ON_ENTRY,
+	                      payload_prefetch_start, NULL),
+	BOOT_STATE_INIT_ENTRY(BS_WRITE_TABLES, BS_ON_ENTRY,
+	                      payload_prefetch_finish, NULL),
+};
+
+struct payload *payload_load(void)
+{
+	void *entry;
+	struct payload *payload = &global_payload;
+
+	if (prefetch.ready) {
+		printk(BIOS_DEBUG, "Using payload prefetched to %p.\n",
+		       prefetch.copy.data);
+		payload->backing_store = prefetch.copy;
+	} else if (payload_locate(payload) < 0) {
 		return NULL;
+	}
 
 	mirror_payload(payload);
 
@@ -97,5 +207,7 @@ void payload_run(const struct payload *payload)
 	 */
 	checkstack(_estack, 0);
 
+	console_sync();
+
 	arch_payload_run(payload);
 }
@@ -19,9 +19,11 @@
 
 #include <stdlib.h>
 #include <console/console.h>
+#include <arch/acpi.h>
 #include <arch/stages.h>
 #include <cbfs.h>
 #include <cbmem.h>
+#include <ramstage_cache.h>
 #include <ramstage_loader.h>
 #include <romstage_handoff.h>
 #include <timestamp.h>
@@ -54,6 +56,8 @@ load_ramstage(const struct ramstage_loader_ops *ops, struct romstage_handoff *ha
 	cache_loaded_ramstage(handoff, cbmem_entry, entry_point);
 
 	timestamp_add_now(TS_END_COPYRAM);
+	timestamp_add_now(TS_END_ROMSTAGE);
+	timestamp_handoff();
 
 	stage_exit(entry_point);
 }
@@ -78,6 +82,18 @@ static void run_ramstage_from_resume(struct romstage_handoff *handoff)
 			stage_exit(entry);
 		}
 	}
+
+#if CONFIG_HAVE_ACPI_RESUME && CONFIG_RAMSTAGE_CACHE
+	/* The fixed address ramstage is cached without the handoff. */
+	if (acpi_get_sleep_type() == 3) {
+		entry = ramstage_cache_load(ramstage_name);
+
+		if (entry != NULL) {
+			print_debug("Jumping to image.\n");
+			stage_exit(entry);
+		}
+	}
+#endif
 }
 
 void run_ramstage(void)
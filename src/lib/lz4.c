@@ -0,0 +1,57 @@
+/*
+ * This file is part of the coreboot project.
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston,  MA 02110-1301 USA
+ */
+
+#include "lz4dec.c"
+#include <console/console.h>
+#include <lib.h>
+#include <timestamp.h>
+
+size_t ulz4fn(const void *src, size_t srcn, void *dst, size_t dstn)
+{
+	size_t size;
+
+	/* Never let the decoder's end pointers wrap around. */
+	if (srcn > (size_t)0 - (size_t)src)
+		srcn = (size_t)0 - (size_t)src;
+	if (dstn > (size_t)0 - (size_t)dst)
+		dstn = (size_t)0 - (size_t)dst;
+
+	timestamp_add_now(TS_START_ULZ4F);
+	size = lz4_decode_frame(src, srcn, dst, dstn);
+	timestamp_add_now(TS_END_ULZ4F);
+	if (!size)
+		printk(BIOS_WARNING, "lz4: Decoding error.\n");
+	return size;
+}
+
+size_t ulz4f_content_size(const void *src, size_t srcn)
+{
+	if (srcn > (size_t)0 - (size_t)src)
+		srcn = (size_t)0 - (size_t)src;
+	return lz4_frame_content_size(src, srcn);
+}
+
+size_t ulz4f(const void *src, void *dst)
+{
+	size_t dstn = ulz4f_content_size(src, (size_t)-1);
+
+	if (!dstn)
+		return 0;
+	return ulz4fn(src, (size_t)-1, dst, dstn);
+}
@@ -0,0 +1,180 @@
+/*
+ * LZ4 frame decoder
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE
+ * FOR ANY DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "lz4dec.h"
+
+#define LZ4_MIN_MATCH		4
+
+static size_t lz4_get_le32(const unsigned char *p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((size_t)p[3] << 24);
+}
+
+/* Reads the 255 continued length bytes after a token nibble of 15. */
+static int lz4_get_length(const unsigned char **ip, const unsigned char *iend,
+			  size_t *len)
+{
+	unsigned char s;
+
+	do {
+		if (*ip >= iend)
+			return -1;
+		s = *(*ip)++;
+		*len += s;
+	} while (s == 255);
+	return 0;
+}
+
+/*
+ * Decodes one block to base + *out. base is the start of the whole output,
+ * so matches of a linked frame may reach back into the blocks before.
+ *
+ * Short literal runs and matches that are at least 8 bytes away are copied
+ * in 8 byte pieces as long as the output has room for the overshoot; the
+ * bytes past the end are overwritten by the next sequence.
+ */
+static int lz4_decode_block(const unsigned char *ip, size_t inn,
+			    unsigned char *base, size_t *out, size_t outn)
+{
+	const unsigned char *iend = ip + inn;
+	unsigned char *op = base + *out, *oend = base + outn;
+	const unsigned char *match;
+	size_t len, offset;
+	unsigned char token;
+
+	for (;;) {
+		if (ip >= iend)
+			return -1;
+		token = *ip++;
+
+		len = token >> 4;
+		if (len == 15 && lz4_get_length(&ip, iend, &len))
+			return -1;
+		if (len > (size_t)(iend - ip) || len > (size_t)(oend - op))
+			return -1;
+		if (len <= 16 && iend - ip >= 16 && oend - op >= 16)
+			memcpy(op, ip, 16);
+		else
+			memcpy(op, ip, len);
+		ip += len;
+		op += len;
+
+		/* The last sequence of a block has literals only. */
+		if (ip == iend)
+			break;
+
+		if (iend - ip < 2)
+			return -1;
+		offset = ip[0] | (ip[1] << 8);
+		ip += 2;
+		if (offset == 0 || offset > (size_t)(op - base))
+			return -1;
+
+		len = token & 15;
+		if (len == 15 && lz4_get_length(&ip, iend, &len))
+			return -1;
+		len += LZ4_MIN_MATCH;
+		if (len > (size_t)(oend - op))
+			return -1;
+
+		match = op - offset;
+		if (offset >= 8 && (size_t)(oend - op) >= len + 8) {
+			unsigned char *end = op + len;
+
+			do {
+				memcpy(op, match, 8);
+				op += 8;
+				match += 8;
+			} while (op < end);
+			op = end;
+		} else {
+			/* Overlapping, this repeats the last offset bytes. */
+			while (len--)
+				*op++ = *match++;
+		}
+	}
+
+	*out = op - base;
+	return 0;
+}
+
+size_t lz4_frame_content_size(const void *src, size_t srcn)
+{
+	const unsigned char *in = src;
+
+	if (srcn < LZ4_FRAME_MIN_SIZE + 8 || lz4_get_le32(in) != LZ4_FRAME_MAGIC)
+		return 0;
+	if ((in[4] & LZ4_FLG_VERSION_MASK) != LZ4_FLG_VERSION ||
+	    !(in[4] & LZ4_FLG_CONTENT_SIZE) || lz4_get_le32(in + 10) != 0)
+		return 0;
+	return lz4_get_le32(in + 6);
+}
+
+size_t lz4_decode_frame(const void *src, size_t srcn, void *dst, size_t dstn)
+{
+	const unsigned char *in = src;
+	size_t pos, out = 0, bsize, content = 0;
+	unsigned char flg;
+
+	if (srcn < LZ4_FRAME_MIN_SIZE || lz4_get_le32(in) != LZ4_FRAME_MAGIC)
+		return 0;
+	flg = in[4];
+	if ((flg & LZ4_FLG_VERSION_MASK) != LZ4_FLG_VERSION ||
+	    (flg & LZ4_FLG_DICT_ID))
+		return 0;
+	pos = 6;
+	if (flg & LZ4_FLG_CONTENT_SIZE) {
+		if (srcn < LZ4_FRAME_MIN_SIZE + 8)
+			return 0;
+		content = lz4_get_le32(in + pos);
+		if (lz4_get_le32(in + pos + 4) != 0 || content > dstn)
+			return 0;
+		pos += 8;
+	}
+	pos++;	/* header checksum */
+
+	for (;;) {
+		if (pos > srcn || srcn - pos < 4)
+			return 0;
+		bsize = lz4_get_le32(in + pos);
+		pos += 4;
+		if (bsize == 0)
+			break;	/* end mark, a content checksum may follow */
+
+		if ((bsize & ~LZ4_BLOCK_UNCOMPRESSED) > srcn - pos)
+			return 0;
+		if (bsize & LZ4_BLOCK_UNCOMPRESSED) {
+			bsize &= ~LZ4_BLOCK_UNCOMPRESSED;
+			if (bsize > dstn - out)
+				return 0;
+			memcpy((unsigned char *)dst + out, in + pos, bsize);
+			out += bsize;
+		} else if (lz4_decode_block(in + pos, bsize, dst, &out, dstn)) {
+			return 0;
+		}
+		pos += bsize;
+		if (flg & LZ4_FLG_BLOCK_CHECKSUM)
+			pos += 4;
+	}
+
+	if ((flg & LZ4_FLG_CONTENT_SIZE) && out != content)
+		return 0;
+	return out;
+}
@@ -0,0 +1,58 @@
+/*
+ * LZ4 frame decoder
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES ARE DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE
+ * FOR ANY DAMAGES ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __LZ4DEC_H
+#define __LZ4DEC_H
+
+#include <stddef.h>
+#include <string.h>
+
+/*
+ * CBFS_COMPRESS_LZ4 data is an LZ4 frame as written by util/cbfslz4 or the
+ * lz4 tool: magic, frame descriptor, blocks of at most 4MB, end mark. Only
+ * what the descriptor says is checked; the optional xxHash checksums are
+ * skipped, as CBFS has no checksum for LZMA data either.
+ *
+ * This file and lz4dec.c have no coreboot dependencies so that the host
+ * tools can use the same decoder (util/cbfslz4).
+ */
+
+#define LZ4_FRAME_MAGIC		0x184d2204
+#define LZ4_FRAME_MIN_SIZE	11	/* magic, FLG, BD, HC, end mark */
+
+/* FLG, the first byte of the frame descriptor */
+#define LZ4_FLG_VERSION_MASK	0xc0
+#define LZ4_FLG_VERSION		0x40
+#define LZ4_FLG_BLOCK_INDEP	0x20
+#define LZ4_FLG_BLOCK_CHECKSUM	0x10
+#define LZ4_FLG_CONTENT_SIZE	0x08	/* 64 bit size follows BD */
+#define LZ4_FLG_DICT_ID		0x01
+
+#define LZ4_BLOCK_UNCOMPRESSED	0x80000000
+
+/* Returns the decompressed size, or 0 on error. srcn and dstn bound the
+ * input and output, a frame that claims more than that is refused. */
+size_t lz4_decode_frame(const void *src, size_t srcn, void *dst, size_t dstn);
+
+/* Returns the content size from the frame descriptor, or 0 if the frame is
+ * invalid or does not carry one. */
+size_t lz4_frame_content_size(const void *src, size_t srcn);
+
+#endif
@@ -1,5 +1,5 @@
 /*
- * coreboot interface to memory-saving variant of LZMA decoder
+ * coreboot interface to the streaming variant of the LZMA decoder
  *
  * Copyright (C) 2006 Carl-Daniel Hailfinger
  * Released under the GNU GPL v2 or later
@@ -13,46 +13,189 @@
 #include <console/console.h>
 #include <string.h>
 #include <lib.h>
+#include <lzma.h>
+#include <timestamp.h>
 
-unsigned long ulzma(unsigned char * src, unsigned char * dst)
+#define LZMA_HEADER_SIZE	(LZMA_PROPERTIES_SIZE + 8)
+
+static int lzma_mem_open(struct cbfs_media *media)
 {
-	unsigned char properties[LZMA_PROPERTIES_SIZE];
-	UInt32 outSize;
-	SizeT inProcessed;
-	SizeT outProcessed;
-	int res;
-	CLzmaDecoderState state;
-	SizeT mallocneeds;
-#if !defined(__PRE_RAM__)
-	/* in ramstage, this can go in BSS */
-	static
-#endif
-	/* in pre-ram, it must go on the stack */
-	unsigned char scratchpad[15980];
+	return 0;
+}
+
+static size_t lzma_mem_read(struct cbfs_media *media, void *dest,
+			    size_t offset, size_t count)
+{
+	memcpy(dest, (void *)offset, count);
+	return count;
+}
+
+static int lzma_mem_close(struct cbfs_media *media)
+{
+	return 0;
+}
+
+/* Refill the decoder input. Reads after the first one start on a chunk
+ * boundary so that each one covers exactly one cache line of flash. */
+static int lzma_stream_read(void *object, const unsigned char **buffer,
+			    SizeT *size)
+{
+	struct lzma_stream *s = object;
+	size_t n = LZMA_STREAM_CHUNK - (s->offset % LZMA_STREAM_CHUNK);
+
+	if (n > s->remaining)
+		n = s->remaining;
+	if (n == 0 || s->media->read(s->media, s->chunk, s->offset, n) != n) {
+		printk(BIOS_WARNING, "lzma: Read error at 0x%zx.\n", s->offset);
+		return LZMA_RESULT_DATA_ERROR;
+	}
+	s->offset += n;
+	s->remaining -= n;
+	*buffer = s->chunk;
+	*size = n;
+	return LZMA_RESULT_OK;
+}
+
+int lzma_stream_init(struct lzma_stream *s, struct cbfs_media *media,
+		     size_t offset, size_t len, void *dst, size_t dst_size)
+{
+	unsigned char header[LZMA_HEADER_SIZE];
 	unsigned char *cp;
+	int i;
 
-	memcpy(properties, src, LZMA_PROPERTIES_SIZE);
-	/* The outSize in LZMA stream is a 64bit integer stored in little-endian
-	 * (ref: lzma.cc@LZMACompress: put_64). To prevent accessing by
-	 * unaligned memory address and to load in correct endianness, read each
-	 * byte and re-construct. */
-	cp = src + LZMA_PROPERTIES_SIZE;
-	outSize = cp[3] << 24 | cp[2] << 16 | cp[1] << 8 | cp[0];
-	if (LzmaDecodeProperties(&state.Properties, properties, LZMA_PROPERTIES_SIZE) != LZMA_RESULT_OK) {
+	s->error = 1;
+	if (media == NULL) {
+		s->mem_media.open = lzma_mem_open;
+		s->mem_media.read = lzma_mem_read;
+		s->mem_media.close = lzma_mem_close;
+		media = &s->mem_media;
+	}
+	s->media = media;
+	/* Never let a chunk read wrap around the end of the address space. */
+	if (len > (size_t)0 - offset)
+		len = (size_t)0 - offset;
+
+	if (len < LZMA_HEADER_SIZE) {
+		printk(BIOS_WARNING, "lzma: Stream too short.\n");
+		return -1;
+	}
+	media->open(media);
+	if (media->read(media, header, offset, sizeof(header)) != sizeof(header)) {
+		printk(BIOS_WARNING, "lzma: Read error at 0x%zx.\n", offset);
+		media->close(media);
+		return -1;
+	}
+	s->offset = offset + sizeof(header);
+	s->remaining = len - sizeof(header);
+
+	if (LzmaDecodeProperties(&s->dec.Properties, header, LZMA_PROPERTIES_SIZE) != LZMA_RESULT_OK) {
 		printk(BIOS_WARNING, "lzma: Incorrect stream properties.\n");
-		return 0;
+		media->close(media);
+		return -1;
 	}
-	mallocneeds = (LzmaGetNumProbs(&state.Properties) * sizeof(CProb));
-	if (mallocneeds > 15980) {
+	if (LzmaGetNumProbs(&s->dec.Properties) > LZMA_STREAM_PROBS) {
 		printk(BIOS_WARNING, "lzma: Decoder scratchpad too small!\n");
-		return 0;
+		media->close(media);
+		return -1;
+	}
+
+	/* The outSize in LZMA stream is a 64bit integer stored in little-endian
+	 * (ref: lzma.cc@LZMACompress: put_64). All ones means unknown, the
+	 * stream then ends with a marker. */
+	cp = header + LZMA_PROPERTIES_SIZE;
+	s->out_size = cp[3] << 24 | cp[2] << 16 | cp[1] << 8 | cp[0];
+	for (i = 4; i < 8 && cp[i] == 0; i++)
+		;
+	if (i < 8) {
+		for (i = 0; i < 8 && cp[i] == 0xff; i++)
+			;
+		if (i < 8) {
+			printk(BIOS_WARNING, "lzma: Stream too large.\n");
+			media->close(media);
+			return -1;
+		}
+		s->out_size = dst_size;
 	}
-	state.Probs = (CProb *)scratchpad;
-	res = LzmaDecode(&state, src + LZMA_PROPERTIES_SIZE + 8, (SizeT)0xffffffff, &inProcessed,
-		dst, outSize, &outProcessed);
-	if (res != 0) {
-		printk(BIOS_WARNING, "lzma: Decoding error = %d\n", res);
+	if (s->out_size > dst_size) {
+		printk(BIOS_WARNING, "lzma: %zu bytes do not fit into %zu.\n",
+		       s->out_size, dst_size);
+		media->close(media);
+		return -1;
+	}
+
+	s->dst = dst;
+	s->dec.Probs = s->probs;
+	s->dec.Read = lzma_stream_read;
+	s->dec.ReadObject = s;
+	s->dec.Buffer = s->dec.BufferLim = NULL;
+	if (LzmaStreamInit(&s->dec) != LZMA_RESULT_OK) {
+		media->close(media);
+		return -1;
+	}
+
+	s->error = 0;
+	return 0;
+}
+
+size_t lzma_stream_decode(struct lzma_stream *s, size_t out)
+{
+	SizeT done = s->dec.NowPos;
+
+	if (s->error)
+		return done;
+	if (out > s->out_size)
+		out = s->out_size;
+	if (LzmaStreamDecode(&s->dec, s->dst, out, &done) != LZMA_RESULT_OK) {
+		printk(BIOS_WARNING, "lzma: Decoding error at %u.\n",
+		       (unsigned int)done);
+		s->error = 1;
+	}
+	return done;
+}
+
+/* Returns the size of the output, or 0 unless the stream was decoded
+ * completely. */
+size_t lzma_stream_finish(struct lzma_stream *s)
+{
+	size_t done;
+
+	if (s->error)
+		return 0;
+	done = lzma_stream_decode(s, s->out_size);
+	s->media->close(s->media);
+	if (s->error)
+		return 0;
+	if (done != s->out_size && !LzmaStreamFinished(&s->dec)) {
+		printk(BIOS_WARNING, "lzma: Stream ended early.\n");
 		return 0;
 	}
-	return outSize;
+	return done;
+}
+
+size_t ulzma_media(struct cbfs_media *media, size_t offset, size_t srcn,
+		   void *dst, size_t dstn)
+{
+#if !defined(__PRE_RAM__)
+	/* in ramstage, this can go in BSS */
+	static
+#endif
+	/* in pre-ram, it must go on the stack */
+	struct lzma_stream stream;
+	size_t size = 0;
+
+	timestamp_add_now(TS_START_ULZMA);
+	if (!lzma_stream_init(&stream, media, offset, srcn, dst, dstn))
+		size = lzma_stream_finish(&stream);
+	timestamp_add_now(TS_END_ULZMA);
+	return size;
+}
+
+size_t ulzman(const void *src, size_t srcn, void *dst, size_t dstn)
+{
+	return ulzma_media(NULL, (size_t)src, srcn, dst, dstn);
+}
+
+unsigned long ulzma(unsigned char * src, unsigned char * dst)
+{
+	return ulzman(src, (size_t)-1, dst, (size_t)-1);
 }
@@ -50,6 +50,7 @@ int LzmaDecodeProperties(CLzmaProperties *propsRes, const unsigned char *propsDa
 #define LzmaGetNumProbs(Properties) (LZMA_BASE_SIZE + (LZMA_LIT_SIZE << ((Properties)->lc + (Properties)->lp)))
 
 #define kLzmaNeedInitId (-2)
+#define kLzmaStreamWasFinishedId (-1)
 
 typedef struct _CLzmaDecoderState
 {
@@ -60,8 +61,44 @@ typedef struct _CLzmaDecoderState
 } CLzmaDecoderState;
 
 
+#ifdef LZMA_ONESHOT
 int LzmaDecode(CLzmaDecoderState *vs,
     const unsigned char *inStream, SizeT inSize, SizeT *inSizeProcessed,
     unsigned char *outStream, SizeT outSize, SizeT *outSizeProcessed);
+#endif
+
+/*
+  Streaming decoder: input is pulled through Read() whenever the current
+  buffer runs dry, output may be requested in several steps. The output
+  buffer is the dictionary, so every call gets the same outStream and a
+  growing outSize.
+*/
+
+typedef int (*LzmaReadCallback)(void *object, const unsigned char **buffer, SizeT *size);
+
+typedef struct _CLzmaStreamState
+{
+  CLzmaProperties Properties;
+  CProb *Probs;
+
+  LzmaReadCallback Read;
+  void *ReadObject;
+  const Byte *Buffer;
+  const Byte *BufferLim;
+
+  UInt32 Range;
+  UInt32 Code;
+  int State;
+  UInt32 Reps[4];
+  int RemainLen;
+  Byte PreviousByte;
+  SizeT NowPos;
+} CLzmaStreamState;
+
+#define LzmaStreamFinished(vs) ((vs)->RemainLen == kLzmaStreamWasFinishedId)
+
+int LzmaStreamInit(CLzmaStreamState *vs);
+int LzmaStreamDecode(CLzmaStreamState *vs,
+    unsigned char *outStream, SizeT outSize, SizeT *outSizeProcessed);
 
 #endif
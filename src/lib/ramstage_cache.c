@@ -0,0 +1,252 @@
+/*
+ * This file is part of the coreboot project.
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <cbfs.h>
+#include <cbmem.h>
+#include <console/console.h>
+#include <ip_checksum.h>
+#include <ramstage_cache.h>
+#if !defined(__PRE_RAM__)
+#include <arch/acpi.h>
+#include <bootstate.h>
+#include <cpu/x86/ap_jobs.h>
+#include <lzma.h>
+#include <spi-generic.h>
+#include "lz4dec.h"
+#endif
+
+#define RAMSTAGE_CACHE_SPACE \
+	(CONFIG_RAMSTAGE_CACHE_SIZE - sizeof(struct ramstage_cache))
+
+#if defined(__PRE_RAM__)
+static int ramstage_cache_valid(struct ramstage_cache *cache,
+				const struct cbfs_stage *stage)
+{
+	if (cache->magic != RAMSTAGE_CACHE_MAGIC)
+		return 0;
+
+	/* A copy of another build, the flash was updated before the
+	 * suspend. */
+	if (memcmp(&cache->stage, stage, sizeof(*stage)))
+		return 0;
+
+	if (cache->size > RAMSTAGE_CACHE_SPACE ||
+	    cache->size > cache->stage.memlen)
+		return 0;
+
+	return cache->checksum == compute_ip_checksum(cache->program,
+						      cache->size);
+}
+
+void *ramstage_cache_load(const char *name)
+{
+	struct ramstage_cache *cache;
+	struct cbfs_stage *stage;
+	uint8_t *load;
+
+	cache = cbmem_find(CBMEM_ID_RAMSTAGE_CACHE);
+	if (cache == NULL)
+		return NULL;
+
+	/* Only the stage header is read from the flash. */
+	stage = cbfs_get_file_content(CBFS_DEFAULT_MEDIA, name,
+				      CBFS_TYPE_STAGE, NULL);
+	if (stage == NULL || !ramstage_cache_valid(cache, stage)) {
+		printk(BIOS_DEBUG, "Ramstage cache is not valid.\n");
+		return NULL;
+	}
+
+	printk(BIOS_DEBUG, "Loading ramstage from cache @ %p (%d bytes).\n",
+	       cache, cache->size);
+
+	load = (uint8_t *)(uintptr_t)cache->stage.load;
+	memcpy(load, cache->program, cache->size);
+	memset(load + cache->size, 0, cache->stage.memlen - cache->size);
+
+	return (void *)(uintptr_t)cache->stage.entry;
+}
+
+#else /* __PRE_RAM__ */
+
+/*
+ * The copy is decompressed from the flash again, by an AP when there is
+ * one, once CBMEM is up. Every access to the flash is done with the SPI
+ * bus locked, so the BSP cannot program or erase the flash in the middle
+ * of one.
+ */
+static struct {
+	struct ap_job job;
+	struct ramstage_cache *cache;
+	struct cbfs_stage stage;
+	struct cbfs_media default_media;
+	struct cbfs_media *media;
+	uint32_t offset;
+	int queued;
+} save;
+
+/* Not shared with ulzman(), which the BSP may use at the same time. */
+static struct lzma_stream save_lzma;
+
+/* LZMA streams through this media, which locks the bus for each chunk the
+ * decoder reads from save.media. */
+static int ramstage_cache_open(struct cbfs_media *media)
+{
+	return save.media->open(save.media);
+}
+
+static size_t ramstage_cache_read(struct cbfs_media *media, void *dest,
+				  size_t offset, size_t count)
+{
+	size_t ret;
+
+	spi_flash_bus_lock();
+	ret = save.media->read(save.media, dest, offset, count);
+	spi_flash_bus_unlock();
+	return ret;
+}
+
+static int ramstage_cache_close(struct cbfs_media *media)
+{
+	return save.media->close(save.media);
+}
+
+static struct cbfs_media save_locked_media = {
+	.open = ramstage_cache_open,
+	.read = ramstage_cache_read,
+	.close = ramstage_cache_close,
+};
+
+static void ramstage_cache_fill(void *unused)
+{
+	struct ramstage_cache *cache = save.cache;
+	const struct cbfs_stage *stage = &save.stage;
+	struct cbfs_media *media = save.media;
+	const uint8_t *src;
+	size_t space = RAMSTAGE_CACHE_SPACE;
+	size_t size = 0;
+
+	if (space > stage->memlen)
+		space = stage->memlen;
+
+	/* LZMA streams from the media, the others need the data mapped. */
+	if (stage->compression == CBFS_COMPRESS_LZMA) {
+		if (!lzma_stream_init(&save_lzma, &save_locked_media,
+				      save.offset, stage->len, cache->program,
+				      space))
+			size = lzma_stream_finish(&save_lzma);
+	} else {
+		media->open(media);
+		src = media->map(media, save.offset, stage->len);
+		media->close(media);
+		if (src == CBFS_MEDIA_INVALID_MAP_ADDRESS)
+			return;
+		/* The decoder reads the mapping as it goes, so the bus is
+		 * held for one pass over the data. Only LZMA is slow enough
+		 * to need locking per chunk. */
+		spi_flash_bus_lock();
+		switch (stage->compression) {
+		case CBFS_COMPRESS_LZ4:
+			size = lz4_decode_frame(src, stage->len,
+						cache->program, space);
+			break;
+		case CBFS_COMPRESS_NONE:
+			if (stage->len <= space) {
+				memcpy(cache->program, src, stage->len);
+				size = stage->len;
+			}
+			break;
+		}
+		spi_flash_bus_unlock();
+		media->unmap(media, src);
+	}
+
+	if (size == 0)
+		return;
+
+	cache->stage = *stage;
+	cache->size = size;
+	cache->checksum = compute_ip_checksum(cache->program, size);
+	cache->magic = RAMSTAGE_CACHE_MAGIC;
+}
+
+static void ramstage_cache_save_start(void *unused)
+{
+	struct cbfs_file file;
+	uint32_t offset;
+
+	if (acpi_slp_type == 3)
+		return;
+
+	save.media = CBFS_DEFAULT_MEDIA;
+	offset = cbfs_locate_file(&save.media, &save.default_media,
+				  CONFIG_CBFS_PREFIX "/ramstage", &file);
+	if (offset == CBFS_INVALID_OFFSET ||
+	    ntohl(file.type) != CBFS_TYPE_STAGE)
+		return;
+
+	/* Only the stage header is read here, the AP reads the rest. */
+	offset += ntohl(file.offset);
+	save.media->open(save.media);
+	if (save.media->read(save.media, &save.stage, offset,
+			     sizeof(save.stage)) != sizeof(save.stage)) {
+		save.media->close(save.media);
+		return;
+	}
+	save.media->close(save.media);
+	save.offset = offset + sizeof(save.stage);
+
+	save.cache = cbmem_add(CBMEM_ID_RAMSTAGE_CACHE,
+			       CONFIG_RAMSTAGE_CACHE_SIZE);
+	if (save.cache == NULL) {
+		printk(BIOS_ERR, "Could not add the ramstage cache.\n");
+		return;
+	}
+
+	save.cache->magic = 0;
+	ap_job_queue(&save.job, ramstage_cache_fill, NULL);
+	save.queued = 1;
+}
+
+static void ramstage_cache_save_finish(void *unused)
+{
+	if (!save.queued)
+		return;
+
+	ap_job_wait(&save.job);
+
+	if (save.cache->magic == RAMSTAGE_CACHE_MAGIC)
+		printk(BIOS_DEBUG, "Ramstage cached @ %p (%d bytes).\n",
+		       save.cache, save.cache->size);
+	else
+		printk(BIOS_ERR, "Could not cache the ramstage in %d bytes.\n",
+		       CONFIG_RAMSTAGE_CACHE_SIZE);
+}
+
+/* CBMEM is set up on entry to BS_POST_DEVICE. */
+BOOT_STATE_INIT_ENTRIES(ramstage_cache_bscb) = {
+	BOOT_STATE_INIT_ENTRY(BS_POST_DEVICE, BS_ON_EXIT,
+	                      ramstage_cache_save_start, NULL),
+	BOOT_STATE_INIT_ENTRY(BS_WRITE_TABLES, BS_ON_ENTRY,
+	                      ramstage_cache_save_finish, NULL),
+};
+
+#endif /* __PRE_RAM__ */
@@ -28,6 +28,7 @@
 #include <lib.h>
 #include <bootmem.h>
 #include <payload_loader.h>
+#include <timestamp.h>
 
 /* from ramstage.ld: */
 extern unsigned char _ram_seg;
@@ -388,7 +389,16 @@ static int load_self_segments(
 			switch(ptr->compression) {
 				case CBFS_COMPRESS_LZMA: {
 					printk(BIOS_DEBUG, "using LZMA\n");
-					len = ulzma(src, dest);
+					len = ulzman(src, ptr->s_filesz, dest,
+						     ptr->s_memsz);
+					if (!len) /* Decompression Error. */
+						return 0;
+					break;
+				}
+				case CBFS_COMPRESS_LZ4: {
+					printk(BIOS_DEBUG, "using LZ4\n");
+					len = ulz4fn(src, ptr->s_filesz, dest,
+						     ptr->s_memsz);
 					if (!len) /* Decompression Error. */
 						return 0;
 					break;
@@ -451,8 +461,10 @@ void *selfload(struct payload *payload)
 		goto out;
 
 	/* Load the segments */
+	timestamp_add_now(TS_START_SELF_SEGMENTS);
 	if (!load_self_segments(&head, payload))
 		goto out;
+	timestamp_add_now(TS_END_SELF_SEGMENTS);
 
 	printk(BIOS_SPEW, "Loaded segments\n");
 
@@ -0,0 +1,181 @@
+/*
+ * This file is part of the coreboot project.
+ *
+ * Copyright (C) 2013 Google, Inc.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#include <stddef.h>
+#include <timer.h>
+
+#define MAX_TIMER_QUEUE_ENTRIES 64
+
+/* The timer queue is implemented using a min heap. Therefore the first
+ * element is the one with smallest time to expiration. */
+struct timer_queue {
+	int num_entries;
+	int max_entries;
+	struct timeout_callback *queue[MAX_TIMER_QUEUE_ENTRIES];
+};
+
+static struct timer_queue global_timer_queue = {
+	.num_entries = 0,
+	.max_entries = MAX_TIMER_QUEUE_ENTRIES,
+	.queue = { 0 },
+};
+
+static inline int timer_queue_empty(struct timer_queue *tq)
+{
+	return tq->num_entries == 0;
+}
+
+static inline int timer_queue_full(struct timer_queue *tq)
+{
+	return tq->num_entries == tq->max_entries;
+}
+
+static inline struct timeout_callback *timer_queue_head(struct timer_queue *tq)
+{
+	if (timer_queue_empty(tq))
+		return NULL;
+	return tq->queue[0];
+}
+
+static inline int parent(int index)
+{
+	return (index - 1) / 2;
+}
+
+static inline int left_child(int index)
+{
+	return 2 * index + 1;
+}
+
+static inline int right_child(int index)
+{
+	return 2 * index + 2;
+}
+
+static inline void swap(struct timer_queue *tq, int i, int j)
+{
+	struct timeout_callback *tmp = tq->queue[i];
+
+	tq->queue[i] = tq->queue[j];
+	tq->queue[j] = tmp;
+}
+
+/* Return 1 if the entry at index i expires before the one at index j. */
+static inline int expires_before(struct timer_queue *tq, int i, int j)
+{
+	return mono_time_before(&tq->queue[i]->expiration,
+	                        &tq->queue[j]->expiration);
+}
+
+static void min_heapify(struct timer_queue *tq, int index)
+{
+	while (1) {
+		int left = left_child(index);
+		int right = right_child(index);
+		int min = index;
+
+		if (left < tq->num_entries && expires_before(tq, left, min))
+			min = left;
+
+		if (right < tq->num_entries && expires_before(tq, right, min))
+			min = right;
+
+		if (min == index)
+			break;
+
+		swap(tq, min, index);
+		index = min;
+	}
+}
+
+static int timer_queue_insert(struct timer_queue *tq,
+                              struct timeout_callback *tocb)
+{
+	int index;
+
+	/* No more slots. */
+	if (timer_queue_full(tq))
+		return -1;
+
+	index = tq->num_entries;
+	tq->num_entries++;
+	tq->queue[index] = tocb;
+
+	while (index != 0 && expires_before(tq, index, parent(index))) {
+		swap(tq, index, parent(index));
+		index = parent(index);
+	}
+
+	return 0;
+}
+
+/* Get the next callback to run which has expired by current_time. */
+static struct timeout_callback *
+timer_queue_expired(struct timer_queue *tq, struct mono_time *current_time)
+{
+	struct timeout_callback *tocb;
+
+	tocb = timer_queue_head(tq);
+
+	if (tocb == NULL)
+		return NULL;
+
+	/* The timeout callback hasn't expired yet. */
+	if (mono_time_before(current_time, &tocb->expiration))
+		return NULL;
+
+	/* Move the last entry to the top and restore the heap property. */
+	tq->num_entries--;
+	tq->queue[0] = tq->queue[tq->num_entries];
+	tq->queue[tq->num_entries] = NULL;
+	min_heapify(tq, 0);
+
+	return tocb;
+}
+
+int timer_sched_callback(struct timeout_callback *tocb, unsigned long us)
+{
+	struct mono_time current_time;
+
+	if ((long)us < 0)
+		return -1;
+
+	timer_monotonic_get(&current_time);
+	tocb->expiration = current_time;
+	mono_time_add_usecs(&tocb->expiration, us);
+
+	/* The expiration overflowed. */
+	if (us != 0 && !mono_time_before(&current_time, &tocb->expiration))
+		return -1;
+
+	return timer_queue_insert(&global_timer_queue, tocb);
+}
+
+int timers_run(void)
+{
+	struct timeout_callback *tocb;
+	struct mono_time current_time;
+
+	timer_monotonic_get(&current_time);
+	tocb = timer_queue_expired(&global_timer_queue, &current_time);
+
+	if (tocb != NULL)
+		tocb->callback(tocb);
+
+	return !timer_queue_empty(&global_timer_queue);
+}
@@ -0,0 +1,213 @@
+/*
+ * This file is part of the coreboot project.
+ *
+ * Copyright (C) 2011 The ChromiumOS Authors.  All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA, 02110-1301 USA
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <console/console.h>
+#include <cbmem.h>
+#include <timestamp.h>
+#include <arch/early_variables.h>
+
+#define MAX_TIMESTAMPS 128
+
+/*
+ * Until CBMEM is available the timestamps are kept in a small table of
+ * their own: in CAR for romstage, in .bss for ramstage. Entries are always
+ * stored relative to the base time of the table they live in.
+ */
+static struct timestamp_handoff ts_cache CAR_GLOBAL;
+static struct timestamp_table *ts_table_p CAR_GLOBAL = NULL;
+
+static void timestamp_table_add(struct timestamp_table *tst,
+				enum timestamp_id id, uint64_t ts_time)
+{
+	struct timestamp_entry *tse;
+
+	if (tst->num_entries >= tst->max_entries)
+		return;
+
+	tse = &tst->entries[tst->num_entries++];
+	tse->entry_id = id;
+	tse->entry_stamp = ts_time - tst->base_time;
+}
+
+/* Append the entries of src to dst, rebasing them onto dst->base_time. */
+static void timestamp_table_merge(struct timestamp_table *dst,
+				  const struct timestamp_table *src)
+{
+	uint32_t i;
+
+	for (i = 0; i < src->num_entries; i++)
+		timestamp_table_add(dst, src->entries[i].entry_id,
+			src->base_time + src->entries[i].entry_stamp);
+}
+
+static void timestamp_cache_init(struct timestamp_handoff *tsc,
+				 uint64_t base)
+{
+	tsc->magic = TIMESTAMP_HANDOFF_MAGIC;
+	tsc->table.base_time = base;
+	tsc->table.max_entries = TIMESTAMP_HANDOFF_ENTRIES;
+	tsc->table.num_entries = 0;
+}
+
+static struct timestamp_table *timestamp_table_get(void)
+{
+	struct timestamp_table *tst = car_get_var(ts_table_p);
+	struct timestamp_handoff *tsc;
+
+	if (tst != NULL)
+		return tst;
+
+	tsc = car_get_var_ptr(&ts_cache);
+	if (tsc->magic != TIMESTAMP_HANDOFF_MAGIC)
+		return NULL;
+
+	return &tsc->table;
+}
+
+/*
+ * Create the CBMEM table and move the cached entries over. An existing
+ * table is one left by a previous boot (S3 resume) or by romstage.
+ */
+static struct timestamp_table *timestamp_cbmem_init(uint64_t base,
+						    int keep_existing)
+{
+	struct timestamp_table *tst;
+
+	tst = cbmem_find(CBMEM_ID_TIMESTAMP);
+	if (tst == NULL || !keep_existing) {
+		if (tst == NULL)
+			tst = cbmem_add(CBMEM_ID_TIMESTAMP,
+				sizeof(struct timestamp_table) +
+				MAX_TIMESTAMPS * sizeof(struct timestamp_entry));
+		if (tst == NULL) {
+			printk(BIOS_ERR, "ERROR: failed to allocate timestamp table\n");
+			return NULL;
+		}
+		tst->base_time = base;
+		tst->max_entries = MAX_TIMESTAMPS;
+		tst->num_entries = 0;
+	}
+
+	return tst;
+}
+
+void timestamp_add(enum timestamp_id id, tsc_t ts_time)
+{
+	struct timestamp_table *tst = timestamp_table_get();
+
+	if (tst == NULL)
+		return;
+
+	timestamp_table_add(tst, id, tsc_to_uint64(ts_time));
+}
+
+void timestamp_add_now(enum timestamp_id id)
+{
+	timestamp_add(id, rdtsc());
+}
+
+#ifdef __PRE_RAM__
+
+void timestamp_init(tsc_t base)
+{
+	car_set_var(ts_table_p, NULL);
+	timestamp_cache_init(car_get_var_ptr(&ts_cache), tsc_to_uint64(base));
+}
+
+/* On S3 resume CBMEM is recovered in romstage, the cache goes straight into
+ * a fresh table there and ramstage will find it. */
+static void timestamp_migrate(void)
+{
+	struct timestamp_handoff *tsc = car_get_var_ptr(&ts_cache);
+	struct timestamp_table *tst;
+
+	if (tsc->magic != TIMESTAMP_HANDOFF_MAGIC)
+		return;
+
+	tst = timestamp_cbmem_init(tsc->table.base_time, 0);
+	if (tst == NULL)
+		return;
+
+	timestamp_table_merge(tst, &tsc->table);
+	car_set_var(ts_table_p, tst);
+}
+CAR_MIGRATE(timestamp_migrate)
+
+void timestamp_reinit(void)
+{
+	timestamp_migrate();
+}
+
+void timestamp_handoff(void)
+{
+	struct timestamp_handoff *tsc = car_get_var_ptr(&ts_cache);
+
+	if (car_get_var(ts_table_p) != NULL ||
+	    tsc->magic != TIMESTAMP_HANDOFF_MAGIC)
+		return;
+
+	memcpy((void *)TIMESTAMP_HANDOFF_ADDR, tsc, sizeof(*tsc));
+}
+
+#else
+
+void timestamp_init(tsc_t base)
+{
+	struct timestamp_handoff *handoff;
+
+#if CONFIG_EARLY_CBMEM_INIT
+	ts_table_p = cbmem_find(CBMEM_ID_TIMESTAMP);
+	if (ts_table_p != NULL)
+		return;
+#endif
+	/* Continue on the romstage base time so that the whole boot ends up
+	 * in one timeline, and take the entries before anything reuses the
+	 * memory they were left in. */
+	handoff = (struct timestamp_handoff *)TIMESTAMP_HANDOFF_ADDR;
+	if (handoff->magic == TIMESTAMP_HANDOFF_MAGIC &&
+	    handoff->table.num_entries <= TIMESTAMP_HANDOFF_ENTRIES) {
+		memcpy(&ts_cache, handoff, sizeof(ts_cache));
+		handoff->magic = 0;
+		return;
+	}
+
+	timestamp_cache_init(&ts_cache, tsc_to_uint64(base));
+}
+
+void timestamp_reinit(void)
+{
+	struct timestamp_table *tst;
+
+	if (ts_table_p != NULL || ts_cache.magic != TIMESTAMP_HANDOFF_MAGIC)
+		return;
+
+	/* A table created by romstage on S3 resume is kept and extended. */
+	tst = timestamp_cbmem_init(ts_cache.table.base_time, 1);
+	if (tst == NULL)
+		return;
+
+	timestamp_table_merge(tst, &ts_cache.table);
+	ts_cache.magic = 0;
+	ts_table_p = tst;
+}
+
+#endif
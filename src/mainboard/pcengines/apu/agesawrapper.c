@@ -31,12 +31,25 @@
 #include <string.h>
 
 #include <cpu/amd/agesa/s3_resume.h>
+#include <cpu/amd/agesa/mem_restore.h>
+#include <arch/cpu.h>
+#include <cbfs.h>
+#include <console/console.h>
+#include <option.h>
+#include <reset.h>
+#include <timestamp.h>
+#include "gpio_ftns.h"
+#include <sb_cimx.h>
 #include <vendorcode/amd/agesa/f14/Proc/CPU/heapManager.h>
 
 #define FILECODE UNASSIGNED_FILE_FILECODE
 
 #define MMCONF_ENABLE 1
 
+#define SPD_SIZE		128	/* SPDs for PCEngines/APU are all 128 bytes */
+#define MEM_RESTORE_MAX_FAILS	3	/* saturates the 2 bit CMOS counter */
+#define MC4_STATUS		0x411
+
 /* ACPI table pointers returned by AmdInitLate */
 VOID *DmiTable		= NULL;
 VOID *AcpiPstate	= NULL;
@@ -66,6 +79,182 @@ VOID *AcpiAlib		= NULL;
  *						L O C A L		F U N C T I O N S
  *------------------------------------------------------------------------------
  */
+#if CONFIG_HAVE_ACPI_RESUME
+/*
+ * Fast boot: with "fben1" in bootorder the memory context saved by AmdS3Save
+ * is handed back to AmdInitPost on a cold boot, which then restores the DQS
+ * timings instead of training. The context is only used when its signature
+ * matches this CPU, board and SPD, and only proven by a readback test of
+ * DRAM afterwards. mem_restore_pending in CMOS stays set until that test
+ * passes, so a hang or reset in between is counted in mem_restore_fails
+ * and the next boots train normally.
+ */
+static int mem_restore_get_id(struct mem_restore_id *id)
+{
+	const u8 *spd;
+	size_t spd_len;
+	int index = get_spd_offset();
+
+	spd = cbfs_get_file_content(CBFS_DEFAULT_MEDIA, "spd.bin",
+				    CBFS_TYPE_SPD_BIN, &spd_len);
+	if (!spd || spd_len < (index + 1) * SPD_SIZE)
+		return -1;
+
+	mem_restore_id_init(id, cpuid_eax(1),
+			    CONFIG_MAINBOARD_VENDOR " " CONFIG_MAINBOARD_PART_NUMBER,
+			    index, spd + index * SPD_SIZE, SPD_SIZE);
+	return 0;
+}
+
+#ifdef __PRE_RAM__
+static int mem_restore_prepare(AMD_POST_PARAMS *PostParams)
+{
+	struct mem_restore_id id;
+	enum mem_restore_result result;
+	u8 pending = 0, fails = 0;
+	u32 ctx_size;
+	void *ctx;
+
+	if (!cbfs_find_string("fben1", "bootorder"))
+		return 0;
+
+	/* Without CMOS a failed restore could not be caught, so train. */
+	if (get_option(&pending, "mem_restore_pending") != CB_SUCCESS ||
+	    get_option(&fails, "mem_restore_fails") != CB_SUCCESS)
+		return 0;
+
+	if (pending) {
+		printk(BIOS_WARNING, "Fast boot: previous memory restore did not complete\n");
+		pending = 0;
+		if (fails < MEM_RESTORE_MAX_FAILS)
+			fails++;
+		set_option("mem_restore_pending", &pending);
+		set_option("mem_restore_fails", &fails);
+		return 0;
+	}
+	if (fails >= MEM_RESTORE_MAX_FAILS) {
+		printk(BIOS_INFO, "Fast boot: disabled after %d failed restores\n", fails);
+		return 0;
+	}
+
+	if (mem_restore_get_id(&id))
+		return 0;
+
+	OemAgesaGetS3Info(S3DataTypeNonVolatile, &ctx_size, &ctx);
+	result = mem_restore_validate(s3_get_mem_restore_sig(), &id, ctx, ctx_size,
+			S3_DATA_NONVOLATILE_SIZE - S3_DATA_MEM_RESTORE_SIZE - sizeof(u32));
+	if (result != MEM_RESTORE_OK) {
+		printk(BIOS_INFO, "Fast boot: saved memory context %s, training\n",
+		       mem_restore_result_str(result));
+		return 0;
+	}
+
+	pending = 1;
+	set_option("mem_restore_pending", &pending);
+
+	PostParams->MemConfig.MemRestoreCtl = TRUE;
+	PostParams->MemConfig.MemContext.NvStorage = ctx;
+	PostParams->MemConfig.MemContext.NvStorageSize = ctx_size;
+	return 1;
+}
+
+static inline void mem_restore_flush(volatile u32 *p)
+{
+	asm volatile ("clflush (%0)" : : "r" (p) : "memory");
+}
+
+/*
+ * Write a distinct pattern at every power of two from RAMBASE up to TOM and
+ * read it back from DRAM. Wrong timings show up as bit errors, a wrong
+ * geometry as aliased addresses. The lines are flushed one by one, wbinvd
+ * would take cache-as-RAM with it. The old contents are put back since the
+ * AGESA heap already lives in DRAM.
+ */
+static int mem_restore_readback(void)
+{
+	u32 saved[32];
+	volatile u32 *p;
+	u32 addr, top;
+	int i, n, ret = 0;
+	msr_t msr;
+
+	top = rdmsr(TOP_MEM).lo;
+
+	for (n = 0, addr = CONFIG_RAMBASE; addr && addr < top && n < 32; addr <<= 1, n++) {
+		p = (volatile u32 *)addr;
+		saved[n] = *p;
+		*p = addr ^ 0x5aa5c33c;
+		mem_restore_flush(p);
+	}
+	asm volatile ("mfence" : : : "memory");
+
+	for (i = 0, addr = CONFIG_RAMBASE; i < n; addr <<= 1, i++) {
+		p = (volatile u32 *)addr;
+		if (*p != (addr ^ 0x5aa5c33c)) {
+			printk(BIOS_ERR, "Fast boot: readback mismatch at %x\n", addr);
+			ret = -1;
+		}
+		*p = saved[i];
+	}
+
+	/* The APU has no ECC, but the NB still logs what it sees. */
+	msr = rdmsr(MC4_STATUS);
+	if (msr.hi & (1 << 31)) {
+		printk(BIOS_ERR, "Fast boot: MC4 error %08x%08x\n", msr.hi, msr.lo);
+		ret = -1;
+	}
+
+	return ret;
+}
+
+static void mem_restore_finish(AMD_POST_PARAMS *PostParams, AGESA_STATUS status)
+{
+	u8 pending = 0;
+
+	if (!PostParams->MemConfig.MemRestoreCtl) {
+		/* AGESA refused the context and trained on its own. */
+		printk(BIOS_INFO, "Fast boot: memory context not restored, trained\n");
+	} else if (status != AGESA_SUCCESS || mem_restore_readback()) {
+		/* Leave pending set, the next boot counts it and trains. */
+		printk(BIOS_ERR, "Fast boot: restored memory is unusable, resetting\n");
+		hard_reset();
+		return;
+	} else {
+		printk(BIOS_INFO, "Fast boot: memory context restored\n");
+	}
+
+	set_option("mem_restore_pending", &pending);
+}
+#else
+/* Sign the context that was just saved, and give a newly trained one a fresh
+ * set of restore attempts. */
+static void mem_restore_sign(void)
+{
+	const struct mem_restore_sig *old = s3_get_mem_restore_sig();
+	struct mem_restore_sig sig;
+	struct mem_restore_id id;
+	u32 ctx_size;
+	void *ctx;
+	u8 fails = 0;
+
+	if (mem_restore_get_id(&id))
+		return;
+
+	OemAgesaGetS3Info(S3DataTypeNonVolatile, &ctx_size, &ctx);
+	if (ctx_size > S3_DATA_NONVOLATILE_SIZE - S3_DATA_MEM_RESTORE_SIZE - sizeof(u32))
+		return;
+
+	mem_restore_sig_fill(&sig, &id, ctx, ctx_size);
+	if (memcmp(old, &sig, sizeof(sig)) == 0)
+		return;
+
+	if (old->ctx_crc != sig.ctx_crc)
+		set_option("mem_restore_fails", &fails);
+	s3_save_mem_restore_sig(&sig);
+}
+#endif
+#endif
+
 UINT32
 agesawrapper_amdinitcpuio (
 	VOID
@@ -188,7 +377,9 @@ agesawrapper_amdinitreset (
 	AmdCreateStruct (&AmdParamStruct);
 	AmdResetParams.HtConfig.Depth = 0;
 
+	timestamp_add_now(TS_AGESA_INIT_RESET_START);
 	status = AmdInitReset ((AMD_RESET_PARAMS *)AmdParamStruct.NewStructPtr);
+	timestamp_add_now(TS_AGESA_INIT_RESET_DONE);
 	if (status != AGESA_SUCCESS) agesawrapper_amdreadeventlog();
 	AmdReleaseStruct (&AmdParamStruct);
 	return (UINT32)status;
@@ -216,7 +407,9 @@ agesawrapper_amdinitearly (
 	AmdEarlyParamsPtr = (AMD_EARLY_PARAMS *)AmdParamStruct.NewStructPtr;
 	OemCustomizeInitEarly (AmdEarlyParamsPtr);
 
+	timestamp_add_now(TS_AGESA_INIT_EARLY_START);
 	status = AmdInitEarly ((AMD_EARLY_PARAMS *)AmdParamStruct.NewStructPtr);
+	timestamp_add_now(TS_AGESA_INIT_EARLY_DONE);
 	if (status != AGESA_SUCCESS) agesawrapper_amdreadeventlog();
 	AmdReleaseStruct (&AmdParamStruct);
 
@@ -230,6 +423,10 @@ agesawrapper_amdinitpost (
 {
 	AGESA_STATUS status;
 	AMD_INTERFACE_PARAMS	AmdParamStruct;
+	AMD_POST_PARAMS *PostParams;
+#if CONFIG_HAVE_ACPI_RESUME && defined(__PRE_RAM__)
+	int restore;
+#endif
 
 	memset(&AmdParamStruct, 0, sizeof(AMD_INTERFACE_PARAMS));
 
@@ -241,8 +438,18 @@ agesawrapper_amdinitpost (
 	AmdParamStruct.StdHeader.ImageBasePtr = 0;
 
 	AmdCreateStruct (&AmdParamStruct);
-	status = AmdInitPost ((AMD_POST_PARAMS *)AmdParamStruct.NewStructPtr);
+	PostParams = (AMD_POST_PARAMS *)AmdParamStruct.NewStructPtr;
+#if CONFIG_HAVE_ACPI_RESUME && defined(__PRE_RAM__)
+	restore = mem_restore_prepare(PostParams);
+#endif
+	timestamp_add_now(TS_AGESA_INIT_POST_START);
+	status = AmdInitPost (PostParams);
+	timestamp_add_now(TS_AGESA_INIT_POST_DONE);
 	if (status != AGESA_SUCCESS) agesawrapper_amdreadeventlog();
+#if CONFIG_HAVE_ACPI_RESUME && defined(__PRE_RAM__)
+	if (restore)
+		mem_restore_finish(PostParams, status);
+#endif
 	AmdReleaseStruct (&AmdParamStruct);
 
 	/* Initialize heap space */
@@ -270,7 +477,9 @@ agesawrapper_amdinitenv (
 	AmdParamStruct.StdHeader.Func = 0;
 	AmdParamStruct.StdHeader.ImageBasePtr = 0;
 	AmdCreateStruct (&AmdParamStruct);
+	timestamp_add_now(TS_AGESA_INIT_ENV_START);
 	status = AmdInitEnv ((AMD_ENV_PARAMS *)AmdParamStruct.NewStructPtr);
+	timestamp_add_now(TS_AGESA_INIT_ENV_DONE);
 	if (status != AGESA_SUCCESS) agesawrapper_amdreadeventlog();
 	/* Initialize Subordinate Bus Number and Secondary Bus Number
 	 * In platform BIOS this address is allocated by PCI enumeration code
@@ -396,7 +605,12 @@ agesawrapper_amdinitmid (
 
 	AmdCreateStruct (&AmdParamStruct);
 
+	timestamp_add_now(TS_AGESA_INIT_MID_START);
+	/* The CIMx mid post init may be running on a thread. */
+	sb_cimx_lock();
 	status = AmdInitMid ((AMD_MID_PARAMS *)AmdParamStruct.NewStructPtr);
+	sb_cimx_unlock();
+	timestamp_add_now(TS_AGESA_INIT_MID_DONE);
 	if (status != AGESA_SUCCESS) agesawrapper_amdreadeventlog();
 	AmdReleaseStruct (&AmdParamStruct);
 
@@ -426,7 +640,9 @@ agesawrapper_amdinitlate (
 
 	printk (BIOS_DEBUG, "agesawrapper_amdinitlate: AmdLateParamsPtr = %X\n", (u32)AmdLateParamsPtr);
 
+	timestamp_add_now(TS_AGESA_INIT_LATE_START);
 	Status = AmdInitLate (AmdLateParamsPtr);
+	timestamp_add_now(TS_AGESA_INIT_LATE_DONE);
 	if (Status != AGESA_SUCCESS) {
 		agesawrapper_amdreadeventlog();
 		ASSERT(Status == AGESA_SUCCESS);
@@ -484,7 +700,9 @@ agesawrapper_amdinitresume (
 			   (u32 *) &AmdResumeParamsPtr->S3DataBlock.NvStorageSize,
 			   (void **) &AmdResumeParamsPtr->S3DataBlock.NvStorage);
 
+	timestamp_add_now(TS_AGESA_INIT_RESUME_START);
 	status = AmdInitResume ((AMD_RESUME_PARAMS *)AmdParamStruct.NewStructPtr);
+	timestamp_add_now(TS_AGESA_INIT_RESUME_DONE);
 
 	if (status != AGESA_SUCCESS) agesawrapper_amdreadeventlog();
 	AmdReleaseStruct (&AmdParamStruct);
@@ -522,7 +740,9 @@ agesawrapper_amds3laterestore (
 			   (u32 *) &AmdS3LateParamsPtr->S3DataBlock.VolatileStorageSize,
 			   (void **) &AmdS3LateParamsPtr->S3DataBlock.VolatileStorage);
 
+	timestamp_add_now(TS_AGESA_S3_LATE_START);
 	Status = AmdS3LateRestore (AmdS3LateParamsPtr);
+	timestamp_add_now(TS_AGESA_S3_LATE_DONE);
 	if (Status != AGESA_SUCCESS) {
 		agesawrapper_amdreadeventlog();
 		ASSERT(Status == AGESA_SUCCESS);
@@ -556,7 +776,9 @@ agesawrapper_amdS3Save (
 	AmdS3SaveParamsPtr = (AMD_S3SAVE_PARAMS *)AmdInterfaceParams.NewStructPtr;
 	AmdS3SaveParamsPtr->StdHeader = AmdInterfaceParams.StdHeader;
 
+	timestamp_add_now(TS_AGESA_S3_SAVE_START);
 	Status = AmdS3Save (AmdS3SaveParamsPtr);
+	timestamp_add_now(TS_AGESA_S3_SAVE_DONE);
 	if (Status != AGESA_SUCCESS) {
 		agesawrapper_amdreadeventlog();
 		ASSERT(Status == AGESA_SUCCESS);
@@ -579,6 +801,7 @@ agesawrapper_amdS3Save (
 			);
 	}
 
+	mem_restore_sign();
 	OemAgesaSaveMtrr();
 	AmdReleaseStruct (&AmdInterfaceParams);
 
@@ -46,6 +46,7 @@
 #include <cbfs.h>
 #include "gpio_ftns.h"
 #include <pc80/mc146818rtc.h>
+#include <timestamp.h>
 
 #define MSR_MTRR_VARIABLE_BASE6  0x020C
 #define MSR_MTRR_VARIABLE_MASK6  0x020D
@@ -61,11 +62,19 @@
 #define MSR_CPUID_NAME_STRING1   0xC0010031
 #define MSR_CPUID_NAME_STRING2   0XC0010032
 
-void cache_as_ram_main(unsigned long bist, unsigned long cpu_init_detectedx)
+void cache_as_ram_main(unsigned long bist, unsigned long cpu_init_detectedx,
+		       const tsc_t *car_tsc)
 {
 	u32 val;
 	u32 mmio_base;
 
+	if (boot_cpu()) {
+		timestamp_init(car_tsc[0]);
+		timestamp_add(TS_BEFORE_CAR_INIT, car_tsc[0]);
+		timestamp_add(TS_AFTER_CAR_INIT, car_tsc[1]);
+		timestamp_add_now(TS_START_ROMSTAGE);
+	}
+
 	/* PC Engines requires system boot when power is applied. This feature is
 	 * controlled in PM_REG 5Bh register. "Always Power On" works by writing a
 	 * value of 05h.
@@ -238,6 +247,13 @@ void cache_as_ram_main(unsigned long bist, unsigned long cpu_init_detectedx)
 		else
 			printk(BIOS_DEBUG, "passed.\n");
 
+		/*
+		 * Teardown begins with CBMEM recovery, which moves the timestamps
+		 * out of CAR. The CAR contents are thrown away by the stack move,
+		 * so nothing is recorded again until ramstage.
+		 */
+		timestamp_add_now(TS_BEFORE_CAR_TEARDOWN);
+
 		post_code(0x61);
 		printk(BIOS_DEBUG, "Find resume memory location\n");
 		resume_backup_memory = backup_resume();
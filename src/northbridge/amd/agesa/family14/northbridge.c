@@ -32,6 +32,7 @@
 
 #include <cpu/x86/lapic.h>
 #include <cpu/amd/mtrr.h>
+#include <cpu/x86/msr.h>
 
 #include "agesawrapper.h"
 #include "northbridge.h"
@@ -358,6 +359,21 @@ static void nb_read_resources(device_t dev)
 #endif
 }
 
+#if CONFIG_MMCONF_SUPPORT
+/* MMCONFIG is enabled in romstage by agesawrapper_amdinitmmio(). */
+unsigned int pci_mmconf_buses(void)
+{
+	msr_t msr = rdmsr(MMIO_CONF_BASE);
+
+	if (!(msr.lo & MMIO_CONF_ENABLE) || msr.hi ||
+	    (msr.lo & MMIO_CONF_BASE_ADDR_MASK) != CONFIG_MMCONF_BASE_ADDRESS)
+		return 0;
+
+	return 1 << ((msr.lo >> MMIO_CONF_BUS_RANGE_SHIFT) &
+		     MMIO_CONF_BUS_RANGE_MASK);
+}
+#endif
+
 static void set_resource(device_t dev, struct resource *resource, u32 nodeid)
 {
 	resource_t rbase, rend;
@@ -58,6 +58,7 @@ typedef union _PCI_ADDR {
 #endif
 
 #include <console/console.h>
+#include "sb_cimx.h"
 #include "AmdSbLib.h"
 #include "Amd.h"
 #include "SB800.h"
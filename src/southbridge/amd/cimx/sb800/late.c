@@ -22,6 +22,7 @@
 #include <device/pci.h>		/* device_operations */
 #include <device/pci_ids.h>
 #include <bootstate.h>
+#include <thread.h>
 #include <arch/ioapic.h>
 #include <device/smbus.h>	/* smbus_bus_operations */
 #include <pc80/mc146818rtc.h>
@@ -290,43 +291,114 @@ struct device_operations bridge_ops = {
 	.ops_pci          = &lops_pci,
 };
 
+/*
+ * The CIMx mid post init runs on a thread (see sb_Mid_Post_Init()), so CIMx
+ * code can run while the main thread goes on with the device init and
+ * AmdInitMid. The two share sb_config, the PM and PM2 index/data ports
+ * (0xCD6/0xCD7, 0xCD0/0xCD1), the PCI config ports and the ACPI MMIO
+ * PM registers.
+ *
+ * sb_cimx_mutex serializes all of that. It is held for every CIMx dispatch
+ * and for AmdInitMid (agesawrapper_amdinitmid()), and is only dropped while
+ * SbStall() waits. So the only overlap is the main thread running during a
+ * CIMx stall, which is always between two complete register accesses: a
+ * stall never splits an index write from its data access, and neither does
+ * pm_ioread()/pm_iowrite() or a PCI config access. Main thread code that
+ * does a read-modify-write of a PM register and may yield in between (e.g.
+ * with udelay()) has to take the lock with sb_cimx_lock().
+ */
+static struct thread_mutex sb_cimx_mutex;
+
+void sb_cimx_lock(void)
+{
+	thread_mutex_lock(&sb_cimx_mutex);
+}
+
+void sb_cimx_unlock(void)
+{
+	thread_mutex_unlock(&sb_cimx_mutex);
+}
+
+/*
+ * Called by SbStall(). Other threads only get to run if the current one
+ * holds sb_cimx_mutex (i.e. the stall is within sb_dispatch()). A CIMx call
+ * made without the lock busy-waits instead, so that neither a lock it does
+ * not own is dropped nor other CIMx code runs in the middle of it.
+ */
+int sb_stall_yield(unsigned microsecs)
+{
+	int ret;
+
+	if (!thread_mutex_held(&sb_cimx_mutex))
+		return -1;
+
+	sb_cimx_unlock();
+	ret = thread_yield_microseconds(microsecs);
+	sb_cimx_lock();
+
+	return ret;
+}
+
+static void sb_dispatch(u32 func)
+{
+	sb_cimx_lock();
+	sb_config->StdHeader.Func = func;
+	AmdSbDispatcher(sb_config);
+	sb_cimx_unlock();
+}
+
 /**
  * South Bridge CIMx ramstage entry point wrapper.
  */
 void sb_Before_Pci_Init(void)
 {
-	sb_config->StdHeader.Func = SB_BEFORE_PCI_INIT;
-	AmdSbDispatcher(sb_config);
+	sb_dispatch(SB_BEFORE_PCI_INIT);
 }
 
 void sb_After_Pci_Init(void)
 {
-	sb_config->StdHeader.Func = SB_AFTER_PCI_INIT;
-	AmdSbDispatcher(sb_config);
+	sb_dispatch(SB_AFTER_PCI_INIT);
+}
+
+static void sb_mid_post_thread(void *unused)
+{
+	sb_dispatch(SB_MID_POST_INIT);
 }
 
+/*
+ * Stack needed to run the CIMx dispatcher on a thread. The deepest path
+ * (through SbStall() and the scheduler, or into die()) takes about 1.1KiB;
+ * this leaves twice that. Finished threads report their stack use at
+ * BIOS_SPEW level.
+ */
+#define SB_MID_POST_STACK_SIZE 0x900
+
+/*
+ * In IDE mode the mid post init waits for every attached drive to become
+ * ready, up to 30s per port. Do that on a thread so that the device init
+ * goes on meanwhile. It has to be done before sb_Late_Post() switches the
+ * SATA class code, which happens when the tables are written.
+ */
 void sb_Mid_Post_Init(void)
 {
-	sb_config->StdHeader.Func = SB_MID_POST_INIT;
-	AmdSbDispatcher(sb_config);
+	if (CONFIG_STACK_SIZE < SB_MID_POST_STACK_SIZE ||
+	    thread_run_until(sb_mid_post_thread, NULL, BS_DEV_INIT, BS_ON_EXIT))
+		sb_mid_post_thread(NULL);
 }
 
 void sb_Late_Post(void)
 {
-	sb_config->StdHeader.Func = SB_LATE_POST_INIT;
-	AmdSbDispatcher(sb_config);
+	sb_dispatch(SB_LATE_POST_INIT);
 }
 
 void sb_Before_Pci_Restore_Init(void)
 {
-	sb_config->StdHeader.Func = SB_BEFORE_PCI_RESTORE_INIT;
-	AmdSbDispatcher(sb_config);
+	sb_dispatch(SB_BEFORE_PCI_RESTORE_INIT);
 }
 
 void sb_After_Pci_Restore_Init(void)
 {
-	sb_config->StdHeader.Func = SB_AFTER_PCI_RESTORE_INIT;
-	AmdSbDispatcher(sb_config);
+	sb_dispatch(SB_AFTER_PCI_RESTORE_INIT);
 }
 
 /*
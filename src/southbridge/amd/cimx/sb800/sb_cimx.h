@@ -34,6 +34,20 @@ void sb_After_Pci_Restore_Init(void);
 
 int acpi_is_wakeup_early(void);
 
+/**
+ * Serialize against CIMx code running on the mid post thread, see late.c.
+ * sb_stall_yield() lets other threads run during an SbStall().
+ */
+#if CONFIG_COOP_MULTITASKING && !defined(__SMM__) && !defined(__PRE_RAM__)
+void sb_cimx_lock(void);
+void sb_cimx_unlock(void);
+int sb_stall_yield(unsigned microsecs);
+#else
+static inline void sb_cimx_lock(void) {}
+static inline void sb_cimx_unlock(void) {}
+static inline int sb_stall_yield(unsigned microsecs) { return -1; }
+#endif
+
 /**
  * CIMX not set the clock to 48Mhz until sbBeforePciInit,
  * coreboot may need to set this even more earlier
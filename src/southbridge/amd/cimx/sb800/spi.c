@@ -24,6 +24,7 @@
 #include <device/device.h>
 #include <device/pci.h>
 #include <device/pci_ops.h>
+#include <smp/spinlock.h>
 
 #if IS_ENABLED(CONFIG_SB800_IMC_FWM)
 #include "SBPLATFORM.h"
@@ -34,6 +35,20 @@ static int bus_claimed = 0;
 
 static u32 spibar;
 
+/* Only the BSP sends commands, so the claim depth needs no lock. */
+DECLARE_SPIN_LOCK(spi_bus_lock)
+static int spi_bus_depth;
+
+void spi_flash_bus_lock(void)
+{
+	spin_lock(&spi_bus_lock);
+}
+
+void spi_flash_bus_unlock(void)
+{
+	spin_unlock(&spi_bus_lock);
+}
+
 static void reset_internal_fifo_pointer(void)
 {
 	do {
@@ -106,11 +121,14 @@ static void ImcSleep(void)
 	u8	reg0_val = 0;		/* clear response register */
 	u8	reg1_val = 0xB4;	/* request ownership flag */
 
+	/* The mailbox wait stalls, see sb_stall_yield() */
+	sb_cimx_lock();
 	WriteECmsg (MSG_REG0, AccWidthUint8, &reg0_val);
 	WriteECmsg (MSG_REG1, AccWidthUint8, &reg1_val);
 	WriteECmsg (MSG_SYS_TO_IMC, AccWidthUint8, &cmd_val);
 
 	WaitForEcLDN9MailboxCmdAck();
+	sb_cimx_unlock();
 }
 
 
@@ -120,16 +138,23 @@ static void ImcWakeup(void)
 	u8	reg0_val = 0;		/* clear response register */
 	u8	reg1_val = 0xB5;	/* release ownership flag */
 
+	/* The mailbox wait stalls, see sb_stall_yield() */
+	sb_cimx_lock();
 	WriteECmsg (MSG_REG0, AccWidthUint8, &reg0_val);
 	WriteECmsg (MSG_REG1, AccWidthUint8, &reg1_val);
 	WriteECmsg (MSG_SYS_TO_IMC, AccWidthUint8, &cmd_val);
 
 	WaitForEcLDN9MailboxCmdAck();
+	sb_cimx_unlock();
 }
 #endif
 
 int spi_claim_bus(struct spi_slave *slave)
 {
+	/* The flash commands claim the bus again for every command. */
+	if (spi_bus_depth++ == 0)
+		spi_flash_bus_lock();
+
 #if IS_ENABLED(CONFIG_SB800_IMC_FWM)
 	if (slave->rw == SPI_WRITE_FLAG) {
 		bus_claimed++;
@@ -152,6 +177,9 @@ void spi_release_bus(struct spi_slave *slave)
 		}
 	}
 #endif
+
+	if (--spi_bus_depth == 0)
+		spi_flash_bus_unlock();
 }
 
 void spi_cs_activate(struct spi_slave *slave)
@@ -64,6 +64,10 @@ SbStall (
   UINT32 startTime;
   UINT32 elapsedTime;
 
+  // In ramstage another thread may run meanwhile (no-op elsewhere)
+  if ( sb_stall_yield (uSec) == 0 ) {
+    return;
+  }
   ReadMEM (ACPI_MMIO_BASE + PMIO_BASE + SB_PMIOA_REG64, AccWidthUint16, &timerAddr);
   if ( timerAddr == 0 ) {
     uSec = uSec / 2;
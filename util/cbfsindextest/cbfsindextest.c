@@ -0,0 +1,408 @@
+/*
+ * cbfsindextest, check the CBFS directory index against the linear walk
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA, 02110-1301 USA
+ */
+
+/*
+ * Runs src/lib/cbfs_core.c against synthetic CBFS images held in an
+ * in-memory cbfs_media. Every name is looked up once with the index and
+ * once with the plain walk, and both have to return the same file:
+ *
+ *   cc -O2 -idirafter src/include -o cbfsindextest \
+ *      util/cbfsindextest/cbfsindextest.c
+ *   ./cbfsindextest [-n rounds] [-s seed]
+ *
+ * The media counts every read() and map(), which on the board is an
+ * access to SPI flash, and the totals of both lookup methods are printed
+ * at the end. Exits with 1 on the first failure.
+ */
+
+#include <arpa/inet.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#define CONFIG_CBFS_INDEX_ENTRIES	32
+#define CBFS_CORE_WITH_INDEX
+
+/* cbfs_core.c only uses these to test pointer alignment. */
+typedef uintptr_t u32;
+typedef uint8_t u8;
+
+#define ERROR(x...)
+#define LOG(x...)
+#define DEBUG(x...)
+
+#define CBFS_HEADER_ROM_ADDRESS	header_address
+#define CONFIG_ROM_SIZE		ROM_SIZE
+
+/* Keep cbfs.h and its coreboot table dependencies out. */
+#define _CBFS_H_
+#include "../../src/include/cbfs_core.h"
+
+#define ROM_SIZE	(256 * 1024)
+#define ALIGN		64
+#define MAX_FILES	48
+#define ARRAY_SIZE(a)	(sizeof(a) / sizeof((a)[0]))
+
+static uint32_t header_address;
+static int init_default_cbfs_media(struct cbfs_media *media);
+
+#include "../../src/lib/cbfs_core.c"
+
+static uint8_t rom[ROM_SIZE];
+static struct cbfs_index index_storage;
+static int use_index;
+static int failed;
+
+struct counts {
+	unsigned long accesses;
+	unsigned long bytes;
+};
+
+static struct counts *counting;
+static struct counts linear_counts, index_counts, build_counts;
+
+static char names[MAX_FILES][32];
+static uint32_t offsets[MAX_FILES];
+static int file_count;
+
+#define check(cond) do { \
+	if (!(cond)) { \
+		fprintf(stderr, "%s:%d: check failed: %s\n", \
+			__FILE__, __LINE__, #cond); \
+		failed = 1; \
+		return; \
+	} \
+} while (0)
+
+static void account(size_t count)
+{
+	if (counting == NULL)
+		return;
+	counting->accesses++;
+	counting->bytes += count;
+}
+
+static int mem_open(struct cbfs_media *media __attribute__((unused)))
+{
+	return 0;
+}
+
+static int mem_close(struct cbfs_media *media __attribute__((unused)))
+{
+	return 0;
+}
+
+static size_t mem_read(struct cbfs_media *media __attribute__((unused)),
+		       void *dest, size_t offset, size_t count)
+{
+	if (offset > ROM_SIZE || count > ROM_SIZE - offset)
+		return 0;
+	account(count);
+	memcpy(dest, rom + offset, count);
+	return count;
+}
+
+static void *mem_map(struct cbfs_media *media __attribute__((unused)),
+		     size_t offset, size_t count)
+{
+	if (offset > ROM_SIZE || count > ROM_SIZE - offset)
+		return CBFS_MEDIA_INVALID_MAP_ADDRESS;
+	account(count);
+	return rom + offset;
+}
+
+static void *mem_unmap(struct cbfs_media *media __attribute__((unused)),
+		       const void *address __attribute__((unused)))
+{
+	return NULL;
+}
+
+static int init_default_cbfs_media(struct cbfs_media *media)
+{
+	media->context = NULL;
+	media->open = mem_open;
+	media->close = mem_close;
+	media->read = mem_read;
+	media->map = mem_map;
+	media->unmap = mem_unmap;
+	return 0;
+}
+
+struct cbfs_index *cbfs_get_index(void)
+{
+	return use_index ? &index_storage : NULL;
+}
+
+static uint32_t align_up(uint32_t value)
+{
+	return (value + ALIGN - 1) & ~(ALIGN - 1);
+}
+
+/* Lays out the master header at the start of the ROM followed by 'count'
+ * files with random sizes, named from 'fixed' or at random. With 'gaps',
+ * some files are preceded by an aligned block of erased flash that the
+ * walk has to skip. */
+static void build_image(int count, int gaps, const char * const *fixed)
+{
+	struct cbfs_header *header;
+	struct cbfs_file *file;
+	uint32_t offset, len, name_len, j;
+	int i;
+
+	memset(rom, 0xff, sizeof(rom));
+	header_address = 0;
+	header = (struct cbfs_header *)rom;
+	header->magic = htonl(CBFS_HEADER_MAGIC);
+	header->version = htonl(CBFS_HEADER_VERSION);
+	header->romsize = htonl(ROM_SIZE);
+	header->bootblocksize = htonl(0);
+	header->align = htonl(ALIGN);
+	header->offset = htonl(ALIGN);
+
+	offset = ALIGN;
+	file_count = 0;
+	for (i = 0; i < count; i++) {
+		if (gaps && rand() % 4 == 0)
+			offset += ALIGN * (1 + rand() % 3);
+
+		if (fixed != NULL) {
+			strcpy(names[i], fixed[i]);
+			name_len = strlen(names[i]);
+		} else {
+			name_len = 1 + rand() % 20;
+			for (j = 0; j < name_len; j++)
+				names[i][j] = 'a' + rand() % 26;
+			names[i][name_len] = '\0';
+		}
+		/* Names are stored padded to 16 bytes like cbfstool does. */
+		name_len = (name_len + 16) & ~15;
+		len = rand() % 3000;
+
+		if (offset + sizeof(*file) + name_len + len > ROM_SIZE)
+			break;
+		file = (struct cbfs_file *)(rom + offset);
+		memcpy(file->magic, CBFS_FILE_MAGIC, sizeof(file->magic));
+		file->len = htonl(len);
+		file->type = htonl(CBFS_TYPE_RAW);
+		file->checksum = 0;
+		file->offset = htonl(sizeof(*file) + name_len);
+		memset(CBFS_NAME(file), 0, name_len);
+		strcpy(CBFS_NAME(file), names[i]);
+		memset(CBFS_SUBHEADER(file), i, len);
+
+		offsets[i] = offset;
+		file_count++;
+		offset = align_up(offset + sizeof(*file) + name_len + len);
+	}
+	index_storage.magic = 0;
+}
+
+/* The file the walk finds first, which is the one the index must give. */
+static struct cbfs_file *expected(const char *name)
+{
+	int i;
+
+	for (i = 0; i < file_count; i++) {
+		if (strcmp(names[i], name) == 0)
+			return (struct cbfs_file *)(rom + offsets[i]);
+	}
+	return NULL;
+}
+
+static struct cbfs_file *lookup(const char *name, int indexed,
+				struct counts *counts)
+{
+	struct cbfs_file *file;
+
+	use_index = indexed;
+	counting = counts;
+	file = cbfs_get_file(CBFS_DEFAULT_MEDIA, name);
+	counting = NULL;
+	return file;
+}
+
+static void compare(const char *name)
+{
+	struct cbfs_file *linear, *indexed;
+
+	linear = lookup(name, 0, &linear_counts);
+	indexed = lookup(name, 1, &index_counts);
+	check(linear == expected(name));
+	check(indexed == linear);
+}
+
+static void test_lookups(int count, int gaps)
+{
+	char missing[40];
+	int i;
+
+	build_image(count, gaps, NULL);
+
+	/* The first lookup pays for building the index. */
+	use_index = 1;
+	counting = &build_counts;
+	cbfs_get_file(CBFS_DEFAULT_MEDIA, names[0]);
+	counting = NULL;
+	check(index_storage.magic == CBFS_INDEX_MAGIC);
+	if (file_count <= CONFIG_CBFS_INDEX_ENTRIES)
+		check(index_storage.flags & CBFS_INDEX_COMPLETE);
+	else
+		check(!(index_storage.flags & CBFS_INDEX_COMPLETE));
+
+	/* Lookups binary-search the entries by hash. */
+	for (i = 1; i < index_storage.count; i++)
+		check(index_storage.entries[i - 1].hash <=
+		      index_storage.entries[i].hash);
+
+	for (i = 0; i < file_count; i++) {
+		compare(names[i]);
+		if (failed)
+			return;
+	}
+
+	/* Names that are not in the image, including empty and prefixes. */
+	compare("");
+	compare("fallback/payload");
+	snprintf(missing, sizeof(missing), "%sx", names[0]);
+	compare(missing);
+	if (strlen(names[0]) > 1) {
+		snprintf(missing, sizeof(missing), "%.*s",
+			 (int)strlen(names[0]) - 1, names[0]);
+		compare(missing);
+	}
+}
+
+/* Pairs of names with the same FNV-1a hash. */
+static void test_collision(void)
+{
+	static const char * const colliding[] = {
+		"costarring", "liquid", "declinate", "macallums",
+		"altarage", "zinke",
+	};
+	int i;
+
+	check(cbfs_name_hash("costarring") == cbfs_name_hash("liquid"));
+	build_image(ARRAY_SIZE(colliding), 0, colliding);
+	for (i = 0; i < file_count; i++) {
+		compare(names[i]);
+		if (failed)
+			return;
+	}
+	/* Only one of a pair present, the other must not match it. */
+	build_image(1, 0, &colliding[1]);
+	compare("costarring");
+	compare("liquid");
+}
+
+/* A hit in a complete index touches only the file it returns. */
+static void test_no_walk(void)
+{
+	struct counts counts = { 0, 0 };
+	struct cbfs_file *file;
+
+	build_image(CONFIG_CBFS_INDEX_ENTRIES / 2, 1, NULL);
+	lookup(names[0], 1, NULL);
+	check(index_storage.flags & CBFS_INDEX_COMPLETE);
+
+	file = lookup(names[file_count - 1], 1, &counts);
+	check(file == expected(names[file_count - 1]));
+	/* Master header, file header and name, then the mapped file. */
+	check(counts.accesses == 4);
+
+	counts.accesses = 0;
+	check(lookup("not-there", 1, &counts) == NULL);
+	check(counts.accesses == 1);
+}
+
+/* Changing the flash under a built index must not return stale data. */
+static void test_stale(void)
+{
+	struct cbfs_file *file;
+	int victim;
+
+	build_image(CONFIG_CBFS_INDEX_ENTRIES / 2, 0, NULL);
+	lookup(names[0], 1, NULL);
+	check(index_storage.magic == CBFS_INDEX_MAGIC);
+
+	/* Shrink a file in place, the index still has the old length. */
+	victim = file_count / 2;
+	file = (struct cbfs_file *)(rom + offsets[victim]);
+	file->len = htonl(ntohl(file->len) / 2);
+	check(lookup(names[victim], 1, NULL) == NULL ||
+	      index_storage.magic != CBFS_INDEX_MAGIC);
+	check(lookup(names[victim], 1, NULL) == file);
+
+	/* Erase a file, the walk and the index have to agree again. */
+	memset(file->magic, 0xff, sizeof(file->magic));
+	check(lookup(names[victim], 1, NULL) == lookup(names[victim], 0, NULL));
+
+	/* A different image layout invalidates the index on its own. */
+	build_image(CONFIG_CBFS_INDEX_ENTRIES / 4, 1, NULL);
+	index_storage.magic = CBFS_INDEX_MAGIC;
+	index_storage.first_offset = 0;
+	check(lookup(names[1], 1, NULL) == expected(names[1]));
+}
+
+int main(int argc, char **argv)
+{
+	unsigned int seed = 1;
+	int rounds = 200;
+	int opt, i;
+
+	while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+		switch (opt) {
+		case 'n':
+			rounds = atoi(optarg);
+			break;
+		case 's':
+			seed = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-n rounds] [-s seed]\n",
+				argv[0]);
+			return 1;
+		}
+	}
+
+	test_no_walk();
+	if (!failed)
+		test_stale();
+	if (!failed)
+		test_collision();
+
+	srand(seed);
+	for (i = 0; i < rounds && !failed; i++) {
+		test_lookups(1 + rand() % MAX_FILES, i & 1);
+		if (failed)
+			fprintf(stderr, "round %d, seed %u\n", i, seed);
+	}
+	if (failed)
+		return 1;
+
+	printf("%d rounds, seed %u\n", rounds, seed);
+	printf("linear:  %lu accesses, %lu bytes\n",
+	       linear_counts.accesses, linear_counts.bytes);
+	printf("indexed: %lu accesses, %lu bytes "
+	       "(+%lu accesses, %lu bytes building)\n",
+	       index_counts.accesses, index_counts.bytes,
+	       build_counts.accesses, build_counts.bytes);
+	return 0;
+}
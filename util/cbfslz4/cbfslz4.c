@@ -0,0 +1,664 @@
+/*
+ * cbfslz4, LZ4 compress CBFS stages and payloads and compare them with LZMA
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA, 02110-1301 USA
+ */
+
+/*
+ * Our cbfstool only knows LZMA, so LZ4 files are made from the uncompressed
+ * ones it extracts (see cbfs_add_compressed in build.sh):
+ *
+ *   cc -O2 -o cbfslz4 util/cbfslz4/cbfslz4.c
+ *   cbfstool scratch.rom add-stage -f ramstage.elf -n s -c none
+ *   cbfstool scratch.rom extract -n s -f s.bin
+ *   ./cbfslz4 stage s.bin s.lz4
+ *   cbfstool coreboot.rom add -f s.lz4 -n fallback/ramstage -t stage
+ *
+ * "payload" does the same for the CODE and DATA segments of a payload.
+ *
+ *   ./cbfslz4 bench [-n iterations] [-f flash MB/s] build/coreboot.rom
+ *
+ * decodes every LZMA and LZ4 stage and payload segment of an image with the
+ * decoders of src/lib, recompresses it with LZ4 where it was LZMA, and
+ * prints the sizes and the decompression speed of both. With -f the time to
+ * read the compressed data from flash at that rate is added, which is what
+ * decides the choice on the board: LZ4 decodes several times faster but
+ * reads more.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../../src/lib/lz4dec.c"
+#define LZMA_ONESHOT
+#include "../../src/lib/lzmadecode.c"
+
+/* Keep in sync with src/include/cbfs_core.h, the segment types are
+ * compared in the byte order of the target like selfboot.c does. */
+#define CBFS_TYPE_STAGE		0x10
+#define CBFS_TYPE_PAYLOAD	0x20
+#define CBFS_COMPRESS_NONE	0
+#define CBFS_COMPRESS_LZMA	1
+#define CBFS_COMPRESS_LZ4	2
+#define CBFS_STAGE_SIZE		28
+#define CBFS_SEGMENT_SIZE	28
+#define PAYLOAD_SEGMENT_CODE	0x45444F43
+#define PAYLOAD_SEGMENT_DATA	0x41544144
+#define PAYLOAD_SEGMENT_ENTRY	0x52544E45
+
+#define LZMA_HEADER_SIZE	(LZMA_PROPERTIES_SIZE + 8)
+#define MAX_PROBS		(LZMA_BASE_SIZE + (LZMA_LIT_SIZE << 3))
+
+/* Compressor limits from the LZ4 block format. */
+#define LZ4_HASH_LOG		16
+#define LZ4_MAX_OFFSET		65535
+#define LZ4_MAX_CHAIN		256
+#define LZ4_LAST_LITERALS	5	/* a block ends with 5 literals */
+#define LZ4_MFLIMIT		12	/* no match starts in the last 12 */
+#define LZ4_MAX_BLOCK		(4 << 20)
+#define LZ4_BD_4MB		0x70
+
+static uint32_t get_be32(const uint8_t *p)
+{
+	return p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+static uint32_t get_le32(const uint8_t *p)
+{
+	return (uint32_t)p[3] << 24 | p[2] << 16 | p[1] << 8 | p[0];
+}
+
+static void put_be32(uint8_t *p, uint32_t v)
+{
+	p[0] = v >> 24;
+	p[1] = v >> 16;
+	p[2] = v >> 8;
+	p[3] = v;
+}
+
+static void put_le32(uint8_t *p, uint32_t v)
+{
+	p[0] = v;
+	p[1] = v >> 8;
+	p[2] = v >> 16;
+	p[3] = v >> 24;
+}
+
+static void *xmalloc(size_t size)
+{
+	void *p = malloc(size ? size : 1);
+
+	if (p == NULL) {
+		fprintf(stderr, "out of memory\n");
+		exit(1);
+	}
+	return p;
+}
+
+static uint8_t *read_file(const char *name, size_t *size)
+{
+	uint8_t *buf;
+	FILE *f;
+
+	f = fopen(name, "rb");
+	if (f == NULL) {
+		perror(name);
+		exit(1);
+	}
+	fseek(f, 0, SEEK_END);
+	*size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	buf = xmalloc(*size);
+	if (fread(buf, 1, *size, f) != *size) {
+		fprintf(stderr, "%s: read error\n", name);
+		exit(1);
+	}
+	fclose(f);
+	return buf;
+}
+
+static void write_file(const char *name, const uint8_t *buf, size_t size)
+{
+	FILE *f;
+
+	f = fopen(name, "wb");
+	if (f == NULL || fwrite(buf, 1, size, f) != size || fclose(f)) {
+		perror(name);
+		exit(1);
+	}
+}
+
+/* xxHash32, only needed for the header checksum byte of the frame. */
+#define XXH_P1	2654435761U
+#define XXH_P2	2246822519U
+#define XXH_P3	3266489917U
+#define XXH_P4	668265263U
+#define XXH_P5	374761393U
+#define XXH_ROTL(x, r)	(((x) << (r)) | ((x) >> (32 - (r))))
+
+static uint32_t xxh32(const uint8_t *p, size_t len, uint32_t seed)
+{
+	const uint8_t *end = p + len;
+	uint32_t h, v[4];
+	int i;
+
+	if (len >= 16) {
+		v[0] = seed + XXH_P1 + XXH_P2;
+		v[1] = seed + XXH_P2;
+		v[2] = seed;
+		v[3] = seed - XXH_P1;
+		for (; p + 16 <= end; p += 16)
+			for (i = 0; i < 4; i++) {
+				v[i] += get_le32(p + 4 * i) * XXH_P2;
+				v[i] = XXH_ROTL(v[i], 13) * XXH_P1;
+			}
+		h = XXH_ROTL(v[0], 1) + XXH_ROTL(v[1], 7) +
+			XXH_ROTL(v[2], 12) + XXH_ROTL(v[3], 18);
+	} else {
+		h = seed + XXH_P5;
+	}
+	h += len;
+	for (; p + 4 <= end; p += 4)
+		h = XXH_ROTL(h + get_le32(p) * XXH_P3, 17) * XXH_P4;
+	for (; p < end; p++)
+		h = XXH_ROTL(h + *p * XXH_P5, 11) * XXH_P1;
+	h ^= h >> 15;
+	h *= XXH_P2;
+	h ^= h >> 13;
+	h *= XXH_P3;
+	h ^= h >> 16;
+	return h;
+}
+
+static uint32_t lz4_hash(const uint8_t *p)
+{
+	return (get_le32(p) * XXH_P1) >> (32 - LZ4_HASH_LOG);
+}
+
+static size_t lz4_put_length(uint8_t *op, size_t len)
+{
+	size_t n = 0;
+
+	for (; len >= 255; len -= 255)
+		op[n++] = 255;
+	op[n++] = len;
+	return n;
+}
+
+static size_t lz4_put_sequence(uint8_t *op, const uint8_t *lit, size_t nlit,
+			       size_t offset, size_t len)
+{
+	uint8_t *start = op, *token = op++;
+
+	*token = (nlit < 15 ? nlit : 15) << 4;
+	if (nlit >= 15)
+		op += lz4_put_length(op, nlit - 15);
+	memcpy(op, lit, nlit);
+	op += nlit;
+	if (len == 0)
+		return op - start;
+
+	*op++ = offset;
+	*op++ = offset >> 8;
+	len -= LZ4_MIN_MATCH;
+	*token |= len < 15 ? len : 15;
+	if (len >= 15)
+		op += lz4_put_length(op, len - 15);
+	return op - start;
+}
+
+/*
+ * Hash chain match finder with lazy matching. Firmware images
+ * are small enough that ratio matters more than compression speed, the
+ * decoder does not care how the matches were found.
+ */
+struct lz4_matcher {
+	const uint8_t *src;
+	size_t next;		/* first position not in the chains yet */
+	size_t matchlimit;	/* matches end before the last literals */
+	int32_t *head;
+	int32_t *chain;
+};
+
+static void lz4_insert_until(struct lz4_matcher *m, size_t pos)
+{
+	uint32_t h;
+
+	for (; m->next <= pos; m->next++) {
+		h = lz4_hash(m->src + m->next);
+		m->chain[m->next] = m->head[h];
+		m->head[h] = m->next;
+	}
+}
+
+static size_t lz4_find_best(struct lz4_matcher *m, size_t pos, size_t *offset)
+{
+	const uint8_t *src = m->src;
+	int32_t c;
+	size_t best = 0, l;
+	int depth = LZ4_MAX_CHAIN;
+
+	lz4_insert_until(m, pos);
+	for (c = m->chain[pos]; c >= 0 && pos - c <= LZ4_MAX_OFFSET && depth--;
+	     c = m->chain[c]) {
+		if (src[c + best] != src[pos + best])
+			continue;
+		for (l = 0; pos + l < m->matchlimit && src[c + l] == src[pos + l];)
+			l++;
+		if (l > best) {
+			best = l;
+			*offset = pos - c;
+		}
+	}
+	return best;
+}
+
+static size_t lz4_compress_block(const uint8_t *src, size_t n, uint8_t *dst)
+{
+	struct lz4_matcher m;
+	size_t ip = 0, anchor = 0, op = 0;
+	size_t mflimit = n > LZ4_MFLIMIT ? n - LZ4_MFLIMIT : 0;
+	size_t len, offset = 0, len2, offset2 = 0;
+	size_t i;
+
+	m.src = src;
+	m.next = 0;
+	m.matchlimit = n > LZ4_LAST_LITERALS ? n - LZ4_LAST_LITERALS : 0;
+	m.head = xmalloc(sizeof(*m.head) << LZ4_HASH_LOG);
+	m.chain = xmalloc(sizeof(*m.chain) * (n + 1));
+	for (i = 0; i < 1 << LZ4_HASH_LOG; i++)
+		m.head[i] = -1;
+
+	while (ip < mflimit) {
+		len = lz4_find_best(&m, ip, &offset);
+		if (len < LZ4_MIN_MATCH) {
+			ip++;
+			continue;
+		}
+		while (ip + 1 < mflimit) {
+			len2 = lz4_find_best(&m, ip + 1, &offset2);
+			if (len2 <= len)
+				break;
+			ip++;
+			len = len2;
+			offset = offset2;
+		}
+		op += lz4_put_sequence(dst + op, src + anchor, ip - anchor,
+				       offset, len);
+		ip += len;
+		anchor = ip;
+	}
+	op += lz4_put_sequence(dst + op, src + anchor, n - anchor, 0, 0);
+
+	free(m.head);
+	free(m.chain);
+	return op;
+}
+
+/* Writes an LZ4 frame with the content size, which SeaBIOS needs to list
+ * .lz4 files, and independent 4MB blocks. */
+static uint8_t *lz4_compress_frame(const uint8_t *src, size_t n, size_t *size)
+{
+	uint8_t *dst = xmalloc(n + n / 255 + 64 + 8 * (n / LZ4_MAX_BLOCK + 1));
+	size_t op = 0, pos, bn, cn;
+
+	put_le32(dst, LZ4_FRAME_MAGIC);
+	dst[4] = LZ4_FLG_VERSION | LZ4_FLG_BLOCK_INDEP | LZ4_FLG_CONTENT_SIZE;
+	dst[5] = LZ4_BD_4MB;
+	put_le32(dst + 6, n);
+	put_le32(dst + 10, 0);
+	dst[14] = xxh32(dst + 4, 10, 0) >> 8;
+	op = 15;
+
+	for (pos = 0; pos < n; pos += bn) {
+		bn = n - pos < LZ4_MAX_BLOCK ? n - pos : LZ4_MAX_BLOCK;
+		cn = lz4_compress_block(src + pos, bn, dst + op + 4);
+		if (cn >= bn) {
+			memcpy(dst + op + 4, src + pos, bn);
+			put_le32(dst + op, bn | LZ4_BLOCK_UNCOMPRESSED);
+			op += 4 + bn;
+		} else {
+			put_le32(dst + op, cn);
+			op += 4 + cn;
+		}
+	}
+	put_le32(dst + op, 0);
+	*size = op + 4;
+	return dst;
+}
+
+/* Compresses and decodes again, nothing unverified goes into an image. */
+static uint8_t *lz4_compress_checked(const uint8_t *src, size_t n,
+				     size_t *size)
+{
+	uint8_t *frame = lz4_compress_frame(src, n, size);
+	uint8_t *check = xmalloc(n);
+
+	if (lz4_decode_frame(frame, *size, check, n) != n ||
+	    memcmp(check, src, n)) {
+		fprintf(stderr, "LZ4 round trip failed\n");
+		exit(1);
+	}
+	free(check);
+	return frame;
+}
+
+static int convert_stage(const char *in, const char *out)
+{
+	uint8_t *buf, *frame, *res;
+	size_t size, len, flen;
+
+	buf = read_file(in, &size);
+	if (size < CBFS_STAGE_SIZE ||
+	    get_le32(buf) != CBFS_COMPRESS_NONE ||
+	    (len = get_le32(buf + 20)) > size - CBFS_STAGE_SIZE) {
+		fprintf(stderr, "%s: not an uncompressed stage\n", in);
+		return 1;
+	}
+	frame = lz4_compress_checked(buf + CBFS_STAGE_SIZE, len, &flen);
+	res = xmalloc(CBFS_STAGE_SIZE + flen);
+	memcpy(res, buf, CBFS_STAGE_SIZE);
+	put_le32(res, CBFS_COMPRESS_LZ4);
+	put_le32(res + 20, flen);
+	memcpy(res + CBFS_STAGE_SIZE, frame, flen);
+	write_file(out, res, CBFS_STAGE_SIZE + flen);
+	printf("%s: %zu -> %zu bytes\n", out, len, flen);
+	free(buf);
+	free(frame);
+	free(res);
+	return 0;
+}
+
+/* The segment table is followed by the segment data, whose offsets count
+ * from the start of the table. Only CODE and DATA carry data. */
+static int convert_payload(const char *in, const char *out)
+{
+	uint8_t *buf, *res, *seg, *frame;
+	size_t size, nseg, table, op, off, len, flen, total = 0;
+	uint32_t type;
+
+	buf = read_file(in, &size);
+	for (nseg = 0; (nseg + 1) * CBFS_SEGMENT_SIZE <= size; nseg++)
+		if (get_le32(buf + nseg * CBFS_SEGMENT_SIZE) ==
+		    PAYLOAD_SEGMENT_ENTRY)
+			break;
+	if ((nseg + 1) * CBFS_SEGMENT_SIZE > size) {
+		fprintf(stderr, "%s: no entry segment\n", in);
+		return 1;
+	}
+	table = (nseg + 1) * CBFS_SEGMENT_SIZE;
+
+	res = xmalloc(size + size / 255 + 64 * (nseg + 1));
+	memcpy(res, buf, table);
+	op = table;
+	for (seg = res; seg < res + nseg * CBFS_SEGMENT_SIZE;
+	     seg += CBFS_SEGMENT_SIZE) {
+		type = get_le32(seg);
+		off = get_be32(seg + 8);
+		len = get_be32(seg + 20);
+		if (type != PAYLOAD_SEGMENT_CODE && type != PAYLOAD_SEGMENT_DATA)
+			continue;
+		if (get_be32(seg + 4) != CBFS_COMPRESS_NONE ||
+		    off > size || len > size - off) {
+			fprintf(stderr, "%s: not an uncompressed payload\n", in);
+			return 1;
+		}
+		frame = lz4_compress_checked(buf + off, len, &flen);
+		memcpy(res + op, frame, flen);
+		put_be32(seg + 4, CBFS_COMPRESS_LZ4);
+		put_be32(seg + 8, op);
+		put_be32(seg + 20, flen);
+		op += flen;
+		total += len;
+		free(frame);
+	}
+	write_file(out, res, op);
+	printf("%s: %zu -> %zu bytes\n", out, total, op - table);
+	free(buf);
+	free(res);
+	return 0;
+}
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int decode_lzma(const uint8_t *in, size_t len, uint8_t *out,
+		       size_t out_size)
+{
+	static CProb probs[MAX_PROBS];
+	CLzmaDecoderState state;
+	SizeT in_done, out_done;
+
+	if (len < LZMA_HEADER_SIZE ||
+	    LzmaDecodeProperties(&state.Properties, in, LZMA_PROPERTIES_SIZE) ||
+	    LzmaGetNumProbs(&state.Properties) > MAX_PROBS)
+		return -1;
+	state.Probs = probs;
+	if (LzmaDecode(&state, in + LZMA_HEADER_SIZE, len - LZMA_HEADER_SIZE,
+		       &in_done, out, out_size, &out_done))
+		return -1;
+	return out_done == out_size ? 0 : -1;
+}
+
+static int iterations = 20;
+static double flash_mbps;
+static double total_lzma, total_lz4;
+
+/* Load time in us: decoding plus reading len bytes from flash. */
+static double load_us(double decode, size_t len)
+{
+	return decode * 1e6 + (flash_mbps > 0 ? len / flash_mbps : 0);
+}
+
+static void bench(const char *name, uint32_t compression, const uint8_t *in,
+		  size_t len)
+{
+	uint8_t *raw, *frame = NULL, *out;
+	size_t raw_size, flen;
+	double t, t_lzma = 0, t_lz4;
+	int i;
+
+	if (compression == CBFS_COMPRESS_LZMA) {
+		if (len < LZMA_HEADER_SIZE ||
+		    get_le32(in + LZMA_PROPERTIES_SIZE + 4) != 0) {
+			printf("%-24s bad LZMA header\n", name);
+			return;
+		}
+		raw_size = get_le32(in + LZMA_PROPERTIES_SIZE);
+		raw = xmalloc(raw_size);
+		if (decode_lzma(in, len, raw, raw_size)) {
+			printf("%-24s LZMA decoding failed\n", name);
+			free(raw);
+			return;
+		}
+		frame = lz4_compress_checked(raw, raw_size, &flen);
+	} else {
+		if (len < LZ4_FRAME_MIN_SIZE + 8 ||
+		    !(in[4] & LZ4_FLG_CONTENT_SIZE)) {
+			printf("%-24s no LZ4 content size\n", name);
+			return;
+		}
+		raw_size = get_le32(in + 6);
+		raw = xmalloc(raw_size);
+		if (lz4_decode_frame(in, len, raw, raw_size) != raw_size) {
+			printf("%-24s LZ4 decoding failed\n", name);
+			free(raw);
+			return;
+		}
+		flen = len;
+	}
+	out = xmalloc(raw_size);
+
+	if (compression == CBFS_COMPRESS_LZMA) {
+		t = now();
+		for (i = 0; i < iterations; i++)
+			decode_lzma(in, len, out, raw_size);
+		t_lzma = (now() - t) / iterations;
+	}
+	t = now();
+	for (i = 0; i < iterations; i++)
+		lz4_decode_frame(frame ? frame : in, flen, out, raw_size);
+	t_lz4 = (now() - t) / iterations;
+
+	if (compression == CBFS_COMPRESS_LZMA) {
+		total_lzma += load_us(t_lzma, len);
+		total_lz4 += load_us(t_lz4, flen);
+		printf("%-24s %8zu %8zu %8zu %8.1f %8.1f", name, raw_size, len,
+		       flen, raw_size / t_lzma / 1e6, raw_size / t_lz4 / 1e6);
+		if (flash_mbps > 0)
+			printf(" %8.0f %8.0f", load_us(t_lzma, len),
+			       load_us(t_lz4, flen));
+	} else {
+		printf("%-24s %8zu %8s %8zu %8s %8.1f", name, raw_size, "-",
+		       flen, "-", raw_size / t_lz4 / 1e6);
+		if (flash_mbps > 0)
+			printf(" %8s %8.0f", "-", load_us(t_lz4, flen));
+	}
+	printf("\n");
+	free(raw);
+	free(frame);
+	free(out);
+}
+
+/* Walk CBFS at every 64 bytes, which is the alignment of this image. */
+static int bench_cbfs(const uint8_t *rom, size_t size)
+{
+	char name[64];
+	size_t off, data, len, seg, s_off, s_len;
+	uint32_t type, comp;
+	int found = 0;
+
+	for (off = 0; off + 24 <= size; off += 64) {
+		if (memcmp(rom + off, "LARCHIVE", 8))
+			continue;
+		len = get_be32(rom + off + 8);
+		type = get_be32(rom + off + 12);
+		data = off + get_be32(rom + off + 20);
+		if (data + len > size || data < off + 24)
+			continue;
+		found = 1;
+
+		if (type == CBFS_TYPE_STAGE && len >= CBFS_STAGE_SIZE) {
+			comp = get_le32(rom + data);
+			if (comp != CBFS_COMPRESS_LZMA &&
+			    comp != CBFS_COMPRESS_LZ4)
+				continue;
+			snprintf(name, sizeof(name), "%s", rom + off + 24);
+			bench(name, comp, rom + data + CBFS_STAGE_SIZE,
+			      len - CBFS_STAGE_SIZE);
+		} else if (type == CBFS_TYPE_PAYLOAD) {
+			for (seg = data; seg + CBFS_SEGMENT_SIZE <= data + len;
+			     seg += CBFS_SEGMENT_SIZE) {
+				const uint8_t *s = rom + seg;
+
+				if (get_le32(s) == PAYLOAD_SEGMENT_ENTRY)
+					break;
+				comp = get_be32(s + 4);
+				s_off = get_be32(s + 8);
+				s_len = get_be32(s + 20);
+				if ((comp != CBFS_COMPRESS_LZMA &&
+				     comp != CBFS_COMPRESS_LZ4) ||
+				    s_off + s_len > len)
+					continue;
+				snprintf(name, sizeof(name), "%s@%x",
+					 rom + off + 24, get_be32(s + 16));
+				bench(name, comp, rom + data + s_off, s_len);
+			}
+		}
+	}
+	return found;
+}
+
+static int run_bench(int argc, char **argv)
+{
+	uint8_t *buf;
+	size_t size;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "n:f:h")) != -1) {
+		switch (opt) {
+		case 'n':
+			iterations = atoi(optarg);
+			break;
+		case 'f':
+			flash_mbps = atof(optarg);
+			break;
+		default:
+			optind = argc;
+			iterations = 0;
+		}
+	}
+	if (optind == argc || iterations < 1) {
+		fprintf(stderr, "usage: %s bench [-n iterations] "
+			"[-f flash MB/s] image...\n", "cbfslz4");
+		return 1;
+	}
+
+	printf("%-24s %8s %8s %8s %8s %8s", "file", "raw", "lzma", "lz4",
+	       "lzma", "lz4");
+	if (flash_mbps > 0)
+		printf(" %8s %8s", "lzma", "lz4");
+	printf("\n%-24s %8s %8s %8s %8s %8s", "", "bytes", "bytes", "bytes",
+	       "MB/s", "MB/s");
+	if (flash_mbps > 0)
+		printf(" %8s %8s", "load us", "load us");
+	printf("\n");
+
+	for (; optind < argc; optind++) {
+		buf = read_file(argv[optind], &size);
+		if (!bench_cbfs(buf, size))
+			printf("%s: no CBFS\n", argv[optind]);
+		free(buf);
+	}
+	if (total_lzma > 0)
+		printf("\n%-24s %s %.0f us with LZMA, %.0f us with LZ4\n",
+		       "total", flash_mbps > 0 ? "load" : "decode",
+		       total_lzma, total_lz4);
+	return 0;
+}
+
+static void usage(const char *name)
+{
+	fprintf(stderr, "usage: %s stage|payload in out\n"
+		"       %s bench [-n iterations] [-f flash MB/s] image...\n",
+		name, name);
+	exit(1);
+}
+
+int main(int argc, char **argv)
+{
+	if (argc < 2)
+		usage(argv[0]);
+	if (!strcmp(argv[1], "bench"))
+		return run_bench(argc - 1, argv + 1);
+	if (argc != 4)
+		usage(argv[0]);
+	if (!strcmp(argv[1], "stage"))
+		return convert_stage(argv[2], argv[3]);
+	if (!strcmp(argv[1], "payload"))
+		return convert_payload(argv[2], argv[3]);
+	usage(argv[0]);
+	return 1;
+}
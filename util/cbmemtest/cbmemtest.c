@@ -0,0 +1,351 @@
+/*
+ * cbmemtest, exercise the dynamic cbmem directory on the host
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA, 02110-1301 USA
+ */
+
+/*
+ * Runs src/lib/cbmem_dir.c against a buffer standing in for the memory
+ * below cbmem_top(). Every step is followed by a recovery of the directory,
+ * so a broken invariant shows up where it is introduced:
+ *
+ *   cc -O2 -idirafter src/include -o cbmemtest util/cbmemtest/cbmemtest.c
+ *   ./cbmemtest [-n rounds] [-s seed]
+ *
+ * Exits with 1 on the first failure.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../../src/lib/cbmem_dir.c"
+
+#define REGION_SIZE	(1024 * 1024)
+#define ROOT_ID		0x524f4f54
+
+static uint8_t *region;
+static uint8_t *top;
+static int failed;
+
+#define check(cond) do { \
+	if (!(cond)) { \
+		fprintf(stderr, "%s:%d: check failed: %s\n", \
+			__FILE__, __LINE__, #cond); \
+		failed = 1; \
+		return; \
+	} \
+} while (0)
+
+/* Entry contents are a pattern derived from the id. */
+static void fill(const struct cbmem_dir *dir, const struct cbmem_entry *e,
+		 uint32_t len)
+{
+	uint8_t *p = cbmem_dir_entry_start(dir, e);
+	uint32_t i;
+
+	for (i = 0; i < len; i++)
+		p[i] = (uint8_t)(e->id * 31 + i);
+}
+
+static int verify(const struct cbmem_dir *dir, const struct cbmem_entry *e,
+		  uint32_t len)
+{
+	const uint8_t *p = cbmem_dir_entry_start(dir, e);
+	uint32_t i;
+
+	for (i = 0; i < len; i++) {
+		if (p[i] != (uint8_t)(e->id * 31 + i))
+			return 0;
+	}
+	return 1;
+}
+
+static struct cbmem_dir *fresh(uint32_t limit)
+{
+	memset(region, 0, REGION_SIZE);
+	return cbmem_dir_create(top, limit, ROOT_ID);
+}
+
+static void test_basic(void)
+{
+	struct cbmem_dir *dir = fresh(REGION_SIZE);
+	const struct cbmem_entry *a, *b, *c;
+
+	check(dir != NULL);
+	check(cbmem_dir_recover(top) == dir);
+	check(cbmem_dir_used(dir) == CBMEM_DIR_ROOT_SIZE);
+	check(cbmem_dir_find(dir, ROOT_ID) != NULL);
+
+	a = cbmem_dir_add(dir, 0x300, 100);
+	b = cbmem_dir_add(dir, 0x100, 8192);
+	c = cbmem_dir_add(dir, 0x200, 1);
+	check(a != NULL && b != NULL && c != NULL);
+	check(a->size == 128 && b->size == 8192 && c->size == 32);
+	check(a->offset % CBMEM_DIR_ALIGN == 0);
+	check(b->offset % CBMEM_DIR_LARGE_ALIGN == 0);
+	check(cbmem_dir_recover(top) == dir);
+
+	/* Same id again gives the existing entry. */
+	check(cbmem_dir_add(dir, 0x300, 5000) == a);
+	check(a->size == 128);
+
+	check(cbmem_dir_find(dir, 0x100) == b);
+	check(cbmem_dir_find(dir, 0x200) == c);
+	check(cbmem_dir_find(dir, 0x300) == a);
+	check(cbmem_dir_find(dir, 0x250) == NULL);
+	check(cbmem_dir_find(dir, 0xffffffff) == NULL);
+
+	/* Listed in id order. */
+	check(cbmem_dir_entry(dir, 0) == b);
+	check(cbmem_dir_entry(dir, 1) == c);
+	check(cbmem_dir_entry(dir, 2) == a);
+	check(cbmem_dir_entry(dir, 3) == cbmem_dir_find(dir, ROOT_ID));
+	check(cbmem_dir_entry(dir, 4) == NULL);
+
+	check(cbmem_dir_add(dir, 0, 16) == NULL);
+}
+
+static void test_remove(void)
+{
+	struct cbmem_dir *dir = fresh(REGION_SIZE);
+	const struct cbmem_entry *a, *b, *c, *d;
+	uint32_t hole, used;
+
+	a = cbmem_dir_add(dir, 1, 4096);
+	b = cbmem_dir_add(dir, 2, 4096);
+	c = cbmem_dir_add(dir, 3, 4096);
+	check(a != NULL && b != NULL && c != NULL);
+	fill(dir, a, a->size);
+	fill(dir, c, c->size);
+	used = cbmem_dir_used(dir);
+
+	/* Any entry can go, not just the last one. */
+	hole = b->offset;
+	check(cbmem_dir_remove(dir, b) == 0);
+	check(cbmem_dir_find(dir, 2) == NULL);
+	check(cbmem_dir_recover(top) == dir);
+	check(cbmem_dir_remove(dir, b) < 0);
+
+	/* The hole is reused, the directory doesn't grow. */
+	d = cbmem_dir_add(dir, 4, 4096);
+	check(d != NULL && d->offset == hole);
+	check(cbmem_dir_used(dir) == used);
+	check(verify(dir, a, a->size) && verify(dir, c, c->size));
+
+	/* A bigger one doesn't fit the hole after the next removal. */
+	check(cbmem_dir_remove(dir, d) == 0);
+	d = cbmem_dir_add(dir, 5, 8192);
+	check(d != NULL && d->offset > used);
+
+	check(cbmem_dir_remove(dir, cbmem_dir_find(dir, ROOT_ID)) < 0);
+	check(cbmem_dir_recover(top) == dir);
+}
+
+static void test_resize(void)
+{
+	struct cbmem_dir *dir = fresh(REGION_SIZE);
+	const struct cbmem_entry *a, *b;
+	uint32_t offset;
+
+	a = cbmem_dir_add(dir, 1, 256);
+	b = cbmem_dir_add(dir, 2, 256);
+	check(a != NULL && b != NULL);
+	fill(dir, a, 256);
+	fill(dir, b, 256);
+
+	/* Shrinking keeps the start. */
+	offset = a->offset;
+	check(cbmem_dir_resize(dir, a, 64) == 0);
+	check(a->offset == offset && a->size == 64);
+	check(verify(dir, a, 64));
+
+	/* Growing into the freed tail stays in place. */
+	check(cbmem_dir_resize(dir, a, 256) == 0);
+	check(a->offset == offset);
+	check(verify(dir, a, 64));
+	fill(dir, a, 256);
+
+	/* Growing past the neighbour moves the entry with its contents. */
+	check(cbmem_dir_resize(dir, a, 10000) == 0);
+	check(a->offset != offset && a->size == 12288);
+	check(verify(dir, a, 256) && verify(dir, b, 256));
+	check(cbmem_dir_recover(top) == dir);
+
+	/* Too big, nothing changes. */
+	offset = a->offset;
+	check(cbmem_dir_resize(dir, a, REGION_SIZE) < 0);
+	check(a->offset == offset && a->size == 12288);
+
+	check(cbmem_dir_resize(dir, cbmem_dir_find(dir, ROOT_ID), 8192) < 0);
+	check(cbmem_dir_recover(top) == dir);
+}
+
+static void test_limit(void)
+{
+	struct cbmem_dir *dir = fresh(64 * 1024);
+	const struct cbmem_entry *e;
+	unsigned int i;
+
+	check(cbmem_dir_create(top, CBMEM_DIR_ROOT_SIZE - 1, ROOT_ID) == NULL);
+	check(cbmem_dir_create(top + 1, REGION_SIZE, ROOT_ID) == NULL);
+
+	check(cbmem_dir_add(dir, 1, 60 * 1024) != NULL);
+	check(cbmem_dir_add(dir, 2, 32) == NULL);
+	check(cbmem_dir_add(dir, 3, UINT32_MAX) == NULL);
+	check(cbmem_dir_used(dir) == 64 * 1024);
+
+	/* The slots run out before the space. */
+	dir = fresh(REGION_SIZE);
+	for (i = 1; i < CBMEM_DIR_ENTRIES; i++)
+		check(cbmem_dir_add(dir, i, 32) != NULL);
+	check(cbmem_dir_add(dir, i, 32) == NULL);
+	check(cbmem_dir_recover(top) == dir);
+
+	e = cbmem_dir_find(dir, 10);
+	check(cbmem_dir_remove(dir, e) == 0);
+	check(cbmem_dir_add(dir, i, 32) != NULL);
+	check(cbmem_dir_recover(top) == dir);
+}
+
+static void test_corrupt(void)
+{
+	struct cbmem_dir *dir = fresh(REGION_SIZE);
+	struct cbmem_entry *a, *b;
+
+	a = (struct cbmem_entry *)cbmem_dir_add(dir, 1, 4096);
+	b = (struct cbmem_entry *)cbmem_dir_add(dir, 2, 4096);
+	check(a != NULL && b != NULL);
+	check(cbmem_dir_recover(top) == dir);
+
+	dir->magic ^= 1;
+	check(cbmem_dir_recover(top) == NULL);
+	dir->magic ^= 1;
+
+	b->offset -= 4096;
+	check(cbmem_dir_recover(top) == NULL);
+	b->offset += 4096;
+
+	b->offset += 16;
+	check(cbmem_dir_recover(top) == NULL);
+	b->offset -= 16;
+
+	b->offset = REGION_SIZE * 2;
+	check(cbmem_dir_recover(top) == NULL);
+	b->offset = a->offset + 4096;
+
+	dir->index[1] = dir->index[0];
+	check(cbmem_dir_recover(top) == NULL);
+	check(cbmem_dir_recover(top + 1) == NULL);
+}
+
+static void test_random(unsigned int rounds)
+{
+	struct cbmem_dir *dir = fresh(REGION_SIZE);
+	const struct cbmem_entry *e;
+	uint32_t lens[256] = { 0 };
+	unsigned int r, id, i;
+	uint32_t len;
+
+	for (r = 0; r < rounds; r++) {
+		id = rand() % 255 + 1;
+		e = cbmem_dir_find(dir, id);
+		len = rand() % 3 ? rand() % 2048 + 1 : rand() % 65536 + 1;
+
+		switch (rand() % 3) {
+		case 0:
+			if (e != NULL)
+				break;
+			e = cbmem_dir_add(dir, id, len);
+			if (e != NULL) {
+				fill(dir, e, len);
+				lens[id] = len;
+			}
+			break;
+		case 1:
+			if (e == NULL)
+				break;
+			check(cbmem_dir_remove(dir, e) == 0);
+			lens[id] = 0;
+			break;
+		case 2:
+			if (e == NULL)
+				break;
+			if (cbmem_dir_resize(dir, e, len) == 0) {
+				if (len < lens[id])
+					lens[id] = len;
+				check(verify(dir, e, lens[id]));
+				fill(dir, e, len);
+				lens[id] = len;
+			}
+			break;
+		}
+
+		check(cbmem_dir_recover(top) == dir);
+		for (i = 1; i < 256; i++) {
+			e = cbmem_dir_find(dir, i);
+			check((e != NULL) == (lens[i] != 0));
+			if (e != NULL)
+				check(e->size >= lens[i] && verify(dir, e, lens[i]));
+		}
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	unsigned int rounds = 10000;
+	unsigned int seed = 1;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+		switch (opt) {
+		case 'n':
+			rounds = strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			seed = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-n rounds] [-s seed]\n",
+				argv[0]);
+			return 2;
+		}
+	}
+	srand(seed);
+
+	if (posix_memalign((void **)&region, CBMEM_DIR_LARGE_ALIGN,
+			   REGION_SIZE)) {
+		perror("posix_memalign");
+		return 2;
+	}
+	top = region + REGION_SIZE;
+
+	test_basic();
+	test_remove();
+	test_resize();
+	test_limit();
+	test_corrupt();
+	test_random(rounds);
+
+	free(region);
+
+	if (failed)
+		return 1;
+	printf("cbmemtest: all passed\n");
+	return 0;
+}
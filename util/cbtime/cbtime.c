@@ -0,0 +1,310 @@
+/*
+ * cbtime, print the boot timeline recorded in the coreboot timestamp table
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA, 02110-1301 USA
+ */
+
+/*
+ * Works on a memory dump that contains CBMEM, e.g. taken on the running
+ * system with
+ *
+ *   dd if=/dev/mem of=cbmem.bin bs=1M skip=<top of RAM - 1M in MiB> count=1
+ *
+ * and decoded on any host with
+ *
+ *   cc -O2 -o cbtime util/cbtime/cbtime.c
+ *   ./cbtime -a <dump load address> [-m <TSC MHz>] cbmem.bin
+ *
+ * The CBMEM table of contents is searched for the timestamp entry, so the
+ * dump only has to cover it and the table it points to.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#define CBMEM_MAGIC		0x434f5245
+#define CBMEM_ID_TIMESTAMP	0x54494d45
+
+struct cbmem_entry {
+	uint32_t magic;
+	uint32_t id;
+	uint64_t base;
+	uint64_t size;
+} __attribute__((packed));
+
+struct timestamp_entry {
+	uint32_t	entry_id;
+	uint64_t	entry_stamp;
+} __attribute__((packed));
+
+struct timestamp_table {
+	uint64_t	base_time;
+	uint32_t	max_entries;
+	uint32_t	num_entries;
+	struct timestamp_entry entries[0];
+} __attribute__((packed));
+
+/* Keep in sync with src/include/timestamp.h */
+static const struct {
+	uint32_t id;
+	const char *name;
+} timestamp_ids[] = {
+	{ 0,	"base time" },
+	{ 1,	"start of romstage" },
+	{ 2,	"before ram initialization" },
+	{ 3,	"after ram initialization" },
+	{ 4,	"end of romstage" },
+	{ 5,	"start of verified boot" },
+	{ 6,	"end of verified boot" },
+	{ 8,	"starting to load ramstage" },
+	{ 9,	"finished loading ramstage" },
+	{ 10,	"start of ramstage" },
+	{ 15,	"before CAR setup" },
+	{ 16,	"after CAR setup" },
+	{ 17,	"starting CAR teardown" },
+	{ 20,	"starting CBFS load" },
+	{ 21,	"finished CBFS load" },
+	{ 22,	"starting LZMA decompress" },
+	{ 23,	"finished LZMA decompress" },
+	{ 24,	"starting LZ4 decompress" },
+	{ 25,	"finished LZ4 decompress" },
+	{ 26,	"AP job start" },
+	{ 27,	"AP job done" },
+	{ 30,	"device enumeration" },
+	{ 40,	"device configuration" },
+	{ 50,	"device enable" },
+	{ 60,	"device initialization" },
+	{ 70,	"device setup done" },
+	{ 75,	"cbmem post" },
+	{ 80,	"write tables" },
+	{ 90,	"load payload" },
+	{ 91,	"starting SELF segment load" },
+	{ 92,	"finished SELF segment load" },
+	{ 98,	"ACPI wake jump" },
+	{ 99,	"selfboot jump" },
+	{ 955,	"calling AmdInitReset" },
+	{ 956,	"back from AmdInitReset" },
+	{ 957,	"calling AmdInitEarly" },
+	{ 958,	"back from AmdInitEarly" },
+	{ 959,	"calling AmdInitPost" },
+	{ 960,	"back from AmdInitPost" },
+	{ 961,	"calling AmdInitEnv" },
+	{ 962,	"back from AmdInitEnv" },
+	{ 963,	"calling AmdInitMid" },
+	{ 964,	"back from AmdInitMid" },
+	{ 965,	"calling AmdInitLate" },
+	{ 966,	"back from AmdInitLate" },
+	{ 969,	"calling AmdInitResume" },
+	{ 970,	"back from AmdInitResume" },
+	{ 971,	"calling AmdS3LateRestore" },
+	{ 972,	"back from AmdS3LateRestore" },
+	{ 973,	"calling AmdS3Save" },
+	{ 974,	"back from AmdS3Save" },
+	{ 1100,	"SeaBIOS start" },
+	{ 1101,	"SeaBIOS devices initialized" },
+	{ 1102,	"SeaBIOS option roms done" },
+	{ 1103,	"SeaBIOS boot menu done" },
+	{ 1104,	"SeaBIOS booting" },
+};
+
+/* Start/end pairs that are summed up per phase at the end. */
+static const struct {
+	uint32_t start, end;
+	const char *name;
+} phases[] = {
+	{ 15,	16,	"cache-as-RAM setup" },
+	{ 955,	956,	"AGESA InitReset" },
+	{ 957,	958,	"AGESA InitEarly" },
+	{ 959,	960,	"AGESA InitPost (DRAM training)" },
+	{ 961,	962,	"AGESA InitEnv" },
+	{ 969,	970,	"AGESA InitResume" },
+	{ 971,	972,	"AGESA S3LateRestore" },
+	{ 8,	9,	"ramstage load" },
+	{ 963,	964,	"AGESA InitMid" },
+	{ 965,	966,	"AGESA InitLate" },
+	{ 973,	974,	"AGESA S3Save" },
+	{ 20,	21,	"CBFS loads" },
+	{ 22,	23,	"LZMA decompression" },
+	{ 24,	25,	"LZ4 decompression" },
+	{ 26,	27,	"AP jobs (overlapped)" },
+	{ 30,	70,	"device init" },
+	{ 91,	92,	"payload segments" },
+	{ 1100,	1101,	"SeaBIOS device init" },
+	{ 1101,	1102,	"SeaBIOS option roms" },
+	{ 1102,	1103,	"SeaBIOS boot menu" },
+};
+
+static const char *timestamp_name(uint32_t id)
+{
+	size_t i;
+
+	for (i = 0; i < sizeof(timestamp_ids) / sizeof(timestamp_ids[0]); i++)
+		if (timestamp_ids[i].id == id)
+			return timestamp_ids[i].name;
+	return "unknown";
+}
+
+static int compare_stamps(const void *a, const void *b)
+{
+	const struct timestamp_entry *ea = a, *eb = b;
+
+	if (ea->entry_stamp < eb->entry_stamp)
+		return -1;
+	return ea->entry_stamp > eb->entry_stamp;
+}
+
+static void usage(const char *name)
+{
+	fprintf(stderr, "usage: %s [-a load_address] [-m tsc_mhz] dump\n",
+		name);
+	exit(1);
+}
+
+static struct timestamp_table *find_timestamps(uint8_t *buf, size_t size,
+					       uint64_t load, size_t *avail)
+{
+	struct cbmem_entry *e;
+	uint64_t off;
+	size_t i;
+
+	for (i = 0; i + sizeof(*e) <= size; i += 4) {
+		e = (struct cbmem_entry *)(buf + i);
+		if (e->magic != CBMEM_MAGIC || e->id != CBMEM_ID_TIMESTAMP)
+			continue;
+		if (e->base < load)
+			continue;
+		off = e->base - load;
+		if (off + sizeof(struct timestamp_table) > size)
+			continue;
+		*avail = size - off;
+		return (struct timestamp_table *)(buf + off);
+	}
+	return NULL;
+}
+
+int main(int argc, char **argv)
+{
+	struct timestamp_table *tst;
+	struct timestamp_entry *entries;
+	uint64_t load = 0, prev = 0, sum, total;
+	unsigned long mhz = 1000;
+	size_t size = 0, avail, n, i, j;
+	uint8_t *buf = NULL;
+	FILE *f;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "a:m:h")) != -1) {
+		switch (opt) {
+		case 'a':
+			load = strtoull(optarg, NULL, 0);
+			break;
+		case 'm':
+			mhz = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (optind != argc - 1 || mhz == 0)
+		usage(argv[0]);
+
+	f = fopen(argv[optind], "rb");
+	if (f == NULL) {
+		perror(argv[optind]);
+		return 1;
+	}
+	for (;;) {
+		buf = realloc(buf, size + 0x10000);
+		if (buf == NULL) {
+			fprintf(stderr, "out of memory\n");
+			return 1;
+		}
+		n = fread(buf + size, 1, 0x10000, f);
+		size += n;
+		if (n < 0x10000)
+			break;
+	}
+	fclose(f);
+
+	tst = find_timestamps(buf, size, load, &avail);
+	if (tst == NULL) {
+		fprintf(stderr, "no CBMEM timestamp table in %s at 0x%llx\n",
+			argv[optind], (unsigned long long)load);
+		return 1;
+	}
+
+	n = tst->num_entries;
+	if (n > (avail - sizeof(*tst)) / sizeof(struct timestamp_entry)) {
+		n = (avail - sizeof(*tst)) / sizeof(struct timestamp_entry);
+		fprintf(stderr, "dump ends inside the timestamp table, "
+			"showing %zu of %u entries\n", n, tst->num_entries);
+	}
+
+	/* Payload entries are appended in order too, but sort anyway so
+	 * entries imported late from an earlier stage land in place. */
+	entries = malloc(n * sizeof(*entries));
+	if (entries == NULL && n) {
+		fprintf(stderr, "out of memory\n");
+		return 1;
+	}
+	memcpy(entries, tst->entries, n * sizeof(*entries));
+	qsort(entries, n, sizeof(*entries), compare_stamps);
+
+	printf("%u entries, TSC at %lu MHz\n\n", tst->num_entries, mhz);
+	printf("%5s %-32s %12s %12s\n", "id", "event", "time (us)",
+	       "delta (us)");
+	for (i = 0; i < n; i++) {
+		printf("%5u %-32s %12llu %12llu\n", entries[i].entry_id,
+		       timestamp_name(entries[i].entry_id),
+		       (unsigned long long)(entries[i].entry_stamp / mhz),
+		       (unsigned long long)
+		       ((entries[i].entry_stamp - prev) / mhz));
+		prev = entries[i].entry_stamp;
+	}
+	total = n ? entries[n - 1].entry_stamp : 0;
+	printf("\n%-38s %12llu us\n\n", "total", (unsigned long long)(total / mhz));
+
+	/* Every start is paired with the next end after it, which also
+	 * sums up repeated pairs such as one per CBFS load. */
+	printf("%-38s %12s %6s\n", "phase", "time (us)", "share");
+	for (i = 0; i < sizeof(phases) / sizeof(phases[0]); i++) {
+		sum = 0;
+		for (j = 0; j < n; j++) {
+			size_t k;
+
+			if (entries[j].entry_id != phases[i].start)
+				continue;
+			for (k = j + 1; k < n; k++)
+				if (entries[k].entry_id == phases[i].end)
+					break;
+			if (k < n)
+				sum += entries[k].entry_stamp -
+					entries[j].entry_stamp;
+		}
+		if (sum == 0)
+			continue;
+		printf("%-38s %12llu %5.1f%%\n", phases[i].name,
+		       (unsigned long long)(sum / mhz),
+		       total ? 100.0 * sum / total : 0.0);
+	}
+
+	free(entries);
+	free(buf);
+	return 0;
+}
@@ -0,0 +1,297 @@
+/*
+ * lzmabench, compare the one-shot and the streaming LZMA decoder
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA, 02110-1301 USA
+ */
+
+/*
+ * Runs both decoders of src/lib/lzmadecode.c over the same streams, checks
+ * that they agree and prints the time each one takes:
+ *
+ *   cc -O2 -o lzmabench util/lzmabench/lzmabench.c
+ *   ./lzmabench [-n iterations] build/coreboot.rom
+ *
+ * Given a coreboot image, every LZMA compressed stage and payload segment
+ * in CBFS is measured, i.e. ramstage, SeaBIOS, sortbootorder and memtest.
+ * Any other file is taken as a single stream with the 13 byte header
+ * cbfstool writes.
+ *
+ * On the host both read from RAM, so this measures the decoder loops only.
+ * On the board the one-shot decoder also pays for every uncached read of
+ * the ROM window, which the streaming one does once per cache line.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define LZMA_ONESHOT
+#include "../../src/lib/lzmadecode.c"
+
+#define LZMA_HEADER_SIZE	(LZMA_PROPERTIES_SIZE + 8)
+#define STREAM_CHUNK		64
+#define MAX_PROBS		(LZMA_BASE_SIZE + (LZMA_LIT_SIZE << 3))
+
+#define CBFS_TYPE_STAGE		0x10
+#define CBFS_TYPE_PAYLOAD	0x20
+#define CBFS_COMPRESS_LZMA	1
+#define PAYLOAD_SEGMENT_ENTRY	0x52544E45
+
+/* Same refill as src/lib/lzma.c, cache line sized and aligned. */
+struct mem_source {
+	const uint8_t *base;
+	size_t offset, remaining;
+	uint8_t chunk[STREAM_CHUNK];
+};
+
+static int mem_read(void *object, const unsigned char **buffer, SizeT *size)
+{
+	struct mem_source *src = object;
+	size_t n = STREAM_CHUNK - (src->offset % STREAM_CHUNK);
+
+	if (n > src->remaining)
+		n = src->remaining;
+	if (n == 0)
+		return LZMA_RESULT_DATA_ERROR;
+	memcpy(src->chunk, src->base + src->offset, n);
+	src->offset += n;
+	src->remaining -= n;
+	*buffer = src->chunk;
+	*size = n;
+	return LZMA_RESULT_OK;
+}
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint32_t get_be32(const uint8_t *p)
+{
+	return p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+static uint32_t get_le32(const uint8_t *p)
+{
+	return p[3] << 24 | p[2] << 16 | p[1] << 8 | p[0];
+}
+
+static int decode_oneshot(const uint8_t *in, size_t len, uint8_t *out,
+			  size_t out_size, CProb *probs)
+{
+	CLzmaDecoderState state;
+	SizeT in_done, out_done;
+
+	if (LzmaDecodeProperties(&state.Properties, in, LZMA_PROPERTIES_SIZE))
+		return -1;
+	state.Probs = probs;
+	if (LzmaDecode(&state, in + LZMA_HEADER_SIZE, len - LZMA_HEADER_SIZE,
+		       &in_done, out, out_size, &out_done))
+		return -1;
+	return out_done == out_size ? 0 : -1;
+}
+
+/* Decodes in steps of step bytes to exercise resuming as well. */
+static int decode_stream(const uint8_t *in, size_t len, uint8_t *out,
+			 size_t out_size, CProb *probs, size_t step)
+{
+	CLzmaStreamState state;
+	struct mem_source src;
+	SizeT done = 0, limit = 0;
+
+	if (LzmaDecodeProperties(&state.Properties, in, LZMA_PROPERTIES_SIZE))
+		return -1;
+	src.base = in;
+	src.offset = LZMA_HEADER_SIZE;
+	src.remaining = len - LZMA_HEADER_SIZE;
+	state.Probs = probs;
+	state.Read = mem_read;
+	state.ReadObject = &src;
+	state.Buffer = state.BufferLim = NULL;
+	if (LzmaStreamInit(&state))
+		return -1;
+	while (done < out_size && !LzmaStreamFinished(&state)) {
+		limit = step && limit + step < out_size ? limit + step : out_size;
+		if (LzmaStreamDecode(&state, out, limit, &done))
+			return -1;
+	}
+	return done == out_size ? 0 : -1;
+}
+
+static int iterations = 20;
+static double total_oneshot, total_stream;
+
+static void bench(const char *name, const uint8_t *in, size_t len)
+{
+	static CProb probs[MAX_PROBS];
+	CLzmaProperties props;
+	uint8_t *ref, *out;
+	size_t out_size;
+	double t, t_oneshot, t_stream;
+	int i;
+
+	if (len < LZMA_HEADER_SIZE ||
+	    LzmaDecodeProperties(&props, in, LZMA_PROPERTIES_SIZE) ||
+	    (size_t)LzmaGetNumProbs(&props) > MAX_PROBS) {
+		printf("%-32s bad stream header\n", name);
+		return;
+	}
+	out_size = get_le32(in + LZMA_PROPERTIES_SIZE);
+	if (get_le32(in + LZMA_PROPERTIES_SIZE + 4) != 0) {
+		printf("%-32s no size in stream header\n", name);
+		return;
+	}
+
+	ref = malloc(out_size + 1);
+	out = malloc(out_size + 1);
+	if (ref == NULL || out == NULL) {
+		fprintf(stderr, "out of memory\n");
+		exit(1);
+	}
+
+	if (decode_oneshot(in, len, ref, out_size, probs)) {
+		printf("%-32s one-shot decoder failed\n", name);
+		goto out;
+	}
+	/* Odd steps cut matches and literals at every possible place. */
+	memset(out, 0, out_size);
+	if (decode_stream(in, len, out, out_size, probs, 4093) ||
+	    memcmp(ref, out, out_size)) {
+		printf("%-32s streaming decoder MISMATCH\n", name);
+		goto out;
+	}
+
+	t = now();
+	for (i = 0; i < iterations; i++)
+		decode_oneshot(in, len, ref, out_size, probs);
+	t_oneshot = (now() - t) / iterations;
+
+	t = now();
+	for (i = 0; i < iterations; i++)
+		decode_stream(in, len, out, out_size, probs, 0);
+	t_stream = (now() - t) / iterations;
+
+	total_oneshot += t_oneshot;
+	total_stream += t_stream;
+	printf("%-32s %8zu %8zu %10.0f %10.0f %6.1f%%\n", name, len, out_size,
+	       t_oneshot * 1e6, t_stream * 1e6,
+	       100.0 * (t_oneshot - t_stream) / t_oneshot);
+out:
+	free(ref);
+	free(out);
+}
+
+/* Walk CBFS at every 64 bytes, which is the alignment of this image. */
+static int bench_cbfs(const uint8_t *rom, size_t size)
+{
+	char name[64];
+	size_t off, data, len, seg;
+	uint32_t type;
+	int found = 0;
+
+	for (off = 0; off + 24 <= size; off += 64) {
+		if (memcmp(rom + off, "LARCHIVE", 8))
+			continue;
+		len = get_be32(rom + off + 8);
+		type = get_be32(rom + off + 12);
+		data = off + get_be32(rom + off + 20);
+		if (data + len > size || data < off + 24)
+			continue;
+		found = 1;
+
+		if (type == CBFS_TYPE_STAGE && len >= 28 &&
+		    get_le32(rom + data) == CBFS_COMPRESS_LZMA) {
+			snprintf(name, sizeof(name), "%s", rom + off + 24);
+			bench(name, rom + data + 28, len - 28);
+		} else if (type == CBFS_TYPE_PAYLOAD) {
+			for (seg = data; seg + 28 <= data + len; seg += 28) {
+				const uint8_t *s = rom + seg;
+				size_t s_off = get_be32(s + 8);
+				size_t s_len = get_be32(s + 20);
+
+				if (get_le32(s) == PAYLOAD_SEGMENT_ENTRY)
+					break;
+				if (get_be32(s + 4) != CBFS_COMPRESS_LZMA ||
+				    s_off + s_len > len)
+					continue;
+				snprintf(name, sizeof(name), "%s@%x",
+					 rom + off + 24, get_be32(s + 16));
+				bench(name, rom + data + s_off, s_len);
+			}
+		}
+	}
+	return found;
+}
+
+int main(int argc, char **argv)
+{
+	uint8_t *buf;
+	size_t size;
+	FILE *f;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "n:h")) != -1) {
+		switch (opt) {
+		case 'n':
+			iterations = atoi(optarg);
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-n iterations] file...\n",
+				argv[0]);
+			return 1;
+		}
+	}
+	if (optind == argc || iterations < 1) {
+		fprintf(stderr, "usage: %s [-n iterations] file...\n", argv[0]);
+		return 1;
+	}
+
+	printf("%-32s %8s %8s %10s %10s %7s\n", "stream", "in", "out",
+	       "one-shot", "stream", "saved");
+	printf("%-32s %8s %8s %10s %10s\n", "", "bytes", "bytes", "us", "us");
+	for (; optind < argc; optind++) {
+		f = fopen(argv[optind], "rb");
+		if (f == NULL) {
+			perror(argv[optind]);
+			return 1;
+		}
+		fseek(f, 0, SEEK_END);
+		size = ftell(f);
+		fseek(f, 0, SEEK_SET);
+		buf = malloc(size);
+		if (buf == NULL || fread(buf, 1, size, f) != size) {
+			fprintf(stderr, "%s: read error\n", argv[optind]);
+			return 1;
+		}
+		fclose(f);
+
+		if (!bench_cbfs(buf, size))
+			bench(argv[optind], buf, size);
+		free(buf);
+	}
+
+	if (total_oneshot > 0)
+		printf("\n%-32s %8s %8s %10.0f %10.0f %6.1f%%\n", "total", "",
+		       "", total_oneshot * 1e6, total_stream * 1e6,
+		       100.0 * (total_oneshot - total_stream) / total_oneshot);
+	return 0;
+}
@@ -0,0 +1,194 @@
+/*
+ * memrestore, replay saved AGESA memory contexts through the fast boot checks
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA, 02110-1301 USA
+ */
+
+/*
+ * Works on dumps of the 4k non-volatile S3 sector (S3_DATA_NONVOLATILE_POS
+ * in src/cpu/amd/agesa/s3_resume.h), e.g. cut out of a flash image read
+ * back with flashrom. Each dump is checked exactly as romstage checks it
+ * before handing it to AmdInitPost:
+ *
+ *   cc -O2 -o memrestore util/memrestore/memrestore.c
+ *   ./memrestore -c 0x500f20 -i 1 \
+ *       -s src/mainboard/pcengines/apu/HYNIX-H5TQ2G83CFR.spd.hex \
+ *       -s src/mainboard/pcengines/apu/HYNIX-H5TQ4G83MFR.spd.hex \
+ *       nv-*.bin
+ *
+ * The -s files are concatenated like spd.bin in the build, raw files are
+ * taken as they are. With -w a signature for the given identity is written
+ * into the dumps instead, to record test blobs.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <ctype.h>
+
+#include "../../src/cpu/amd/agesa/mem_restore.c"
+
+/* Keep in sync with src/cpu/amd/agesa/s3_resume.h and agesawrapper.c */
+#define NV_SIZE			0x1000
+#define MEM_RESTORE_SIZE	0x40
+#define SPD_SIZE		128
+#define SPD_MAX			(8 * SPD_SIZE)
+
+static void usage(const char *name)
+{
+	fprintf(stderr, "usage: %s -c cpuid [-b board] [-i spd_index] "
+		"-s spd_file [-s spd_file...] [-w] nv_dump...\n", name);
+	exit(2);
+}
+
+static size_t read_file(const char *name, uint8_t *buf, size_t max)
+{
+	FILE *f;
+	size_t n;
+
+	f = fopen(name, "rb");
+	if (f == NULL) {
+		perror(name);
+		exit(2);
+	}
+	n = fread(buf, 1, max, f);
+	fclose(f);
+	return n;
+}
+
+/* The .spd.hex format: '#' comment lines, otherwise hex bytes. */
+static size_t read_spd_hex(const char *name, uint8_t *buf, size_t max)
+{
+	char line[256], *p, *end;
+	size_t n = 0;
+	FILE *f;
+
+	f = fopen(name, "r");
+	if (f == NULL) {
+		perror(name);
+		exit(2);
+	}
+	while (fgets(line, sizeof(line), f)) {
+		if (line[0] == '#')
+			continue;
+		for (p = line; *p; p = end) {
+			while (*p && isspace((unsigned char)*p))
+				p++;
+			if (!*p)
+				break;
+			if (n == max) {
+				fprintf(stderr, "%s: too large\n", name);
+				exit(2);
+			}
+			buf[n++] = strtoul(p, &end, 16);
+			if (end == p) {
+				fprintf(stderr, "%s: bad hex '%s'\n", name, p);
+				exit(2);
+			}
+		}
+	}
+	fclose(f);
+	return n;
+}
+
+int main(int argc, char **argv)
+{
+	const char *board = "PC Engines APU";
+	uint8_t spd[SPD_MAX], nv[NV_SIZE];
+	struct mem_restore_sig *sig;
+	struct mem_restore_id id;
+	enum mem_restore_result result;
+	uint32_t cpuid = 0, index = 0, ctx_size;
+	size_t spd_len = 0, len;
+	int opt, write = 0, have_cpuid = 0, ret = 0;
+	FILE *f;
+
+	while ((opt = getopt(argc, argv, "b:c:i:s:wh")) != -1) {
+		switch (opt) {
+		case 'b':
+			board = optarg;
+			break;
+		case 'c':
+			cpuid = strtoul(optarg, NULL, 0);
+			have_cpuid = 1;
+			break;
+		case 'i':
+			index = strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			len = strlen(optarg);
+			if (len > 4 && !strcmp(optarg + len - 4, ".hex"))
+				spd_len += read_spd_hex(optarg, spd + spd_len,
+							sizeof(spd) - spd_len);
+			else
+				spd_len += read_file(optarg, spd + spd_len,
+						     sizeof(spd) - spd_len);
+			break;
+		case 'w':
+			write = 1;
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (optind == argc || !have_cpuid || spd_len == 0)
+		usage(argv[0]);
+	if ((index + 1) * SPD_SIZE > spd_len) {
+		fprintf(stderr, "SPD %u is not in the %zu bytes given\n",
+			index, spd_len);
+		return 2;
+	}
+
+	mem_restore_id_init(&id, cpuid, board, index,
+			    spd + index * SPD_SIZE, SPD_SIZE);
+
+	for (; optind < argc; optind++) {
+		memset(nv, 0xff, sizeof(nv));
+		read_file(argv[optind], nv, sizeof(nv));
+		memcpy(&ctx_size, nv, sizeof(ctx_size));
+		sig = (struct mem_restore_sig *)(nv + NV_SIZE - MEM_RESTORE_SIZE);
+
+		if (write) {
+			if (ctx_size > NV_SIZE - MEM_RESTORE_SIZE - 4) {
+				fprintf(stderr, "%s: context size %u does not fit\n",
+					argv[optind], ctx_size);
+				ret = 1;
+				continue;
+			}
+			memset(nv + NV_SIZE - MEM_RESTORE_SIZE, 0xff,
+			       MEM_RESTORE_SIZE);
+			mem_restore_sig_fill(sig, &id, nv + 4, ctx_size);
+			f = fopen(argv[optind], "wb");
+			if (f == NULL || fwrite(nv, 1, sizeof(nv), f) != sizeof(nv)) {
+				perror(argv[optind]);
+				return 2;
+			}
+			fclose(f);
+			printf("%s: signed %u bytes\n", argv[optind], ctx_size);
+			continue;
+		}
+
+		result = mem_restore_validate(sig, &id, nv + 4, ctx_size,
+					      NV_SIZE - MEM_RESTORE_SIZE - 4);
+		printf("%s: %s\n", argv[optind], mem_restore_result_str(result));
+		if (result != MEM_RESTORE_OK)
+			ret = 1;
+	}
+
+	return ret;
+}
@@ -0,0 +1,211 @@
+/*
+ * printkbench, measure printk formatting throughput on the host
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA, 02110-1301 USA
+ */
+
+/*
+ * Runs src/console/vtxprintf.c over typical ramstage messages, once with
+ * every byte handed to the console drivers separately (as printk did) and
+ * once through a line buffer like the one in src/console/printk.c. The
+ * drivers are stand-ins writing to memory, so only the CPU side is
+ * measured, not the UART:
+ *
+ *   cc -O2 -idirafter src/include -o printkbench util/printkbench/printkbench.c
+ *   ./printkbench [-n rounds]
+ *
+ * Both variants must produce the same output, the program fails otherwise.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* vtxprintf.c only needs the varargs from the coreboot headers. */
+#define CONSOLE_CONSOLE_H_
+#include "../../src/console/vtxprintf.c"
+
+#define SINK_SIZE		(1024 * 1024)
+#define CONSOLE_LINE_SIZE	128
+
+/* Two drivers, like the CBMEM console and the UART on the APU. */
+static unsigned char sink[2][SINK_SIZE];
+static size_t cursor[2];
+
+static void __attribute__((noinline)) drv_tx_byte(int n, unsigned char byte)
+{
+	if (cursor[n] < SINK_SIZE)
+		sink[n][cursor[n]] = byte;
+	cursor[n]++;
+}
+
+static void __attribute__((noinline)) drv_tx_bytes(int n,
+		const unsigned char *data, size_t len)
+{
+	size_t room = cursor[n] < SINK_SIZE ? SINK_SIZE - cursor[n] : 0;
+
+	memcpy(&sink[n][cursor[n]], data, len < room ? len : room);
+	cursor[n] += len;
+}
+
+static void byte_putchar(unsigned char byte,
+			 void *data __attribute__((unused)))
+{
+	if (byte == '\n') {
+		drv_tx_byte(0, '\r');
+		drv_tx_byte(1, '\r');
+	}
+	drv_tx_byte(0, byte);
+	drv_tx_byte(1, byte);
+}
+
+struct console_line {
+	size_t len;
+	unsigned char buf[CONSOLE_LINE_SIZE];
+};
+
+static void line_flush(struct console_line *line)
+{
+	if (line->len) {
+		drv_tx_bytes(0, line->buf, line->len);
+		drv_tx_bytes(1, line->buf, line->len);
+		line->len = 0;
+	}
+}
+
+static void line_putchar(unsigned char byte, void *data)
+{
+	struct console_line *line = data;
+
+	if (line->len >= sizeof(line->buf) - 1)
+		line_flush(line);
+
+	if (byte == '\n')
+		line->buf[line->len++] = '\r';
+	line->buf[line->len++] = byte;
+
+	if (byte == '\n')
+		line_flush(line);
+}
+
+static int by_byte(const char *fmt, ...)
+{
+	va_list args;
+	int i;
+
+	va_start(args, fmt);
+	i = vtxprintf(byte_putchar, fmt, args, NULL);
+	va_end(args);
+	return i;
+}
+
+static int by_line(const char *fmt, ...)
+{
+	struct console_line line;
+	va_list args;
+	int i;
+
+	line.len = 0;
+	va_start(args, fmt);
+	i = vtxprintf(line_putchar, fmt, args, &line);
+	va_end(args);
+	line_flush(&line);
+	return i;
+}
+
+/* A few messages as pci_scan_bus() and the allocator print them. */
+#define MESSAGES(print, n) do { \
+	print("PCI: %02x:%02x.%01x [%04x/%04x] enabled\n", \
+	      0, (n) & 0x1f, (n) & 7, 0x1022, 0x1510 + ((n) & 0xf)); \
+	print("PCI: 00:%02x.%01x resource base %llx size %llx " \
+	      "align %d gran %d limit %llx flags %lx index %lx\n", \
+	      (n) & 0x1f, (n) & 7, 0xf7f00000ULL + (n) * 0x1000ULL, \
+	      0x1000ULL, 12, 12, 0xffffffffULL, 0x40000200UL, 0x10UL); \
+	print("%s: %s%s\n", "CBFS", "Looking for 'pci1002,9804.rom'", \
+	      " starting from offset 0x0"); \
+	print("Assigned: PCI: 00:%02x.%d %02x * [0x%08x - 0x%08x] mem\n", \
+	      (n) & 0x1f, (n) & 7, 0x10, 0xf7f00000 + (n) * 0x1000, \
+	      0xf7f00fff + (n) * 0x1000); \
+	print("BS: Entering %s state.\n", "BS_DEV_RESOURCES"); \
+	print("%d", (n)); \
+	print(" done\n"); \
+} while (0)
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static double run(int line, unsigned int rounds, size_t *bytes)
+{
+	double start;
+	unsigned int n;
+
+	cursor[0] = cursor[1] = 0;
+	start = now();
+	for (n = 0; n < rounds; n++) {
+		if (line)
+			MESSAGES(by_line, n);
+		else
+			MESSAGES(by_byte, n);
+	}
+	*bytes = cursor[0];
+	return now() - start;
+}
+
+int main(int argc, char *argv[])
+{
+	static unsigned char check[SINK_SIZE];
+	unsigned int rounds = 100000;
+	size_t byte_bytes, line_bytes, n;
+	double byte_time, line_time;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "n:")) != -1) {
+		switch (opt) {
+		case 'n':
+			rounds = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-n rounds]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	/* Same bytes from both, as far as the sink holds them. */
+	run(0, 1000, &byte_bytes);
+	memcpy(check, sink[0], SINK_SIZE);
+	run(1, 1000, &line_bytes);
+	n = byte_bytes < SINK_SIZE ? byte_bytes : SINK_SIZE;
+	if (byte_bytes != line_bytes || memcmp(check, sink[0], n) ||
+	    memcmp(sink[0], sink[1], n)) {
+		fprintf(stderr, "printkbench: output differs\n");
+		return 1;
+	}
+
+	byte_time = run(0, rounds, &byte_bytes);
+	line_time = run(1, rounds, &line_bytes);
+
+	printf("per byte: %8.1f MB/s\n", byte_bytes / byte_time / 1e6);
+	printf("per line: %8.1f MB/s\n", line_bytes / line_time / 1e6);
+	return 0;
+}
@@ -0,0 +1,550 @@
+/*
+ * resalloctest, run the resource allocator on synthetic device trees
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA, 02110-1301 USA
+ */
+
+/*
+ * Builds random trees of PCI bridges and devices, with a few fixed
+ * resources in the way, and places them with compute_resources(),
+ * avoid_fixed_resources() and allocate_resources() from src/device/device.c.
+ * Every tree is placed twice: once as the allocator does it now, and once
+ * in the order the old largest_resource() search picked, which walked the
+ * whole bus again for every resource. Both layouts must be identical and
+ * valid:
+ *
+ *   cc -O2 -include src/include/kconfig.h -Ibuild -idirafter src/include \
+ *      -idirafter src/arch/x86/include \
+ *      -o resalloctest util/resalloctest/resalloctest.c
+ *   ./resalloctest [-n devices] [-r rounds] [-s seed] [-v]
+ *
+ * Exits with 1 on the first difference or broken layout.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int8_t s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef int64_t s64;
+
+/* Only the ramstage device tree, the host headers provide the rest. */
+#define ROMSTAGE_CONST
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+
+/* Keep every message, -v prints them. */
+#undef CONFIG_MAX_CONSOLE_LOGLEVEL
+#define CONFIG_MAX_CONSOLE_LOGLEVEL 8
+
+#include "../../src/device/device_util.c"
+
+/*
+ * device.c finds the resources of a bus through this, which lets the
+ * reference run feed them in the old order.
+ */
+static void test_search_bus_resources(struct bus *bus,
+		unsigned long type_mask, unsigned long type,
+		resource_search_t search, void *gp);
+#define search_bus_resources test_search_bus_resources
+#include "../../src/device/device.c"
+#undef search_bus_resources
+
+struct device dev_root;
+struct device *last_dev = &dev_root;
+
+static int verbose;
+
+int do_printk(int msg_level, const char *fmt, ...)
+{
+	va_list args;
+	int i;
+
+	if (!verbose)
+		return 0;
+	va_start(args, fmt);
+	i = vfprintf(stderr, fmt, args);
+	va_end(args);
+	return i;
+}
+
+void die(const char *msg)
+{
+	fprintf(stderr, "resalloctest: die: %s\n", msg);
+	exit(1);
+}
+
+void post_code(u8 value)
+{
+}
+
+void hexdump(int8_t level, const void *memory, size_t length)
+{
+}
+
+void setup_default_ebda(void)
+{
+}
+
+void timer_monotonic_get(struct mono_time *mt)
+{
+}
+
+/* The allocator before sorting, as it was in device.c. */
+struct pick_largest_state {
+	struct resource *last;
+	struct device *result_dev;
+	struct resource *result;
+	int seen_last;
+};
+
+static void pick_largest_resource(void *gp, struct device *dev,
+				  struct resource *resource)
+{
+	struct pick_largest_state *state = gp;
+	struct resource *last;
+
+	last = state->last;
+
+	/* Be certain to pick the successor to last. */
+	if (resource == last) {
+		state->seen_last = 1;
+		return;
+	}
+	if (resource->flags & IORESOURCE_FIXED)
+		return;	/* Skip it. */
+	if (last && ((last->align < resource->align) ||
+		     ((last->align == resource->align) &&
+		      (last->size < resource->size)) ||
+		     ((last->align == resource->align) &&
+		      (last->size == resource->size) && (!state->seen_last)))) {
+		return;
+	}
+	if (!state->result ||
+	    (state->result->align < resource->align) ||
+	    ((state->result->align == resource->align) &&
+	     (state->result->size < resource->size))) {
+		state->result_dev = dev;
+		state->result = resource;
+	}
+}
+
+static struct device *largest_resource(struct bus *bus,
+				       struct resource **result_res,
+				       unsigned long type_mask,
+				       unsigned long type)
+{
+	struct pick_largest_state state;
+
+	state.last = *result_res;
+	state.result_dev = NULL;
+	state.result = NULL;
+	state.seen_last = 0;
+
+	search_bus_resources(bus, type_mask, type, pick_largest_resource,
+			     &state);
+
+	*result_res = state.result;
+	return state.result_dev;
+}
+
+static int reference;
+
+static void test_search_bus_resources(struct bus *bus,
+		unsigned long type_mask, unsigned long type,
+		resource_search_t search, void *gp)
+{
+	struct resource *resource = NULL;
+	struct device *dev;
+
+	if (!reference) {
+		search_bus_resources(bus, type_mask, type, search, gp);
+		return;
+	}
+
+	/*
+	 * Already in order, so the sort leaves it alone and everything is
+	 * placed the way largest_resource() had it.
+	 */
+	while ((dev = largest_resource(bus, &resource, type_mask, type)))
+		search(gp, dev, resource);
+}
+
+/* The tree, every device is also on this list in creation order. */
+static struct device *devs[65536];
+static unsigned int ndevs;
+
+static struct device *add_dev(struct bus *bus, enum device_path_type type)
+{
+	struct device *dev, *child;
+
+	if (ndevs == ARRAY_SIZE(devs))
+		die("too many devices");
+	dev = calloc(1, sizeof(*dev));
+	dev->bus = bus;
+	dev->path.type = type;
+	dev->path.pci.devfn = ndevs & 0xff;
+	dev->enabled = 1;
+	if (bus->children) {
+		for (child = bus->children; child->sibling;
+		     child = child->sibling)
+			;
+		child->sibling = dev;
+	} else {
+		bus->children = dev;
+	}
+	devs[ndevs++] = dev;
+	return dev;
+}
+
+static struct bus *add_link(struct device *dev)
+{
+	struct bus *link = calloc(1, sizeof(*link));
+
+	link->dev = dev;
+	dev->link_list = link;
+	return link;
+}
+
+static void add_bar(struct device *dev, unsigned long index,
+		    unsigned long flags, unsigned int align)
+{
+	struct resource *res = new_resource(dev, index);
+
+	res->flags = flags;
+	res->align = res->gran = align;
+	res->size = 1ULL << align;
+	res->limit = (flags & IORESOURCE_IO) ? 0xffff : 0xffffffff;
+
+	/* Now and then a BAR that reads back as unimplemented. */
+	if (rand() % 64 == 0)
+		res->size = 0;
+}
+
+static void add_fixed(struct device *dev, unsigned long index,
+		      unsigned long flags, resource_t base, resource_t size)
+{
+	struct resource *res = new_resource(dev, index);
+
+	res->flags = flags | IORESOURCE_FIXED | IORESOURCE_STORED |
+		     IORESOURCE_ASSIGNED;
+	res->base = base;
+	res->size = size;
+	res->limit = base + size - 1;
+}
+
+static void add_bridge_window(struct device *dev, unsigned long index,
+			      unsigned long flags, unsigned int gran)
+{
+	struct resource *res = new_resource(dev, index);
+
+	res->flags = flags | IORESOURCE_PCI_BRIDGE | IORESOURCE_BRIDGE;
+	res->align = res->gran = gran;
+	res->limit = (flags & IORESOURCE_IO) ? 0xffff : 0xffffffff;
+}
+
+static void add_device(struct bus *bus)
+{
+	struct device *dev = add_dev(bus, DEVICE_PATH_PCI);
+	unsigned long index;
+	unsigned int bars = rand() % 6 + 1;
+
+	for (index = PCI_BASE_ADDRESS_0; bars--; index += 4) {
+		switch (rand() % 16) {
+		case 0:
+			add_bar(dev, index, IORESOURCE_IO, rand() % 6 + 3);
+			break;
+		case 1:
+		case 2:
+			add_bar(dev, index, IORESOURCE_MEM |
+				IORESOURCE_PREFETCH, rand() % 5 + 16);
+			break;
+		default:
+			add_bar(dev, index, IORESOURCE_MEM, rand() % 5 + 12);
+			break;
+		}
+	}
+	if (rand() % 16 == 0)
+		dev->enabled = 0;
+}
+
+/* Bridges get an I/O window only now and then, there is little I/O space. */
+static void add_bridge(struct bus *bus, unsigned int devices, int depth)
+{
+	struct device *dev = add_dev(bus, DEVICE_PATH_PCI);
+	struct bus *link = add_link(dev);
+	unsigned int i;
+
+	if (rand() % 16 == 0)
+		add_bridge_window(dev, PCI_IO_BASE, IORESOURCE_IO, 12);
+	add_bridge_window(dev, PCI_PREF_MEMORY_BASE,
+			  IORESOURCE_MEM | IORESOURCE_PREFETCH, 20);
+	add_bridge_window(dev, PCI_MEMORY_BASE, IORESOURCE_MEM, 20);
+
+	for (i = 0; i < devices; i++) {
+		if (depth && rand() % 8 == 0) {
+			add_bridge(link, devices / 2, depth - 1);
+			i += devices / 2;
+		} else {
+			add_device(link);
+		}
+	}
+}
+
+static struct device *build_tree(unsigned int devices, unsigned int seed)
+{
+	struct device *domain, *dev;
+	struct bus *link;
+	struct resource *res;
+	unsigned int i;
+
+	srand(seed);
+	ndevs = 0;
+	memset(&dev_root, 0, sizeof(dev_root));
+	add_link(&dev_root);
+	domain = add_dev(dev_root.link_list, DEVICE_PATH_DOMAIN);
+	link = add_link(domain);
+
+	/* Like pci_domain_read_resources(). */
+	res = new_resource(domain, IOINDEX_SUBTRACTIVE(0, 0));
+	res->limit = 0xffffUL;
+	res->flags = IORESOURCE_IO | IORESOURCE_SUBTRACTIVE |
+		     IORESOURCE_ASSIGNED;
+	res = new_resource(domain, IOINDEX_SUBTRACTIVE(1, 0));
+	res->limit = 0xffffffffULL;
+	res->flags = IORESOURCE_MEM | IORESOURCE_SUBTRACTIVE |
+		     IORESOURCE_ASSIGNED;
+
+	/* Legacy I/O, the MMCONFIG window and the IOAPIC/HPET region. */
+	dev = add_dev(link, DEVICE_PATH_PCI);
+	add_fixed(dev, 0, IORESOURCE_IO, 0, 0x1000);
+	add_fixed(dev, 1, IORESOURCE_MEM, 0xf8000000, 0x4000000);
+	add_fixed(dev, 2, IORESOURCE_MEM, 0xfec00000, 0x1400000);
+
+	for (i = 0; i < devices; i++) {
+		if (rand() % 4 == 0) {
+			add_bridge(link, rand() % 64 + 1, 3);
+			i += 32;
+		} else {
+			add_device(link);
+		}
+	}
+	return domain;
+}
+
+/* The part of dev_configure() between reading and storing resources. */
+static void place(struct device *domain)
+{
+	struct resource *res;
+
+	for (res = domain->resource_list; res; res = res->next) {
+		if (res->flags & IORESOURCE_FIXED)
+			continue;
+		if (res->flags & IORESOURCE_PREFETCH)
+			compute_resources(domain->link_list, res,
+					  MEM_MASK, PREF_TYPE);
+		else if (res->flags & IORESOURCE_MEM)
+			compute_resources(domain->link_list, res,
+					  MEM_MASK, MEM_TYPE);
+		else if (res->flags & IORESOURCE_IO)
+			compute_resources(domain->link_list, res,
+					  IO_MASK, IO_TYPE);
+	}
+
+	avoid_fixed_resources(domain);
+
+	for (res = domain->resource_list; res; res = res->next) {
+		if (!(res->flags & IORESOURCE_MEM) ||
+		    res->flags & IORESOURCE_FIXED)
+			continue;
+		res->base = resource_max(res);
+	}
+
+	for (res = domain->resource_list; res; res = res->next) {
+		if (res->flags & IORESOURCE_FIXED)
+			continue;
+		if (res->flags & IORESOURCE_PREFETCH)
+			allocate_resources(domain->link_list, res,
+					   MEM_MASK, PREF_TYPE);
+		else if (res->flags & IORESOURCE_MEM)
+			allocate_resources(domain->link_list, res,
+					   MEM_MASK, MEM_TYPE);
+		else if (res->flags & IORESOURCE_IO)
+			allocate_resources(domain->link_list, res,
+					   IO_MASK, IO_TYPE);
+	}
+}
+
+struct layout {
+	resource_t base, size, limit;
+	unsigned long flags;
+	unsigned char align;
+};
+
+static unsigned int save_layout(struct layout *out)
+{
+	struct resource *res;
+	unsigned int i, n = 0;
+
+	for (i = 0; i < ndevs; i++) {
+		for (res = devs[i]->resource_list; res; res = res->next) {
+			out[n].base = res->base;
+			out[n].size = res->size;
+			out[n].limit = res->limit;
+			out[n].flags = res->flags;
+			out[n].align = res->align;
+			n++;
+		}
+	}
+	return n;
+}
+
+static int by_base(const void *a, const void *b)
+{
+	const struct layout *x = a, *y = b;
+
+	return x->base < y->base ? -1 : x->base > y->base;
+}
+
+/*
+ * Every BAR of an enabled device is assigned, aligned, below its limit and
+ * clear of every other BAR and fixed resource in the same space. Bridge
+ * windows nest, so only the leaves are compared.
+ */
+static int check_layout(struct layout *l, unsigned int n, unsigned long type,
+			unsigned int *placed)
+{
+	struct layout *leaves = calloc(n, sizeof(*leaves));
+	unsigned int i, count = 0;
+	int ret = 0;
+
+	for (i = 0; i < n; i++) {
+		if (!l[i].size || (l[i].flags & type) != type ||
+		    l[i].flags & (IORESOURCE_BRIDGE | IORESOURCE_SUBTRACTIVE))
+			continue;
+		if (!(l[i].flags & IORESOURCE_FIXED)) {
+			if (!(l[i].flags & IORESOURCE_ASSIGNED))
+				continue;	/* Disabled device. */
+			if (l[i].base & ((1ULL << l[i].align) - 1) ||
+			    l[i].base + l[i].size - 1 > l[i].limit) {
+				fprintf(stderr, "resalloctest: %llx size %llx "
+					"misplaced\n", l[i].base, l[i].size);
+				ret = -1;
+			}
+			(*placed)++;
+		}
+		leaves[count++] = l[i];
+	}
+
+	qsort(leaves, count, sizeof(*leaves), by_base);
+	for (i = 1; i < count; i++) {
+		if (leaves[i - 1].base + leaves[i - 1].size > leaves[i].base) {
+			fprintf(stderr, "resalloctest: %llx size %llx overlaps "
+				"%llx size %llx\n", leaves[i - 1].base,
+				leaves[i - 1].size, leaves[i].base,
+				leaves[i].size);
+			ret = -1;
+		}
+	}
+	free(leaves);
+	return ret;
+}
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char *argv[])
+{
+	static struct layout before[65536 * 6], after[65536 * 6];
+	unsigned int devices = 4000, rounds = 10, seed = 1;
+	unsigned int r, n, m, placed;
+	double sorted_time = 0, old_time = 0, start;
+	struct device *domain;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "n:r:s:v")) != -1) {
+		switch (opt) {
+		case 'n':
+			devices = strtoul(optarg, NULL, 0);
+			break;
+		case 'r':
+			rounds = strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			seed = strtoul(optarg, NULL, 0);
+			break;
+		case 'v':
+			verbose = 1;
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-n devices] [-r rounds] "
+				"[-s seed] [-v]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	for (r = 0; r < rounds; r++) {
+		reference = 1;
+		domain = build_tree(devices, seed + r);
+		start = now();
+		place(domain);
+		old_time += now() - start;
+		n = save_layout(before);
+
+		reference = 0;
+		domain = build_tree(devices, seed + r);
+		start = now();
+		place(domain);
+		sorted_time += now() - start;
+		m = save_layout(after);
+
+		if (n != m || memcmp(before, after, n * sizeof(*before))) {
+			fprintf(stderr, "resalloctest: seed %u: layout "
+				"differs\n", seed + r);
+			return 1;
+		}
+
+		placed = 0;
+		if (check_layout(after, n, IORESOURCE_IO, &placed) ||
+		    check_layout(after, n, IORESOURCE_MEM, &placed)) {
+			fprintf(stderr, "resalloctest: seed %u: bad layout\n",
+				seed + r);
+			return 1;
+		}
+	}
+
+	printf("resalloctest: %u rounds, %u BARs placed in the last\n",
+	       rounds, placed);
+	printf("largest first: %8.3f ms per tree\n", old_time * 1e3 / rounds);
+	printf("sorted:        %8.3f ms per tree\n",
+	       sorted_time * 1e3 / rounds);
+	return 0;
+}
@@ -0,0 +1,500 @@
+/*
+ * spiflashsim, run the SPI flash update layer against a simulated NOR part
+ *
+ * Copyright (C) 2014 Sage Electronic Engineering, LLC.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA, 02110-1301 USA
+ */
+
+/*
+ * Runs src/drivers/spi/spi_flash.c and the Winbond driver on top of a model
+ * of the SB800 SPI controller and a W25Q16 behind it. The model decodes
+ * every spi_xfer() into an opcode, counts opcodes and bytes on the bus and
+ * behaves like NOR flash: a page program can only clear bits, wraps at the
+ * page boundary and needs a write enable, and a command that does not fit
+ * the 8 byte controller FIFO is refused.
+ *
+ *   cc -O2 -include src/include/kconfig.h -Ibuild -idirafter src/include \
+ *      -idirafter src/arch/x86/include \
+ *      -o spiflashsim util/spiflashsim/spiflashsim.c
+ *   ./spiflashsim [-f MHz] [-s seed] [-v]
+ *
+ * Each scenario is the save path of s3_resume.c or sortbootorder, once as
+ * it was (erase, then 4 byte writes) and once through spi_flash_update().
+ * Both must leave the same contents in flash. The estimated time uses the
+ * typical program and erase times of the W25Q16DV data sheet plus the bus
+ * time at the given clock. Exits with 1 on the first failure.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int8_t s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef int64_t s64;
+
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+
+#include "../../src/drivers/spi/spi_flash.c"
+#include "../../src/drivers/spi/winbond.c"
+
+#define FLASH_SIZE	(2 * 1024 * 1024)
+#define PAGE_SIZE	256
+#define SECTOR_SIZE	4096
+#define FIFO_SIZE	8
+
+/* W25Q16DV typical timings, in microseconds. */
+#define T_BP1		30.0
+#define T_BPN		2.5
+#define T_SE		45000.0
+
+/* The old save paths wrote this many bytes per command. */
+#define OLD_TX_LEN	4
+
+/* Where the board keeps its data, as offsets into the part. */
+#define S3_MTRR_OFFSET		(0x1F0000 + 0x6000)
+#define S3_NONVOLATILE_OFFSET	(0x1F0000 + 0x7000)
+#define BOOTORDER_OFFSET	0x1E0000
+
+static u8 flash_array[FLASH_SIZE];
+static int write_enabled;
+static int verbose;
+static int failed;
+static double mhz = 16.5;
+
+struct bus_counts {
+	unsigned long transactions;
+	unsigned long bytes;
+	unsigned long wren, pp, se, rdsr, other;
+	unsigned long programmed;
+	double busy_us;
+};
+
+static struct bus_counts counts;
+
+#define check(cond) do { \
+	if (!(cond)) { \
+		fprintf(stderr, "%s:%d: check failed: %s\n", \
+			__FILE__, __LINE__, #cond); \
+		failed = 1; \
+		return; \
+	} \
+} while (0)
+
+int do_printk(int msg_level __attribute__((unused)), const char *fmt, ...)
+{
+	va_list args;
+	int i;
+
+	if (!verbose)
+		return 0;
+	va_start(args, fmt);
+	i = vfprintf(stderr, fmt, args);
+	va_end(args);
+	return i;
+}
+
+void udelay(unsigned usecs __attribute__((unused)))
+{
+}
+
+struct spi_slave *spi_setup_slave(unsigned int bus __attribute__((unused)),
+		unsigned int cs __attribute__((unused)),
+		unsigned int max_hz __attribute__((unused)),
+		unsigned int mode __attribute__((unused)))
+{
+	return calloc(1, sizeof(struct spi_slave));
+}
+
+int spi_claim_bus(struct spi_slave *slave __attribute__((unused)))
+{
+	return 0;
+}
+
+void spi_release_bus(struct spi_slave *slave __attribute__((unused)))
+{
+}
+
+/* Only the Winbond part is modelled. */
+#define NO_PROBE(name) \
+	struct spi_flash *name(struct spi_slave *spi __attribute__((unused)), \
+			       u8 *idcode __attribute__((unused))) \
+	{ \
+		return NULL; \
+	}
+NO_PROBE(spi_flash_probe_amic)
+NO_PROBE(spi_flash_probe_atmel)
+NO_PROBE(spi_flash_probe_eon)
+NO_PROBE(spi_flash_probe_gigadevice)
+NO_PROBE(spi_flash_probe_macronix)
+NO_PROBE(spi_flash_probe_micron)
+NO_PROBE(spi_flash_probe_spansion)
+NO_PROBE(spi_flash_probe_sst)
+NO_PROBE(spi_flash_probe_stmicro)
+NO_PROBE(spi_flash_probe_adesto)
+
+static void sim_error(const char *msg, u8 cmd, u32 addr)
+{
+	fprintf(stderr, "spiflashsim: %s (opcode %02x, address 0x%06x)\n",
+		msg, cmd, addr);
+	failed = 1;
+}
+
+static void sim_program(u32 addr, const u8 *data, unsigned int len)
+{
+	u32 page = addr & ~(PAGE_SIZE - 1);
+	unsigned int i;
+	u8 *cell;
+
+	for (i = 0; i < len; i++) {
+		/* The part wraps within the page, it never crosses it. */
+		cell = &flash_array[page + ((addr + i) & (PAGE_SIZE - 1))];
+		if (data[i] & ~*cell)
+			sim_error("program needs an erase", CMD_W25_PP, addr);
+		*cell &= data[i];
+	}
+	if (page != ((addr + len - 1) & ~(PAGE_SIZE - 1)))
+		sim_error("page program wrapped", CMD_W25_PP, addr);
+	counts.programmed += len;
+	counts.busy_us += T_BP1 + (len - 1) * T_BPN;
+}
+
+/*
+ * The SB800 controller: the opcode goes to its own register, everything
+ * after it through an 8 byte FIFO, which also receives the reply.
+ */
+int spi_xfer(struct spi_slave *slave __attribute__((unused)),
+		const void *dout, unsigned int bitsout,
+		void *din, unsigned int bitsin)
+{
+	const u8 *out = dout;
+	unsigned int bytesout = bitsout / 8 - 1;
+	unsigned int bytesin = bitsin / 8;
+	u8 cmd = out[0];
+	u32 addr = 0;
+
+	counts.transactions++;
+	counts.bytes += 1 + bytesout + bytesin;
+	if (bytesout > FIFO_SIZE || bytesin > FIFO_SIZE) {
+		sim_error("command exceeds the controller FIFO", cmd, 0);
+		return -1;
+	}
+	if (bytesout >= 3)
+		addr = ((out[1] << 16) | (out[2] << 8) | out[3]) &
+			(FLASH_SIZE - 1);
+
+	switch (cmd) {
+	case CMD_READ_ID:
+		counts.other++;
+		memcpy(din, "\xef\x40\x15", bytesin < 3 ? bytesin : 3);
+		break;
+	case CMD_W25_RDSR:
+		counts.rdsr++;
+		/* Busy time is accounted separately, never report WIP. */
+		memset(din, 0, bytesin);
+		break;
+	case CMD_W25_WREN:
+		counts.wren++;
+		write_enabled = 1;
+		break;
+	case CMD_W25_PP:
+		counts.pp++;
+		if (!write_enabled)
+			sim_error("program without write enable", cmd, addr);
+		else
+			sim_program(addr, out + 4, bytesout - 3);
+		write_enabled = 0;
+		break;
+	case CMD_W25_SE:
+		counts.se++;
+		if (!write_enabled)
+			sim_error("erase without write enable", cmd, addr);
+		else
+			memset(&flash_array[addr & ~(SECTOR_SIZE - 1)], 0xff,
+			       SECTOR_SIZE);
+		counts.busy_us += T_SE;
+		write_enabled = 0;
+		break;
+	default:
+		counts.other++;
+		sim_error("unexpected opcode", cmd, addr);
+		return -1;
+	}
+	return 0;
+}
+
+/* sortbootorder save_flash() before the update layer. */
+static void old_save_bootorder(struct spi_flash *flash, u32 offset,
+			       const u8 *data, size_t used)
+{
+	u32 pos;
+
+	flash->erase(flash, offset, SECTOR_SIZE);
+	for (pos = 0; pos < (used & ~3); pos += 4)
+		flash->write(flash, offset + pos, 4, data + pos);
+	flash->write(flash, offset + pos, used % 4, data + pos);
+}
+
+/* OemAgesaSaveS3Info() before the update layer. */
+static void old_save_s3_info(struct spi_flash *flash, u32 offset,
+			     const u8 *data, size_t len)
+{
+	size_t chunk, pos;
+
+	for (; len > 0; len -= chunk) {
+		chunk = len >= SECTOR_SIZE ? SECTOR_SIZE : len;
+		if (memcmp(&flash_array[offset], data, chunk)) {
+			flash->erase(flash, offset, SECTOR_SIZE);
+			for (pos = 0; pos < chunk - (chunk % OLD_TX_LEN);
+			     pos += OLD_TX_LEN)
+				flash->write(flash, offset + pos, OLD_TX_LEN,
+					     data + pos);
+			flash->write(flash, offset + pos, chunk % OLD_TX_LEN,
+				     data + pos);
+		}
+		data += chunk;
+		offset += chunk;
+	}
+}
+
+/* OemAgesaSaveMtrr() before the update layer. */
+static void old_save_mtrr(struct spi_flash *flash, u32 offset,
+			  const u8 *data, size_t len)
+{
+	size_t pos;
+
+	flash->erase(flash, offset, SECTOR_SIZE);
+	for (pos = 0; pos < len; pos += 4)
+		flash->write(flash, offset + pos, 4, data + pos);
+}
+
+enum save_kind { SAVE_BOOTORDER, SAVE_S3_INFO, SAVE_MTRR };
+
+struct scenario {
+	const char *name;
+	enum save_kind kind;
+	u32 offset;
+	size_t len;
+	/* Fill 'old' (what flash holds) and 'new' (what is saved). */
+	void (*setup)(u8 *old, u8 *new, size_t len);
+};
+
+static void random_bytes(u8 *p, size_t len)
+{
+	while (len--)
+		*p++ = rand();
+}
+
+/* A boot order list as save_flash() writes it, rest of the sector erased. */
+static size_t bootorder_list(u8 *p, int swap)
+{
+	static const char * const lines[] = {
+		"/pci@i0cf8/usb@10/*@0", "/pci@i0cf8/usb@10/*@1",
+		"/pci@i0cf8/*@11/drive@0/disk@0", "/pci@i0cf8/*@14,7",
+		"/rom@genroms/pxe.rom", "/pci@i0cf8/usb@12/*@1",
+	};
+	size_t pos = 0;
+	int i, line;
+
+	memset(p, 0xff, SECTOR_SIZE);
+	for (i = 0; i < (int)ARRAY_SIZE(lines); i++) {
+		line = i;
+		if (swap && i < 2)
+			line = 1 - i;
+		pos += sprintf((char *)p + pos, "%s\n", lines[line]);
+	}
+	pos += sprintf((char *)p + pos, "pxen1\nusben1\n");
+	return pos + 1;
+}
+
+static void setup_bootorder_swap(u8 *old, u8 *new,
+				 size_t len __attribute__((unused)))
+{
+	bootorder_list(old, 0);
+	bootorder_list(new, 1);
+}
+
+static void setup_bootorder_same(u8 *old, u8 *new,
+				 size_t len __attribute__((unused)))
+{
+	bootorder_list(old, 0);
+	bootorder_list(new, 0);
+}
+
+static void setup_erased(u8 *old, u8 *new, size_t len)
+{
+	memset(old, 0xff, len);
+	random_bytes(new, len);
+}
+
+static void setup_same(u8 *old, u8 *new, size_t len)
+{
+	random_bytes(old, len);
+	memcpy(new, old, len);
+}
+
+static void setup_few_changed(u8 *old, u8 *new, size_t len)
+{
+	int i;
+
+	random_bytes(old, len);
+	memcpy(new, old, len);
+	for (i = 0; i < 8; i++)
+		new[rand() % len] ^= 1 << (rand() % 8);
+}
+
+/* Only 1 -> 0 transitions, e.g. a flag being cleared. */
+static void setup_bits_cleared(u8 *old, u8 *new, size_t len)
+{
+	int i;
+
+	random_bytes(old, len);
+	memcpy(new, old, len);
+	for (i = 0; i < 8; i++)
+		new[rand() % len] &= ~(1 << (rand() % 8));
+}
+
+/* Fixed and variable MTRRs, SYS_CFG, TOM and TOM2, 8 bytes each. */
+#define MTRR_DATA_SIZE	((11 + 19) * 8)
+
+static const struct scenario scenarios[] = {
+	{ "bootorder, two entries swapped", SAVE_BOOTORDER,
+	  BOOTORDER_OFFSET, SECTOR_SIZE, setup_bootorder_swap },
+	{ "bootorder, saved unchanged", SAVE_BOOTORDER,
+	  BOOTORDER_OFFSET, SECTOR_SIZE, setup_bootorder_same },
+	{ "S3 non-volatile, first save", SAVE_S3_INFO,
+	  S3_NONVOLATILE_OFFSET, 2048, setup_erased },
+	{ "S3 non-volatile, unchanged", SAVE_S3_INFO,
+	  S3_NONVOLATILE_OFFSET, 2048, setup_same },
+	{ "S3 non-volatile, 8 bits flipped", SAVE_S3_INFO,
+	  S3_NONVOLATILE_OFFSET, 2048, setup_few_changed },
+	{ "S3 non-volatile, 8 bits cleared", SAVE_S3_INFO,
+	  S3_NONVOLATILE_OFFSET, 2048, setup_bits_cleared },
+	{ "MTRRs, first save", SAVE_MTRR,
+	  S3_MTRR_OFFSET, MTRR_DATA_SIZE, setup_erased },
+	{ "MTRRs, 8 bits flipped", SAVE_MTRR,
+	  S3_MTRR_OFFSET, MTRR_DATA_SIZE, setup_few_changed },
+};
+
+static double estimate_ms(const struct bus_counts *c)
+{
+	return (c->busy_us + c->bytes * 8 / mhz) / 1000.0;
+}
+
+static void print_counts(const char *label, const struct bus_counts *c)
+{
+	printf("  %-7s %5lu xfers %6lu bytes  WREN %4lu PP %4lu SE %2lu "
+	       "RDSR %4lu  %5lu programmed  %8.2f ms\n", label,
+	       c->transactions, c->bytes, c->wren, c->pp, c->se, c->rdsr,
+	       c->programmed, estimate_ms(c));
+}
+
+static void run(struct spi_flash *flash, const struct scenario *s, int new)
+{
+	static u8 old_data[SECTOR_SIZE], new_data[SECTOR_SIZE];
+	static u8 expected[FLASH_SIZE];
+	size_t used;
+
+	/* The same data for both runs. */
+	s->setup(old_data, new_data, s->len);
+	used = s->kind == SAVE_BOOTORDER ?
+		strlen((char *)new_data) + 1 : s->len;
+
+	memset(flash_array, 0xff, sizeof(flash_array));
+	memcpy(&flash_array[s->offset], old_data, s->len);
+	memcpy(expected, flash_array, sizeof(expected));
+	memcpy(&expected[s->offset], new_data, s->len);
+	/* The old MTRR and S3 paths erased the rest of the sector. */
+	if (!new && s->kind == SAVE_MTRR)
+		memset(&expected[s->offset + s->len], 0xff,
+		       SECTOR_SIZE - s->len);
+	if (!new && s->kind == SAVE_S3_INFO &&
+	    memcmp(old_data, new_data, s->len))
+		memset(&expected[s->offset + s->len], 0xff,
+		       SECTOR_SIZE - s->len);
+
+	memset(&counts, 0, sizeof(counts));
+	if (new)
+		check(spi_flash_update(flash, s->offset, s->len, new_data,
+				       &flash_array[s->offset]) == 0);
+	else if (s->kind == SAVE_BOOTORDER)
+		old_save_bootorder(flash, s->offset, new_data, used);
+	else if (s->kind == SAVE_S3_INFO)
+		old_save_s3_info(flash, s->offset, new_data, s->len);
+	else
+		old_save_mtrr(flash, s->offset, new_data, s->len);
+	check(!failed);
+	check(memcmp(flash_array, expected, sizeof(expected)) == 0);
+}
+
+int main(int argc, char **argv)
+{
+	struct bus_counts before, after;
+	struct spi_flash *flash;
+	unsigned int seed = 1;
+	unsigned int i;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "f:s:v")) != -1) {
+		switch (opt) {
+		case 'f':
+			mhz = atof(optarg);
+			break;
+		case 's':
+			seed = strtoul(optarg, NULL, 0);
+			break;
+		case 'v':
+			verbose = 1;
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-f MHz] [-s seed] [-v]\n",
+				argv[0]);
+			return 1;
+		}
+	}
+
+	flash = spi_flash_probe(0, 0, 0, 0);
+	if (flash == NULL || flash->sector_size != SECTOR_SIZE) {
+		fprintf(stderr, "spiflashsim: probe failed\n");
+		return 1;
+	}
+
+	printf("%s, %.1f MHz, seed %u\n", flash->name, mhz, seed);
+	for (i = 0; i < ARRAY_SIZE(scenarios) && !failed; i++) {
+		srand(seed + i);
+		run(flash, &scenarios[i], 0);
+		before = counts;
+		srand(seed + i);
+		run(flash, &scenarios[i], 1);
+		after = counts;
+		if (failed) {
+			fprintf(stderr, "in scenario '%s'\n",
+				scenarios[i].name);
+			break;
+		}
+		printf("%s\n", scenarios[i].name);
+		print_counts("before", &before);
+		print_counts("after", &after);
+	}
+	return failed;
+}